@@ -0,0 +1,44 @@
+import time
+
+import moderngl
+
+ITERATIONS = 100000
+
+ctx = moderngl.create_standalone_context()
+
+attachments = min(ctx.info['GL_MAX_COLOR_ATTACHMENTS'], 8)
+fbo1 = ctx.framebuffer([ctx.texture((64, 64), 4) for _ in range(attachments)])
+fbo2 = ctx.framebuffer([ctx.texture((64, 64), 4) for _ in range(attachments)])
+fbo2.scissor = (0, 0, 32, 32)
+
+
+def measure(name, func):
+    func()
+    start = time.perf_counter()
+    for _ in range(ITERATIONS):
+        func()
+    ctx.finish()
+    elapsed = time.perf_counter() - start
+    print('%-32s %8.3f us' % (name, elapsed / ITERATIONS * 1e6))
+
+
+def use_same():
+    fbo1.use()
+
+
+def use_alternating():
+    fbo1.use()
+    fbo2.use()
+
+
+def scope():
+    with ctx.scope(fbo2):
+        pass
+
+
+print('%d color attachments, %d iterations' % (attachments, ITERATIONS))
+
+fbo1.use()
+measure('fbo.use() same framebuffer', use_same)
+measure('fbo.use() two framebuffers', use_alternating)
+measure('ctx.scope() enter and exit', scope)
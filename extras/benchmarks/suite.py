@@ -0,0 +1,340 @@
+'''
+    Per call overhead of the binding layer on a standalone context.
+
+    python suite.py [--backend egl] [--filter buffer] [--save NAME] [--compare NAME]
+
+    Every benchmark is calibrated to run for --min-time seconds per round. The median
+    of the rounds is reported in nanoseconds per call, and in GB/s for the transfers.
+    With the egl backend and no display, Mesa picks llvmpipe, so the numbers are
+    comparable between machines without a GPU.
+
+    --save stores the results in baselines/NAME.json. --compare prints the ratio of the
+    fastest rounds to a stored baseline and exits with 1 when a benchmark is slower than
+    --threshold.
+'''
+
+import argparse
+import json
+import os
+import platform
+import re
+import struct
+import sys
+import time
+
+import moderngl
+
+BASELINES = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'baselines')
+
+DTYPES = ['f1', 'f2', 'f4', 'u1', 'u2', 'u4', 'i1', 'i2', 'i4']
+
+UNIFORMS = {
+    'float': 1.0,
+    'vec2': (1.0, 2.0),
+    'vec3': (1.0, 2.0, 3.0),
+    'vec4': (1.0, 2.0, 3.0, 4.0),
+    'int': 1,
+    'ivec4': (1, 2, 3, 4),
+    'uint': 1,
+    'bool': True,
+    'mat3': tuple(range(9)),
+    'mat4': tuple(range(16)),
+}
+
+VERTEX_SHADER = '''
+    #version 330
+
+    in vec2 in_vert;
+
+    void main() {
+        gl_Position = vec4(in_vert, 0.0, 1.0);
+    }
+'''
+
+FRAGMENT_SHADER = '''
+    #version 330
+
+    out vec4 f_color;
+
+    void main() {
+        f_color = vec4(1.0);
+    }
+'''
+
+
+class Benchmark:
+    '''
+        A named function to time, called once per iteration.
+        The size is the number of bytes transferred per call, zero when not a transfer.
+        The calls are the number of operations per function call, the report is per operation.
+    '''
+
+    def __init__(self, name, func, size=0, calls=1):
+        self.name = name
+        self.func = func
+        self.size = size
+        self.calls = calls
+
+
+class Suite:
+    def __init__(self, ctx):
+        self.ctx = ctx
+        self.benchmarks = []
+        self.objects = []
+
+    def add(self, name, func, size=0, calls=1):
+        self.benchmarks.append(Benchmark(name, func, size, calls))
+
+    def keep(self, obj):
+        # The objects must outlive the benchmarks using them
+        self.objects.append(obj)
+        return obj
+
+    def buffers(self):
+        ctx = self.ctx
+
+        for size in (64, 4096, 1 << 20):
+            data = bytes(size)
+            out = bytearray(size)
+            buf = self.keep(ctx.buffer(reserve=size))
+
+            self.add('buffer.write %s' % format_size(size), lambda buf=buf, data=data: buf.write(data), size)
+            self.add('buffer.read %s' % format_size(size), lambda buf=buf: buf.read(), size)
+            self.add('buffer.read_into %s' % format_size(size), lambda buf=buf, out=out: buf.read_into(out), size)
+            self.add('buffer.clear %s' % format_size(size), lambda buf=buf: buf.clear(), size)
+
+        # 1024 chunks of 16 bytes every 32 bytes
+        chunks = bytes(16 * 1024)
+        buf = self.keep(ctx.buffer(reserve=32 * 1024))
+        self.add('buffer.write_chunks 1024x16B', lambda: buf.write_chunks(chunks, 0, 32, 1024), len(chunks))
+
+    def textures(self):
+        ctx = self.ctx
+
+        for dtype in DTYPES:
+            tex = self.keep(ctx.texture((256, 256), 4, dtype=dtype))
+            data = bytes(256 * 256 * 4 * int(dtype[1]))
+
+            self.add('texture.write 256x256x4 %s' % dtype, lambda tex=tex, data=data: tex.write(data), len(data))
+            self.add('texture.read 256x256x4 %s' % dtype, lambda tex=tex: tex.read(), len(data))
+
+    def rendering(self):
+        ctx = self.ctx
+
+        prog = self.keep(ctx.program(vertex_shader=VERTEX_SHADER, fragment_shader=FRAGMENT_SHADER))
+        vbo = self.keep(ctx.buffer(struct.pack('6f', -0.01, -0.01, 0.01, -0.01, 0.0, 0.01)))
+        vao = self.keep(ctx.simple_vertex_array(prog, vbo, 'in_vert'))
+        fbo = self.keep(ctx.simple_framebuffer((256, 256)))
+        fbo.use()
+
+        def draws(count):
+            def func():
+                for _ in range(count):
+                    vao.render()
+            return func
+
+        for count in (1, 10, 100, 1000, 10000):
+            self.add('vao.render %d draws' % count, draws(count), calls=count)
+
+    def uniforms(self):
+        ctx = self.ctx
+
+        declarations = ''.join('uniform %s u_%s;\n' % (name, name) for name in UNIFORMS)
+        uses = ' + '.join(
+            'float(u_%s%s)' % (name, '[0][0]' if name.startswith('mat') else '.x' if name[-1].isdigit() else '')
+            for name in UNIFORMS
+        )
+        prog = self.keep(ctx.program(
+            vertex_shader=VERTEX_SHADER,
+            fragment_shader='''
+                #version 330
+
+                %s
+                out vec4 f_color;
+
+                void main() {
+                    f_color = vec4(%s);
+                }
+            ''' % (declarations, uses),
+        ))
+
+        for name, value in UNIFORMS.items():
+            uniform = prog['u_%s' % name]
+
+            def func(uniform=uniform, value=value):
+                uniform.value = value
+
+            self.add('uniform.value %s' % name, func)
+
+    def programs(self):
+        ctx = self.ctx
+
+        def func():
+            ctx.program(vertex_shader=VERTEX_SHADER, fragment_shader=FRAGMENT_SHADER).release()
+
+        self.add('ctx.program', func)
+
+    def scopes(self):
+        ctx = self.ctx
+
+        fbo = self.keep(ctx.simple_framebuffer((64, 64)))
+        tex = self.keep(ctx.texture((4, 4), 4))
+        ubo = self.keep(ctx.buffer(reserve=64))
+        scope = self.keep(ctx.scope(
+            fbo,
+            moderngl.BLEND | moderngl.DEPTH_TEST,
+            textures=[(tex, 0)],
+            uniform_buffers=[(ubo, 0)],
+        ))
+
+        def func():
+            with scope:
+                pass
+
+        self.add('scope.begin/end', func)
+
+    def framebuffers(self):
+        ctx = self.ctx
+
+        fbo = self.keep(ctx.framebuffer(
+            color_attachments=[ctx.texture((256, 256), 4), ctx.texture((256, 256), 4, dtype='f4')],
+        ))
+
+        self.add('framebuffer.read 256x256x4 f1', lambda: fbo.read(components=4), 256 * 256 * 4)
+        self.add(
+            'framebuffer.read 256x256x4 f4',
+            lambda: fbo.read(components=4, attachment=1, dtype='f4'),
+            256 * 256 * 16,
+        )
+
+    def build(self):
+        self.buffers()
+        self.textures()
+        self.rendering()
+        self.uniforms()
+        self.programs()
+        self.scopes()
+        self.framebuffers()
+
+
+def format_size(size):
+    for unit, scale in (('MB', 1 << 20), ('KB', 1 << 10)):
+        if size >= scale:
+            return '%d%s' % (size // scale, unit)
+    return '%dB' % size
+
+
+def measure(ctx, benchmark, min_time, rounds):
+    '''
+        The median and the fastest round in nanoseconds per call.
+        The queued commands are finished in every round to measure their cost too.
+    '''
+
+    func = benchmark.func
+    func()
+    ctx.finish()
+
+    target = min_time * 1e9
+    iterations = 1
+    while True:
+        start = time.perf_counter_ns()
+        for _ in range(iterations):
+            func()
+        ctx.finish()
+        elapsed = time.perf_counter_ns() - start
+        if elapsed >= target or iterations >= 1 << 24:
+            break
+        iterations = min(1 << 24, max(iterations * 2, int(iterations * target / max(elapsed, 1))))
+
+    samples = []
+    for _ in range(rounds):
+        start = time.perf_counter_ns()
+        for _ in range(iterations):
+            func()
+        ctx.finish()
+        samples.append((time.perf_counter_ns() - start) / (iterations * benchmark.calls))
+
+    samples.sort()
+    return samples[len(samples) // 2], samples[0]
+
+
+def environment(ctx):
+    return {
+        'renderer': ctx.info['GL_RENDERER'],
+        'version': ctx.info['GL_VERSION'],
+        'moderngl': moderngl.__version__,
+        'python': platform.python_version(),
+        'machine': platform.machine(),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(prog='suite', description='Times the moderngl calls on a standalone context.')
+    parser.add_argument('--backend', help='the glcontext backend, egl for llvmpipe without a display')
+    parser.add_argument('--filter', help='only run the benchmarks matching the regular expression')
+    parser.add_argument('--min-time', type=float, default=0.05, help='the minimum duration of a round in seconds')
+    parser.add_argument('--rounds', type=int, default=5, help='the number of rounds')
+    parser.add_argument('--save', metavar='NAME', help='store the results as a baseline')
+    parser.add_argument('--compare', metavar='NAME', help='compare the results to a baseline')
+    parser.add_argument('--threshold', type=float, default=0.1, help='the slowdown reported as a regression')
+    args = parser.parse_args()
+
+    settings = {'backend': args.backend} if args.backend else {}
+    ctx = moderngl.create_standalone_context(**settings)
+
+    suite = Suite(ctx)
+    suite.build()
+
+    baseline = None
+    if args.compare:
+        with open(os.path.join(BASELINES, args.compare + '.json')) as f:
+            baseline = json.load(f)
+
+    info = environment(ctx)
+    print('%s, %s' % (info['renderer'], info['version']))
+    if baseline is not None and baseline['environment']['renderer'] != info['renderer']:
+        print('the baseline was measured on %s' % baseline['environment']['renderer'])
+    print()
+
+    print('%-32s %12s %12s %10s%s' % ('benchmark', 'ns/call', 'min', 'GB/s', '   baseline' if baseline else ''))
+
+    results = {}
+    regressions = []
+
+    for benchmark in suite.benchmarks:
+        if args.filter and not re.search(args.filter, benchmark.name):
+            continue
+
+        median, fastest = measure(ctx, benchmark, args.min_time, args.rounds)
+        gbps = benchmark.size / median if benchmark.size else None
+        results[benchmark.name] = {'ns': median, 'min': fastest, 'gbps': gbps}
+
+        line = '%-32s %12.1f %12.1f %10s' % (benchmark.name, median, fastest, '%.3f' % gbps if gbps else '')
+
+        # The fastest rounds are compared, they are the least affected by the other processes
+        previous = baseline['results'].get(benchmark.name) if baseline else None
+        if previous is not None:
+            ratio = fastest / previous['min']
+            line += '   %6.2fx' % ratio
+            if ratio > 1.0 + args.threshold:
+                line += ' slower'
+                regressions.append(benchmark.name)
+
+        print(line)
+        sys.stdout.flush()
+
+    if args.save:
+        os.makedirs(BASELINES, exist_ok=True)
+        with open(os.path.join(BASELINES, args.save + '.json'), 'w') as f:
+            json.dump({'environment': info, 'results': results}, f, indent=2)
+        print()
+        print('saved to %s' % os.path.join(BASELINES, args.save + '.json'))
+
+    if regressions:
+        print()
+        print('%d regressions over %d%%: %s' % (len(regressions), args.threshold * 100, ', '.join(regressions)))
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
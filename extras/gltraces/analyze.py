@@ -0,0 +1,381 @@
+'''
+    Reports the avoidable work in a trace file.
+
+    python analyze.py capture.gltrace [--top 20] [--json]
+
+    The binding state is simulated over the trace to find the redundant Bind*, Enable,
+    Disable, UseProgram and state setter calls. The glGet* queries in the frame loop,
+    the map and readback sync points, glFinish and glFlush are reported with the call
+    site of the closest gltraces.mark() before them. The marks also split the trace
+    into frames for the draw counts.
+'''
+
+import argparse
+import json
+
+from tracefile import TraceFile
+
+GL_ELEMENT_ARRAY_BUFFER = 0x8893
+GL_PIXEL_PACK_BUFFER = 0x88EB
+GL_FRAMEBUFFER = 0x8D40
+GL_READ_FRAMEBUFFER = 0x8CA8
+GL_DRAW_FRAMEBUFFER = 0x8CA9
+GL_TEXTURE0 = 0x84C0
+GL_MAP_READ_BIT = 0x0001
+GL_MAP_UNSYNCHRONIZED_BIT = 0x0020
+GL_READ_ONLY = 0x88B8
+GL_READ_WRITE = 0x88BA
+
+# Binding functions, the state key is made of the parameters before the bound value
+BINDS = {
+    'glBindBuffer': (['target'], 'buffer'),
+    'glBindBufferBase': (['target', 'index'], ['buffer']),
+    'glBindBufferRange': (['target', 'index'], ['buffer', 'offset', 'size']),
+    'glBindTexture': (['target'], 'texture'),
+    'glBindSampler': (['unit'], 'sampler'),
+    'glBindRenderbuffer': (['target'], 'renderbuffer'),
+    'glBindVertexArray': ([], 'array'),
+    'glUseProgram': ([], 'program'),
+    'glBindTransformFeedback': (['target'], 'id'),
+    'glBindProgramPipeline': ([], 'pipeline'),
+    'glBindImageTexture': (['unit'], ['texture', 'level', 'layered', 'layer', 'access', 'format']),
+    'glActiveTexture': ([], 'texture'),
+}
+
+# State setters, a call setting the current value again is redundant
+SETTERS = {
+    'glViewport': [],
+    'glScissor': [],
+    'glBlendFunc': [],
+    'glBlendFuncSeparate': [],
+    'glBlendEquation': [],
+    'glBlendEquationSeparate': [],
+    'glBlendColor': [],
+    'glDepthFunc': [],
+    'glDepthMask': [],
+    'glDepthRange': [],
+    'glColorMask': [],
+    'glCullFace': [],
+    'glFrontFace': [],
+    'glPolygonMode': ['face'],
+    'glPolygonOffset': [],
+    'glPointSize': [],
+    'glLineWidth': [],
+    'glClearColor': [],
+    'glClearDepth': [],
+    'glClearStencil': [],
+    'glStencilFunc': [],
+    'glStencilOp': [],
+    'glStencilMask': [],
+    'glPixelStorei': ['pname'],
+    'glPatchParameteri': ['pname'],
+    'glProvokingVertex': [],
+    'glPrimitiveRestartIndex': [],
+    'glDrawBuffer': [],
+    'glReadBuffer': [],
+}
+
+# The namespace of the names deleted by the function and the bindings of the namespace
+DELETES = {
+    'glDeleteBuffers': ('glBindBuffer', 'glBindBufferBase', 'glBindBufferRange'),
+    'glDeleteTextures': ('glBindTexture', 'glBindImageTexture'),
+    'glDeleteSamplers': ('glBindSampler',),
+    'glDeleteRenderbuffers': ('glBindRenderbuffer',),
+    'glDeleteVertexArrays': ('glBindVertexArray',),
+    'glDeleteFramebuffers': ('glBindFramebuffer',),
+    'glDeleteTransformFeedbacks': ('glBindTransformFeedback',),
+    'glDeleteProgramPipelines': ('glBindProgramPipeline',),
+}
+
+# Readbacks waiting for the queued commands, unless the results go to a pixel pack buffer
+READBACKS = {
+    'glReadPixels', 'glReadnPixels', 'glGetTexImage', 'glGetnTexImage', 'glGetCompressedTexImage',
+    'glGetTextureImage', 'glGetTextureSubImage', 'glGetCompressedTextureImage',
+}
+
+SYNC_POINTS = {
+    'glGetBufferSubData', 'glGetNamedBufferSubData', 'glClientWaitSync',
+    'glGetQueryObjectiv', 'glGetQueryObjectuiv', 'glGetQueryObjecti64v', 'glGetQueryObjectui64v',
+}
+
+# The draw and dispatch entry points, glDrawBuffer and glDrawBuffers are state setters
+DRAWS = {
+    'glDrawArrays', 'glDrawArraysInstanced', 'glDrawArraysInstancedBaseInstance', 'glDrawArraysIndirect',
+    'glDrawElements', 'glDrawElementsBaseVertex', 'glDrawElementsInstanced', 'glDrawElementsInstancedBaseVertex',
+    'glDrawElementsInstancedBaseInstance', 'glDrawElementsInstancedBaseVertexBaseInstance', 'glDrawElementsIndirect',
+    'glDrawRangeElements', 'glDrawRangeElementsBaseVertex',
+    'glDrawTransformFeedback', 'glDrawTransformFeedbackInstanced',
+    'glDrawTransformFeedbackStream', 'glDrawTransformFeedbackStreamInstanced',
+    'glMultiDrawArrays', 'glMultiDrawArraysIndirect', 'glMultiDrawArraysIndirectCount',
+    'glMultiDrawElements', 'glMultiDrawElementsBaseVertex', 'glMultiDrawElementsIndirect',
+    'glMultiDrawElementsIndirectCount',
+    'glDispatchCompute', 'glDispatchComputeIndirect',
+}
+
+CATEGORIES = {
+    'redundant': 'redundant state change',
+    'query': 'glGet* in the frame loop',
+    'map': 'synchronized map/unmap',
+    'sync': 'readback / sync point',
+    'finish': 'glFinish / glFlush',
+}
+
+
+class Frame:
+    __slots__ = ['index', 'name', 'site', 'start', 'end', 'calls', 'draws']
+
+    def __init__(self, index, name, site, start):
+        self.index = index
+        self.name = name
+        self.site = site
+        self.start = start
+        self.end = start
+        self.calls = 0
+        self.draws = 0
+
+
+class Analyzer:
+    '''
+        Walks the records of a trace and collects the findings.
+    '''
+
+    def __init__(self, trace):
+        self.trace = trace
+        self.state = {}
+        self.findings = {}
+        self.frames = []
+        self.mappings = {}
+        self.site = '(before the first mark)'
+        self.in_frames = False
+        self.calls = 0
+
+    def flag(self, category, record, detail=None):
+        key = (category, record.name, detail, self.site)
+        entry = self.findings.get(key)
+        if entry is None:
+            entry = self.findings[key] = [0, 0]
+        entry[0] += 1
+        entry[1] += record.duration
+
+    def params(self, record):
+        names = [param for param, _ in self.trace.functions[record.call][2]]
+        return dict(zip(names, record.args))
+
+    def set_state(self, key, value, record):
+        if self.state.get(key) == value:
+            self.flag('redundant', record)
+        self.state[key] = value
+
+    def mark(self, record):
+        name = record.text(0) or ''
+        location = record.text(1) or ''
+        self.site = '%s %s' % (name, location) if name else location
+        self.in_frames = True
+
+        if self.frames:
+            self.frames[-1].end = record.start
+        self.frames.append(Frame(len(self.frames), name, location, record.start))
+
+    def bind(self, record, args):
+        name = record.name
+        vao = self.state.get(('glBindVertexArray',), 0)
+
+        if name == 'glBindFramebuffer':
+            # GL_FRAMEBUFFER binds both the draw and the read framebuffer
+            targets = [GL_DRAW_FRAMEBUFFER, GL_READ_FRAMEBUFFER] if args['target'] == GL_FRAMEBUFFER else [args['target']]
+            keys = [(name, target) for target in targets]
+            if all(self.state.get(key) == args['framebuffer'] for key in keys):
+                self.flag('redundant', record)
+            for key in keys:
+                self.state[key] = args['framebuffer']
+            return
+
+        key_params, value_params = BINDS[name]
+        key = (name,) + tuple(args[param] for param in key_params)
+        value = args[value_params] if isinstance(value_params, str) else tuple(args[param] for param in value_params)
+
+        if name == 'glBindTexture':
+            # The texture bindings belong to the active unit
+            key += (self.state.get(('glActiveTexture',), GL_TEXTURE0),)
+
+        if name == 'glBindBuffer' and args['target'] == GL_ELEMENT_ARRAY_BUFFER:
+            # The element buffer binding belongs to the vertex array
+            key += (vao,)
+
+        self.set_state(key, value, record)
+
+        if name in ('glBindBufferBase', 'glBindBufferRange'):
+            # The indexed bindings also bind the generic target
+            self.state[('glBindBuffer', args['target'])] = args['buffer']
+
+    def delete(self, record, args):
+        payload = record.payloads.get(len(record.args) - 1)
+        if payload is None or payload.data is None:
+            return
+        deleted = set(int.from_bytes(payload.data[i:i + 4], 'little') for i in range(0, len(payload.data), 4))
+        bindings = DELETES[record.name]
+
+        for key in list(self.state):
+            value = self.state[key]
+            value = value[0] if isinstance(value, tuple) else value
+            if key[0] in bindings and value in deleted:
+                del self.state[key]
+
+    def record(self, record):
+        if record.is_mark:
+            self.mark(record)
+            return
+
+        name = record.name
+        args = self.params(record)
+        self.calls += 1
+
+        if self.frames:
+            frame = self.frames[-1]
+            frame.calls += 1
+            frame.end = record.start + record.duration
+            if name in DRAWS:
+                frame.draws += 1
+
+        if name in BINDS or name == 'glBindFramebuffer':
+            self.bind(record, args)
+
+        elif name in ('glEnable', 'glDisable'):
+            self.set_state(('cap', args['cap']), name == 'glEnable', record)
+
+        elif name in ('glEnablei', 'glDisablei'):
+            self.set_state(('cap', args['target'], args['index']), name == 'glEnablei', record)
+
+        elif name in SETTERS:
+            key = (name,) + tuple(args[param] for param in SETTERS[name])
+            self.set_state(key, tuple(record.args), record)
+
+        elif name in DELETES:
+            self.delete(record, args)
+
+        elif name == 'glDeleteProgram' and self.state.get(('glUseProgram',)) == args['program']:
+            del self.state[('glUseProgram',)]
+
+        if name in ('glMapBuffer', 'glMapBufferRange'):
+            access = args['access']
+            if name == 'glMapBuffer':
+                unsynchronized = False
+                detail = 'read' if access in (GL_READ_ONLY, GL_READ_WRITE) else 'write'
+            else:
+                unsynchronized = bool(access & GL_MAP_UNSYNCHRONIZED_BIT)
+                detail = 'read' if access & GL_MAP_READ_BIT else 'write'
+            if not unsynchronized:
+                self.flag('map', record, detail)
+            self.mappings[args['target']] = None if unsynchronized else detail
+
+        elif name == 'glUnmapBuffer':
+            # Unmapping a synchronized mapping waits for the written range as well
+            detail = self.mappings.pop(args['target'], None)
+            if detail is not None:
+                self.flag('map', record, detail)
+
+        elif name in READBACKS:
+            if not self.state.get(('glBindBuffer', GL_PIXEL_PACK_BUFFER)):
+                self.flag('sync', record)
+
+        elif name in SYNC_POINTS:
+            self.flag('sync', record)
+
+        elif name in ('glFinish', 'glFlush'):
+            self.flag('finish', record)
+
+        elif self.in_frames and (name.startswith('glGet') or name.startswith('glIs') or name == 'glCheckFramebufferStatus'):
+            self.flag('query', record)
+
+    def run(self):
+        for record in self.trace.records():
+            self.record(record)
+        return self
+
+    def ranked(self):
+        '''
+            The findings, the most expensive first.
+        '''
+
+        items = [
+            {
+                'category': category,
+                'function': function,
+                'detail': detail,
+                'site': site,
+                'count': count,
+                'time': time,
+            }
+            for (category, function, detail, site), (count, time) in self.findings.items()
+        ]
+        items.sort(key=lambda item: (item['time'], item['count']), reverse=True)
+        return items
+
+
+def format_ns(ns):
+    for unit, scale in (('s', 1e9), ('ms', 1e6), ('us', 1e3)):
+        if ns >= scale:
+            return '%.3g%s' % (ns / scale, unit)
+    return '%dns' % ns
+
+
+def report(analyzer, top):
+    findings = analyzer.ranked()
+
+    print('%d calls, %d frames' % (analyzer.calls, len(analyzer.frames)))
+    if not analyzer.frames:
+        print('no gltraces.mark() in the trace, the glGet* calls are not checked')
+    print()
+
+    print('%-4s %-26s %-32s %8s %10s  %s' % ('rank', 'issue', 'function', 'calls', 'time', 'call site'))
+    for rank, item in enumerate(findings[:top], 1):
+        function = item['function'] + (' (%s)' % item['detail'] if item['detail'] else '')
+        print('%-4d %-26s %-32s %8d %10s  %s' % (
+            rank, CATEGORIES[item['category']], function, item['count'], format_ns(item['time']), item['site'],
+        ))
+
+    print()
+    print('%-26s %8s %10s' % ('issue', 'calls', 'time'))
+    for category, title in CATEGORIES.items():
+        items = [item for item in findings if item['category'] == category]
+        print('%-26s %8d %10s' % (title, sum(x['count'] for x in items), format_ns(sum(x['time'] for x in items))))
+
+    if analyzer.frames:
+        draws = [frame.draws for frame in analyzer.frames]
+        print()
+        print('draws per frame: min %d, mean %.1f, max %d' % (min(draws), sum(draws) / len(draws), max(draws)))
+        print()
+        print('%-6s %8s %8s %10s  %s' % ('frame', 'calls', 'draws', 'duration', 'mark'))
+        for frame in sorted(analyzer.frames, key=lambda frame: frame.draws, reverse=True)[:top]:
+            mark = '%s %s' % (frame.name, frame.site) if frame.name else frame.site
+            print('%-6d %8d %8d %10s  %s' % (frame.index, frame.calls, frame.draws, format_ns(frame.end - frame.start), mark))
+
+
+def main():
+    parser = argparse.ArgumentParser(prog='analyze', description='Reports the avoidable work in a gltraces capture.')
+    parser.add_argument('trace', help='the trace file')
+    parser.add_argument('--top', type=int, default=20, help='the number of findings and frames to print')
+    parser.add_argument('--json', action='store_true', help='print the findings and the frames as json')
+    args = parser.parse_args()
+
+    analyzer = Analyzer(TraceFile(args.trace)).run()
+
+    if args.json:
+        frames = [
+            {
+                'index': frame.index,
+                'mark': frame.name,
+                'site': frame.site,
+                'calls': frame.calls,
+                'draws': frame.draws,
+                'duration': frame.end - frame.start,
+            }
+            for frame in analyzer.frames
+        ]
+        print(json.dumps({'calls': analyzer.calls, 'findings': analyzer.ranked(), 'frames': frames}, indent=2))
+    else:
+        report(analyzer, args.top)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,140 @@
+'''
+    Prints a trace file in the text format of the former printf tracer.
+
+    python decode.py trace.bin [--timestamps] [--payloads]
+'''
+
+import argparse
+
+from tracefile import TRACE_DATA, TRACE_HASH, TraceFile
+
+PRIMITIVES = {
+    0x0000: 'GL_POINTS',
+    0x0001: 'GL_LINES',
+    0x0002: 'GL_LINE_LOOP',
+    0x0003: 'GL_LINE_STRIP',
+    0x0004: 'GL_TRIANGLES',
+    0x0005: 'GL_TRIANGLE_STRIP',
+    0x0006: 'GL_TRIANGLE_FAN',
+    0x000A: 'GL_LINES_ADJACENCY',
+    0x000B: 'GL_LINE_STRIP_ADJACENCY',
+    0x000C: 'GL_TRIANGLES_ADJACENCY',
+    0x000D: 'GL_TRIANGLE_STRIP_ADJACENCY',
+    0x000E: 'GL_PATCHES',
+}
+
+BLEND_FACTORS = {'sfactor', 'dfactor', 'srcRGB', 'dstRGB', 'srcAlpha', 'dstAlpha'}
+
+CLEAR_BITS = [
+    (0x00004000, 'GL_COLOR_BUFFER_BIT'),
+    (0x00000100, 'GL_DEPTH_BUFFER_BIT'),
+    (0x00000400, 'GL_STENCIL_BUFFER_BIT'),
+]
+
+ACCESS_BITS = [
+    (0x0001, 'GL_MAP_READ_BIT'),
+    (0x0002, 'GL_MAP_WRITE_BIT'),
+    (0x0004, 'GL_MAP_INVALIDATE_RANGE_BIT'),
+    (0x0008, 'GL_MAP_INVALIDATE_BUFFER_BIT'),
+    (0x0010, 'GL_MAP_FLUSH_EXPLICIT_BIT'),
+    (0x0020, 'GL_MAP_UNSYNCHRONIZED_BIT'),
+    (0x0040, 'GL_MAP_PERSISTENT_BIT'),
+    (0x0080, 'GL_MAP_COHERENT_BIT'),
+    (0x0100, 'GL_DYNAMIC_STORAGE_BIT'),
+    (0x0200, 'GL_CLIENT_STORAGE_BIT'),
+]
+
+BITFIELDS = {
+    'mask': CLEAR_BITS,
+    'access': ACCESS_BITS,
+    'flags': ACCESS_BITS,
+}
+
+
+def format_bits(value, bits):
+    names = []
+    for bit, name in bits:
+        if value & bit:
+            names.append(name)
+            value &= ~bit
+    if value or not names:
+        names.append('0x%x' % value)
+    return '|'.join(names)
+
+
+def format_value(trace, param, code, value):
+    if code == 'e':
+        if param == 'mode' and value in PRIMITIVES:
+            return PRIMITIVES[value]
+        if value == 0:
+            return 'GL_ZERO' if param in BLEND_FACTORS else 'GL_NONE'
+        if value == 1:
+            return 'GL_ONE'
+        return trace.enums.get(value, '0x%04x' % value)
+    if code == 'x':
+        return format_bits(value, BITFIELDS.get(param, []))
+    if code == 'b':
+        return 'true' if value else 'false'
+    if code == 'p':
+        return '0x%x' % value if value else '(nil)'
+    if code in 'fd':
+        return '%g' % value
+    return '%d' % value
+
+
+def format_payload(payload):
+    if payload.kind == TRACE_DATA:
+        text = repr(payload.data)
+        return text if len(text) <= 120 else text[:117] + '...'
+    if payload.kind == TRACE_HASH:
+        return '%d bytes, hash %016x' % (payload.length, payload.data)
+    return '%d bytes' % payload.length
+
+
+def format_record(trace, record):
+    if record.is_mark:
+        name = record.text(0)
+        location = record.text(1)
+        return '%s %s' % (name, location) if name else location
+
+    name, ret, params = trace.functions[record.call]
+    args = ', '.join(
+        '%s=%s' % (param, format_value(trace, param, code, value))
+        for (param, code), value in zip(params, record.args)
+    )
+    line = '%s(%s)' % (name, args)
+    if ret != 'v':
+        line += ' -> ' + format_value(trace, 'result', ret, record.result)
+    return line
+
+
+def main():
+    parser = argparse.ArgumentParser(prog='decode', description='Prints a trace file recorded by gltraces.')
+    parser.add_argument('trace', help='the trace file')
+    parser.add_argument('--timestamps', action='store_true', help='prefix the calls with the start and the duration')
+    parser.add_argument('--payloads', action='store_true', help='print the recorded payloads under the calls')
+    args = parser.parse_args()
+
+    trace = TraceFile(args.trace)
+    origin = None
+
+    for record in trace.records():
+        line = format_record(trace, record)
+
+        if args.timestamps:
+            if origin is None:
+                origin = record.start
+            line = '[%12.3f us %9.3f us] %s' % ((record.start - origin) / 1e3, record.duration / 1e3, line)
+
+        print(line)
+
+        if args.payloads and not record.is_mark:
+            params = trace.functions[record.call][2]
+            for arg, payload in sorted(record.payloads.items()):
+                # The bytes written through a mapping are stored past the arguments of glUnmapBuffer
+                name = params[arg][0] if arg < len(params) else 'mapped'
+                print('    %s: %s' % (name, format_payload(payload)))
+
+
+if __name__ == '__main__':
+    main()
@@ -1,15 +1,15 @@
-import moderngl.experimental as mgl
+import moderngl
 import gltraces
 
-ctx = mgl.create_context(standalone=True, debug=True)
+ctx = moderngl.create_standalone_context()
 
-mglprocs = mgl.glprocs(ctx)
-gltraces.glprocs[:] = mglprocs
-mglprocs[:] = gltraces.gltraces
+# Swap the function table of the context for the recording wrappers
+gltraces.install(ctx.mglo.glprocs())
+gltraces.start('example.gltrace', payloads='blob')
 
 prog = ctx.program(
     vertex_shader='''
-        #version 130
+        #version 330
 
         in vec2 in_vert;
         out vec2 v_vert;
@@ -22,7 +22,16 @@ prog = ctx.program(
     varyings=['v_vert'],
 )
 
+gltraces.mark('buffer')
 buf = ctx.buffer(reserve=16)
 buf.clear()
 buf.write(b'1234')
 print(buf.read())
+
+gltraces.stop()
+gltraces.uninstall(ctx.mglo.glprocs())
+print(gltraces.stats())
+
+# python decode.py example.gltrace --payloads
+# python replay.py example.gltrace
+# python analyze.py example.gltrace
@@ -0,0 +1,518 @@
+'''
+    Generates wrappers.cpp and replays.cpp from the GLMethods table of moderngl.
+
+    python generate.py
+
+    Every member of GLMethods gets a wrapper calling the original function
+    and recording the call. The order of the table is kept, the wrappers
+    replace the function table of a context in place.
+
+    The replays call the functions again from the recorded arguments and payloads.
+'''
+
+import json
+import os
+import re
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+GL_METHODS = os.path.join(ROOT, 'moderngl', 'src', 'gl_methods.hpp')
+OPENGL = os.path.join(ROOT, 'moderngl', 'src', 'OpenGL.hpp')
+OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'wrappers.cpp')
+REPLAY_OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'replays.cpp')
+
+# Argument codes stored in the metadata
+#   i: signed integer, u: unsigned integer, e: enum, x: bitfield, b: boolean
+#   f: float, d: double, p: pointer, v: void (return only)
+TYPE_CODES = {
+    'GLenum': 'e',
+    'GLbitfield': 'x',
+    'GLboolean': 'b',
+    'GLfloat': 'f',
+    'GLclampf': 'f',
+    'GLdouble': 'd',
+    'GLclampd': 'd',
+    'GLbyte': 'i',
+    'GLchar': 'i',
+    'GLshort': 'i',
+    'GLint': 'i',
+    'GLsizei': 'i',
+    'GLint64': 'i',
+    'GLintptr': 'i',
+    'GLsizeiptr': 'i',
+    'GLubyte': 'u',
+    'GLushort': 'u',
+    'GLhalf': 'u',
+    'GLuint': 'u',
+    'GLuint64': 'u',
+    'GLsync': 'p',
+    'GLDEBUGPROC': 'p',
+    'void': 'v',
+}
+
+RECORD_METHODS = {
+    'i': 'argi', 'u': 'argu', 'e': 'argu', 'x': 'argu', 'b': 'argu', 'f': 'argf', 'd': 'argf', 'p': 'argp',
+}
+
+UNIFORM = re.compile(r'^(Program)?Uniform([1-4])(f|i|ui|d)v$')
+UNIFORM_MATRIX = re.compile(r'^(Program)?UniformMatrix([2-4])(x([2-4]))?(f|d)v$')
+PARAMETER = re.compile(r'^(Tex|Sampler|Texture)Parameter(fv|iv|Iiv|Iuiv)$')
+PIXELS = re.compile(r'^Tex(ture)?(Sub)?Image([1-3])D$')
+COMPRESSED = re.compile(r'^CompressedTex(ture)?(Sub)?Image([1-3])D$')
+CLEAR_DATA = re.compile(r'^Clear(Named)?(Buffer|Tex)(Sub)?(Data|Image)$')
+VERTEX_ATTRIB = re.compile(r'^VertexAttrib(I|L)?([1-4])(N)?(b|s|i|f|d|ub|us|ui)v$')
+NAME_ARRAY = re.compile(r'^(Gen|Create|Delete)(Buffers|Textures|Framebuffers|Renderbuffers|VertexArrays|Samplers|Queries|TransformFeedbacks|ProgramPipelines)$')
+
+ELEMENT_SIZES = {'f': 'sizeof(GLfloat)', 'i': 'sizeof(GLint)', 'ui': 'sizeof(GLuint)', 'd': 'sizeof(GLdouble)'}
+# Object names are remapped per namespace during the replay
+NAMESPACES = {
+    'Buffers': 'REPLAY_BUFFER',
+    'Textures': 'REPLAY_TEXTURE',
+    'Framebuffers': 'REPLAY_FRAMEBUFFER',
+    'Renderbuffers': 'REPLAY_RENDERBUFFER',
+    'VertexArrays': 'REPLAY_VERTEX_ARRAY',
+    'Samplers': 'REPLAY_SAMPLER',
+    'Queries': 'REPLAY_QUERY',
+    'TransformFeedbacks': 'REPLAY_TRANSFORM_FEEDBACK',
+    'ProgramPipelines': 'REPLAY_PIPELINE',
+}
+
+NAME_PARAMS = {
+    'buffer': 'REPLAY_BUFFER',
+    'readBuffer': 'REPLAY_BUFFER',
+    'writeBuffer': 'REPLAY_BUFFER',
+    'texture': 'REPLAY_TEXTURE',
+    'program': 'REPLAY_PROGRAM',
+    'shader': 'REPLAY_PROGRAM',
+    'framebuffer': 'REPLAY_FRAMEBUFFER',
+    'readFramebuffer': 'REPLAY_FRAMEBUFFER',
+    'drawFramebuffer': 'REPLAY_FRAMEBUFFER',
+    'renderbuffer': 'REPLAY_RENDERBUFFER',
+    'array': 'REPLAY_VERTEX_ARRAY',
+    'vaobj': 'REPLAY_VERTEX_ARRAY',
+    'sampler': 'REPLAY_SAMPLER',
+    'pipeline': 'REPLAY_PIPELINE',
+    'xfb': 'REPLAY_TRANSFORM_FEEDBACK',
+}
+
+# Pointer parameters holding an offset into a bound buffer when no payload is recorded
+OFFSET_PARAMS = {'pointer', 'indices', 'indirect', 'pixels', 'data'}
+
+# Functions writing pixels to client memory or to the bound pixel pack buffer
+PACK_FUNCTIONS = {
+    'ReadPixels', 'ReadnPixels', 'GetTexImage', 'GetnTexImage', 'GetCompressedTexImage', 'GetnCompressedTexImage',
+    'GetTextureImage', 'GetCompressedTextureImage', 'GetTextureSubImage', 'GetCompressedTextureSubImage',
+}
+
+ATTRIB_SIZES = {'b': '1', 'ub': '1', 's': '2', 'us': '2', 'i': '4', 'ui': '4', 'f': '4', 'd': '8'}
+
+
+class Param:
+    def __init__(self, text):
+        text = text.strip()
+        match = re.match(r'^(.*?)\s*(\w+)$', text)
+        self.type = match.group(1).strip()
+        self.name = match.group(2)
+
+        if '*' in self.type:
+            self.code = 'p'
+        else:
+            self.code = TYPE_CODES[self.type.replace('const ', '')]
+
+
+class Function:
+    def __init__(self, name, ret, params):
+        self.name = name
+        self.ret = ret.strip()
+        self.params = params
+        self.ret_code = 'p' if '*' in self.ret else TYPE_CODES[self.ret.replace('const ', '')]
+
+    def index(self, name):
+        for i, param in enumerate(self.params):
+            if param.name == name:
+                return i
+        raise KeyError('%s has no parameter %s' % (self.name, name))
+
+
+def parse():
+    typedefs = {}
+
+    with open(OPENGL) as f:
+        for line in f:
+            match = re.match(r'^typedef (.+?)\s*\(GLAPI \* (PFNGL\w+PROC)\)\((.*)\);', line)
+            if match:
+                ret, proc, params = match.groups()
+                params = [] if params.strip() in ('', 'void') else [Param(x) for x in params.split(',')]
+                typedefs[proc] = (ret, params)
+
+    functions = []
+
+    with open(GL_METHODS) as f:
+        for line in f:
+            match = re.match(r'^\s+(PFNGL\w+PROC) (\w+);', line)
+            if match:
+                proc, name = match.groups()
+                ret, params = typedefs[proc]
+                functions.append(Function(name, ret, params))
+
+    enums = {}
+
+    with open(OPENGL) as f:
+        for line in f:
+            match = re.match(r'^#define (GL_\w+) (0x[0-9A-Fa-f]+|\d+)$', line)
+            if match:
+                name, value = match.groups()
+                value = int(value, 0)
+                # The small values depend on the parameter, decode.py names them
+                if name.endswith('_BIT') or name.startswith('GL_VERSION_') or value < 0x10 or value > 0xFFFFFF:
+                    continue
+                enums.setdefault(value, name)
+
+    return functions, enums
+
+
+def name_array(func):
+    '''
+        The namespace of the names generated or deleted by the function, None for the other functions.
+    '''
+
+    match = NAME_ARRAY.match(func.name)
+    if match and len(func.params) == 2 and func.params[0].name in ('n', 'count'):
+        return NAMESPACES[match.group(2)]
+    return None
+
+
+def payloads(func):
+    '''
+        The statements recording the data behind the pointer arguments.
+    '''
+
+    name = func.name
+    params = func.params
+    names = [p.name for p in params]
+    lines = []
+
+    for i, param in enumerate(params):
+        if param.type == 'const GLchar *':
+            length = 'length' if i > 0 and names[i - 1] == 'length' else '-1'
+            lines.append('rec.string(%d, %s, %s);' % (i, param.name, length))
+
+        elif param.type == 'const GLchar * const *':
+            lengths = names[i + 1] if i + 1 < len(names) and names[i + 1] == 'length' else '0'
+            lines.append('rec.strings(%d, %s, %s, %s);' % (i, names[i - 1], param.name, lengths))
+
+    if name_array(func) is not None:
+        lines.append('rec.data(%d, %s, %s * sizeof(GLuint));' % (len(params) - 1, names[-1], names[0]))
+
+    match = UNIFORM.match(name)
+    if match:
+        lines.append('rec.data(%d, value, count * %s * %s);' % (func.index('value'), match.group(2), ELEMENT_SIZES[match.group(3)]))
+
+    match = UNIFORM_MATRIX.match(name)
+    if match:
+        rows = match.group(4) or match.group(2)
+        lines.append('rec.data(%d, value, count * %s * %s * %s);' % (
+            func.index('value'), match.group(2), rows, ELEMENT_SIZES[match.group(5)]))
+
+    match = PARAMETER.match(name)
+    if match:
+        lines.append('rec.data(2, %s, trace_parameter_count(pname) * 4);' % names[2])
+
+    if name in ('ClearBufferiv', 'ClearBufferuiv', 'ClearBufferfv'):
+        lines.append('rec.data(2, value, buffer == GL_COLOR ? 16 : 4);')
+
+    if name in ('ClearNamedFramebufferiv', 'ClearNamedFramebufferuiv', 'ClearNamedFramebufferfv'):
+        lines.append('rec.data(3, value, buffer == GL_COLOR ? 16 : 4);')
+
+    match = VERTEX_ATTRIB.match(name)
+    if match:
+        lines.append('rec.data(1, %s, %s * %s);' % (names[1], match.group(2), ATTRIB_SIZES[match.group(4)]))
+
+    if name == 'DrawBuffers':
+        lines.append('rec.data(1, bufs, n * sizeof(GLenum));')
+
+    if name == 'DebugMessageControl':
+        lines.append('rec.data(4, ids, count * sizeof(GLuint));')
+
+    if name in ('InvalidateFramebuffer', 'InvalidateSubFramebuffer'):
+        lines.append('rec.data(2, attachments, numAttachments * sizeof(GLenum));')
+
+    if name in ('BufferData', 'BufferSubData', 'BufferStorage', 'NamedBufferData', 'NamedBufferSubData', 'NamedBufferStorage'):
+        lines.append('rec.bulk(%d, data, size);' % func.index('data'))
+
+    match = PIXELS.match(name)
+    if match:
+        dims = int(match.group(3))
+        height = 'height' if dims >= 2 else '1'
+        depth = 'depth' if dims >= 3 else '1'
+        lines.append('rec.pixels(%d, pixels, width, %s, %s, format, type);' % (func.index('pixels'), height, depth))
+
+    if COMPRESSED.match(name):
+        lines.append('rec.compressed(%d, data, imageSize);' % func.index('data'))
+
+    if CLEAR_DATA.match(name):
+        lines.append('rec.data(%d, data, trace_pixel_size(format, type));' % func.index('data'))
+
+    return lines
+
+
+# Calls updating the state the recorder depends on, run while the wrappers are installed
+TRACKING = {
+    'PixelStorei': ['trace_pixel_store(pname, param);'],
+    'BindBuffer': ['trace_bind_buffer(target, buffer);'],
+    'MapBufferRange': ['trace_map(target, result, length, access);'],
+    'MapBuffer': ['trace_map(target, result, trace_buffer_size(target), access == GL_READ_ONLY ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT);'],
+    'UnmapBuffer': ['trace_unmap(target);'],
+}
+
+# Recorded before the call, the mapped memory is gone after it
+BEFORE_CALL = {
+    'UnmapBuffer': ['rec.mapped(1, target);'],
+}
+
+
+def wrapper(index, func):
+    params = ', '.join('%s %s' % (p.type, p.name) for p in func.params)
+    args = ', '.join(p.name for p in func.params)
+    returns = func.ret != 'void'
+    call = '%sgl.%s(%s);' % ('%s result = ' % func.ret if returns else '', func.name, args)
+    tracking = TRACKING.get(func.name, [])
+
+    lines = ['static %s GLAPI trace_%s(%s) {' % (func.ret, func.name, params)]
+    lines.append('    if (!trace_recording.load(std::memory_order_relaxed)) {')
+    lines.append('        ' + call)
+    lines.extend('        ' + x for x in tracking)
+    if returns:
+        lines.append('        return result;')
+    else:
+        lines.append('        return;')
+    lines.append('    }')
+    lines.append('')
+    lines.append('    TraceRecord rec(%d);' % index)
+
+    record_args = [
+        '    rec.%s(%s%s);' % (RECORD_METHODS[p.code], '(const void *)' if p.type == 'GLDEBUGPROC' else '', p.name)
+        for p in func.params
+    ]
+
+    if func.name in BEFORE_CALL:
+        lines.extend(record_args)
+        if returns:
+            lines.append('    size_t result_slot = rec.reserve();')
+        lines.extend('    ' + x for x in BEFORE_CALL[func.name])
+        lines.append('    rec.begin();')
+        lines.append('    ' + call)
+        lines.append('    rec.end();')
+        lines.extend('    ' + x for x in tracking)
+        if returns:
+            lines.append('    rec.patch(result_slot, (uint64_t)result);')
+    else:
+        lines.append('    rec.begin();')
+        lines.append('    ' + call)
+        lines.append('    rec.end();')
+        lines.extend('    ' + x for x in tracking)
+        lines.extend(record_args)
+        if returns:
+            lines.append('    rec.%s(result);' % RECORD_METHODS[func.ret_code])
+        lines.extend('    ' + x for x in payloads(func))
+
+    lines.append('    rec.commit();')
+    if returns:
+        lines.append('    return result;')
+    lines.append('}')
+    return '\n'.join(lines)
+
+
+def name_param(func, param):
+    '''
+        The namespace of an object name parameter, None for the other parameters.
+    '''
+
+    if param.code != 'u':
+        return None
+    if param.name == 'id' and 'Quer' in func.name:
+        return 'REPLAY_QUERY'
+    if param.name == 'id' and 'TransformFeedback' in func.name:
+        return 'REPLAY_TRANSFORM_FEEDBACK'
+    if param.name == 'name' and func.name in ('ObjectLabel', 'GetObjectLabel'):
+        return 'replay.label_namespace(identifier)'
+    return NAME_PARAMS.get(param.name)
+
+
+def output_size(func):
+    '''
+        The size of the memory written through the output pointers, zero for a small default.
+    '''
+
+    names = [p.name for p in func.params]
+    if func.name == 'ReadPixels':
+        return '(size_t)width * height * 16 + (size_t)height * 8'
+    if func.name in ('GetTexImage', 'GetTextureImage') and 'bufSize' not in names:
+        return 'replay.texture_size(target, level)'
+    if func.name == 'GetCompressedTexImage':
+        return 'replay.compressed_size(target, level)'
+    if func.name in ('GetBufferSubData', 'GetNamedBufferSubData'):
+        return '(size_t)size'
+    if 'bufSize' in names:
+        return '(size_t)bufSize'
+    return '0'
+
+
+def replay(index, func):
+    '''
+        The case of the replay switch, None if the function cannot be replayed.
+    '''
+
+    if func.name == 'DebugMessageCallback':
+        return None
+
+    names = [p.name for p in func.params]
+    covered = set(int(x) for line in payloads(func) for x in re.findall(r'^rec\.\w+\((\d+)', line))
+    namespace = name_array(func)
+    lines = []
+    args = []
+    after = []
+
+    # The scalar arguments are declared first, the sizes of the pointer arguments depend on them
+    for i, param in enumerate(func.params):
+        if param.code in 'fd':
+            lines.append('%s %s = (%s)replay.real(slots[%d]);' % (param.type, param.name, param.type, i))
+        elif param.code != 'p':
+            ns = name_param(func, param)
+            value = 'replay.name(%s, slots[%d])' % (ns, i) if ns else '(%s)slots[%d]' % (param.type, i)
+            lines.append('%s %s = %s;' % (param.type, param.name, value))
+
+    for i, param in enumerate(func.params):
+        if param.code != 'p':
+            args.append(param.name)
+        elif param.type == 'GLsync':
+            args.append('replay.sync(slots[%d])' % i)
+        elif param.type == 'const GLchar * const *':
+            args.append('replay.strings(%d, %s)' % (i, names[i - 1]))
+        elif param.type == 'const GLint *' and param.name == 'length' and i > 0 and func.params[i - 1].type == 'const GLchar * const *':
+            # The strings are stored zero terminated
+            args.append('0')
+        elif namespace and i == len(func.params) - 1:
+            if func.name.startswith('Delete'):
+                args.append('replay.names_of(%s, %d, %s)' % (namespace, i, names[0]))
+            else:
+                lines.append('GLuint * created = (GLuint *)replay.output(%s * sizeof(GLuint));' % names[0])
+                args.append('created')
+                after.append('replay.created(%s, %d, %s, created);' % (namespace, i, names[0]))
+        elif param.type == 'const GLchar *':
+            args.append('replay.text(%d, slots[%d])' % (i, i))
+        elif param.type.startswith('const'):
+            if i not in covered and param.name not in OFFSET_PARAMS:
+                return None
+            args.append('(%s)replay.input(%d, slots[%d])' % (param.type, i, i))
+        elif func.name in PACK_FUNCTIONS and param.name in ('pixels', 'img'):
+            args.append('(%s)replay.pack(slots[%d], %s)' % (param.type, i, output_size(func)))
+        else:
+            args.append('(%s)replay.output(%s)' % (param.type, output_size(func)))
+
+    slot = len(func.params)
+
+    if func.name in ('CreateShader', 'CreateProgram', 'CreateShaderProgramv'):
+        after.append('replay.created(REPLAY_PROGRAM, slots[%d], result);' % slot)
+    if func.name == 'FenceSync':
+        after.append('replay.created_sync(slots[%d], result);' % slot)
+    if func.name in ('MapBuffer', 'MapBufferRange'):
+        after.append('replay.map(target, result);')
+    if func.name == 'BindBuffer':
+        after.append('replay.bind_buffer(target, slots[1]);')
+    if func.name == 'UnmapBuffer':
+        lines.append('replay.unmap(target, %d);' % slot)
+
+    result = '%s result = ' % func.ret if func.ret != 'void' and after else ''
+    lines.append('%sreplay.gl.%s(%s);' % (result, func.name, ', '.join(args)))
+    lines.extend(after)
+
+    out = ['        case %d: {' % index]
+    out.extend('            ' + x for x in lines)
+    out.append('            return true;')
+    out.append('        }')
+    return '\n'.join(out)
+
+
+def metadata(functions, enums):
+    data = {
+        'functions': [
+            ['gl' + func.name, func.ret_code, [[p.name, p.code] for p in func.params]]
+            for func in functions
+        ],
+        'enums': {str(value): name for value, name in sorted(enums.items())},
+    }
+    text = json.dumps(data, separators=(',', ':'))
+    # Split in pieces, some compilers limit the length of a string literal
+    return [text[i:i + 1024] for i in range(0, len(text), 1024)]
+
+
+def main():
+    functions, enums = parse()
+
+    out = []
+    out.append('// Generated by generate.py from moderngl/src/gl_methods.hpp, do not edit.')
+    out.append('')
+    out.append('#include "recorder.hpp"')
+    out.append('')
+
+    for index, func in enumerate(functions):
+        out.append(wrapper(index, func))
+        out.append('')
+
+    out.append('const GLMethods traces = {')
+    out.extend('    trace_%s,' % func.name for func in functions)
+    out.append('};')
+    out.append('')
+    out.append('const char * const trace_names[] = {')
+    out.extend('    "gl%s",' % func.name for func in functions)
+    out.append('    0,')
+    out.append('};')
+    out.append('')
+    out.append('const char * const trace_metadata[] = {')
+    out.extend('    %s,' % json.dumps(piece) for piece in metadata(functions, enums))
+    out.append('    0,')
+    out.append('};')
+    out.append('')
+
+    with open(OUTPUT, 'w') as f:
+        f.write('\n'.join(out))
+
+    print('%d functions written to %s' % (len(functions), os.path.relpath(OUTPUT)))
+
+    out = []
+    out.append('// Generated by generate.py from moderngl/src/gl_methods.hpp, do not edit.')
+    out.append('')
+    out.append('#include "replayer.hpp"')
+    out.append('')
+    out.append('const unsigned char trace_arg_counts[] = {')
+    out.extend('    %d,' % len(func.params) for func in functions)
+    out.append('};')
+    out.append('')
+    out.append('const unsigned char trace_returns[] = {')
+    out.extend('    %d,' % (func.ret != 'void') for func in functions)
+    out.append('};')
+    out.append('')
+    out.append('bool trace_replay_call(TraceReplay & replay, uint32_t call, const uint64_t * slots) {')
+    out.append('    switch (call) {')
+
+    skipped = []
+    for index, func in enumerate(functions):
+        case = replay(index, func)
+        if case is None:
+            skipped.append(func.name)
+        else:
+            out.append(case)
+
+    out.append('    }')
+    out.append('    return false;')
+    out.append('}')
+    out.append('')
+
+    with open(REPLAY_OUTPUT, 'w') as f:
+        f.write('\n'.join(out))
+
+    print('%d functions written to %s, %d not replayed' % (len(functions) - len(skipped), os.path.relpath(REPLAY_OUTPUT), len(skipped)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,375 @@
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "recorder.hpp"
+
+#define TRACE_MAX_THREADS 64
+#define TRACE_MAX_MAPPINGS 16
+
+GLMethods gl;
+
+std::atomic<bool> trace_recording(false);
+int trace_payload_mode = TRACE_PAYLOAD_HASH;
+
+// Single producer single consumer ring, the producer is the thread calling GL
+struct TraceRing {
+    uint32_t index;
+    char * data;
+    size_t capacity;
+    std::atomic<size_t> head;
+    std::atomic<size_t> tail;
+};
+
+struct TraceMapping {
+    GLenum target;
+    const void * ptr;
+    size_t length;
+    bool write;
+};
+
+struct TraceThread {
+    TraceRing * ring;
+    std::vector<char> scratch;
+
+    GLuint unpack_buffer;
+    GLint unpack_alignment;
+    GLint unpack_row_length;
+    GLint unpack_image_height;
+
+    TraceMapping mappings[TRACE_MAX_MAPPINGS];
+    int num_mappings;
+
+    TraceThread() : ring(0), unpack_buffer(0), unpack_alignment(4), unpack_row_length(0), unpack_image_height(0), num_mappings(0) {
+    }
+};
+
+static thread_local TraceThread thread_state;
+
+static TraceRing * rings[TRACE_MAX_THREADS];
+static std::atomic<int> num_rings(0);
+static std::mutex rings_lock;
+
+static FILE * trace_file;
+static std::mutex file_lock;
+static std::thread flush_thread;
+static std::atomic<bool> flushing(false);
+static size_t ring_capacity = 8 * 1024 * 1024;
+
+static std::atomic<unsigned long long> stat_records(0);
+static std::atomic<unsigned long long> stat_bytes(0);
+static std::atomic<unsigned long long> stat_stalls(0);
+
+uint64_t trace_clock() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Not cryptographic, 8 bytes per step to keep up with the uploads
+uint64_t trace_hash(const void * data, size_t size) {
+    const unsigned char * ptr = (const unsigned char *)data;
+    uint64_t hash = 0xCBF29CE484222325ull ^ size;
+
+    while (size >= 8) {
+        uint64_t word;
+        memcpy(&word, ptr, 8);
+        hash = (hash ^ word) * 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 29;
+        ptr += 8;
+        size -= 8;
+    }
+
+    while (size--) {
+        hash = (hash ^ *ptr++) * 0x100000001B3ull;
+    }
+
+    return hash ^ (hash >> 32);
+}
+
+std::vector<char> & trace_scratch() {
+    return thread_state.scratch;
+}
+
+static void write_chunk(uint32_t thread, const char * first, size_t first_size, const char * second, size_t second_size) {
+    uint32_t header[2] = {thread, (uint32_t)(first_size + second_size)};
+    fwrite(header, sizeof(header), 1, trace_file);
+    fwrite(first, 1, first_size, trace_file);
+    if (second_size) {
+        fwrite(second, 1, second_size, trace_file);
+    }
+}
+
+static TraceRing * register_thread() {
+    std::lock_guard<std::mutex> guard(rings_lock);
+
+    int index = num_rings.load();
+    if (index == TRACE_MAX_THREADS) {
+        return 0;
+    }
+
+    TraceRing * ring = new TraceRing();
+    ring->index = index;
+    ring->data = new char[ring_capacity];
+    ring->capacity = ring_capacity;
+    ring->head = 0;
+    ring->tail = 0;
+
+    rings[index] = ring;
+    num_rings.store(index + 1, std::memory_order_release);
+    return ring;
+}
+
+void trace_push(const char * data, size_t size) {
+    TraceRing * ring = thread_state.ring;
+
+    if (!ring) {
+        ring = thread_state.ring = register_thread();
+        if (!ring) {
+            return;
+        }
+    }
+
+    size_t head = ring->head.load(std::memory_order_relaxed);
+
+    if (size > ring->capacity) {
+        // Larger than the ring, written in place once the pending records of the thread are out
+        while (ring->tail.load(std::memory_order_acquire) != head) {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> guard(file_lock);
+        write_chunk(ring->index, data, size, 0, 0);
+    } else {
+        if (ring->capacity - (head - ring->tail.load(std::memory_order_acquire)) < size) {
+            stat_stalls.fetch_add(1, std::memory_order_relaxed);
+            while (ring->capacity - (head - ring->tail.load(std::memory_order_acquire)) < size) {
+                std::this_thread::yield();
+            }
+        }
+
+        size_t offset = head % ring->capacity;
+        size_t first = ring->capacity - offset < size ? ring->capacity - offset : size;
+        memcpy(ring->data + offset, data, first);
+        memcpy(ring->data, data + first, size - first);
+        ring->head.store(head + size, std::memory_order_release);
+    }
+
+    stat_records.fetch_add(1, std::memory_order_relaxed);
+    stat_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+static bool flush_rings() {
+    bool written = false;
+    int count = num_rings.load(std::memory_order_acquire);
+
+    for (int i = 0; i < count; ++i) {
+        TraceRing * ring = rings[i];
+        size_t tail = ring->tail.load(std::memory_order_relaxed);
+        size_t head = ring->head.load(std::memory_order_acquire);
+
+        if (head == tail) {
+            continue;
+        }
+
+        size_t offset = tail % ring->capacity;
+        size_t size = head - tail;
+        size_t first = ring->capacity - offset < size ? ring->capacity - offset : size;
+
+        {
+            std::lock_guard<std::mutex> guard(file_lock);
+            write_chunk(i, ring->data + offset, first, ring->data, size - first);
+        }
+
+        ring->tail.store(head, std::memory_order_release);
+        written = true;
+    }
+
+    return written;
+}
+
+static void flush_loop() {
+    while (flushing.load(std::memory_order_acquire)) {
+        if (!flush_rings()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    flush_rings();
+}
+
+bool trace_start(const char * path, int payload_mode, size_t capacity) {
+    trace_file = fopen(path, "wb");
+    if (!trace_file) {
+        return false;
+    }
+
+    std::string metadata;
+    for (int i = 0; trace_metadata[i]; ++i) {
+        metadata += trace_metadata[i];
+    }
+
+    uint32_t header[2] = {TRACE_VERSION, (uint32_t)metadata.size()};
+    fwrite(TRACE_MAGIC, 1, 8, trace_file);
+    fwrite(header, sizeof(header), 1, trace_file);
+    fwrite(metadata.data(), 1, metadata.size(), trace_file);
+
+    // The rings of the previous session are empty, only new ones get the new capacity
+    ring_capacity = capacity;
+    trace_payload_mode = payload_mode;
+    stat_records = 0;
+    stat_bytes = 0;
+    stat_stalls = 0;
+
+    flushing = true;
+    flush_thread = std::thread(flush_loop);
+    trace_recording = true;
+    return true;
+}
+
+void trace_stop() {
+    if (!trace_file) {
+        return;
+    }
+
+    trace_recording = false;
+    flushing = false;
+    flush_thread.join();
+
+    fclose(trace_file);
+    trace_file = 0;
+}
+
+void trace_flush() {
+    if (trace_file && trace_recording) {
+        // Wait for the flush thread to drain the rings
+        int count = num_rings.load(std::memory_order_acquire);
+        for (int i = 0; i < count; ++i) {
+            while (rings[i]->tail.load(std::memory_order_acquire) != rings[i]->head.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+        }
+        std::lock_guard<std::mutex> guard(file_lock);
+        fflush(trace_file);
+    }
+}
+
+void trace_stats(unsigned long long * records, unsigned long long * bytes, unsigned long long * stalls) {
+    *records = stat_records.load();
+    *bytes = stat_bytes.load();
+    *stalls = stat_stalls.load();
+}
+
+void trace_pixel_store(GLenum pname, GLint param) {
+    switch (pname) {
+        case GL_UNPACK_ALIGNMENT: thread_state.unpack_alignment = param; break;
+        case GL_UNPACK_ROW_LENGTH: thread_state.unpack_row_length = param; break;
+        case GL_UNPACK_IMAGE_HEIGHT: thread_state.unpack_image_height = param; break;
+    }
+}
+
+void trace_bind_buffer(GLenum target, GLuint buffer) {
+    if (target == GL_PIXEL_UNPACK_BUFFER) {
+        thread_state.unpack_buffer = buffer;
+    }
+}
+
+bool trace_unpack_bound() {
+    return thread_state.unpack_buffer != 0;
+}
+
+void trace_map(GLenum target, void * ptr, GLsizeiptr length, GLbitfield access) {
+    if (!ptr || thread_state.num_mappings == TRACE_MAX_MAPPINGS) {
+        return;
+    }
+
+    TraceMapping & mapping = thread_state.mappings[thread_state.num_mappings++];
+    mapping.target = target;
+    mapping.ptr = ptr;
+    mapping.length = (size_t)length;
+    mapping.write = (access & GL_MAP_WRITE_BIT) != 0;
+}
+
+void trace_unmap(GLenum target) {
+    for (int i = 0; i < thread_state.num_mappings; ++i) {
+        if (thread_state.mappings[i].target == target) {
+            thread_state.mappings[i] = thread_state.mappings[--thread_state.num_mappings];
+            return;
+        }
+    }
+}
+
+size_t trace_buffer_size(GLenum target) {
+    GLint64 size = 0;
+    gl.GetBufferParameteri64v(target, GL_BUFFER_SIZE, &size);
+    return (size_t)size;
+}
+
+const void * trace_mapped(GLenum target, size_t * length) {
+    for (int i = 0; i < thread_state.num_mappings; ++i) {
+        const TraceMapping & mapping = thread_state.mappings[i];
+        if (mapping.target == target && mapping.write) {
+            *length = mapping.length;
+            return mapping.ptr;
+        }
+    }
+    return 0;
+}
+
+size_t trace_pixel_size(GLenum format, GLenum type) {
+    size_t components = 4;
+
+    switch (format) {
+        case GL_RED: case GL_GREEN: case GL_BLUE: case GL_RED_INTEGER: case GL_GREEN_INTEGER: case GL_BLUE_INTEGER:
+        case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: case GL_DEPTH_STENCIL:
+            components = 1;
+            break;
+        case GL_RG: case GL_RG_INTEGER:
+            components = 2;
+            break;
+        case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+            components = 3;
+            break;
+    }
+
+    switch (type) {
+        case GL_UNSIGNED_BYTE: case GL_BYTE:
+            return components;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+            return components * 2;
+        case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+            return components * 4;
+        case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+            return 1;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV: case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_4_4_4_4_REV: case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+            return 2;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+            return 8;
+        default:
+            // The packed 32 bit types
+            return 4;
+    }
+}
+
+size_t trace_image_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type) {
+    if (width <= 0 || height <= 0 || depth <= 0) {
+        return 0;
+    }
+
+    size_t pixel = trace_pixel_size(format, type);
+    size_t row_pixels = thread_state.unpack_row_length > 0 ? thread_state.unpack_row_length : width;
+    size_t image_rows = thread_state.unpack_image_height > 0 ? thread_state.unpack_image_height : height;
+    size_t alignment = thread_state.unpack_alignment > 0 ? thread_state.unpack_alignment : 1;
+    size_t row = (row_pixels * pixel + alignment - 1) / alignment * alignment;
+
+    // The last row is not padded
+    return row * (image_rows * (depth - 1) + height - 1) + width * pixel;
+}
+
+size_t trace_parameter_count(GLenum pname) {
+    switch (pname) {
+        case GL_TEXTURE_BORDER_COLOR: case GL_TEXTURE_SWIZZLE_RGBA:
+            return 4;
+        default:
+            return 1;
+    }
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "gl_methods.hpp"
+
+/*
+    Trace file layout, every integer is little endian:
+
+        "GLTRACE1"                      magic
+        uint32 version, uint32 size     followed by the JSON metadata of `size` bytes
+        chunks                          uint32 thread, uint32 size, followed by `size` bytes
+
+    The chunks of a thread concatenate into a stream of records:
+
+        uint32 call, uint32 size        call index in the metadata or TRACE_MARK, size of the record
+        uint64 start, uint64 duration   nanoseconds on a monotonic clock
+        uint64 args[]                   integers widened to 64 bits, floats stored as doubles
+        uint64 result                   only if the function returns a value
+        payloads                        uint32 arg, uint32 kind, uint64 length, followed by
+                                        the bytes padded to 8 (TRACE_DATA), a uint64 hash (TRACE_HASH)
+                                        or nothing (TRACE_SIZE)
+*/
+
+#define TRACE_MAGIC "GLTRACE1"
+#define TRACE_VERSION 1
+#define TRACE_MARK 0xFFFFFFFFu
+
+enum TracePayloadKind {
+    TRACE_DATA = 0,
+    TRACE_HASH = 1,
+    TRACE_SIZE = 2,
+};
+
+// How the buffer and texture contents are recorded, the strings and small arrays are always stored
+enum TracePayloadMode {
+    TRACE_PAYLOAD_NONE = 0,
+    TRACE_PAYLOAD_HASH = 1,
+    TRACE_PAYLOAD_BLOB = 2,
+};
+
+struct TraceRecordHeader {
+    uint32_t call;
+    uint32_t size;
+    uint64_t start;
+    uint64_t duration;
+};
+
+struct TracePayloadHeader {
+    uint32_t arg;
+    uint32_t kind;
+    uint64_t length;
+};
+
+// The original functions, called by the wrappers
+extern GLMethods gl;
+
+// The wrappers, generated by generate.py
+extern const GLMethods traces;
+extern const char * const trace_names[];
+extern const char * const trace_metadata[];
+
+extern std::atomic<bool> trace_recording;
+extern int trace_payload_mode;
+
+bool trace_start(const char * path, int payload_mode, size_t capacity);
+void trace_stop();
+void trace_flush();
+void trace_stats(unsigned long long * records, unsigned long long * bytes, unsigned long long * stalls);
+
+uint64_t trace_clock();
+uint64_t trace_hash(const void * data, size_t size);
+void trace_push(const char * data, size_t size);
+
+// Unpack state and mapped ranges, tracked while the wrappers are installed
+void trace_pixel_store(GLenum pname, GLint param);
+void trace_bind_buffer(GLenum target, GLuint buffer);
+void trace_map(GLenum target, void * ptr, GLsizeiptr length, GLbitfield access);
+void trace_unmap(GLenum target);
+bool trace_unpack_bound();
+size_t trace_pixel_size(GLenum format, GLenum type);
+size_t trace_image_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type);
+size_t trace_parameter_count(GLenum pname);
+size_t trace_buffer_size(GLenum target);
+const void * trace_mapped(GLenum target, size_t * length);
+
+std::vector<char> & trace_scratch();
+
+// A record is assembled in a thread local buffer and pushed to the ring of the thread at once
+struct TraceRecord {
+    std::vector<char> & buf;
+
+    TraceRecord(uint32_t call) : buf(trace_scratch()) {
+        TraceRecordHeader header = {call, 0, 0, 0};
+        buf.clear();
+        buf.insert(buf.end(), (const char *)&header, (const char *)&header + sizeof(header));
+    }
+
+    TraceRecordHeader * header() {
+        return (TraceRecordHeader *)buf.data();
+    }
+
+    void begin() {
+        header()->start = trace_clock();
+    }
+
+    void end() {
+        header()->duration = trace_clock() - header()->start;
+    }
+
+    void slot(uint64_t value) {
+        buf.insert(buf.end(), (const char *)&value, (const char *)&value + sizeof(value));
+    }
+
+    void argi(int64_t value) {
+        slot((uint64_t)value);
+    }
+
+    void argu(uint64_t value) {
+        slot(value);
+    }
+
+    void argf(double value) {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        slot(bits);
+    }
+
+    void argp(const void * value) {
+        slot((uint64_t)(uintptr_t)value);
+    }
+
+    size_t reserve() {
+        slot(0);
+        return buf.size() - sizeof(uint64_t);
+    }
+
+    void patch(size_t offset, uint64_t value) {
+        memcpy(buf.data() + offset, &value, sizeof(value));
+    }
+
+    void payload(uint32_t arg, uint32_t kind, const void * data, size_t length) {
+        TracePayloadHeader header = {arg, kind, length};
+        buf.insert(buf.end(), (const char *)&header, (const char *)&header + sizeof(header));
+
+        if (kind == TRACE_DATA) {
+            buf.insert(buf.end(), (const char *)data, (const char *)data + length);
+            buf.resize((buf.size() + 7) & ~(size_t)7);
+        } else if (kind == TRACE_HASH) {
+            slot(trace_hash(data, length));
+        }
+    }
+
+    // Strings and small arrays, always stored
+    void data(uint32_t arg, const void * ptr, size_t length) {
+        if (ptr) {
+            payload(arg, TRACE_DATA, ptr, length);
+        }
+    }
+
+    void string(uint32_t arg, const GLchar * str, GLsizei length) {
+        if (str) {
+            payload(arg, TRACE_DATA, str, length < 0 ? strlen(str) : (size_t)length);
+        }
+    }
+
+    // The strings are separated by zeros
+    void strings(uint32_t arg, GLsizei count, const GLchar * const * strs, const GLint * lengths) {
+        if (!strs) {
+            return;
+        }
+        std::vector<char> joined;
+        for (GLsizei i = 0; i < count; ++i) {
+            size_t length = (!lengths || lengths[i] < 0) ? strlen(strs[i]) : (size_t)lengths[i];
+            joined.insert(joined.end(), strs[i], strs[i] + length);
+            joined.push_back(0);
+        }
+        payload(arg, TRACE_DATA, joined.data(), joined.size());
+    }
+
+    // Buffer and texture contents, stored according to the payload mode
+    void bulk(uint32_t arg, const void * ptr, size_t length) {
+        if (!ptr) {
+            return;
+        }
+        switch (trace_payload_mode) {
+            case TRACE_PAYLOAD_BLOB: payload(arg, TRACE_DATA, ptr, length); break;
+            case TRACE_PAYLOAD_HASH: payload(arg, TRACE_HASH, ptr, length); break;
+            default: payload(arg, TRACE_SIZE, 0, length); break;
+        }
+    }
+
+    // The pixels are an offset while a pixel unpack buffer is bound
+    void pixels(uint32_t arg, const void * ptr, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type) {
+        if (!trace_unpack_bound()) {
+            bulk(arg, ptr, trace_image_size(width, height, depth, format, type));
+        }
+    }
+
+    void compressed(uint32_t arg, const void * ptr, GLsizei size) {
+        if (!trace_unpack_bound()) {
+            bulk(arg, ptr, size);
+        }
+    }
+
+    // The bytes written through the mapping, captured before unmapping
+    void mapped(uint32_t arg, GLenum target) {
+        size_t length = 0;
+        const void * ptr = trace_mapped(target, &length);
+        bulk(arg, ptr, length);
+    }
+
+    void commit() {
+        header()->size = (uint32_t)buf.size();
+        trace_push(buf.data(), buf.size());
+    }
+};
@@ -0,0 +1,123 @@
+'''
+    Replays a trace file on a new standalone context and reports the time spent in each function.
+
+    python replay.py capture.gltrace [--timing] [--backend egl] [--require 330]
+
+    The calls run from C++ without returning to Python. The object names are remapped,
+    the buffer and texture contents recorded with payloads='blob' are uploaded again,
+    the hashed or omitted contents are replaced with zeros.
+'''
+
+import argparse
+import json
+
+import gltraces
+import moderngl
+from tracefile import read_metadata
+
+# The histogram column spans the buckets from the fastest to the slowest call
+SHADES = ' .:-=+*#%@'
+
+
+def remap(functions):
+    '''
+        The local index of every recorded function, -1 when the signature differs.
+    '''
+
+    local = {
+        name: (index, ret, [code for _, code in params])
+        for index, (name, ret, params) in enumerate(json.loads(gltraces.metadata)['functions'])
+    }
+
+    result = []
+    for name, ret, params in functions:
+        index, local_ret, local_codes = local.get(name, (-1, None, None))
+        if local_ret != ret or local_codes != [code for _, code in params]:
+            index = -1
+        result.append(index)
+
+    return result
+
+
+def replay(ctx, path, timing=False) -> dict:
+    '''
+        Replays the trace file on the context.
+
+        Args:
+            ctx (Context): The context to replay on, it must be current.
+            path (str): The trace file.
+
+        Keyword Args:
+            timing (bool): Wait for the recorded start of each call.
+
+        Returns:
+            dict: The duration of the replay and the statistics of every function.
+    '''
+
+    functions, _ = read_metadata(path)
+    return gltraces.replay(ctx.mglo.glprocs(), path, remap(functions), timing=timing)
+
+
+def histogram(buckets):
+    used = [i for i, count in enumerate(buckets) if count]
+    if not used:
+        return ''
+    peak = max(buckets)
+    return '%s|%s|' % (
+        format_ns(2 ** used[0]),
+        ''.join(SHADES[(buckets[i] * (len(SHADES) - 1) + peak - 1) // peak] for i in range(used[0], used[-1] + 1)),
+    )
+
+
+def format_ns(ns):
+    for unit, scale in (('s', 1e9), ('ms', 1e6), ('us', 1e3)):
+        if ns >= scale:
+            return '%.3g%s' % (ns / scale, unit)
+    return '%dns' % ns
+
+
+def report(result, top=None):
+    functions = sorted(result['functions'].items(), key=lambda item: item[1]['total'], reverse=True)
+
+    print('%-36s %9s %12s %10s %10s %10s  %s' % ('function', 'calls', 'total', 'mean', 'min', 'max', 'histogram (log2)'))
+
+    for name, stat in functions[:top]:
+        if not stat['count']:
+            continue
+        print('%-36s %9d %12s %10s %10s %10s  %s' % (
+            name,
+            stat['count'],
+            format_ns(stat['total']),
+            format_ns(stat['total'] // stat['count']),
+            format_ns(stat['min']),
+            format_ns(stat['max']),
+            histogram(stat['histogram']),
+        ))
+
+    calls = sum(stat['count'] for stat in result['functions'].values())
+    total = sum(stat['total'] for stat in result['functions'].values())
+    print()
+    print('%d calls in %s, %s spent in the calls' % (calls, format_ns(result['duration']), format_ns(total)))
+
+    skipped = {name: stat['skipped'] for name, stat in result['functions'].items() if stat['skipped']}
+    if skipped:
+        print('not replayed: %s' % ', '.join('%s (%d)' % item for item in sorted(skipped.items())))
+
+
+def main():
+    parser = argparse.ArgumentParser(prog='replay', description='Replays a trace file recorded by gltraces.')
+    parser.add_argument('trace', help='the trace file')
+    parser.add_argument('--timing', action='store_true', help='keep the recorded time between the calls')
+    parser.add_argument('--require', type=int, default=330, help='the OpenGL version of the context')
+    parser.add_argument('--backend', help='the glcontext backend, egl for llvmpipe without a display')
+    parser.add_argument('--top', type=int, help='only report the most expensive functions')
+    args = parser.parse_args()
+
+    settings = {'backend': args.backend} if args.backend else {}
+    ctx = moderngl.create_standalone_context(require=args.require, **settings)
+
+    report(replay(ctx, args.trace, timing=args.timing), args.top)
+
+
+if __name__ == '__main__':
+    main()
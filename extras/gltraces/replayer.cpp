@@ -0,0 +1,317 @@
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <thread>
+
+#include "replayer.hpp"
+
+#define REPLAY_MIN_SCRATCH 65536
+
+int TraceReplay::label_namespace(GLenum identifier) {
+    switch (identifier) {
+        case GL_BUFFER: return REPLAY_BUFFER;
+        case GL_TEXTURE: return REPLAY_TEXTURE;
+        case GL_SHADER: case GL_PROGRAM: return REPLAY_PROGRAM;
+        case GL_FRAMEBUFFER: return REPLAY_FRAMEBUFFER;
+        case GL_RENDERBUFFER: return REPLAY_RENDERBUFFER;
+        case GL_VERTEX_ARRAY: return REPLAY_VERTEX_ARRAY;
+        case GL_SAMPLER: return REPLAY_SAMPLER;
+        case GL_QUERY: return REPLAY_QUERY;
+        case GL_TRANSFORM_FEEDBACK: return REPLAY_TRANSFORM_FEEDBACK;
+        case GL_PROGRAM_PIPELINE: return REPLAY_PIPELINE;
+        default: return REPLAY_NAMESPACES;
+    }
+}
+
+const void * TraceReplay::input(int arg, uint64_t recorded) {
+    const TracePayloadHeader * payload = payloads[arg];
+
+    if (!payload) {
+        return (const void *)(uintptr_t)recorded;
+    }
+
+    if (payload->kind == TRACE_DATA) {
+        return payload + 1;
+    }
+
+    if (zeros.size() < payload->length) {
+        zeros.resize(payload->length);
+    }
+    return zeros.data();
+}
+
+// The stored strings are not terminated
+const GLchar * TraceReplay::text(int arg, uint64_t recorded) {
+    const TracePayloadHeader * payload = payloads[arg];
+
+    if (!payload || payload->kind != TRACE_DATA) {
+        return recorded ? "" : 0;
+    }
+
+    std::vector<char> & buf = texts[arg];
+    buf.assign((const char *)(payload + 1), (const char *)(payload + 1) + payload->length);
+    buf.push_back(0);
+    return buf.data();
+}
+
+// The strings are stored separated by zeros
+const GLchar * const * TraceReplay::strings(int arg, GLsizei count) {
+    const TracePayloadHeader * payload = payloads[arg];
+
+    if (!payload || payload->kind != TRACE_DATA) {
+        return 0;
+    }
+
+    string_list.clear();
+    const char * ptr = (const char *)(payload + 1);
+    const char * end = ptr + payload->length;
+
+    for (GLsizei i = 0; i < count && ptr < end; ++i) {
+        string_list.push_back(ptr);
+        ptr += strlen(ptr) + 1;
+    }
+
+    while ((GLsizei)string_list.size() < count) {
+        string_list.push_back("");
+    }
+
+    return string_list.data();
+}
+
+void * TraceReplay::output(size_t size) {
+    if (size < REPLAY_MIN_SCRATCH) {
+        size = REPLAY_MIN_SCRATCH;
+    }
+    if (scratch.size() < size) {
+        scratch.resize(size);
+    }
+    return scratch.data();
+}
+
+// The pixels go to the pixel pack buffer at the recorded offset when one is bound
+void * TraceReplay::pack(uint64_t recorded, size_t size) {
+    if (pack_bound) {
+        return (void *)(uintptr_t)recorded;
+    }
+    return output(size);
+}
+
+size_t TraceReplay::texture_size(GLenum target, GLint level) {
+    GLint width = 0, height = 0, depth = 0;
+    gl.GetTexLevelParameteriv(target, level, GL_TEXTURE_WIDTH, &width);
+    gl.GetTexLevelParameteriv(target, level, GL_TEXTURE_HEIGHT, &height);
+    gl.GetTexLevelParameteriv(target, level, GL_TEXTURE_DEPTH, &depth);
+
+    // Large enough for four doubles per pixel and the row alignment
+    return (size_t)(width * 32 + 8) * (height > 0 ? height : 1) * (depth > 0 ? depth : 1);
+}
+
+size_t TraceReplay::compressed_size(GLenum target, GLint level) {
+    GLint size = 0;
+    gl.GetTexLevelParameteriv(target, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+    return (size_t)size;
+}
+
+// The bytes written through the mapping are recorded when unmapping
+void TraceReplay::unmap(GLenum target, int arg) {
+    std::unordered_map<GLenum, void *>::iterator it = mappings.find(target);
+    if (it == mappings.end()) {
+        return;
+    }
+
+    const TracePayloadHeader * payload = payloads[arg];
+    if (it->second && payload && payload->kind == TRACE_DATA) {
+        memcpy(it->second, payload + 1, payload->length);
+    }
+
+    mappings.erase(it);
+}
+
+struct TraceStream {
+    std::vector<char> data;
+    size_t offset;
+
+    const TraceRecordHeader * peek() const {
+        return offset + sizeof(TraceRecordHeader) <= data.size() ? (const TraceRecordHeader *)(data.data() + offset) : 0;
+    }
+};
+
+static bool load_streams(const char * path, std::vector<TraceStream> & streams, std::string & error) {
+    FILE * file = fopen(path, "rb");
+    if (!file) {
+        error = std::string("cannot open ") + path;
+        return false;
+    }
+
+    char magic[8];
+    uint32_t header[2];
+
+    if (fread(magic, 1, 8, file) != 8 || memcmp(magic, TRACE_MAGIC, 8) || fread(header, sizeof(header), 1, file) != 1) {
+        fclose(file);
+        error = std::string(path) + " is not a trace file";
+        return false;
+    }
+
+    if (header[0] != TRACE_VERSION) {
+        fclose(file);
+        error = "unsupported trace version";
+        return false;
+    }
+
+    fseek(file, header[1], SEEK_CUR);
+
+    std::map<uint32_t, size_t> threads;
+    uint32_t chunk[2];
+
+    while (fread(chunk, sizeof(chunk), 1, file) == 1) {
+        std::map<uint32_t, size_t>::iterator it = threads.find(chunk[0]);
+        if (it == threads.end()) {
+            it = threads.insert(std::make_pair(chunk[0], streams.size())).first;
+            streams.push_back(TraceStream());
+            streams.back().offset = 0;
+        }
+
+        std::vector<char> & data = streams[it->second].data;
+        size_t size = data.size();
+        data.resize(size + chunk[1]);
+
+        if (fread(data.data() + size, 1, chunk[1], file) != chunk[1]) {
+            data.resize(size);
+            break;
+        }
+    }
+
+    fclose(file);
+    return true;
+}
+
+static void wait_until(uint64_t target) {
+    for (;;) {
+        uint64_t now = trace_clock();
+        if (now >= target) {
+            return;
+        }
+        // Sleeping is too coarse for the last milliseconds
+        if (target - now > 2000000) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(target - now - 2000000));
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+static int bucket(uint64_t duration) {
+    int index = 0;
+    while (duration > 1 && index < REPLAY_BUCKETS - 1) {
+        duration >>= 1;
+        index += 1;
+    }
+    return index;
+}
+
+bool trace_replay(const GLMethods & procs, const char * path, const std::vector<int> & remap, bool timing,
+                  std::vector<TraceReplayStats> & stats, unsigned long long * duration, std::string & error) {
+    std::vector<TraceStream> streams;
+
+    if (!load_streams(path, streams, error)) {
+        return false;
+    }
+
+    TraceReplay * r = new TraceReplay();
+    r->gl = procs;
+    r->pack_bound = false;
+    r->unpack_bound = false;
+
+    uint64_t args[REPLAY_MAX_ARGS + 1];
+    uint64_t origin = 0;
+    bool first = true;
+    uint64_t replay_start = trace_clock();
+
+    for (;;) {
+        // The records of the threads are replayed in the order they started
+        TraceStream * stream = 0;
+        for (size_t i = 0; i < streams.size(); ++i) {
+            const TraceRecordHeader * header = streams[i].peek();
+            if (header && (!stream || header->start < stream->peek()->start)) {
+                stream = &streams[i];
+            }
+        }
+
+        if (!stream) {
+            break;
+        }
+
+        const TraceRecordHeader * header = stream->peek();
+        const char * ptr = (const char *)(header + 1);
+        const char * end = (const char *)header + header->size;
+        stream->offset += header->size;
+
+        if (header->size < sizeof(TraceRecordHeader) || end > stream->data.data() + stream->data.size()) {
+            error = "corrupt trace record";
+            delete r;
+            return false;
+        }
+
+        if (first) {
+            origin = header->start;
+            first = false;
+        }
+
+        if (header->call == TRACE_MARK || header->call >= remap.size() || remap[header->call] < 0) {
+            continue;
+        }
+
+        uint32_t call = (uint32_t)remap[header->call];
+        int num_args = trace_arg_counts[call];
+        int num_slots = num_args + trace_returns[call];
+
+        memcpy(args, ptr, num_slots * sizeof(uint64_t));
+        ptr += num_slots * sizeof(uint64_t);
+
+        memset(r->payloads, 0, sizeof(r->payloads));
+        while (ptr < end) {
+            const TracePayloadHeader * payload = (const TracePayloadHeader *)ptr;
+            if (payload->arg <= REPLAY_MAX_ARGS) {
+                r->payloads[payload->arg] = payload;
+            }
+            ptr += sizeof(TracePayloadHeader);
+            if (payload->kind == TRACE_DATA) {
+                ptr += (payload->length + 7) & ~(uint64_t)7;
+            } else if (payload->kind == TRACE_HASH) {
+                ptr += sizeof(uint64_t);
+            }
+        }
+
+        if (timing) {
+            wait_until(replay_start + (header->start - origin));
+        }
+
+        uint64_t start = trace_clock();
+        bool replayed = trace_replay_call(*r, call, args);
+        uint64_t elapsed = trace_clock() - start;
+
+        TraceReplayStats & stat = stats[call];
+
+        if (!replayed) {
+            stat.skipped += 1;
+            continue;
+        }
+
+        if (!stat.count || elapsed < stat.min) {
+            stat.min = elapsed;
+        }
+        if (elapsed > stat.max) {
+            stat.max = elapsed;
+        }
+        stat.count += 1;
+        stat.total += elapsed;
+        stat.histogram[bucket(elapsed)] += 1;
+    }
+
+    // The queued commands are part of the replay
+    r->gl.Finish();
+    *duration = trace_clock() - replay_start;
+
+    delete r;
+    return true;
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "recorder.hpp"
+
+#define REPLAY_MAX_ARGS 16
+#define REPLAY_BUCKETS 40
+
+// The object names are remapped separately for each namespace
+enum TraceReplayNamespace {
+    REPLAY_BUFFER,
+    REPLAY_TEXTURE,
+    REPLAY_PROGRAM,
+    REPLAY_FRAMEBUFFER,
+    REPLAY_RENDERBUFFER,
+    REPLAY_VERTEX_ARRAY,
+    REPLAY_SAMPLER,
+    REPLAY_QUERY,
+    REPLAY_TRANSFORM_FEEDBACK,
+    REPLAY_PIPELINE,
+    REPLAY_NAMESPACES,
+};
+
+// The time spent in a function, histogram[i] counts the calls of [2^i, 2^(i+1)) nanoseconds
+struct TraceReplayStats {
+    unsigned long long count;
+    unsigned long long total;
+    unsigned long long min;
+    unsigned long long max;
+    unsigned long long skipped;
+    unsigned long long histogram[REPLAY_BUCKETS];
+};
+
+struct TraceReplay {
+    GLMethods gl;
+
+    std::unordered_map<uint64_t, GLuint> names[REPLAY_NAMESPACES];
+    std::unordered_map<uint64_t, GLsync> syncs;
+    std::unordered_map<GLenum, void *> mappings;
+
+    // The payloads of the current record by argument, null when not recorded
+    const TracePayloadHeader * payloads[REPLAY_MAX_ARGS + 1];
+
+    std::vector<char> scratch;
+    std::vector<char> zeros;
+    std::vector<char> texts[REPLAY_MAX_ARGS + 1];
+    std::vector<const GLchar *> string_list;
+    std::vector<GLuint> name_list;
+
+    bool pack_bound;
+    bool unpack_bound;
+
+    double real(uint64_t bits) {
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    GLuint name(int ns, uint64_t recorded) {
+        if (ns >= REPLAY_NAMESPACES || !recorded) {
+            return (GLuint)recorded;
+        }
+        std::unordered_map<uint64_t, GLuint>::iterator it = names[ns].find(recorded);
+        return it != names[ns].end() ? it->second : (GLuint)recorded;
+    }
+
+    GLsync sync(uint64_t recorded) {
+        std::unordered_map<uint64_t, GLsync>::iterator it = syncs.find(recorded);
+        return it != syncs.end() ? it->second : 0;
+    }
+
+    void created(int ns, uint64_t recorded, GLuint name) {
+        names[ns][recorded] = name;
+    }
+
+    void created_sync(uint64_t recorded, GLsync sync) {
+        syncs[recorded] = sync;
+    }
+
+    // The names generated by the Gen* and Create* functions, recorded as the payload of the argument
+    void created(int ns, int arg, GLsizei n, const GLuint * created_names) {
+        const TracePayloadHeader * payload = payloads[arg];
+        if (!payload || payload->kind != TRACE_DATA || payload->length < n * sizeof(GLuint)) {
+            return;
+        }
+        const GLuint * recorded = (const GLuint *)(payload + 1);
+        for (GLsizei i = 0; i < n; ++i) {
+            names[ns][recorded[i]] = created_names[i];
+        }
+    }
+
+    const GLuint * names_of(int ns, int arg, GLsizei n);
+
+    int label_namespace(GLenum identifier);
+
+    // The recorded bytes, zeros when only the hash or the size was recorded and the offset without a payload
+    const void * input(int arg, uint64_t recorded);
+    const GLchar * text(int arg, uint64_t recorded);
+    const GLchar * const * strings(int arg, GLsizei count);
+
+    void * output(size_t size);
+    void * pack(uint64_t recorded, size_t size);
+
+    size_t texture_size(GLenum target, GLint level);
+    size_t compressed_size(GLenum target, GLint level);
+
+    void bind_buffer(GLenum target, uint64_t recorded) {
+        if (target == GL_PIXEL_PACK_BUFFER) {
+            pack_bound = recorded != 0;
+        } else if (target == GL_PIXEL_UNPACK_BUFFER) {
+            unpack_bound = recorded != 0;
+        }
+    }
+
+    void map(GLenum target, void * ptr) {
+        mappings[target] = ptr;
+    }
+
+    void unmap(GLenum target, int arg);
+};
+
+inline const GLuint * TraceReplay::names_of(int ns, int arg, GLsizei n) {
+    const TracePayloadHeader * payload = payloads[arg];
+    if (!payload || payload->kind != TRACE_DATA) {
+        return 0;
+    }
+    const GLuint * recorded = (const GLuint *)(payload + 1);
+    name_list.resize(n);
+    for (GLsizei i = 0; i < n; ++i) {
+        name_list[i] = name(ns, recorded[i]);
+    }
+    return name_list.data();
+}
+
+// The tables generated with the replays
+extern const unsigned char trace_arg_counts[];
+extern const unsigned char trace_returns[];
+
+bool trace_replay_call(TraceReplay & r, uint32_t call, const uint64_t * a);
+
+// The calls are indexed with the local function table, remap converts the recorded call indexes
+bool trace_replay(const GLMethods & procs, const char * path, const std::vector<int> & remap, bool timing,
+                  std::vector<TraceReplayStats> & stats, unsigned long long * duration, std::string & error);
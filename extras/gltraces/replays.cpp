@@ -0,0 +1,5689 @@
+// Generated by generate.py from moderngl/src/gl_methods.hpp, do not edit.
+
+#include "replayer.hpp"
+
+const unsigned char trace_arg_counts[] = {
+    1,
+    1,
+    2,
+    1,
+    1,
+    2,
+    4,
+    3,
+    3,
+    3,
+    3,
+    8,
+    9,
+    1,
+    1,
+    4,
+    1,
+    1,
+    1,
+    4,
+    1,
+    1,
+    1,
+    0,
+    0,
+    2,
+    1,
+    3,
+    3,
+    1,
+    2,
+    2,
+    1,
+    7,
+    2,
+    2,
+    0,
+    2,
+    2,
+    1,
+    5,
+    3,
+    3,
+    4,
+    4,
+    1,
+    2,
+    4,
+    3,
+    4,
+    2,
+    2,
+    7,
+    8,
+    6,
+    8,
+    7,
+    9,
+    2,
+    2,
+    2,
+    1,
+    6,
+    10,
+    11,
+    9,
+    1,
+    2,
+    9,
+    8,
+    7,
+    11,
+    9,
+    7,
+    3,
+    4,
+    4,
+    5,
+    2,
+    2,
+    2,
+    2,
+    4,
+    1,
+    2,
+    2,
+    1,
+    2,
+    1,
+    3,
+    3,
+    3,
+    2,
+    2,
+    2,
+    1,
+    4,
+    4,
+    4,
+    2,
+    1,
+    3,
+    3,
+    2,
+    2,
+    4,
+    4,
+    2,
+    2,
+    3,
+    1,
+    0,
+    1,
+    1,
+    1,
+    2,
+    1,
+    1,
+    7,
+    7,
+    4,
+    2,
+    3,
+    4,
+    3,
+    4,
+    4,
+    2,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    1,
+    1,
+    1,
+    4,
+    1,
+    2,
+    3,
+    4,
+    5,
+    2,
+    3,
+    4,
+    5,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    4,
+    4,
+    4,
+    1,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    3,
+    2,
+    3,
+    2,
+    3,
+    2,
+    4,
+    2,
+    4,
+    2,
+    4,
+    2,
+    2,
+    2,
+    2,
+    5,
+    2,
+    2,
+    2,
+    2,
+    5,
+    2,
+    5,
+    2,
+    2,
+    5,
+    2,
+    2,
+    2,
+    2,
+    6,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    5,
+    3,
+    3,
+    2,
+    2,
+    2,
+    1,
+    0,
+    5,
+    3,
+    4,
+    7,
+    2,
+    2,
+    0,
+    5,
+    3,
+    3,
+    2,
+    3,
+    4,
+    5,
+    2,
+    3,
+    4,
+    5,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    3,
+    3,
+    2,
+    2,
+    3,
+    4,
+    5,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    4,
+    2,
+    1,
+    2,
+    2,
+    2,
+    4,
+    3,
+    1,
+    2,
+    2,
+    2,
+    1,
+    5,
+    5,
+    6,
+    4,
+    4,
+    1,
+    10,
+    5,
+    5,
+    4,
+    3,
+    1,
+    2,
+    2,
+    1,
+    4,
+    5,
+    3,
+    1,
+    5,
+    4,
+    5,
+    5,
+    2,
+    4,
+    5,
+    3,
+    5,
+    7,
+    6,
+    6,
+    1,
+    2,
+    1,
+    1,
+    3,
+    3,
+    2,
+    5,
+    3,
+    3,
+    4,
+    6,
+    7,
+    3,
+    2,
+    4,
+    2,
+    2,
+    2,
+    1,
+    2,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    2,
+    3,
+    3,
+    2,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    1,
+    2,
+    3,
+    3,
+    5,
+    2,
+    3,
+    2,
+    3,
+    4,
+    5,
+    3,
+    3,
+    3,
+    3,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    3,
+    3,
+    3,
+    5,
+    6,
+    6,
+    3,
+    3,
+    4,
+    2,
+    2,
+    2,
+    2,
+    2,
+    1,
+    0,
+    0,
+    2,
+    3,
+    3,
+    2,
+    4,
+    0,
+    5,
+    4,
+    2,
+    1,
+    5,
+    4,
+    3,
+    3,
+    2,
+    3,
+    1,
+    2,
+    2,
+    1,
+    3,
+    3,
+    4,
+    3,
+    4,
+    3,
+    4,
+    3,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    4,
+    5,
+    4,
+    5,
+    4,
+    5,
+    4,
+    5,
+    4,
+    6,
+    4,
+    6,
+    4,
+    6,
+    4,
+    6,
+    4,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    5,
+    1,
+    4,
+    2,
+    3,
+    4,
+    5,
+    2,
+    2,
+    2,
+    2,
+    5,
+    3,
+    3,
+    5,
+    2,
+    3,
+    5,
+    2,
+    3,
+    3,
+    3,
+    3,
+    5,
+    6,
+    7,
+    5,
+    4,
+    7,
+    1,
+    4,
+    5,
+    6,
+    3,
+    4,
+    5,
+    7,
+    3,
+    1,
+    15,
+    3,
+    3,
+    5,
+    8,
+    2,
+    3,
+    1,
+    3,
+    7,
+    4,
+    5,
+    4,
+    3,
+    6,
+    8,
+    3,
+    3,
+    3,
+    5,
+    6,
+    7,
+    8,
+    4,
+    5,
+    4,
+    4,
+    2,
+    2,
+    6,
+    6,
+    2,
+    8,
+    4,
+    0,
+    4,
+    5,
+    3,
+    4,
+    4,
+    5,
+    11,
+    4,
+    6,
+    3,
+    3,
+    3,
+    5,
+    2,
+    2,
+    3,
+    5,
+    3,
+    4,
+    4,
+    2,
+    4,
+    4,
+    4,
+    5,
+    5,
+    7,
+    2,
+    4,
+    1,
+    3,
+    3,
+    3,
+    3,
+    4,
+    2,
+    4,
+    3,
+    4,
+    5,
+    2,
+    3,
+    2,
+    3,
+    7,
+    4,
+    4,
+    4,
+    5,
+    12,
+    2,
+    3,
+    4,
+    2,
+    4,
+    5,
+    3,
+    3,
+    3,
+    5,
+    4,
+    5,
+    6,
+    6,
+    7,
+    7,
+    9,
+    11,
+    7,
+    9,
+    11,
+    6,
+    8,
+    9,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    1,
+    2,
+    6,
+    4,
+    4,
+    4,
+    3,
+    3,
+    3,
+    3,
+    2,
+    2,
+    2,
+    2,
+    5,
+    6,
+    3,
+    6,
+    5,
+    5,
+    3,
+    3,
+    4,
+    4,
+    2,
+    2,
+    3,
+    4,
+    4,
+    4,
+    4,
+    1,
+    12,
+    10,
+    0,
+    4,
+    6,
+    4,
+    4,
+    4,
+    4,
+    8,
+    0,
+    5,
+    5,
+    6,
+    3,
+};
+
+const unsigned char trace_returns[] = {
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+};
+
+bool trace_replay_call(TraceReplay & replay, uint32_t call, const uint64_t * slots) {
+    switch (call) {
+        case 0: {
+            GLenum mode = (GLenum)slots[0];
+            replay.gl.CullFace(mode);
+            return true;
+        }
+        case 1: {
+            GLenum mode = (GLenum)slots[0];
+            replay.gl.FrontFace(mode);
+            return true;
+        }
+        case 2: {
+            GLenum target = (GLenum)slots[0];
+            GLenum mode = (GLenum)slots[1];
+            replay.gl.Hint(target, mode);
+            return true;
+        }
+        case 3: {
+            GLfloat width = (GLfloat)replay.real(slots[0]);
+            replay.gl.LineWidth(width);
+            return true;
+        }
+        case 4: {
+            GLfloat size = (GLfloat)replay.real(slots[0]);
+            replay.gl.PointSize(size);
+            return true;
+        }
+        case 5: {
+            GLenum face = (GLenum)slots[0];
+            GLenum mode = (GLenum)slots[1];
+            replay.gl.PolygonMode(face, mode);
+            return true;
+        }
+        case 6: {
+            GLint x = (GLint)slots[0];
+            GLint y = (GLint)slots[1];
+            GLsizei width = (GLsizei)slots[2];
+            GLsizei height = (GLsizei)slots[3];
+            replay.gl.Scissor(x, y, width, height);
+            return true;
+        }
+        case 7: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            GLfloat param = (GLfloat)replay.real(slots[2]);
+            replay.gl.TexParameterf(target, pname, param);
+            return true;
+        }
+        case 8: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.TexParameterfv(target, pname, (const GLfloat *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 9: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            GLint param = (GLint)slots[2];
+            replay.gl.TexParameteri(target, pname, param);
+            return true;
+        }
+        case 10: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.TexParameteriv(target, pname, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 11: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint internalformat = (GLint)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLint border = (GLint)slots[4];
+            GLenum format = (GLenum)slots[5];
+            GLenum type = (GLenum)slots[6];
+            replay.gl.TexImage1D(target, level, internalformat, width, border, format, type, (const void *)replay.input(7, slots[7]));
+            return true;
+        }
+        case 12: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint internalformat = (GLint)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLint border = (GLint)slots[5];
+            GLenum format = (GLenum)slots[6];
+            GLenum type = (GLenum)slots[7];
+            replay.gl.TexImage2D(target, level, internalformat, width, height, border, format, type, (const void *)replay.input(8, slots[8]));
+            return true;
+        }
+        case 13: {
+            GLenum buf = (GLenum)slots[0];
+            replay.gl.DrawBuffer(buf);
+            return true;
+        }
+        case 14: {
+            GLbitfield mask = (GLbitfield)slots[0];
+            replay.gl.Clear(mask);
+            return true;
+        }
+        case 15: {
+            GLfloat red = (GLfloat)replay.real(slots[0]);
+            GLfloat green = (GLfloat)replay.real(slots[1]);
+            GLfloat blue = (GLfloat)replay.real(slots[2]);
+            GLfloat alpha = (GLfloat)replay.real(slots[3]);
+            replay.gl.ClearColor(red, green, blue, alpha);
+            return true;
+        }
+        case 16: {
+            GLint s = (GLint)slots[0];
+            replay.gl.ClearStencil(s);
+            return true;
+        }
+        case 17: {
+            GLdouble depth = (GLdouble)replay.real(slots[0]);
+            replay.gl.ClearDepth(depth);
+            return true;
+        }
+        case 18: {
+            GLuint mask = (GLuint)slots[0];
+            replay.gl.StencilMask(mask);
+            return true;
+        }
+        case 19: {
+            GLboolean red = (GLboolean)slots[0];
+            GLboolean green = (GLboolean)slots[1];
+            GLboolean blue = (GLboolean)slots[2];
+            GLboolean alpha = (GLboolean)slots[3];
+            replay.gl.ColorMask(red, green, blue, alpha);
+            return true;
+        }
+        case 20: {
+            GLboolean flag = (GLboolean)slots[0];
+            replay.gl.DepthMask(flag);
+            return true;
+        }
+        case 21: {
+            GLenum cap = (GLenum)slots[0];
+            replay.gl.Disable(cap);
+            return true;
+        }
+        case 22: {
+            GLenum cap = (GLenum)slots[0];
+            replay.gl.Enable(cap);
+            return true;
+        }
+        case 23: {
+            replay.gl.Finish();
+            return true;
+        }
+        case 24: {
+            replay.gl.Flush();
+            return true;
+        }
+        case 25: {
+            GLenum sfactor = (GLenum)slots[0];
+            GLenum dfactor = (GLenum)slots[1];
+            replay.gl.BlendFunc(sfactor, dfactor);
+            return true;
+        }
+        case 26: {
+            GLenum opcode = (GLenum)slots[0];
+            replay.gl.LogicOp(opcode);
+            return true;
+        }
+        case 27: {
+            GLenum func = (GLenum)slots[0];
+            GLint ref = (GLint)slots[1];
+            GLuint mask = (GLuint)slots[2];
+            replay.gl.StencilFunc(func, ref, mask);
+            return true;
+        }
+        case 28: {
+            GLenum fail = (GLenum)slots[0];
+            GLenum zfail = (GLenum)slots[1];
+            GLenum zpass = (GLenum)slots[2];
+            replay.gl.StencilOp(fail, zfail, zpass);
+            return true;
+        }
+        case 29: {
+            GLenum func = (GLenum)slots[0];
+            replay.gl.DepthFunc(func);
+            return true;
+        }
+        case 30: {
+            GLenum pname = (GLenum)slots[0];
+            GLfloat param = (GLfloat)replay.real(slots[1]);
+            replay.gl.PixelStoref(pname, param);
+            return true;
+        }
+        case 31: {
+            GLenum pname = (GLenum)slots[0];
+            GLint param = (GLint)slots[1];
+            replay.gl.PixelStorei(pname, param);
+            return true;
+        }
+        case 32: {
+            GLenum src = (GLenum)slots[0];
+            replay.gl.ReadBuffer(src);
+            return true;
+        }
+        case 33: {
+            GLint x = (GLint)slots[0];
+            GLint y = (GLint)slots[1];
+            GLsizei width = (GLsizei)slots[2];
+            GLsizei height = (GLsizei)slots[3];
+            GLenum format = (GLenum)slots[4];
+            GLenum type = (GLenum)slots[5];
+            replay.gl.ReadPixels(x, y, width, height, format, type, (void *)replay.pack(slots[6], (size_t)width * height * 16 + (size_t)height * 8));
+            return true;
+        }
+        case 34: {
+            GLenum pname = (GLenum)slots[0];
+            replay.gl.GetBooleanv(pname, (GLboolean *)replay.output(0));
+            return true;
+        }
+        case 35: {
+            GLenum pname = (GLenum)slots[0];
+            replay.gl.GetDoublev(pname, (GLdouble *)replay.output(0));
+            return true;
+        }
+        case 36: {
+            replay.gl.GetError();
+            return true;
+        }
+        case 37: {
+            GLenum pname = (GLenum)slots[0];
+            replay.gl.GetFloatv(pname, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 38: {
+            GLenum pname = (GLenum)slots[0];
+            replay.gl.GetIntegerv(pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 39: {
+            GLenum name = (GLenum)slots[0];
+            replay.gl.GetString(name);
+            return true;
+        }
+        case 40: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLenum format = (GLenum)slots[2];
+            GLenum type = (GLenum)slots[3];
+            replay.gl.GetTexImage(target, level, format, type, (void *)replay.pack(slots[4], replay.texture_size(target, level)));
+            return true;
+        }
+        case 41: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetTexParameterfv(target, pname, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 42: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetTexParameteriv(target, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 43: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetTexLevelParameterfv(target, level, pname, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 44: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetTexLevelParameteriv(target, level, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 45: {
+            GLenum cap = (GLenum)slots[0];
+            replay.gl.IsEnabled(cap);
+            return true;
+        }
+        case 46: {
+            GLdouble n = (GLdouble)replay.real(slots[0]);
+            GLdouble f = (GLdouble)replay.real(slots[1]);
+            replay.gl.DepthRange(n, f);
+            return true;
+        }
+        case 47: {
+            GLint x = (GLint)slots[0];
+            GLint y = (GLint)slots[1];
+            GLsizei width = (GLsizei)slots[2];
+            GLsizei height = (GLsizei)slots[3];
+            replay.gl.Viewport(x, y, width, height);
+            return true;
+        }
+        case 48: {
+            GLenum mode = (GLenum)slots[0];
+            GLint first = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.DrawArrays(mode, first, count);
+            return true;
+        }
+        case 49: {
+            GLenum mode = (GLenum)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLenum type = (GLenum)slots[2];
+            replay.gl.DrawElements(mode, count, type, (const void *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 50: {
+            GLenum pname = (GLenum)slots[0];
+            replay.gl.GetPointerv(pname, (void **)replay.output(0));
+            return true;
+        }
+        case 51: {
+            GLfloat factor = (GLfloat)replay.real(slots[0]);
+            GLfloat units = (GLfloat)replay.real(slots[1]);
+            replay.gl.PolygonOffset(factor, units);
+            return true;
+        }
+        case 52: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLint x = (GLint)slots[3];
+            GLint y = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLint border = (GLint)slots[6];
+            replay.gl.CopyTexImage1D(target, level, internalformat, x, y, width, border);
+            return true;
+        }
+        case 53: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLint x = (GLint)slots[3];
+            GLint y = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            GLint border = (GLint)slots[7];
+            replay.gl.CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+            return true;
+        }
+        case 54: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint x = (GLint)slots[3];
+            GLint y = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            replay.gl.CopyTexSubImage1D(target, level, xoffset, x, y, width);
+            return true;
+        }
+        case 55: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint x = (GLint)slots[4];
+            GLint y = (GLint)slots[5];
+            GLsizei width = (GLsizei)slots[6];
+            GLsizei height = (GLsizei)slots[7];
+            replay.gl.CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+            return true;
+        }
+        case 56: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLenum format = (GLenum)slots[4];
+            GLenum type = (GLenum)slots[5];
+            replay.gl.TexSubImage1D(target, level, xoffset, width, format, type, (const void *)replay.input(6, slots[6]));
+            return true;
+        }
+        case 57: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLsizei width = (GLsizei)slots[4];
+            GLsizei height = (GLsizei)slots[5];
+            GLenum format = (GLenum)slots[6];
+            GLenum type = (GLenum)slots[7];
+            replay.gl.TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, (const void *)replay.input(8, slots[8]));
+            return true;
+        }
+        case 58: {
+            GLenum target = (GLenum)slots[0];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[1]);
+            replay.gl.BindTexture(target, texture);
+            return true;
+        }
+        case 59: {
+            GLsizei n = (GLsizei)slots[0];
+            replay.gl.DeleteTextures(n, replay.names_of(REPLAY_TEXTURE, 1, n));
+            return true;
+        }
+        case 60: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.GenTextures(n, created);
+            replay.created(REPLAY_TEXTURE, 1, n, created);
+            return true;
+        }
+        case 61: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            replay.gl.IsTexture(texture);
+            return true;
+        }
+        case 62: {
+            GLenum mode = (GLenum)slots[0];
+            GLuint start = (GLuint)slots[1];
+            GLuint end = (GLuint)slots[2];
+            GLsizei count = (GLsizei)slots[3];
+            GLenum type = (GLenum)slots[4];
+            replay.gl.DrawRangeElements(mode, start, end, count, type, (const void *)replay.input(5, slots[5]));
+            return true;
+        }
+        case 63: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint internalformat = (GLint)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLsizei depth = (GLsizei)slots[5];
+            GLint border = (GLint)slots[6];
+            GLenum format = (GLenum)slots[7];
+            GLenum type = (GLenum)slots[8];
+            replay.gl.TexImage3D(target, level, internalformat, width, height, depth, border, format, type, (const void *)replay.input(9, slots[9]));
+            return true;
+        }
+        case 64: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            GLsizei depth = (GLsizei)slots[7];
+            GLenum format = (GLenum)slots[8];
+            GLenum type = (GLenum)slots[9];
+            replay.gl.TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, (const void *)replay.input(10, slots[10]));
+            return true;
+        }
+        case 65: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLint x = (GLint)slots[5];
+            GLint y = (GLint)slots[6];
+            GLsizei width = (GLsizei)slots[7];
+            GLsizei height = (GLsizei)slots[8];
+            replay.gl.CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+            return true;
+        }
+        case 66: {
+            GLenum texture = (GLenum)slots[0];
+            replay.gl.ActiveTexture(texture);
+            return true;
+        }
+        case 67: {
+            GLfloat value = (GLfloat)replay.real(slots[0]);
+            GLboolean invert = (GLboolean)slots[1];
+            replay.gl.SampleCoverage(value, invert);
+            return true;
+        }
+        case 68: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLsizei depth = (GLsizei)slots[5];
+            GLint border = (GLint)slots[6];
+            GLsizei imageSize = (GLsizei)slots[7];
+            replay.gl.CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, (const void *)replay.input(8, slots[8]));
+            return true;
+        }
+        case 69: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLint border = (GLint)slots[5];
+            GLsizei imageSize = (GLsizei)slots[6];
+            replay.gl.CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, (const void *)replay.input(7, slots[7]));
+            return true;
+        }
+        case 70: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLint border = (GLint)slots[4];
+            GLsizei imageSize = (GLsizei)slots[5];
+            replay.gl.CompressedTexImage1D(target, level, internalformat, width, border, imageSize, (const void *)replay.input(6, slots[6]));
+            return true;
+        }
+        case 71: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            GLsizei depth = (GLsizei)slots[7];
+            GLenum format = (GLenum)slots[8];
+            GLsizei imageSize = (GLsizei)slots[9];
+            replay.gl.CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, (const void *)replay.input(10, slots[10]));
+            return true;
+        }
+        case 72: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLsizei width = (GLsizei)slots[4];
+            GLsizei height = (GLsizei)slots[5];
+            GLenum format = (GLenum)slots[6];
+            GLsizei imageSize = (GLsizei)slots[7];
+            replay.gl.CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, (const void *)replay.input(8, slots[8]));
+            return true;
+        }
+        case 73: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLenum format = (GLenum)slots[4];
+            GLsizei imageSize = (GLsizei)slots[5];
+            replay.gl.CompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, (const void *)replay.input(6, slots[6]));
+            return true;
+        }
+        case 74: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            replay.gl.GetCompressedTexImage(target, level, (void *)replay.pack(slots[2], replay.compressed_size(target, level)));
+            return true;
+        }
+        case 75: {
+            GLenum sfactorRGB = (GLenum)slots[0];
+            GLenum dfactorRGB = (GLenum)slots[1];
+            GLenum sfactorAlpha = (GLenum)slots[2];
+            GLenum dfactorAlpha = (GLenum)slots[3];
+            replay.gl.BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+            return true;
+        }
+        case 78: {
+            GLenum pname = (GLenum)slots[0];
+            GLfloat param = (GLfloat)replay.real(slots[1]);
+            replay.gl.PointParameterf(pname, param);
+            return true;
+        }
+        case 80: {
+            GLenum pname = (GLenum)slots[0];
+            GLint param = (GLint)slots[1];
+            replay.gl.PointParameteri(pname, param);
+            return true;
+        }
+        case 82: {
+            GLfloat red = (GLfloat)replay.real(slots[0]);
+            GLfloat green = (GLfloat)replay.real(slots[1]);
+            GLfloat blue = (GLfloat)replay.real(slots[2]);
+            GLfloat alpha = (GLfloat)replay.real(slots[3]);
+            replay.gl.BlendColor(red, green, blue, alpha);
+            return true;
+        }
+        case 83: {
+            GLenum mode = (GLenum)slots[0];
+            replay.gl.BlendEquation(mode);
+            return true;
+        }
+        case 84: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.GenQueries(n, created);
+            replay.created(REPLAY_QUERY, 1, n, created);
+            return true;
+        }
+        case 85: {
+            GLsizei n = (GLsizei)slots[0];
+            replay.gl.DeleteQueries(n, replay.names_of(REPLAY_QUERY, 1, n));
+            return true;
+        }
+        case 86: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            replay.gl.IsQuery(id);
+            return true;
+        }
+        case 87: {
+            GLenum target = (GLenum)slots[0];
+            GLuint id = replay.name(REPLAY_QUERY, slots[1]);
+            replay.gl.BeginQuery(target, id);
+            return true;
+        }
+        case 88: {
+            GLenum target = (GLenum)slots[0];
+            replay.gl.EndQuery(target);
+            return true;
+        }
+        case 89: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetQueryiv(target, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 90: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetQueryObjectiv(id, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 91: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetQueryObjectuiv(id, pname, (GLuint *)replay.output(0));
+            return true;
+        }
+        case 92: {
+            GLenum target = (GLenum)slots[0];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[1]);
+            replay.gl.BindBuffer(target, buffer);
+            replay.bind_buffer(target, slots[1]);
+            return true;
+        }
+        case 93: {
+            GLsizei n = (GLsizei)slots[0];
+            replay.gl.DeleteBuffers(n, replay.names_of(REPLAY_BUFFER, 1, n));
+            return true;
+        }
+        case 94: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.GenBuffers(n, created);
+            replay.created(REPLAY_BUFFER, 1, n, created);
+            return true;
+        }
+        case 95: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            replay.gl.IsBuffer(buffer);
+            return true;
+        }
+        case 96: {
+            GLenum target = (GLenum)slots[0];
+            GLsizeiptr size = (GLsizeiptr)slots[1];
+            GLenum usage = (GLenum)slots[3];
+            replay.gl.BufferData(target, size, (const void *)replay.input(2, slots[2]), usage);
+            return true;
+        }
+        case 97: {
+            GLenum target = (GLenum)slots[0];
+            GLintptr offset = (GLintptr)slots[1];
+            GLsizeiptr size = (GLsizeiptr)slots[2];
+            replay.gl.BufferSubData(target, offset, size, (const void *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 98: {
+            GLenum target = (GLenum)slots[0];
+            GLintptr offset = (GLintptr)slots[1];
+            GLsizeiptr size = (GLsizeiptr)slots[2];
+            replay.gl.GetBufferSubData(target, offset, size, (void *)replay.output((size_t)size));
+            return true;
+        }
+        case 99: {
+            GLenum target = (GLenum)slots[0];
+            GLenum access = (GLenum)slots[1];
+            void * result = replay.gl.MapBuffer(target, access);
+            replay.map(target, result);
+            return true;
+        }
+        case 100: {
+            GLenum target = (GLenum)slots[0];
+            replay.unmap(target, 1);
+            replay.gl.UnmapBuffer(target);
+            return true;
+        }
+        case 101: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetBufferParameteriv(target, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 102: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetBufferPointerv(target, pname, (void **)replay.output(0));
+            return true;
+        }
+        case 103: {
+            GLenum modeRGB = (GLenum)slots[0];
+            GLenum modeAlpha = (GLenum)slots[1];
+            replay.gl.BlendEquationSeparate(modeRGB, modeAlpha);
+            return true;
+        }
+        case 104: {
+            GLsizei n = (GLsizei)slots[0];
+            replay.gl.DrawBuffers(n, (const GLenum *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 105: {
+            GLenum face = (GLenum)slots[0];
+            GLenum sfail = (GLenum)slots[1];
+            GLenum dpfail = (GLenum)slots[2];
+            GLenum dppass = (GLenum)slots[3];
+            replay.gl.StencilOpSeparate(face, sfail, dpfail, dppass);
+            return true;
+        }
+        case 106: {
+            GLenum face = (GLenum)slots[0];
+            GLenum func = (GLenum)slots[1];
+            GLint ref = (GLint)slots[2];
+            GLuint mask = (GLuint)slots[3];
+            replay.gl.StencilFuncSeparate(face, func, ref, mask);
+            return true;
+        }
+        case 107: {
+            GLenum face = (GLenum)slots[0];
+            GLuint mask = (GLuint)slots[1];
+            replay.gl.StencilMaskSeparate(face, mask);
+            return true;
+        }
+        case 108: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint shader = replay.name(REPLAY_PROGRAM, slots[1]);
+            replay.gl.AttachShader(program, shader);
+            return true;
+        }
+        case 109: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            replay.gl.BindAttribLocation(program, index, replay.text(2, slots[2]));
+            return true;
+        }
+        case 110: {
+            GLuint shader = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.CompileShader(shader);
+            return true;
+        }
+        case 111: {
+            GLuint result = replay.gl.CreateProgram();
+            replay.created(REPLAY_PROGRAM, slots[0], result);
+            return true;
+        }
+        case 112: {
+            GLenum type = (GLenum)slots[0];
+            GLuint result = replay.gl.CreateShader(type);
+            replay.created(REPLAY_PROGRAM, slots[1], result);
+            return true;
+        }
+        case 113: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.DeleteProgram(program);
+            return true;
+        }
+        case 114: {
+            GLuint shader = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.DeleteShader(shader);
+            return true;
+        }
+        case 115: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint shader = replay.name(REPLAY_PROGRAM, slots[1]);
+            replay.gl.DetachShader(program, shader);
+            return true;
+        }
+        case 116: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.DisableVertexAttribArray(index);
+            return true;
+        }
+        case 117: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.EnableVertexAttribArray(index);
+            return true;
+        }
+        case 118: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetActiveAttrib(program, index, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLint *)replay.output((size_t)bufSize), (GLenum *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 119: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetActiveUniform(program, index, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLint *)replay.output((size_t)bufSize), (GLenum *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 120: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLsizei maxCount = (GLsizei)slots[1];
+            replay.gl.GetAttachedShaders(program, maxCount, (GLsizei *)replay.output(0), (GLuint *)replay.output(0));
+            return true;
+        }
+        case 121: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.GetAttribLocation(program, replay.text(1, slots[1]));
+            return true;
+        }
+        case 122: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetProgramiv(program, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 123: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLsizei bufSize = (GLsizei)slots[1];
+            replay.gl.GetProgramInfoLog(program, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 124: {
+            GLuint shader = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetShaderiv(shader, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 125: {
+            GLuint shader = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLsizei bufSize = (GLsizei)slots[1];
+            replay.gl.GetShaderInfoLog(shader, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 126: {
+            GLuint shader = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLsizei bufSize = (GLsizei)slots[1];
+            replay.gl.GetShaderSource(shader, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 127: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.GetUniformLocation(program, replay.text(1, slots[1]));
+            return true;
+        }
+        case 128: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            replay.gl.GetUniformfv(program, location, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 129: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            replay.gl.GetUniformiv(program, location, (GLint *)replay.output(0));
+            return true;
+        }
+        case 130: {
+            GLuint index = (GLuint)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetVertexAttribdv(index, pname, (GLdouble *)replay.output(0));
+            return true;
+        }
+        case 131: {
+            GLuint index = (GLuint)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetVertexAttribfv(index, pname, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 132: {
+            GLuint index = (GLuint)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetVertexAttribiv(index, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 133: {
+            GLuint index = (GLuint)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetVertexAttribPointerv(index, pname, (void **)replay.output(0));
+            return true;
+        }
+        case 134: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.IsProgram(program);
+            return true;
+        }
+        case 135: {
+            GLuint shader = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.IsShader(shader);
+            return true;
+        }
+        case 136: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.LinkProgram(program);
+            return true;
+        }
+        case 137: {
+            GLuint shader = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.ShaderSource(shader, count, replay.strings(2, count), 0);
+            return true;
+        }
+        case 138: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.UseProgram(program);
+            return true;
+        }
+        case 139: {
+            GLint location = (GLint)slots[0];
+            GLfloat v0 = (GLfloat)replay.real(slots[1]);
+            replay.gl.Uniform1f(location, v0);
+            return true;
+        }
+        case 140: {
+            GLint location = (GLint)slots[0];
+            GLfloat v0 = (GLfloat)replay.real(slots[1]);
+            GLfloat v1 = (GLfloat)replay.real(slots[2]);
+            replay.gl.Uniform2f(location, v0, v1);
+            return true;
+        }
+        case 141: {
+            GLint location = (GLint)slots[0];
+            GLfloat v0 = (GLfloat)replay.real(slots[1]);
+            GLfloat v1 = (GLfloat)replay.real(slots[2]);
+            GLfloat v2 = (GLfloat)replay.real(slots[3]);
+            replay.gl.Uniform3f(location, v0, v1, v2);
+            return true;
+        }
+        case 142: {
+            GLint location = (GLint)slots[0];
+            GLfloat v0 = (GLfloat)replay.real(slots[1]);
+            GLfloat v1 = (GLfloat)replay.real(slots[2]);
+            GLfloat v2 = (GLfloat)replay.real(slots[3]);
+            GLfloat v3 = (GLfloat)replay.real(slots[4]);
+            replay.gl.Uniform4f(location, v0, v1, v2, v3);
+            return true;
+        }
+        case 143: {
+            GLint location = (GLint)slots[0];
+            GLint v0 = (GLint)slots[1];
+            replay.gl.Uniform1i(location, v0);
+            return true;
+        }
+        case 144: {
+            GLint location = (GLint)slots[0];
+            GLint v0 = (GLint)slots[1];
+            GLint v1 = (GLint)slots[2];
+            replay.gl.Uniform2i(location, v0, v1);
+            return true;
+        }
+        case 145: {
+            GLint location = (GLint)slots[0];
+            GLint v0 = (GLint)slots[1];
+            GLint v1 = (GLint)slots[2];
+            GLint v2 = (GLint)slots[3];
+            replay.gl.Uniform3i(location, v0, v1, v2);
+            return true;
+        }
+        case 146: {
+            GLint location = (GLint)slots[0];
+            GLint v0 = (GLint)slots[1];
+            GLint v1 = (GLint)slots[2];
+            GLint v2 = (GLint)slots[3];
+            GLint v3 = (GLint)slots[4];
+            replay.gl.Uniform4i(location, v0, v1, v2, v3);
+            return true;
+        }
+        case 147: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform1fv(location, count, (const GLfloat *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 148: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform2fv(location, count, (const GLfloat *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 149: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform3fv(location, count, (const GLfloat *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 150: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform4fv(location, count, (const GLfloat *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 151: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform1iv(location, count, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 152: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform2iv(location, count, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 153: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform3iv(location, count, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 154: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform4iv(location, count, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 155: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix2fv(location, count, transpose, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 156: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix3fv(location, count, transpose, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 157: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix4fv(location, count, transpose, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 158: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.ValidateProgram(program);
+            return true;
+        }
+        case 159: {
+            GLuint index = (GLuint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            replay.gl.VertexAttrib1d(index, x);
+            return true;
+        }
+        case 160: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib1dv(index, (const GLdouble *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 161: {
+            GLuint index = (GLuint)slots[0];
+            GLfloat x = (GLfloat)replay.real(slots[1]);
+            replay.gl.VertexAttrib1f(index, x);
+            return true;
+        }
+        case 162: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib1fv(index, (const GLfloat *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 163: {
+            GLuint index = (GLuint)slots[0];
+            GLshort x = (GLshort)slots[1];
+            replay.gl.VertexAttrib1s(index, x);
+            return true;
+        }
+        case 164: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib1sv(index, (const GLshort *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 165: {
+            GLuint index = (GLuint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            GLdouble y = (GLdouble)replay.real(slots[2]);
+            replay.gl.VertexAttrib2d(index, x, y);
+            return true;
+        }
+        case 166: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib2dv(index, (const GLdouble *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 167: {
+            GLuint index = (GLuint)slots[0];
+            GLfloat x = (GLfloat)replay.real(slots[1]);
+            GLfloat y = (GLfloat)replay.real(slots[2]);
+            replay.gl.VertexAttrib2f(index, x, y);
+            return true;
+        }
+        case 168: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib2fv(index, (const GLfloat *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 169: {
+            GLuint index = (GLuint)slots[0];
+            GLshort x = (GLshort)slots[1];
+            GLshort y = (GLshort)slots[2];
+            replay.gl.VertexAttrib2s(index, x, y);
+            return true;
+        }
+        case 170: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib2sv(index, (const GLshort *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 171: {
+            GLuint index = (GLuint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            GLdouble y = (GLdouble)replay.real(slots[2]);
+            GLdouble z = (GLdouble)replay.real(slots[3]);
+            replay.gl.VertexAttrib3d(index, x, y, z);
+            return true;
+        }
+        case 172: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib3dv(index, (const GLdouble *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 173: {
+            GLuint index = (GLuint)slots[0];
+            GLfloat x = (GLfloat)replay.real(slots[1]);
+            GLfloat y = (GLfloat)replay.real(slots[2]);
+            GLfloat z = (GLfloat)replay.real(slots[3]);
+            replay.gl.VertexAttrib3f(index, x, y, z);
+            return true;
+        }
+        case 174: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib3fv(index, (const GLfloat *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 175: {
+            GLuint index = (GLuint)slots[0];
+            GLshort x = (GLshort)slots[1];
+            GLshort y = (GLshort)slots[2];
+            GLshort z = (GLshort)slots[3];
+            replay.gl.VertexAttrib3s(index, x, y, z);
+            return true;
+        }
+        case 176: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib3sv(index, (const GLshort *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 177: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4Nbv(index, (const GLbyte *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 178: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4Niv(index, (const GLint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 179: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4Nsv(index, (const GLshort *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 180: {
+            GLuint index = (GLuint)slots[0];
+            GLubyte x = (GLubyte)slots[1];
+            GLubyte y = (GLubyte)slots[2];
+            GLubyte z = (GLubyte)slots[3];
+            GLubyte w = (GLubyte)slots[4];
+            replay.gl.VertexAttrib4Nub(index, x, y, z, w);
+            return true;
+        }
+        case 181: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4Nubv(index, (const GLubyte *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 182: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4Nuiv(index, (const GLuint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 183: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4Nusv(index, (const GLushort *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 184: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4bv(index, (const GLbyte *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 185: {
+            GLuint index = (GLuint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            GLdouble y = (GLdouble)replay.real(slots[2]);
+            GLdouble z = (GLdouble)replay.real(slots[3]);
+            GLdouble w = (GLdouble)replay.real(slots[4]);
+            replay.gl.VertexAttrib4d(index, x, y, z, w);
+            return true;
+        }
+        case 186: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4dv(index, (const GLdouble *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 187: {
+            GLuint index = (GLuint)slots[0];
+            GLfloat x = (GLfloat)replay.real(slots[1]);
+            GLfloat y = (GLfloat)replay.real(slots[2]);
+            GLfloat z = (GLfloat)replay.real(slots[3]);
+            GLfloat w = (GLfloat)replay.real(slots[4]);
+            replay.gl.VertexAttrib4f(index, x, y, z, w);
+            return true;
+        }
+        case 188: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4fv(index, (const GLfloat *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 189: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4iv(index, (const GLint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 190: {
+            GLuint index = (GLuint)slots[0];
+            GLshort x = (GLshort)slots[1];
+            GLshort y = (GLshort)slots[2];
+            GLshort z = (GLshort)slots[3];
+            GLshort w = (GLshort)slots[4];
+            replay.gl.VertexAttrib4s(index, x, y, z, w);
+            return true;
+        }
+        case 191: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4sv(index, (const GLshort *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 192: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4ubv(index, (const GLubyte *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 193: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4uiv(index, (const GLuint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 194: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttrib4usv(index, (const GLushort *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 195: {
+            GLuint index = (GLuint)slots[0];
+            GLint size = (GLint)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLboolean normalized = (GLboolean)slots[3];
+            GLsizei stride = (GLsizei)slots[4];
+            replay.gl.VertexAttribPointer(index, size, type, normalized, stride, (const void *)replay.input(5, slots[5]));
+            return true;
+        }
+        case 196: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix2x3fv(location, count, transpose, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 197: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix3x2fv(location, count, transpose, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 198: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix2x4fv(location, count, transpose, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 199: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix4x2fv(location, count, transpose, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 200: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix3x4fv(location, count, transpose, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 201: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix4x3fv(location, count, transpose, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 202: {
+            GLuint index = (GLuint)slots[0];
+            GLboolean r = (GLboolean)slots[1];
+            GLboolean g = (GLboolean)slots[2];
+            GLboolean b = (GLboolean)slots[3];
+            GLboolean a = (GLboolean)slots[4];
+            replay.gl.ColorMaski(index, r, g, b, a);
+            return true;
+        }
+        case 203: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.GetBooleani_v(target, index, (GLboolean *)replay.output(0));
+            return true;
+        }
+        case 204: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.GetIntegeri_v(target, index, (GLint *)replay.output(0));
+            return true;
+        }
+        case 205: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.Enablei(target, index);
+            return true;
+        }
+        case 206: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.Disablei(target, index);
+            return true;
+        }
+        case 207: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.IsEnabledi(target, index);
+            return true;
+        }
+        case 208: {
+            GLenum primitiveMode = (GLenum)slots[0];
+            replay.gl.BeginTransformFeedback(primitiveMode);
+            return true;
+        }
+        case 209: {
+            replay.gl.EndTransformFeedback();
+            return true;
+        }
+        case 210: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[2]);
+            GLintptr offset = (GLintptr)slots[3];
+            GLsizeiptr size = (GLsizeiptr)slots[4];
+            replay.gl.BindBufferRange(target, index, buffer, offset, size);
+            return true;
+        }
+        case 211: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[2]);
+            replay.gl.BindBufferBase(target, index, buffer);
+            return true;
+        }
+        case 212: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLsizei count = (GLsizei)slots[1];
+            GLenum bufferMode = (GLenum)slots[3];
+            replay.gl.TransformFeedbackVaryings(program, count, replay.strings(2, count), bufferMode);
+            return true;
+        }
+        case 213: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetTransformFeedbackVarying(program, index, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLsizei *)replay.output((size_t)bufSize), (GLenum *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 214: {
+            GLenum target = (GLenum)slots[0];
+            GLenum clamp = (GLenum)slots[1];
+            replay.gl.ClampColor(target, clamp);
+            return true;
+        }
+        case 215: {
+            GLuint id = (GLuint)slots[0];
+            GLenum mode = (GLenum)slots[1];
+            replay.gl.BeginConditionalRender(id, mode);
+            return true;
+        }
+        case 216: {
+            replay.gl.EndConditionalRender();
+            return true;
+        }
+        case 217: {
+            GLuint index = (GLuint)slots[0];
+            GLint size = (GLint)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLsizei stride = (GLsizei)slots[3];
+            replay.gl.VertexAttribIPointer(index, size, type, stride, (const void *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 218: {
+            GLuint index = (GLuint)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetVertexAttribIiv(index, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 219: {
+            GLuint index = (GLuint)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetVertexAttribIuiv(index, pname, (GLuint *)replay.output(0));
+            return true;
+        }
+        case 220: {
+            GLuint index = (GLuint)slots[0];
+            GLint x = (GLint)slots[1];
+            replay.gl.VertexAttribI1i(index, x);
+            return true;
+        }
+        case 221: {
+            GLuint index = (GLuint)slots[0];
+            GLint x = (GLint)slots[1];
+            GLint y = (GLint)slots[2];
+            replay.gl.VertexAttribI2i(index, x, y);
+            return true;
+        }
+        case 222: {
+            GLuint index = (GLuint)slots[0];
+            GLint x = (GLint)slots[1];
+            GLint y = (GLint)slots[2];
+            GLint z = (GLint)slots[3];
+            replay.gl.VertexAttribI3i(index, x, y, z);
+            return true;
+        }
+        case 223: {
+            GLuint index = (GLuint)slots[0];
+            GLint x = (GLint)slots[1];
+            GLint y = (GLint)slots[2];
+            GLint z = (GLint)slots[3];
+            GLint w = (GLint)slots[4];
+            replay.gl.VertexAttribI4i(index, x, y, z, w);
+            return true;
+        }
+        case 224: {
+            GLuint index = (GLuint)slots[0];
+            GLuint x = (GLuint)slots[1];
+            replay.gl.VertexAttribI1ui(index, x);
+            return true;
+        }
+        case 225: {
+            GLuint index = (GLuint)slots[0];
+            GLuint x = (GLuint)slots[1];
+            GLuint y = (GLuint)slots[2];
+            replay.gl.VertexAttribI2ui(index, x, y);
+            return true;
+        }
+        case 226: {
+            GLuint index = (GLuint)slots[0];
+            GLuint x = (GLuint)slots[1];
+            GLuint y = (GLuint)slots[2];
+            GLuint z = (GLuint)slots[3];
+            replay.gl.VertexAttribI3ui(index, x, y, z);
+            return true;
+        }
+        case 227: {
+            GLuint index = (GLuint)slots[0];
+            GLuint x = (GLuint)slots[1];
+            GLuint y = (GLuint)slots[2];
+            GLuint z = (GLuint)slots[3];
+            GLuint w = (GLuint)slots[4];
+            replay.gl.VertexAttribI4ui(index, x, y, z, w);
+            return true;
+        }
+        case 228: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI1iv(index, (const GLint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 229: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI2iv(index, (const GLint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 230: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI3iv(index, (const GLint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 231: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI4iv(index, (const GLint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 232: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI1uiv(index, (const GLuint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 233: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI2uiv(index, (const GLuint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 234: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI3uiv(index, (const GLuint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 235: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI4uiv(index, (const GLuint *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 236: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI4bv(index, (const GLbyte *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 237: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI4sv(index, (const GLshort *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 238: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI4ubv(index, (const GLubyte *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 239: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribI4usv(index, (const GLushort *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 240: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            replay.gl.GetUniformuiv(program, location, (GLuint *)replay.output(0));
+            return true;
+        }
+        case 241: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint color = (GLuint)slots[1];
+            replay.gl.BindFragDataLocation(program, color, replay.text(2, slots[2]));
+            return true;
+        }
+        case 242: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.GetFragDataLocation(program, replay.text(1, slots[1]));
+            return true;
+        }
+        case 243: {
+            GLint location = (GLint)slots[0];
+            GLuint v0 = (GLuint)slots[1];
+            replay.gl.Uniform1ui(location, v0);
+            return true;
+        }
+        case 244: {
+            GLint location = (GLint)slots[0];
+            GLuint v0 = (GLuint)slots[1];
+            GLuint v1 = (GLuint)slots[2];
+            replay.gl.Uniform2ui(location, v0, v1);
+            return true;
+        }
+        case 245: {
+            GLint location = (GLint)slots[0];
+            GLuint v0 = (GLuint)slots[1];
+            GLuint v1 = (GLuint)slots[2];
+            GLuint v2 = (GLuint)slots[3];
+            replay.gl.Uniform3ui(location, v0, v1, v2);
+            return true;
+        }
+        case 246: {
+            GLint location = (GLint)slots[0];
+            GLuint v0 = (GLuint)slots[1];
+            GLuint v1 = (GLuint)slots[2];
+            GLuint v2 = (GLuint)slots[3];
+            GLuint v3 = (GLuint)slots[4];
+            replay.gl.Uniform4ui(location, v0, v1, v2, v3);
+            return true;
+        }
+        case 247: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform1uiv(location, count, (const GLuint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 248: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform2uiv(location, count, (const GLuint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 249: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform3uiv(location, count, (const GLuint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 250: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform4uiv(location, count, (const GLuint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 251: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.TexParameterIiv(target, pname, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 252: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.TexParameterIuiv(target, pname, (const GLuint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 253: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetTexParameterIiv(target, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 254: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetTexParameterIuiv(target, pname, (GLuint *)replay.output(0));
+            return true;
+        }
+        case 255: {
+            GLenum buffer = (GLenum)slots[0];
+            GLint drawbuffer = (GLint)slots[1];
+            replay.gl.ClearBufferiv(buffer, drawbuffer, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 256: {
+            GLenum buffer = (GLenum)slots[0];
+            GLint drawbuffer = (GLint)slots[1];
+            replay.gl.ClearBufferuiv(buffer, drawbuffer, (const GLuint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 257: {
+            GLenum buffer = (GLenum)slots[0];
+            GLint drawbuffer = (GLint)slots[1];
+            replay.gl.ClearBufferfv(buffer, drawbuffer, (const GLfloat *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 258: {
+            GLenum buffer = (GLenum)slots[0];
+            GLint drawbuffer = (GLint)slots[1];
+            GLfloat depth = (GLfloat)replay.real(slots[2]);
+            GLint stencil = (GLint)slots[3];
+            replay.gl.ClearBufferfi(buffer, drawbuffer, depth, stencil);
+            return true;
+        }
+        case 259: {
+            GLenum name = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.GetStringi(name, index);
+            return true;
+        }
+        case 260: {
+            GLuint renderbuffer = replay.name(REPLAY_RENDERBUFFER, slots[0]);
+            replay.gl.IsRenderbuffer(renderbuffer);
+            return true;
+        }
+        case 261: {
+            GLenum target = (GLenum)slots[0];
+            GLuint renderbuffer = replay.name(REPLAY_RENDERBUFFER, slots[1]);
+            replay.gl.BindRenderbuffer(target, renderbuffer);
+            return true;
+        }
+        case 262: {
+            GLsizei n = (GLsizei)slots[0];
+            replay.gl.DeleteRenderbuffers(n, replay.names_of(REPLAY_RENDERBUFFER, 1, n));
+            return true;
+        }
+        case 263: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.GenRenderbuffers(n, created);
+            replay.created(REPLAY_RENDERBUFFER, 1, n, created);
+            return true;
+        }
+        case 264: {
+            GLenum target = (GLenum)slots[0];
+            GLenum internalformat = (GLenum)slots[1];
+            GLsizei width = (GLsizei)slots[2];
+            GLsizei height = (GLsizei)slots[3];
+            replay.gl.RenderbufferStorage(target, internalformat, width, height);
+            return true;
+        }
+        case 265: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetRenderbufferParameteriv(target, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 266: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            replay.gl.IsFramebuffer(framebuffer);
+            return true;
+        }
+        case 267: {
+            GLenum target = (GLenum)slots[0];
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[1]);
+            replay.gl.BindFramebuffer(target, framebuffer);
+            return true;
+        }
+        case 268: {
+            GLsizei n = (GLsizei)slots[0];
+            replay.gl.DeleteFramebuffers(n, replay.names_of(REPLAY_FRAMEBUFFER, 1, n));
+            return true;
+        }
+        case 269: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.GenFramebuffers(n, created);
+            replay.created(REPLAY_FRAMEBUFFER, 1, n, created);
+            return true;
+        }
+        case 270: {
+            GLenum target = (GLenum)slots[0];
+            replay.gl.CheckFramebufferStatus(target);
+            return true;
+        }
+        case 271: {
+            GLenum target = (GLenum)slots[0];
+            GLenum attachment = (GLenum)slots[1];
+            GLenum textarget = (GLenum)slots[2];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[3]);
+            GLint level = (GLint)slots[4];
+            replay.gl.FramebufferTexture1D(target, attachment, textarget, texture, level);
+            return true;
+        }
+        case 272: {
+            GLenum target = (GLenum)slots[0];
+            GLenum attachment = (GLenum)slots[1];
+            GLenum textarget = (GLenum)slots[2];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[3]);
+            GLint level = (GLint)slots[4];
+            replay.gl.FramebufferTexture2D(target, attachment, textarget, texture, level);
+            return true;
+        }
+        case 273: {
+            GLenum target = (GLenum)slots[0];
+            GLenum attachment = (GLenum)slots[1];
+            GLenum textarget = (GLenum)slots[2];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[3]);
+            GLint level = (GLint)slots[4];
+            GLint zoffset = (GLint)slots[5];
+            replay.gl.FramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+            return true;
+        }
+        case 274: {
+            GLenum target = (GLenum)slots[0];
+            GLenum attachment = (GLenum)slots[1];
+            GLenum renderbuffertarget = (GLenum)slots[2];
+            GLuint renderbuffer = replay.name(REPLAY_RENDERBUFFER, slots[3]);
+            replay.gl.FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+            return true;
+        }
+        case 275: {
+            GLenum target = (GLenum)slots[0];
+            GLenum attachment = (GLenum)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetFramebufferAttachmentParameteriv(target, attachment, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 276: {
+            GLenum target = (GLenum)slots[0];
+            replay.gl.GenerateMipmap(target);
+            return true;
+        }
+        case 277: {
+            GLint srcX0 = (GLint)slots[0];
+            GLint srcY0 = (GLint)slots[1];
+            GLint srcX1 = (GLint)slots[2];
+            GLint srcY1 = (GLint)slots[3];
+            GLint dstX0 = (GLint)slots[4];
+            GLint dstY0 = (GLint)slots[5];
+            GLint dstX1 = (GLint)slots[6];
+            GLint dstY1 = (GLint)slots[7];
+            GLbitfield mask = (GLbitfield)slots[8];
+            GLenum filter = (GLenum)slots[9];
+            replay.gl.BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+            return true;
+        }
+        case 278: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei samples = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            replay.gl.RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+            return true;
+        }
+        case 279: {
+            GLenum target = (GLenum)slots[0];
+            GLenum attachment = (GLenum)slots[1];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[2]);
+            GLint level = (GLint)slots[3];
+            GLint layer = (GLint)slots[4];
+            replay.gl.FramebufferTextureLayer(target, attachment, texture, level, layer);
+            return true;
+        }
+        case 280: {
+            GLenum target = (GLenum)slots[0];
+            GLintptr offset = (GLintptr)slots[1];
+            GLsizeiptr length = (GLsizeiptr)slots[2];
+            GLbitfield access = (GLbitfield)slots[3];
+            void * result = replay.gl.MapBufferRange(target, offset, length, access);
+            replay.map(target, result);
+            return true;
+        }
+        case 281: {
+            GLenum target = (GLenum)slots[0];
+            GLintptr offset = (GLintptr)slots[1];
+            GLsizeiptr length = (GLsizeiptr)slots[2];
+            replay.gl.FlushMappedBufferRange(target, offset, length);
+            return true;
+        }
+        case 282: {
+            GLuint array = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            replay.gl.BindVertexArray(array);
+            return true;
+        }
+        case 283: {
+            GLsizei n = (GLsizei)slots[0];
+            replay.gl.DeleteVertexArrays(n, replay.names_of(REPLAY_VERTEX_ARRAY, 1, n));
+            return true;
+        }
+        case 284: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.GenVertexArrays(n, created);
+            replay.created(REPLAY_VERTEX_ARRAY, 1, n, created);
+            return true;
+        }
+        case 285: {
+            GLuint array = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            replay.gl.IsVertexArray(array);
+            return true;
+        }
+        case 286: {
+            GLenum mode = (GLenum)slots[0];
+            GLint first = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLsizei instancecount = (GLsizei)slots[3];
+            replay.gl.DrawArraysInstanced(mode, first, count, instancecount);
+            return true;
+        }
+        case 287: {
+            GLenum mode = (GLenum)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLsizei instancecount = (GLsizei)slots[4];
+            replay.gl.DrawElementsInstanced(mode, count, type, (const void *)replay.input(3, slots[3]), instancecount);
+            return true;
+        }
+        case 288: {
+            GLenum target = (GLenum)slots[0];
+            GLenum internalformat = (GLenum)slots[1];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[2]);
+            replay.gl.TexBuffer(target, internalformat, buffer);
+            return true;
+        }
+        case 289: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.PrimitiveRestartIndex(index);
+            return true;
+        }
+        case 290: {
+            GLenum readTarget = (GLenum)slots[0];
+            GLenum writeTarget = (GLenum)slots[1];
+            GLintptr readOffset = (GLintptr)slots[2];
+            GLintptr writeOffset = (GLintptr)slots[3];
+            GLsizeiptr size = (GLsizeiptr)slots[4];
+            replay.gl.CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+            return true;
+        }
+        case 291: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLsizei uniformCount = (GLsizei)slots[1];
+            replay.gl.GetUniformIndices(program, uniformCount, replay.strings(2, uniformCount), (GLuint *)replay.output(0));
+            return true;
+        }
+        case 293: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint uniformIndex = (GLuint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetActiveUniformName(program, uniformIndex, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 294: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.GetUniformBlockIndex(program, replay.text(1, slots[1]));
+            return true;
+        }
+        case 295: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint uniformBlockIndex = (GLuint)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetActiveUniformBlockiv(program, uniformBlockIndex, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 296: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint uniformBlockIndex = (GLuint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 297: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint uniformBlockIndex = (GLuint)slots[1];
+            GLuint uniformBlockBinding = (GLuint)slots[2];
+            replay.gl.UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+            return true;
+        }
+        case 298: {
+            GLenum mode = (GLenum)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLint basevertex = (GLint)slots[4];
+            replay.gl.DrawElementsBaseVertex(mode, count, type, (const void *)replay.input(3, slots[3]), basevertex);
+            return true;
+        }
+        case 299: {
+            GLenum mode = (GLenum)slots[0];
+            GLuint start = (GLuint)slots[1];
+            GLuint end = (GLuint)slots[2];
+            GLsizei count = (GLsizei)slots[3];
+            GLenum type = (GLenum)slots[4];
+            GLint basevertex = (GLint)slots[6];
+            replay.gl.DrawRangeElementsBaseVertex(mode, start, end, count, type, (const void *)replay.input(5, slots[5]), basevertex);
+            return true;
+        }
+        case 300: {
+            GLenum mode = (GLenum)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLsizei instancecount = (GLsizei)slots[4];
+            GLint basevertex = (GLint)slots[5];
+            replay.gl.DrawElementsInstancedBaseVertex(mode, count, type, (const void *)replay.input(3, slots[3]), instancecount, basevertex);
+            return true;
+        }
+        case 302: {
+            GLenum mode = (GLenum)slots[0];
+            replay.gl.ProvokingVertex(mode);
+            return true;
+        }
+        case 303: {
+            GLenum condition = (GLenum)slots[0];
+            GLbitfield flags = (GLbitfield)slots[1];
+            GLsync result = replay.gl.FenceSync(condition, flags);
+            replay.created_sync(slots[2], result);
+            return true;
+        }
+        case 304: {
+            replay.gl.IsSync(replay.sync(slots[0]));
+            return true;
+        }
+        case 305: {
+            replay.gl.DeleteSync(replay.sync(slots[0]));
+            return true;
+        }
+        case 306: {
+            GLbitfield flags = (GLbitfield)slots[1];
+            GLuint64 timeout = (GLuint64)slots[2];
+            replay.gl.ClientWaitSync(replay.sync(slots[0]), flags, timeout);
+            return true;
+        }
+        case 307: {
+            GLbitfield flags = (GLbitfield)slots[1];
+            GLuint64 timeout = (GLuint64)slots[2];
+            replay.gl.WaitSync(replay.sync(slots[0]), flags, timeout);
+            return true;
+        }
+        case 308: {
+            GLenum pname = (GLenum)slots[0];
+            replay.gl.GetInteger64v(pname, (GLint64 *)replay.output(0));
+            return true;
+        }
+        case 309: {
+            GLenum pname = (GLenum)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetSynciv(replay.sync(slots[0]), pname, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLint *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 310: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.GetInteger64i_v(target, index, (GLint64 *)replay.output(0));
+            return true;
+        }
+        case 311: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetBufferParameteri64v(target, pname, (GLint64 *)replay.output(0));
+            return true;
+        }
+        case 312: {
+            GLenum target = (GLenum)slots[0];
+            GLenum attachment = (GLenum)slots[1];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[2]);
+            GLint level = (GLint)slots[3];
+            replay.gl.FramebufferTexture(target, attachment, texture, level);
+            return true;
+        }
+        case 313: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei samples = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLboolean fixedsamplelocations = (GLboolean)slots[5];
+            replay.gl.TexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+            return true;
+        }
+        case 314: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei samples = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLsizei depth = (GLsizei)slots[5];
+            GLboolean fixedsamplelocations = (GLboolean)slots[6];
+            replay.gl.TexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+            return true;
+        }
+        case 315: {
+            GLenum pname = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.GetMultisamplefv(pname, index, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 316: {
+            GLuint maskNumber = (GLuint)slots[0];
+            GLbitfield mask = (GLbitfield)slots[1];
+            replay.gl.SampleMaski(maskNumber, mask);
+            return true;
+        }
+        case 317: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint colorNumber = (GLuint)slots[1];
+            GLuint index = (GLuint)slots[2];
+            replay.gl.BindFragDataLocationIndexed(program, colorNumber, index, replay.text(3, slots[3]));
+            return true;
+        }
+        case 318: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            replay.gl.GetFragDataIndex(program, replay.text(1, slots[1]));
+            return true;
+        }
+        case 319: {
+            GLsizei count = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(count * sizeof(GLuint));
+            replay.gl.GenSamplers(count, created);
+            replay.created(REPLAY_SAMPLER, 1, count, created);
+            return true;
+        }
+        case 320: {
+            GLsizei count = (GLsizei)slots[0];
+            replay.gl.DeleteSamplers(count, replay.names_of(REPLAY_SAMPLER, 1, count));
+            return true;
+        }
+        case 321: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            replay.gl.IsSampler(sampler);
+            return true;
+        }
+        case 322: {
+            GLuint unit = (GLuint)slots[0];
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[1]);
+            replay.gl.BindSampler(unit, sampler);
+            return true;
+        }
+        case 323: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            GLint param = (GLint)slots[2];
+            replay.gl.SamplerParameteri(sampler, pname, param);
+            return true;
+        }
+        case 324: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.SamplerParameteriv(sampler, pname, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 325: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            GLfloat param = (GLfloat)replay.real(slots[2]);
+            replay.gl.SamplerParameterf(sampler, pname, param);
+            return true;
+        }
+        case 326: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.SamplerParameterfv(sampler, pname, (const GLfloat *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 327: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.SamplerParameterIiv(sampler, pname, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 328: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.SamplerParameterIuiv(sampler, pname, (const GLuint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 329: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetSamplerParameteriv(sampler, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 330: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetSamplerParameterIiv(sampler, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 331: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetSamplerParameterfv(sampler, pname, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 332: {
+            GLuint sampler = replay.name(REPLAY_SAMPLER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetSamplerParameterIuiv(sampler, pname, (GLuint *)replay.output(0));
+            return true;
+        }
+        case 333: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            GLenum target = (GLenum)slots[1];
+            replay.gl.QueryCounter(id, target);
+            return true;
+        }
+        case 334: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetQueryObjecti64v(id, pname, (GLint64 *)replay.output(0));
+            return true;
+        }
+        case 335: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetQueryObjectui64v(id, pname, (GLuint64 *)replay.output(0));
+            return true;
+        }
+        case 336: {
+            GLuint index = (GLuint)slots[0];
+            GLuint divisor = (GLuint)slots[1];
+            replay.gl.VertexAttribDivisor(index, divisor);
+            return true;
+        }
+        case 337: {
+            GLuint index = (GLuint)slots[0];
+            GLenum type = (GLenum)slots[1];
+            GLboolean normalized = (GLboolean)slots[2];
+            GLuint value = (GLuint)slots[3];
+            replay.gl.VertexAttribP1ui(index, type, normalized, value);
+            return true;
+        }
+        case 339: {
+            GLuint index = (GLuint)slots[0];
+            GLenum type = (GLenum)slots[1];
+            GLboolean normalized = (GLboolean)slots[2];
+            GLuint value = (GLuint)slots[3];
+            replay.gl.VertexAttribP2ui(index, type, normalized, value);
+            return true;
+        }
+        case 341: {
+            GLuint index = (GLuint)slots[0];
+            GLenum type = (GLenum)slots[1];
+            GLboolean normalized = (GLboolean)slots[2];
+            GLuint value = (GLuint)slots[3];
+            replay.gl.VertexAttribP3ui(index, type, normalized, value);
+            return true;
+        }
+        case 343: {
+            GLuint index = (GLuint)slots[0];
+            GLenum type = (GLenum)slots[1];
+            GLboolean normalized = (GLboolean)slots[2];
+            GLuint value = (GLuint)slots[3];
+            replay.gl.VertexAttribP4ui(index, type, normalized, value);
+            return true;
+        }
+        case 345: {
+            GLfloat value = (GLfloat)replay.real(slots[0]);
+            replay.gl.MinSampleShading(value);
+            return true;
+        }
+        case 346: {
+            GLuint buf = (GLuint)slots[0];
+            GLenum mode = (GLenum)slots[1];
+            replay.gl.BlendEquationi(buf, mode);
+            return true;
+        }
+        case 347: {
+            GLuint buf = (GLuint)slots[0];
+            GLenum modeRGB = (GLenum)slots[1];
+            GLenum modeAlpha = (GLenum)slots[2];
+            replay.gl.BlendEquationSeparatei(buf, modeRGB, modeAlpha);
+            return true;
+        }
+        case 348: {
+            GLuint buf = (GLuint)slots[0];
+            GLenum src = (GLenum)slots[1];
+            GLenum dst = (GLenum)slots[2];
+            replay.gl.BlendFunci(buf, src, dst);
+            return true;
+        }
+        case 349: {
+            GLuint buf = (GLuint)slots[0];
+            GLenum srcRGB = (GLenum)slots[1];
+            GLenum dstRGB = (GLenum)slots[2];
+            GLenum srcAlpha = (GLenum)slots[3];
+            GLenum dstAlpha = (GLenum)slots[4];
+            replay.gl.BlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+            return true;
+        }
+        case 350: {
+            GLenum mode = (GLenum)slots[0];
+            replay.gl.DrawArraysIndirect(mode, (const void *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 351: {
+            GLenum mode = (GLenum)slots[0];
+            GLenum type = (GLenum)slots[1];
+            replay.gl.DrawElementsIndirect(mode, type, (const void *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 352: {
+            GLint location = (GLint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            replay.gl.Uniform1d(location, x);
+            return true;
+        }
+        case 353: {
+            GLint location = (GLint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            GLdouble y = (GLdouble)replay.real(slots[2]);
+            replay.gl.Uniform2d(location, x, y);
+            return true;
+        }
+        case 354: {
+            GLint location = (GLint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            GLdouble y = (GLdouble)replay.real(slots[2]);
+            GLdouble z = (GLdouble)replay.real(slots[3]);
+            replay.gl.Uniform3d(location, x, y, z);
+            return true;
+        }
+        case 355: {
+            GLint location = (GLint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            GLdouble y = (GLdouble)replay.real(slots[2]);
+            GLdouble z = (GLdouble)replay.real(slots[3]);
+            GLdouble w = (GLdouble)replay.real(slots[4]);
+            replay.gl.Uniform4d(location, x, y, z, w);
+            return true;
+        }
+        case 356: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform1dv(location, count, (const GLdouble *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 357: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform2dv(location, count, (const GLdouble *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 358: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform3dv(location, count, (const GLdouble *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 359: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.Uniform4dv(location, count, (const GLdouble *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 360: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix2dv(location, count, transpose, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 361: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix3dv(location, count, transpose, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 362: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix4dv(location, count, transpose, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 363: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix2x3dv(location, count, transpose, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 364: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix2x4dv(location, count, transpose, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 365: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix3x2dv(location, count, transpose, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 366: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix3x4dv(location, count, transpose, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 367: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix4x2dv(location, count, transpose, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 368: {
+            GLint location = (GLint)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLboolean transpose = (GLboolean)slots[2];
+            replay.gl.UniformMatrix4x3dv(location, count, transpose, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 369: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            replay.gl.GetUniformdv(program, location, (GLdouble *)replay.output(0));
+            return true;
+        }
+        case 370: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum shadertype = (GLenum)slots[1];
+            replay.gl.GetSubroutineUniformLocation(program, shadertype, replay.text(2, slots[2]));
+            return true;
+        }
+        case 371: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum shadertype = (GLenum)slots[1];
+            replay.gl.GetSubroutineIndex(program, shadertype, replay.text(2, slots[2]));
+            return true;
+        }
+        case 372: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum shadertype = (GLenum)slots[1];
+            GLuint index = (GLuint)slots[2];
+            GLenum pname = (GLenum)slots[3];
+            replay.gl.GetActiveSubroutineUniformiv(program, shadertype, index, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 373: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum shadertype = (GLenum)slots[1];
+            GLuint index = (GLuint)slots[2];
+            GLsizei bufsize = (GLsizei)slots[3];
+            replay.gl.GetActiveSubroutineUniformName(program, shadertype, index, bufsize, (GLsizei *)replay.output(0), (GLchar *)replay.output(0));
+            return true;
+        }
+        case 374: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum shadertype = (GLenum)slots[1];
+            GLuint index = (GLuint)slots[2];
+            GLsizei bufsize = (GLsizei)slots[3];
+            replay.gl.GetActiveSubroutineName(program, shadertype, index, bufsize, (GLsizei *)replay.output(0), (GLchar *)replay.output(0));
+            return true;
+        }
+        case 375: {
+            GLenum shadertype = (GLenum)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            replay.gl.UniformSubroutinesuiv(shadertype, count, (const GLuint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 376: {
+            GLenum shadertype = (GLenum)slots[0];
+            GLint location = (GLint)slots[1];
+            replay.gl.GetUniformSubroutineuiv(shadertype, location, (GLuint *)replay.output(0));
+            return true;
+        }
+        case 377: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum shadertype = (GLenum)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetProgramStageiv(program, shadertype, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 378: {
+            GLenum pname = (GLenum)slots[0];
+            GLint value = (GLint)slots[1];
+            replay.gl.PatchParameteri(pname, value);
+            return true;
+        }
+        case 380: {
+            GLenum target = (GLenum)slots[0];
+            GLuint id = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[1]);
+            replay.gl.BindTransformFeedback(target, id);
+            return true;
+        }
+        case 381: {
+            GLsizei n = (GLsizei)slots[0];
+            replay.gl.DeleteTransformFeedbacks(n, replay.names_of(REPLAY_TRANSFORM_FEEDBACK, 1, n));
+            return true;
+        }
+        case 382: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.GenTransformFeedbacks(n, created);
+            replay.created(REPLAY_TRANSFORM_FEEDBACK, 1, n, created);
+            return true;
+        }
+        case 383: {
+            GLuint id = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[0]);
+            replay.gl.IsTransformFeedback(id);
+            return true;
+        }
+        case 384: {
+            replay.gl.PauseTransformFeedback();
+            return true;
+        }
+        case 385: {
+            replay.gl.ResumeTransformFeedback();
+            return true;
+        }
+        case 386: {
+            GLenum mode = (GLenum)slots[0];
+            GLuint id = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[1]);
+            replay.gl.DrawTransformFeedback(mode, id);
+            return true;
+        }
+        case 387: {
+            GLenum mode = (GLenum)slots[0];
+            GLuint id = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[1]);
+            GLuint stream = (GLuint)slots[2];
+            replay.gl.DrawTransformFeedbackStream(mode, id, stream);
+            return true;
+        }
+        case 388: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            GLuint id = replay.name(REPLAY_QUERY, slots[2]);
+            replay.gl.BeginQueryIndexed(target, index, id);
+            return true;
+        }
+        case 389: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.EndQueryIndexed(target, index);
+            return true;
+        }
+        case 390: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetQueryIndexediv(target, index, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 391: {
+            replay.gl.ReleaseShaderCompiler();
+            return true;
+        }
+        case 393: {
+            GLenum shadertype = (GLenum)slots[0];
+            GLenum precisiontype = (GLenum)slots[1];
+            replay.gl.GetShaderPrecisionFormat(shadertype, precisiontype, (GLint *)replay.output(0), (GLint *)replay.output(0));
+            return true;
+        }
+        case 394: {
+            GLfloat n = (GLfloat)replay.real(slots[0]);
+            GLfloat f = (GLfloat)replay.real(slots[1]);
+            replay.gl.DepthRangef(n, f);
+            return true;
+        }
+        case 395: {
+            GLfloat d = (GLfloat)replay.real(slots[0]);
+            replay.gl.ClearDepthf(d);
+            return true;
+        }
+        case 396: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLsizei bufSize = (GLsizei)slots[1];
+            replay.gl.GetProgramBinary(program, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLenum *)replay.output((size_t)bufSize), (void *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 398: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            GLint value = (GLint)slots[2];
+            replay.gl.ProgramParameteri(program, pname, value);
+            return true;
+        }
+        case 399: {
+            GLuint pipeline = replay.name(REPLAY_PIPELINE, slots[0]);
+            GLbitfield stages = (GLbitfield)slots[1];
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[2]);
+            replay.gl.UseProgramStages(pipeline, stages, program);
+            return true;
+        }
+        case 400: {
+            GLuint pipeline = replay.name(REPLAY_PIPELINE, slots[0]);
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[1]);
+            replay.gl.ActiveShaderProgram(pipeline, program);
+            return true;
+        }
+        case 401: {
+            GLenum type = (GLenum)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLuint result = replay.gl.CreateShaderProgramv(type, count, replay.strings(2, count));
+            replay.created(REPLAY_PROGRAM, slots[3], result);
+            return true;
+        }
+        case 402: {
+            GLuint pipeline = replay.name(REPLAY_PIPELINE, slots[0]);
+            replay.gl.BindProgramPipeline(pipeline);
+            return true;
+        }
+        case 403: {
+            GLsizei n = (GLsizei)slots[0];
+            replay.gl.DeleteProgramPipelines(n, replay.names_of(REPLAY_PIPELINE, 1, n));
+            return true;
+        }
+        case 404: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.GenProgramPipelines(n, created);
+            replay.created(REPLAY_PIPELINE, 1, n, created);
+            return true;
+        }
+        case 405: {
+            GLuint pipeline = replay.name(REPLAY_PIPELINE, slots[0]);
+            replay.gl.IsProgramPipeline(pipeline);
+            return true;
+        }
+        case 406: {
+            GLuint pipeline = replay.name(REPLAY_PIPELINE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetProgramPipelineiv(pipeline, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 407: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLint v0 = (GLint)slots[2];
+            replay.gl.ProgramUniform1i(program, location, v0);
+            return true;
+        }
+        case 408: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform1iv(program, location, count, (const GLint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 409: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLfloat v0 = (GLfloat)replay.real(slots[2]);
+            replay.gl.ProgramUniform1f(program, location, v0);
+            return true;
+        }
+        case 410: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform1fv(program, location, count, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 411: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLdouble v0 = (GLdouble)replay.real(slots[2]);
+            replay.gl.ProgramUniform1d(program, location, v0);
+            return true;
+        }
+        case 412: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform1dv(program, location, count, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 413: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLuint v0 = (GLuint)slots[2];
+            replay.gl.ProgramUniform1ui(program, location, v0);
+            return true;
+        }
+        case 414: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform1uiv(program, location, count, (const GLuint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 415: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLint v0 = (GLint)slots[2];
+            GLint v1 = (GLint)slots[3];
+            replay.gl.ProgramUniform2i(program, location, v0, v1);
+            return true;
+        }
+        case 416: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform2iv(program, location, count, (const GLint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 417: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLfloat v0 = (GLfloat)replay.real(slots[2]);
+            GLfloat v1 = (GLfloat)replay.real(slots[3]);
+            replay.gl.ProgramUniform2f(program, location, v0, v1);
+            return true;
+        }
+        case 418: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform2fv(program, location, count, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 419: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLdouble v0 = (GLdouble)replay.real(slots[2]);
+            GLdouble v1 = (GLdouble)replay.real(slots[3]);
+            replay.gl.ProgramUniform2d(program, location, v0, v1);
+            return true;
+        }
+        case 420: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform2dv(program, location, count, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 421: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLuint v0 = (GLuint)slots[2];
+            GLuint v1 = (GLuint)slots[3];
+            replay.gl.ProgramUniform2ui(program, location, v0, v1);
+            return true;
+        }
+        case 422: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform2uiv(program, location, count, (const GLuint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 423: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLint v0 = (GLint)slots[2];
+            GLint v1 = (GLint)slots[3];
+            GLint v2 = (GLint)slots[4];
+            replay.gl.ProgramUniform3i(program, location, v0, v1, v2);
+            return true;
+        }
+        case 424: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform3iv(program, location, count, (const GLint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 425: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLfloat v0 = (GLfloat)replay.real(slots[2]);
+            GLfloat v1 = (GLfloat)replay.real(slots[3]);
+            GLfloat v2 = (GLfloat)replay.real(slots[4]);
+            replay.gl.ProgramUniform3f(program, location, v0, v1, v2);
+            return true;
+        }
+        case 426: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform3fv(program, location, count, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 427: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLdouble v0 = (GLdouble)replay.real(slots[2]);
+            GLdouble v1 = (GLdouble)replay.real(slots[3]);
+            GLdouble v2 = (GLdouble)replay.real(slots[4]);
+            replay.gl.ProgramUniform3d(program, location, v0, v1, v2);
+            return true;
+        }
+        case 428: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform3dv(program, location, count, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 429: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLuint v0 = (GLuint)slots[2];
+            GLuint v1 = (GLuint)slots[3];
+            GLuint v2 = (GLuint)slots[4];
+            replay.gl.ProgramUniform3ui(program, location, v0, v1, v2);
+            return true;
+        }
+        case 430: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform3uiv(program, location, count, (const GLuint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 431: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLint v0 = (GLint)slots[2];
+            GLint v1 = (GLint)slots[3];
+            GLint v2 = (GLint)slots[4];
+            GLint v3 = (GLint)slots[5];
+            replay.gl.ProgramUniform4i(program, location, v0, v1, v2, v3);
+            return true;
+        }
+        case 432: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform4iv(program, location, count, (const GLint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 433: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLfloat v0 = (GLfloat)replay.real(slots[2]);
+            GLfloat v1 = (GLfloat)replay.real(slots[3]);
+            GLfloat v2 = (GLfloat)replay.real(slots[4]);
+            GLfloat v3 = (GLfloat)replay.real(slots[5]);
+            replay.gl.ProgramUniform4f(program, location, v0, v1, v2, v3);
+            return true;
+        }
+        case 434: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform4fv(program, location, count, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 435: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLdouble v0 = (GLdouble)replay.real(slots[2]);
+            GLdouble v1 = (GLdouble)replay.real(slots[3]);
+            GLdouble v2 = (GLdouble)replay.real(slots[4]);
+            GLdouble v3 = (GLdouble)replay.real(slots[5]);
+            replay.gl.ProgramUniform4d(program, location, v0, v1, v2, v3);
+            return true;
+        }
+        case 436: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform4dv(program, location, count, (const GLdouble *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 437: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLuint v0 = (GLuint)slots[2];
+            GLuint v1 = (GLuint)slots[3];
+            GLuint v2 = (GLuint)slots[4];
+            GLuint v3 = (GLuint)slots[5];
+            replay.gl.ProgramUniform4ui(program, location, v0, v1, v2, v3);
+            return true;
+        }
+        case 438: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            replay.gl.ProgramUniform4uiv(program, location, count, (const GLuint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 439: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix2fv(program, location, count, transpose, (const GLfloat *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 440: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix3fv(program, location, count, transpose, (const GLfloat *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 441: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix4fv(program, location, count, transpose, (const GLfloat *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 442: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix2dv(program, location, count, transpose, (const GLdouble *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 443: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix3dv(program, location, count, transpose, (const GLdouble *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 444: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix4dv(program, location, count, transpose, (const GLdouble *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 445: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix2x3fv(program, location, count, transpose, (const GLfloat *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 446: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix3x2fv(program, location, count, transpose, (const GLfloat *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 447: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix2x4fv(program, location, count, transpose, (const GLfloat *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 448: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix4x2fv(program, location, count, transpose, (const GLfloat *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 449: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix3x4fv(program, location, count, transpose, (const GLfloat *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 450: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix4x3fv(program, location, count, transpose, (const GLfloat *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 451: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix2x3dv(program, location, count, transpose, (const GLdouble *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 452: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix3x2dv(program, location, count, transpose, (const GLdouble *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 453: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix2x4dv(program, location, count, transpose, (const GLdouble *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 454: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix4x2dv(program, location, count, transpose, (const GLdouble *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 455: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix3x4dv(program, location, count, transpose, (const GLdouble *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 456: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLboolean transpose = (GLboolean)slots[3];
+            replay.gl.ProgramUniformMatrix4x3dv(program, location, count, transpose, (const GLdouble *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 457: {
+            GLuint pipeline = replay.name(REPLAY_PIPELINE, slots[0]);
+            replay.gl.ValidateProgramPipeline(pipeline);
+            return true;
+        }
+        case 458: {
+            GLuint pipeline = replay.name(REPLAY_PIPELINE, slots[0]);
+            GLsizei bufSize = (GLsizei)slots[1];
+            replay.gl.GetProgramPipelineInfoLog(pipeline, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 459: {
+            GLuint index = (GLuint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            replay.gl.VertexAttribL1d(index, x);
+            return true;
+        }
+        case 460: {
+            GLuint index = (GLuint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            GLdouble y = (GLdouble)replay.real(slots[2]);
+            replay.gl.VertexAttribL2d(index, x, y);
+            return true;
+        }
+        case 461: {
+            GLuint index = (GLuint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            GLdouble y = (GLdouble)replay.real(slots[2]);
+            GLdouble z = (GLdouble)replay.real(slots[3]);
+            replay.gl.VertexAttribL3d(index, x, y, z);
+            return true;
+        }
+        case 462: {
+            GLuint index = (GLuint)slots[0];
+            GLdouble x = (GLdouble)replay.real(slots[1]);
+            GLdouble y = (GLdouble)replay.real(slots[2]);
+            GLdouble z = (GLdouble)replay.real(slots[3]);
+            GLdouble w = (GLdouble)replay.real(slots[4]);
+            replay.gl.VertexAttribL4d(index, x, y, z, w);
+            return true;
+        }
+        case 463: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribL1dv(index, (const GLdouble *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 464: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribL2dv(index, (const GLdouble *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 465: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribL3dv(index, (const GLdouble *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 466: {
+            GLuint index = (GLuint)slots[0];
+            replay.gl.VertexAttribL4dv(index, (const GLdouble *)replay.input(1, slots[1]));
+            return true;
+        }
+        case 467: {
+            GLuint index = (GLuint)slots[0];
+            GLint size = (GLint)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLsizei stride = (GLsizei)slots[3];
+            replay.gl.VertexAttribLPointer(index, size, type, stride, (const void *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 468: {
+            GLuint index = (GLuint)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetVertexAttribLdv(index, pname, (GLdouble *)replay.output(0));
+            return true;
+        }
+        case 470: {
+            GLuint index = (GLuint)slots[0];
+            GLfloat x = (GLfloat)replay.real(slots[1]);
+            GLfloat y = (GLfloat)replay.real(slots[2]);
+            GLfloat w = (GLfloat)replay.real(slots[3]);
+            GLfloat h = (GLfloat)replay.real(slots[4]);
+            replay.gl.ViewportIndexedf(index, x, y, w, h);
+            return true;
+        }
+        case 473: {
+            GLuint index = (GLuint)slots[0];
+            GLint left = (GLint)slots[1];
+            GLint bottom = (GLint)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            replay.gl.ScissorIndexed(index, left, bottom, width, height);
+            return true;
+        }
+        case 476: {
+            GLuint index = (GLuint)slots[0];
+            GLdouble n = (GLdouble)replay.real(slots[1]);
+            GLdouble f = (GLdouble)replay.real(slots[2]);
+            replay.gl.DepthRangeIndexed(index, n, f);
+            return true;
+        }
+        case 477: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.GetFloati_v(target, index, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 478: {
+            GLenum target = (GLenum)slots[0];
+            GLuint index = (GLuint)slots[1];
+            replay.gl.GetDoublei_v(target, index, (GLdouble *)replay.output(0));
+            return true;
+        }
+        case 479: {
+            GLenum mode = (GLenum)slots[0];
+            GLint first = (GLint)slots[1];
+            GLsizei count = (GLsizei)slots[2];
+            GLsizei instancecount = (GLsizei)slots[3];
+            GLuint baseinstance = (GLuint)slots[4];
+            replay.gl.DrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+            return true;
+        }
+        case 480: {
+            GLenum mode = (GLenum)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLsizei instancecount = (GLsizei)slots[4];
+            GLuint baseinstance = (GLuint)slots[5];
+            replay.gl.DrawElementsInstancedBaseInstance(mode, count, type, (const void *)replay.input(3, slots[3]), instancecount, baseinstance);
+            return true;
+        }
+        case 481: {
+            GLenum mode = (GLenum)slots[0];
+            GLsizei count = (GLsizei)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLsizei instancecount = (GLsizei)slots[4];
+            GLint basevertex = (GLint)slots[5];
+            GLuint baseinstance = (GLuint)slots[6];
+            replay.gl.DrawElementsInstancedBaseVertexBaseInstance(mode, count, type, (const void *)replay.input(3, slots[3]), instancecount, basevertex, baseinstance);
+            return true;
+        }
+        case 482: {
+            GLenum target = (GLenum)slots[0];
+            GLenum internalformat = (GLenum)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            GLsizei bufSize = (GLsizei)slots[3];
+            replay.gl.GetInternalformativ(target, internalformat, pname, bufSize, (GLint *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 483: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint bufferIndex = (GLuint)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetActiveAtomicCounterBufferiv(program, bufferIndex, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 484: {
+            GLuint unit = (GLuint)slots[0];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[1]);
+            GLint level = (GLint)slots[2];
+            GLboolean layered = (GLboolean)slots[3];
+            GLint layer = (GLint)slots[4];
+            GLenum access = (GLenum)slots[5];
+            GLenum format = (GLenum)slots[6];
+            replay.gl.BindImageTexture(unit, texture, level, layered, layer, access, format);
+            return true;
+        }
+        case 485: {
+            GLbitfield barriers = (GLbitfield)slots[0];
+            replay.gl.MemoryBarrier(barriers);
+            return true;
+        }
+        case 486: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei levels = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            replay.gl.TexStorage1D(target, levels, internalformat, width);
+            return true;
+        }
+        case 487: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei levels = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            replay.gl.TexStorage2D(target, levels, internalformat, width, height);
+            return true;
+        }
+        case 488: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei levels = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLsizei depth = (GLsizei)slots[5];
+            replay.gl.TexStorage3D(target, levels, internalformat, width, height, depth);
+            return true;
+        }
+        case 489: {
+            GLenum mode = (GLenum)slots[0];
+            GLuint id = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[1]);
+            GLsizei instancecount = (GLsizei)slots[2];
+            replay.gl.DrawTransformFeedbackInstanced(mode, id, instancecount);
+            return true;
+        }
+        case 490: {
+            GLenum mode = (GLenum)slots[0];
+            GLuint id = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[1]);
+            GLuint stream = (GLuint)slots[2];
+            GLsizei instancecount = (GLsizei)slots[3];
+            replay.gl.DrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+            return true;
+        }
+        case 491: {
+            GLenum target = (GLenum)slots[0];
+            GLenum internalformat = (GLenum)slots[1];
+            GLenum format = (GLenum)slots[2];
+            GLenum type = (GLenum)slots[3];
+            replay.gl.ClearBufferData(target, internalformat, format, type, (const void *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 492: {
+            GLenum target = (GLenum)slots[0];
+            GLenum internalformat = (GLenum)slots[1];
+            GLintptr offset = (GLintptr)slots[2];
+            GLsizeiptr size = (GLsizeiptr)slots[3];
+            GLenum format = (GLenum)slots[4];
+            GLenum type = (GLenum)slots[5];
+            replay.gl.ClearBufferSubData(target, internalformat, offset, size, format, type, (const void *)replay.input(6, slots[6]));
+            return true;
+        }
+        case 493: {
+            GLuint num_groups_x = (GLuint)slots[0];
+            GLuint num_groups_y = (GLuint)slots[1];
+            GLuint num_groups_z = (GLuint)slots[2];
+            replay.gl.DispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+            return true;
+        }
+        case 494: {
+            GLintptr indirect = (GLintptr)slots[0];
+            replay.gl.DispatchComputeIndirect(indirect);
+            return true;
+        }
+        case 495: {
+            GLuint srcName = (GLuint)slots[0];
+            GLenum srcTarget = (GLenum)slots[1];
+            GLint srcLevel = (GLint)slots[2];
+            GLint srcX = (GLint)slots[3];
+            GLint srcY = (GLint)slots[4];
+            GLint srcZ = (GLint)slots[5];
+            GLuint dstName = (GLuint)slots[6];
+            GLenum dstTarget = (GLenum)slots[7];
+            GLint dstLevel = (GLint)slots[8];
+            GLint dstX = (GLint)slots[9];
+            GLint dstY = (GLint)slots[10];
+            GLint dstZ = (GLint)slots[11];
+            GLsizei srcWidth = (GLsizei)slots[12];
+            GLsizei srcHeight = (GLsizei)slots[13];
+            GLsizei srcDepth = (GLsizei)slots[14];
+            replay.gl.CopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+            return true;
+        }
+        case 496: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            GLint param = (GLint)slots[2];
+            replay.gl.FramebufferParameteri(target, pname, param);
+            return true;
+        }
+        case 497: {
+            GLenum target = (GLenum)slots[0];
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetFramebufferParameteriv(target, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 498: {
+            GLenum target = (GLenum)slots[0];
+            GLenum internalformat = (GLenum)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            GLsizei bufSize = (GLsizei)slots[3];
+            replay.gl.GetInternalformati64v(target, internalformat, pname, bufSize, (GLint64 *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 499: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            GLsizei depth = (GLsizei)slots[7];
+            replay.gl.InvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+            return true;
+        }
+        case 500: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            replay.gl.InvalidateTexImage(texture, level);
+            return true;
+        }
+        case 501: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLintptr offset = (GLintptr)slots[1];
+            GLsizeiptr length = (GLsizeiptr)slots[2];
+            replay.gl.InvalidateBufferSubData(buffer, offset, length);
+            return true;
+        }
+        case 502: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            replay.gl.InvalidateBufferData(buffer);
+            return true;
+        }
+        case 503: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei numAttachments = (GLsizei)slots[1];
+            replay.gl.InvalidateFramebuffer(target, numAttachments, (const GLenum *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 504: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei numAttachments = (GLsizei)slots[1];
+            GLint x = (GLint)slots[3];
+            GLint y = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            replay.gl.InvalidateSubFramebuffer(target, numAttachments, (const GLenum *)replay.input(2, slots[2]), x, y, width, height);
+            return true;
+        }
+        case 505: {
+            GLenum mode = (GLenum)slots[0];
+            GLsizei drawcount = (GLsizei)slots[2];
+            GLsizei stride = (GLsizei)slots[3];
+            replay.gl.MultiDrawArraysIndirect(mode, (const void *)replay.input(1, slots[1]), drawcount, stride);
+            return true;
+        }
+        case 506: {
+            GLenum mode = (GLenum)slots[0];
+            GLenum type = (GLenum)slots[1];
+            GLsizei drawcount = (GLsizei)slots[3];
+            GLsizei stride = (GLsizei)slots[4];
+            replay.gl.MultiDrawElementsIndirect(mode, type, (const void *)replay.input(2, slots[2]), drawcount, stride);
+            return true;
+        }
+        case 507: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum programInterface = (GLenum)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetProgramInterfaceiv(program, programInterface, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 508: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum programInterface = (GLenum)slots[1];
+            replay.gl.GetProgramResourceIndex(program, programInterface, replay.text(2, slots[2]));
+            return true;
+        }
+        case 509: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum programInterface = (GLenum)slots[1];
+            GLuint index = (GLuint)slots[2];
+            GLsizei bufSize = (GLsizei)slots[3];
+            replay.gl.GetProgramResourceName(program, programInterface, index, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 511: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum programInterface = (GLenum)slots[1];
+            replay.gl.GetProgramResourceLocation(program, programInterface, replay.text(2, slots[2]));
+            return true;
+        }
+        case 512: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLenum programInterface = (GLenum)slots[1];
+            replay.gl.GetProgramResourceLocationIndex(program, programInterface, replay.text(2, slots[2]));
+            return true;
+        }
+        case 513: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLuint storageBlockIndex = (GLuint)slots[1];
+            GLuint storageBlockBinding = (GLuint)slots[2];
+            replay.gl.ShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+            return true;
+        }
+        case 514: {
+            GLenum target = (GLenum)slots[0];
+            GLenum internalformat = (GLenum)slots[1];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[2]);
+            GLintptr offset = (GLintptr)slots[3];
+            GLsizeiptr size = (GLsizeiptr)slots[4];
+            replay.gl.TexBufferRange(target, internalformat, buffer, offset, size);
+            return true;
+        }
+        case 515: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei samples = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLboolean fixedsamplelocations = (GLboolean)slots[5];
+            replay.gl.TexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+            return true;
+        }
+        case 516: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei samples = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLsizei depth = (GLsizei)slots[5];
+            GLboolean fixedsamplelocations = (GLboolean)slots[6];
+            replay.gl.TexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+            return true;
+        }
+        case 517: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum target = (GLenum)slots[1];
+            GLuint origtexture = (GLuint)slots[2];
+            GLenum internalformat = (GLenum)slots[3];
+            GLuint minlevel = (GLuint)slots[4];
+            GLuint numlevels = (GLuint)slots[5];
+            GLuint minlayer = (GLuint)slots[6];
+            GLuint numlayers = (GLuint)slots[7];
+            replay.gl.TextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+            return true;
+        }
+        case 518: {
+            GLuint bindingindex = (GLuint)slots[0];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[1]);
+            GLintptr offset = (GLintptr)slots[2];
+            GLsizei stride = (GLsizei)slots[3];
+            replay.gl.BindVertexBuffer(bindingindex, buffer, offset, stride);
+            return true;
+        }
+        case 519: {
+            GLuint attribindex = (GLuint)slots[0];
+            GLint size = (GLint)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLboolean normalized = (GLboolean)slots[3];
+            GLuint relativeoffset = (GLuint)slots[4];
+            replay.gl.VertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+            return true;
+        }
+        case 520: {
+            GLuint attribindex = (GLuint)slots[0];
+            GLint size = (GLint)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLuint relativeoffset = (GLuint)slots[3];
+            replay.gl.VertexAttribIFormat(attribindex, size, type, relativeoffset);
+            return true;
+        }
+        case 521: {
+            GLuint attribindex = (GLuint)slots[0];
+            GLint size = (GLint)slots[1];
+            GLenum type = (GLenum)slots[2];
+            GLuint relativeoffset = (GLuint)slots[3];
+            replay.gl.VertexAttribLFormat(attribindex, size, type, relativeoffset);
+            return true;
+        }
+        case 522: {
+            GLuint attribindex = (GLuint)slots[0];
+            GLuint bindingindex = (GLuint)slots[1];
+            replay.gl.VertexAttribBinding(attribindex, bindingindex);
+            return true;
+        }
+        case 523: {
+            GLuint bindingindex = (GLuint)slots[0];
+            GLuint divisor = (GLuint)slots[1];
+            replay.gl.VertexBindingDivisor(bindingindex, divisor);
+            return true;
+        }
+        case 524: {
+            GLenum source = (GLenum)slots[0];
+            GLenum type = (GLenum)slots[1];
+            GLenum severity = (GLenum)slots[2];
+            GLsizei count = (GLsizei)slots[3];
+            GLboolean enabled = (GLboolean)slots[5];
+            replay.gl.DebugMessageControl(source, type, severity, count, (const GLuint *)replay.input(4, slots[4]), enabled);
+            return true;
+        }
+        case 525: {
+            GLenum source = (GLenum)slots[0];
+            GLenum type = (GLenum)slots[1];
+            GLuint id = (GLuint)slots[2];
+            GLenum severity = (GLenum)slots[3];
+            GLsizei length = (GLsizei)slots[4];
+            replay.gl.DebugMessageInsert(source, type, id, severity, length, replay.text(5, slots[5]));
+            return true;
+        }
+        case 527: {
+            GLuint count = (GLuint)slots[0];
+            GLsizei bufSize = (GLsizei)slots[1];
+            replay.gl.GetDebugMessageLog(count, bufSize, (GLenum *)replay.output((size_t)bufSize), (GLenum *)replay.output((size_t)bufSize), (GLuint *)replay.output((size_t)bufSize), (GLenum *)replay.output((size_t)bufSize), (GLsizei *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 528: {
+            GLenum source = (GLenum)slots[0];
+            GLuint id = (GLuint)slots[1];
+            GLsizei length = (GLsizei)slots[2];
+            replay.gl.PushDebugGroup(source, id, length, replay.text(3, slots[3]));
+            return true;
+        }
+        case 529: {
+            replay.gl.PopDebugGroup();
+            return true;
+        }
+        case 530: {
+            GLenum identifier = (GLenum)slots[0];
+            GLuint name = replay.name(replay.label_namespace(identifier), slots[1]);
+            GLsizei length = (GLsizei)slots[2];
+            replay.gl.ObjectLabel(identifier, name, length, replay.text(3, slots[3]));
+            return true;
+        }
+        case 531: {
+            GLenum identifier = (GLenum)slots[0];
+            GLuint name = replay.name(replay.label_namespace(identifier), slots[1]);
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetObjectLabel(identifier, name, bufSize, (GLsizei *)replay.output((size_t)bufSize), (GLchar *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 534: {
+            GLenum target = (GLenum)slots[0];
+            GLsizeiptr size = (GLsizeiptr)slots[1];
+            GLbitfield flags = (GLbitfield)slots[3];
+            replay.gl.BufferStorage(target, size, (const void *)replay.input(2, slots[2]), flags);
+            return true;
+        }
+        case 535: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLenum format = (GLenum)slots[2];
+            GLenum type = (GLenum)slots[3];
+            replay.gl.ClearTexImage(texture, level, format, type, (const void *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 536: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            GLsizei depth = (GLsizei)slots[7];
+            GLenum format = (GLenum)slots[8];
+            GLenum type = (GLenum)slots[9];
+            replay.gl.ClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, (const void *)replay.input(10, slots[10]));
+            return true;
+        }
+        case 543: {
+            GLenum origin = (GLenum)slots[0];
+            GLenum depth = (GLenum)slots[1];
+            replay.gl.ClipControl(origin, depth);
+            return true;
+        }
+        case 544: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.CreateTransformFeedbacks(n, created);
+            replay.created(REPLAY_TRANSFORM_FEEDBACK, 1, n, created);
+            return true;
+        }
+        case 545: {
+            GLuint xfb = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[2]);
+            replay.gl.TransformFeedbackBufferBase(xfb, index, buffer);
+            return true;
+        }
+        case 546: {
+            GLuint xfb = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[2]);
+            GLintptr offset = (GLintptr)slots[3];
+            GLsizeiptr size = (GLsizeiptr)slots[4];
+            replay.gl.TransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+            return true;
+        }
+        case 547: {
+            GLuint xfb = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetTransformFeedbackiv(xfb, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 548: {
+            GLuint xfb = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            GLuint index = (GLuint)slots[2];
+            replay.gl.GetTransformFeedbacki_v(xfb, pname, index, (GLint *)replay.output(0));
+            return true;
+        }
+        case 549: {
+            GLuint xfb = replay.name(REPLAY_TRANSFORM_FEEDBACK, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            GLuint index = (GLuint)slots[2];
+            replay.gl.GetTransformFeedbacki64_v(xfb, pname, index, (GLint64 *)replay.output(0));
+            return true;
+        }
+        case 550: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.CreateBuffers(n, created);
+            replay.created(REPLAY_BUFFER, 1, n, created);
+            return true;
+        }
+        case 551: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLsizeiptr size = (GLsizeiptr)slots[1];
+            GLbitfield flags = (GLbitfield)slots[3];
+            replay.gl.NamedBufferStorage(buffer, size, (const void *)replay.input(2, slots[2]), flags);
+            return true;
+        }
+        case 552: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLsizeiptr size = (GLsizeiptr)slots[1];
+            GLenum usage = (GLenum)slots[3];
+            replay.gl.NamedBufferData(buffer, size, (const void *)replay.input(2, slots[2]), usage);
+            return true;
+        }
+        case 553: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLintptr offset = (GLintptr)slots[1];
+            GLsizeiptr size = (GLsizeiptr)slots[2];
+            replay.gl.NamedBufferSubData(buffer, offset, size, (const void *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 554: {
+            GLuint readBuffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLuint writeBuffer = replay.name(REPLAY_BUFFER, slots[1]);
+            GLintptr readOffset = (GLintptr)slots[2];
+            GLintptr writeOffset = (GLintptr)slots[3];
+            GLsizeiptr size = (GLsizeiptr)slots[4];
+            replay.gl.CopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+            return true;
+        }
+        case 555: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLenum internalformat = (GLenum)slots[1];
+            GLenum format = (GLenum)slots[2];
+            GLenum type = (GLenum)slots[3];
+            replay.gl.ClearNamedBufferData(buffer, internalformat, format, type, (const void *)replay.input(4, slots[4]));
+            return true;
+        }
+        case 556: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLenum internalformat = (GLenum)slots[1];
+            GLintptr offset = (GLintptr)slots[2];
+            GLsizeiptr size = (GLsizeiptr)slots[3];
+            GLenum format = (GLenum)slots[4];
+            GLenum type = (GLenum)slots[5];
+            replay.gl.ClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, (const void *)replay.input(6, slots[6]));
+            return true;
+        }
+        case 557: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLenum access = (GLenum)slots[1];
+            replay.gl.MapNamedBuffer(buffer, access);
+            return true;
+        }
+        case 558: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLintptr offset = (GLintptr)slots[1];
+            GLsizeiptr length = (GLsizeiptr)slots[2];
+            GLbitfield access = (GLbitfield)slots[3];
+            replay.gl.MapNamedBufferRange(buffer, offset, length, access);
+            return true;
+        }
+        case 559: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            replay.gl.UnmapNamedBuffer(buffer);
+            return true;
+        }
+        case 560: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLintptr offset = (GLintptr)slots[1];
+            GLsizeiptr length = (GLsizeiptr)slots[2];
+            replay.gl.FlushMappedNamedBufferRange(buffer, offset, length);
+            return true;
+        }
+        case 561: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetNamedBufferParameteriv(buffer, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 562: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetNamedBufferParameteri64v(buffer, pname, (GLint64 *)replay.output(0));
+            return true;
+        }
+        case 563: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetNamedBufferPointerv(buffer, pname, (void **)replay.output(0));
+            return true;
+        }
+        case 564: {
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[0]);
+            GLintptr offset = (GLintptr)slots[1];
+            GLsizeiptr size = (GLsizeiptr)slots[2];
+            replay.gl.GetNamedBufferSubData(buffer, offset, size, (void *)replay.output((size_t)size));
+            return true;
+        }
+        case 565: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.CreateFramebuffers(n, created);
+            replay.created(REPLAY_FRAMEBUFFER, 1, n, created);
+            return true;
+        }
+        case 566: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum attachment = (GLenum)slots[1];
+            GLenum renderbuffertarget = (GLenum)slots[2];
+            GLuint renderbuffer = replay.name(REPLAY_RENDERBUFFER, slots[3]);
+            replay.gl.NamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+            return true;
+        }
+        case 567: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            GLint param = (GLint)slots[2];
+            replay.gl.NamedFramebufferParameteri(framebuffer, pname, param);
+            return true;
+        }
+        case 568: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum attachment = (GLenum)slots[1];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[2]);
+            GLint level = (GLint)slots[3];
+            replay.gl.NamedFramebufferTexture(framebuffer, attachment, texture, level);
+            return true;
+        }
+        case 569: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum attachment = (GLenum)slots[1];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[2]);
+            GLint level = (GLint)slots[3];
+            GLint layer = (GLint)slots[4];
+            replay.gl.NamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+            return true;
+        }
+        case 570: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum buf = (GLenum)slots[1];
+            replay.gl.NamedFramebufferDrawBuffer(framebuffer, buf);
+            return true;
+        }
+        case 572: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum src = (GLenum)slots[1];
+            replay.gl.NamedFramebufferReadBuffer(framebuffer, src);
+            return true;
+        }
+        case 575: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum buffer = (GLenum)slots[1];
+            GLint drawbuffer = (GLint)slots[2];
+            replay.gl.ClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, (const GLint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 576: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum buffer = (GLenum)slots[1];
+            GLint drawbuffer = (GLint)slots[2];
+            replay.gl.ClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, (const GLuint *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 577: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum buffer = (GLenum)slots[1];
+            GLint drawbuffer = (GLint)slots[2];
+            replay.gl.ClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, (const GLfloat *)replay.input(3, slots[3]));
+            return true;
+        }
+        case 578: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum buffer = (GLenum)slots[1];
+            GLint drawbuffer = (GLint)slots[2];
+            GLfloat depth = (GLfloat)replay.real(slots[3]);
+            GLint stencil = (GLint)slots[4];
+            replay.gl.ClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+            return true;
+        }
+        case 579: {
+            GLuint readFramebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLuint drawFramebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[1]);
+            GLint srcX0 = (GLint)slots[2];
+            GLint srcY0 = (GLint)slots[3];
+            GLint srcX1 = (GLint)slots[4];
+            GLint srcY1 = (GLint)slots[5];
+            GLint dstX0 = (GLint)slots[6];
+            GLint dstY0 = (GLint)slots[7];
+            GLint dstX1 = (GLint)slots[8];
+            GLint dstY1 = (GLint)slots[9];
+            GLbitfield mask = (GLbitfield)slots[10];
+            GLenum filter = (GLenum)slots[11];
+            replay.gl.BlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+            return true;
+        }
+        case 580: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum target = (GLenum)slots[1];
+            replay.gl.CheckNamedFramebufferStatus(framebuffer, target);
+            return true;
+        }
+        case 581: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetNamedFramebufferParameteriv(framebuffer, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 582: {
+            GLuint framebuffer = replay.name(REPLAY_FRAMEBUFFER, slots[0]);
+            GLenum attachment = (GLenum)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 583: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.CreateRenderbuffers(n, created);
+            replay.created(REPLAY_RENDERBUFFER, 1, n, created);
+            return true;
+        }
+        case 584: {
+            GLuint renderbuffer = replay.name(REPLAY_RENDERBUFFER, slots[0]);
+            GLenum internalformat = (GLenum)slots[1];
+            GLsizei width = (GLsizei)slots[2];
+            GLsizei height = (GLsizei)slots[3];
+            replay.gl.NamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+            return true;
+        }
+        case 585: {
+            GLuint renderbuffer = replay.name(REPLAY_RENDERBUFFER, slots[0]);
+            GLsizei samples = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            replay.gl.NamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+            return true;
+        }
+        case 586: {
+            GLuint renderbuffer = replay.name(REPLAY_RENDERBUFFER, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetNamedRenderbufferParameteriv(renderbuffer, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 587: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei n = (GLsizei)slots[1];
+            replay.gl.CreateTextures(target, n, (GLuint *)replay.output(0));
+            return true;
+        }
+        case 588: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum internalformat = (GLenum)slots[1];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[2]);
+            replay.gl.TextureBuffer(texture, internalformat, buffer);
+            return true;
+        }
+        case 589: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum internalformat = (GLenum)slots[1];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[2]);
+            GLintptr offset = (GLintptr)slots[3];
+            GLsizeiptr size = (GLsizeiptr)slots[4];
+            replay.gl.TextureBufferRange(texture, internalformat, buffer, offset, size);
+            return true;
+        }
+        case 590: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLsizei levels = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            replay.gl.TextureStorage1D(texture, levels, internalformat, width);
+            return true;
+        }
+        case 591: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLsizei levels = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            replay.gl.TextureStorage2D(texture, levels, internalformat, width, height);
+            return true;
+        }
+        case 592: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLsizei levels = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLsizei depth = (GLsizei)slots[5];
+            replay.gl.TextureStorage3D(texture, levels, internalformat, width, height, depth);
+            return true;
+        }
+        case 593: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLsizei samples = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLboolean fixedsamplelocations = (GLboolean)slots[5];
+            replay.gl.TextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+            return true;
+        }
+        case 594: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLsizei samples = (GLsizei)slots[1];
+            GLenum internalformat = (GLenum)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLsizei height = (GLsizei)slots[4];
+            GLsizei depth = (GLsizei)slots[5];
+            GLboolean fixedsamplelocations = (GLboolean)slots[6];
+            replay.gl.TextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+            return true;
+        }
+        case 595: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLenum format = (GLenum)slots[4];
+            GLenum type = (GLenum)slots[5];
+            replay.gl.TextureSubImage1D(texture, level, xoffset, width, format, type, (const void *)replay.input(6, slots[6]));
+            return true;
+        }
+        case 596: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLsizei width = (GLsizei)slots[4];
+            GLsizei height = (GLsizei)slots[5];
+            GLenum format = (GLenum)slots[6];
+            GLenum type = (GLenum)slots[7];
+            replay.gl.TextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, (const void *)replay.input(8, slots[8]));
+            return true;
+        }
+        case 597: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            GLsizei depth = (GLsizei)slots[7];
+            GLenum format = (GLenum)slots[8];
+            GLenum type = (GLenum)slots[9];
+            replay.gl.TextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, (const void *)replay.input(10, slots[10]));
+            return true;
+        }
+        case 598: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLsizei width = (GLsizei)slots[3];
+            GLenum format = (GLenum)slots[4];
+            GLsizei imageSize = (GLsizei)slots[5];
+            replay.gl.CompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, (const void *)replay.input(6, slots[6]));
+            return true;
+        }
+        case 599: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLsizei width = (GLsizei)slots[4];
+            GLsizei height = (GLsizei)slots[5];
+            GLenum format = (GLenum)slots[6];
+            GLsizei imageSize = (GLsizei)slots[7];
+            replay.gl.CompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, (const void *)replay.input(8, slots[8]));
+            return true;
+        }
+        case 600: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            GLsizei depth = (GLsizei)slots[7];
+            GLenum format = (GLenum)slots[8];
+            GLsizei imageSize = (GLsizei)slots[9];
+            replay.gl.CompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, (const void *)replay.input(10, slots[10]));
+            return true;
+        }
+        case 601: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint x = (GLint)slots[3];
+            GLint y = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            replay.gl.CopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+            return true;
+        }
+        case 602: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint x = (GLint)slots[4];
+            GLint y = (GLint)slots[5];
+            GLsizei width = (GLsizei)slots[6];
+            GLsizei height = (GLsizei)slots[7];
+            replay.gl.CopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+            return true;
+        }
+        case 603: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLint x = (GLint)slots[5];
+            GLint y = (GLint)slots[6];
+            GLsizei width = (GLsizei)slots[7];
+            GLsizei height = (GLsizei)slots[8];
+            replay.gl.CopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+            return true;
+        }
+        case 604: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            GLfloat param = (GLfloat)replay.real(slots[2]);
+            replay.gl.TextureParameterf(texture, pname, param);
+            return true;
+        }
+        case 605: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.TextureParameterfv(texture, pname, (const GLfloat *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 606: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            GLint param = (GLint)slots[2];
+            replay.gl.TextureParameteri(texture, pname, param);
+            return true;
+        }
+        case 607: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.TextureParameterIiv(texture, pname, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 608: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.TextureParameterIuiv(texture, pname, (const GLuint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 609: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.TextureParameteriv(texture, pname, (const GLint *)replay.input(2, slots[2]));
+            return true;
+        }
+        case 610: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            replay.gl.GenerateTextureMipmap(texture);
+            return true;
+        }
+        case 611: {
+            GLuint unit = (GLuint)slots[0];
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[1]);
+            replay.gl.BindTextureUnit(unit, texture);
+            return true;
+        }
+        case 612: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLenum format = (GLenum)slots[2];
+            GLenum type = (GLenum)slots[3];
+            GLsizei bufSize = (GLsizei)slots[4];
+            replay.gl.GetTextureImage(texture, level, format, type, bufSize, (void *)replay.pack(slots[5], (size_t)bufSize));
+            return true;
+        }
+        case 613: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetCompressedTextureImage(texture, level, bufSize, (void *)replay.pack(slots[3], (size_t)bufSize));
+            return true;
+        }
+        case 614: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetTextureLevelParameterfv(texture, level, pname, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 615: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetTextureLevelParameteriv(texture, level, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 616: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetTextureParameterfv(texture, pname, (GLfloat *)replay.output(0));
+            return true;
+        }
+        case 617: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetTextureParameterIiv(texture, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 618: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetTextureParameterIuiv(texture, pname, (GLuint *)replay.output(0));
+            return true;
+        }
+        case 619: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetTextureParameteriv(texture, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 620: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.CreateVertexArrays(n, created);
+            replay.created(REPLAY_VERTEX_ARRAY, 1, n, created);
+            return true;
+        }
+        case 621: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            replay.gl.DisableVertexArrayAttrib(vaobj, index);
+            return true;
+        }
+        case 622: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            replay.gl.EnableVertexArrayAttrib(vaobj, index);
+            return true;
+        }
+        case 623: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[1]);
+            replay.gl.VertexArrayElementBuffer(vaobj, buffer);
+            return true;
+        }
+        case 624: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint bindingindex = (GLuint)slots[1];
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[2]);
+            GLintptr offset = (GLintptr)slots[3];
+            GLsizei stride = (GLsizei)slots[4];
+            replay.gl.VertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+            return true;
+        }
+        case 626: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint attribindex = (GLuint)slots[1];
+            GLuint bindingindex = (GLuint)slots[2];
+            replay.gl.VertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+            return true;
+        }
+        case 627: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint attribindex = (GLuint)slots[1];
+            GLint size = (GLint)slots[2];
+            GLenum type = (GLenum)slots[3];
+            GLboolean normalized = (GLboolean)slots[4];
+            GLuint relativeoffset = (GLuint)slots[5];
+            replay.gl.VertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+            return true;
+        }
+        case 628: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint attribindex = (GLuint)slots[1];
+            GLint size = (GLint)slots[2];
+            GLenum type = (GLenum)slots[3];
+            GLuint relativeoffset = (GLuint)slots[4];
+            replay.gl.VertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+            return true;
+        }
+        case 629: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint attribindex = (GLuint)slots[1];
+            GLint size = (GLint)slots[2];
+            GLenum type = (GLenum)slots[3];
+            GLuint relativeoffset = (GLuint)slots[4];
+            replay.gl.VertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+            return true;
+        }
+        case 630: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint bindingindex = (GLuint)slots[1];
+            GLuint divisor = (GLuint)slots[2];
+            replay.gl.VertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+            return true;
+        }
+        case 631: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLenum pname = (GLenum)slots[1];
+            replay.gl.GetVertexArrayiv(vaobj, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 632: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetVertexArrayIndexediv(vaobj, index, pname, (GLint *)replay.output(0));
+            return true;
+        }
+        case 633: {
+            GLuint vaobj = replay.name(REPLAY_VERTEX_ARRAY, slots[0]);
+            GLuint index = (GLuint)slots[1];
+            GLenum pname = (GLenum)slots[2];
+            replay.gl.GetVertexArrayIndexed64iv(vaobj, index, pname, (GLint64 *)replay.output(0));
+            return true;
+        }
+        case 634: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.CreateSamplers(n, created);
+            replay.created(REPLAY_SAMPLER, 1, n, created);
+            return true;
+        }
+        case 635: {
+            GLsizei n = (GLsizei)slots[0];
+            GLuint * created = (GLuint *)replay.output(n * sizeof(GLuint));
+            replay.gl.CreateProgramPipelines(n, created);
+            replay.created(REPLAY_PIPELINE, 1, n, created);
+            return true;
+        }
+        case 636: {
+            GLenum target = (GLenum)slots[0];
+            GLsizei n = (GLsizei)slots[1];
+            replay.gl.CreateQueries(target, n, (GLuint *)replay.output(0));
+            return true;
+        }
+        case 637: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[1]);
+            GLenum pname = (GLenum)slots[2];
+            GLintptr offset = (GLintptr)slots[3];
+            replay.gl.GetQueryBufferObjecti64v(id, buffer, pname, offset);
+            return true;
+        }
+        case 638: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[1]);
+            GLenum pname = (GLenum)slots[2];
+            GLintptr offset = (GLintptr)slots[3];
+            replay.gl.GetQueryBufferObjectiv(id, buffer, pname, offset);
+            return true;
+        }
+        case 639: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[1]);
+            GLenum pname = (GLenum)slots[2];
+            GLintptr offset = (GLintptr)slots[3];
+            replay.gl.GetQueryBufferObjectui64v(id, buffer, pname, offset);
+            return true;
+        }
+        case 640: {
+            GLuint id = replay.name(REPLAY_QUERY, slots[0]);
+            GLuint buffer = replay.name(REPLAY_BUFFER, slots[1]);
+            GLenum pname = (GLenum)slots[2];
+            GLintptr offset = (GLintptr)slots[3];
+            replay.gl.GetQueryBufferObjectuiv(id, buffer, pname, offset);
+            return true;
+        }
+        case 641: {
+            GLbitfield barriers = (GLbitfield)slots[0];
+            replay.gl.MemoryBarrierByRegion(barriers);
+            return true;
+        }
+        case 642: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            GLsizei depth = (GLsizei)slots[7];
+            GLenum format = (GLenum)slots[8];
+            GLenum type = (GLenum)slots[9];
+            GLsizei bufSize = (GLsizei)slots[10];
+            replay.gl.GetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, (void *)replay.pack(slots[11], (size_t)bufSize));
+            return true;
+        }
+        case 643: {
+            GLuint texture = replay.name(REPLAY_TEXTURE, slots[0]);
+            GLint level = (GLint)slots[1];
+            GLint xoffset = (GLint)slots[2];
+            GLint yoffset = (GLint)slots[3];
+            GLint zoffset = (GLint)slots[4];
+            GLsizei width = (GLsizei)slots[5];
+            GLsizei height = (GLsizei)slots[6];
+            GLsizei depth = (GLsizei)slots[7];
+            GLsizei bufSize = (GLsizei)slots[8];
+            replay.gl.GetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, (void *)replay.pack(slots[9], (size_t)bufSize));
+            return true;
+        }
+        case 644: {
+            replay.gl.GetGraphicsResetStatus();
+            return true;
+        }
+        case 645: {
+            GLenum target = (GLenum)slots[0];
+            GLint lod = (GLint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetnCompressedTexImage(target, lod, bufSize, (void *)replay.pack(slots[3], (size_t)bufSize));
+            return true;
+        }
+        case 646: {
+            GLenum target = (GLenum)slots[0];
+            GLint level = (GLint)slots[1];
+            GLenum format = (GLenum)slots[2];
+            GLenum type = (GLenum)slots[3];
+            GLsizei bufSize = (GLsizei)slots[4];
+            replay.gl.GetnTexImage(target, level, format, type, bufSize, (void *)replay.pack(slots[5], (size_t)bufSize));
+            return true;
+        }
+        case 647: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetnUniformdv(program, location, bufSize, (GLdouble *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 648: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetnUniformfv(program, location, bufSize, (GLfloat *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 649: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetnUniformiv(program, location, bufSize, (GLint *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 650: {
+            GLuint program = replay.name(REPLAY_PROGRAM, slots[0]);
+            GLint location = (GLint)slots[1];
+            GLsizei bufSize = (GLsizei)slots[2];
+            replay.gl.GetnUniformuiv(program, location, bufSize, (GLuint *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 651: {
+            GLint x = (GLint)slots[0];
+            GLint y = (GLint)slots[1];
+            GLsizei width = (GLsizei)slots[2];
+            GLsizei height = (GLsizei)slots[3];
+            GLenum format = (GLenum)slots[4];
+            GLenum type = (GLenum)slots[5];
+            GLsizei bufSize = (GLsizei)slots[6];
+            replay.gl.ReadnPixels(x, y, width, height, format, type, bufSize, (void *)replay.output((size_t)bufSize));
+            return true;
+        }
+        case 652: {
+            replay.gl.TextureBarrier();
+            return true;
+        }
+        case 654: {
+            GLenum mode = (GLenum)slots[0];
+            GLintptr drawcount = (GLintptr)slots[2];
+            GLsizei maxdrawcount = (GLsizei)slots[3];
+            GLsizei stride = (GLsizei)slots[4];
+            replay.gl.MultiDrawArraysIndirectCount(mode, (const void *)replay.input(1, slots[1]), drawcount, maxdrawcount, stride);
+            return true;
+        }
+        case 655: {
+            GLenum mode = (GLenum)slots[0];
+            GLenum type = (GLenum)slots[1];
+            GLintptr drawcount = (GLintptr)slots[3];
+            GLsizei maxdrawcount = (GLsizei)slots[4];
+            GLsizei stride = (GLsizei)slots[5];
+            replay.gl.MultiDrawElementsIndirectCount(mode, type, (const void *)replay.input(2, slots[2]), drawcount, maxdrawcount, stride);
+            return true;
+        }
+        case 656: {
+            GLfloat factor = (GLfloat)replay.real(slots[0]);
+            GLfloat units = (GLfloat)replay.real(slots[1]);
+            GLfloat clamp = (GLfloat)replay.real(slots[2]);
+            replay.gl.PolygonOffsetClamp(factor, units, clamp);
+            return true;
+        }
+    }
+    return false;
+}
@@ -1,41 +1,27 @@
 import os
-import platform
 
 from setuptools import Extension, setup
 
 os.chdir(os.path.normpath(os.path.join(__file__, '..')))
-PLATFORMS = {'windows', 'linux', 'darwin', 'cygwin'}
-
-target = platform.system().lower()
-
-for known in PLATFORMS:
-    if target.startswith(known):
-        target = known
-
-if target not in PLATFORMS:
-    target = 'linux'
-
-libraries = {
-    'windows': ['gdi32', 'opengl32', 'user32'],
-    'linux': ['GL', 'dl', 'X11'],
-    'cygwin': ['GL', 'X11'],
-    'darwin': [],
-}
 
+# The GL functions are taken from the function table of a moderngl context, no GL library is linked
 sources = [
     'gltraces.cpp',
-    '../../moderngl/mgl/internal/opengl/gl_methods.cpp',
+    'recorder.cpp',
+    'wrappers.cpp',
+    'replayer.cpp',
+    'replays.cpp',
 ]
 
 gltraces = Extension(
     name='gltraces',
     sources=sources,
-    libraries=libraries[target],
-    include_dirs=['../..'],
+    include_dirs=['../../moderngl/src'],
 )
 
 setup(
     name='gltraces',
-    version='6.0.0',
+    version='5.6.0',
+    py_modules=['tracefile', 'decode', 'replay', 'analyze'],
     ext_modules=[gltraces],
 )
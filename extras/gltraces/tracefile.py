@@ -0,0 +1,212 @@
+'''
+    Reader for the trace files written by gltraces.
+
+    The layout is documented in recorder.hpp.
+'''
+
+import heapq
+import json
+import struct
+
+__all__ = ['TraceFile', 'Record', 'read_metadata', 'TRACE_MARK', 'TRACE_DATA', 'TRACE_HASH', 'TRACE_SIZE']
+
+TRACE_MAGIC = b'GLTRACE1'
+TRACE_MARK = 0xFFFFFFFF
+
+TRACE_DATA = 0
+TRACE_HASH = 1
+TRACE_SIZE = 2
+
+RECORD_HEADER = struct.Struct('<IIQQ')
+PAYLOAD_HEADER = struct.Struct('<IIQ')
+CHUNK_HEADER = struct.Struct('<II')
+
+
+def parse_header(data, path):
+    if data[:8] != TRACE_MAGIC:
+        raise ValueError('%s is not a trace file' % path)
+
+    version, size = struct.unpack_from('<II', data, 8)
+    if version != 1:
+        raise ValueError('unsupported trace version %d' % version)
+
+    metadata = json.loads(data[16:16 + size].decode())
+    functions = [(name, ret, [tuple(x) for x in params]) for name, ret, params in metadata['functions']]
+    enums = {int(value): name for value, name in metadata['enums'].items()}
+    return functions, enums, 16 + size
+
+
+def read_metadata(path):
+    '''
+        The functions and the enums of a trace file without reading the records.
+
+        Returns:
+            tuple: The functions as (name, return code, [(param, code), ...]) and the enum names by value.
+    '''
+
+    with open(path, 'rb') as f:
+        data = f.read(16)
+        size = struct.unpack_from('<I', data, 12)[0] if len(data) == 16 else 0
+        data += f.read(size)
+
+    functions, enums, _ = parse_header(data, path)
+    return functions, enums
+
+
+class Payload:
+    '''
+        The data behind a pointer argument.
+        The data is the bytes for TRACE_DATA, the hash for TRACE_HASH and None for TRACE_SIZE.
+    '''
+
+    __slots__ = ['kind', 'length', 'data']
+
+    def __init__(self, kind, length, data):
+        self.kind = kind
+        self.length = length
+        self.data = data
+
+    def __repr__(self):
+        return '<Payload: kind=%d length=%d>' % (self.kind, self.length)
+
+
+class Record:
+    '''
+        A recorded call or mark.
+    '''
+
+    __slots__ = ['thread', 'call', 'name', 'start', 'duration', 'args', 'result', 'payloads']
+
+    def __init__(self, thread, call, name, start, duration, args, result, payloads):
+        #: int: The index of the recording thread.
+        self.thread = thread
+
+        #: int: The index of the function in the metadata, TRACE_MARK for the marks.
+        self.call = call
+
+        #: str: The name of the function, ``mark`` for the marks.
+        self.name = name
+
+        #: int: The start of the call in nanoseconds.
+        self.start = start
+
+        #: int: The duration of the call in nanoseconds.
+        self.duration = duration
+
+        #: list: The arguments, floats for the floating point parameters and ints otherwise.
+        self.args = args
+
+        #: The returned value or None.
+        self.result = result
+
+        #: dict: The payloads by argument index.
+        self.payloads = payloads
+
+    @property
+    def is_mark(self) -> bool:
+        return self.call == TRACE_MARK
+
+    def text(self, arg) -> str:
+        '''
+            The string payload of an argument.
+        '''
+
+        payload = self.payloads.get(arg)
+        if payload is None or payload.kind != TRACE_DATA:
+            return None
+        return payload.data.decode('utf-8', 'replace')
+
+    def __repr__(self):
+        return '<Record: %s>' % self.name
+
+
+class TraceFile:
+    '''
+        A trace file loaded into memory.
+
+        Args:
+            path (str): The path of the file.
+    '''
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            data = f.read()
+
+        functions, enums, offset = parse_header(data, path)
+
+        #: list: The functions as (name, return code, [(param, code), ...]).
+        self.functions = functions
+
+        #: dict: The enum names by value.
+        self.enums = enums
+
+        streams = {}
+
+        while offset + CHUNK_HEADER.size <= len(data):
+            thread, length = CHUNK_HEADER.unpack_from(data, offset)
+            offset += CHUNK_HEADER.size
+            streams.setdefault(thread, []).append(data[offset:offset + length])
+            offset += length
+
+        #: dict: The raw record streams by thread.
+        self.streams = {thread: b''.join(chunks) for thread, chunks in streams.items()}
+
+    def thread_records(self, thread):
+        '''
+            The records of a single thread in the recorded order.
+        '''
+
+        stream = self.streams[thread]
+        offset = 0
+
+        while offset < len(stream):
+            call, size, start, duration = RECORD_HEADER.unpack_from(stream, offset)
+            end = offset + size
+            offset += RECORD_HEADER.size
+            args = []
+            result = None
+
+            if call == TRACE_MARK:
+                name = 'mark'
+            else:
+                name, ret, params = self.functions[call]
+                for _, code in params:
+                    args.append(self._value(stream, offset, code))
+                    offset += 8
+                if ret != 'v':
+                    result = self._value(stream, offset, ret)
+                    offset += 8
+
+            payloads = {}
+
+            while offset < end:
+                arg, kind, length = PAYLOAD_HEADER.unpack_from(stream, offset)
+                offset += PAYLOAD_HEADER.size
+                if kind == TRACE_DATA:
+                    value = bytes(stream[offset:offset + length])
+                    offset += (length + 7) & ~7
+                elif kind == TRACE_HASH:
+                    value = struct.unpack_from('<Q', stream, offset)[0]
+                    offset += 8
+                else:
+                    value = None
+                payloads[arg] = Payload(kind, length, value)
+
+            offset = end
+            yield Record(thread, call, name, start, duration, args, result, payloads)
+
+    def records(self):
+        '''
+            The records of every thread ordered by the start time.
+        '''
+
+        threads = [self.thread_records(thread) for thread in sorted(self.streams)]
+        return heapq.merge(*threads, key=lambda record: record.start)
+
+    @staticmethod
+    def _value(stream, offset, code):
+        if code in 'fd':
+            return struct.unpack_from('<d', stream, offset)[0]
+        if code == 'i':
+            return struct.unpack_from('<q', stream, offset)[0]
+        return struct.unpack_from('<Q', stream, offset)[0]
@@ -0,0 +1,12587 @@
+// Generated by generate.py from moderngl/src/gl_methods.hpp, do not edit.
+
+#include "recorder.hpp"
+
+static void GLAPI trace_CullFace(GLenum mode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CullFace(mode);
+        return;
+    }
+
+    TraceRecord rec(0);
+    rec.begin();
+    gl.CullFace(mode);
+    rec.end();
+    rec.argu(mode);
+    rec.commit();
+}
+
+static void GLAPI trace_FrontFace(GLenum mode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FrontFace(mode);
+        return;
+    }
+
+    TraceRecord rec(1);
+    rec.begin();
+    gl.FrontFace(mode);
+    rec.end();
+    rec.argu(mode);
+    rec.commit();
+}
+
+static void GLAPI trace_Hint(GLenum target, GLenum mode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Hint(target, mode);
+        return;
+    }
+
+    TraceRecord rec(2);
+    rec.begin();
+    gl.Hint(target, mode);
+    rec.end();
+    rec.argu(target);
+    rec.argu(mode);
+    rec.commit();
+}
+
+static void GLAPI trace_LineWidth(GLfloat width) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.LineWidth(width);
+        return;
+    }
+
+    TraceRecord rec(3);
+    rec.begin();
+    gl.LineWidth(width);
+    rec.end();
+    rec.argf(width);
+    rec.commit();
+}
+
+static void GLAPI trace_PointSize(GLfloat size) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PointSize(size);
+        return;
+    }
+
+    TraceRecord rec(4);
+    rec.begin();
+    gl.PointSize(size);
+    rec.end();
+    rec.argf(size);
+    rec.commit();
+}
+
+static void GLAPI trace_PolygonMode(GLenum face, GLenum mode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PolygonMode(face, mode);
+        return;
+    }
+
+    TraceRecord rec(5);
+    rec.begin();
+    gl.PolygonMode(face, mode);
+    rec.end();
+    rec.argu(face);
+    rec.argu(mode);
+    rec.commit();
+}
+
+static void GLAPI trace_Scissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Scissor(x, y, width, height);
+        return;
+    }
+
+    TraceRecord rec(6);
+    rec.begin();
+    gl.Scissor(x, y, width, height);
+    rec.end();
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_TexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexParameterf(target, pname, param);
+        return;
+    }
+
+    TraceRecord rec(7);
+    rec.begin();
+    gl.TexParameterf(target, pname, param);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argf(param);
+    rec.commit();
+}
+
+static void GLAPI trace_TexParameterfv(GLenum target, GLenum pname, const GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexParameterfv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(8);
+    rec.begin();
+    gl.TexParameterfv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.data(2, params, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_TexParameteri(GLenum target, GLenum pname, GLint param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexParameteri(target, pname, param);
+        return;
+    }
+
+    TraceRecord rec(9);
+    rec.begin();
+    gl.TexParameteri(target, pname, param);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argi(param);
+    rec.commit();
+}
+
+static void GLAPI trace_TexParameteriv(GLenum target, GLenum pname, const GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexParameteriv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(10);
+    rec.begin();
+    gl.TexParameteriv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.data(2, params, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexImage1D(target, level, internalformat, width, border, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(11);
+    rec.begin();
+    gl.TexImage1D(target, level, internalformat, width, border, format, type, pixels);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(internalformat);
+    rec.argi(width);
+    rec.argi(border);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.pixels(7, pixels, width, 1, 1, format, type);
+    rec.commit();
+}
+
+static void GLAPI trace_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(12);
+    rec.begin();
+    gl.TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(border);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.pixels(8, pixels, width, height, 1, format, type);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawBuffer(GLenum buf) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawBuffer(buf);
+        return;
+    }
+
+    TraceRecord rec(13);
+    rec.begin();
+    gl.DrawBuffer(buf);
+    rec.end();
+    rec.argu(buf);
+    rec.commit();
+}
+
+static void GLAPI trace_Clear(GLbitfield mask) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Clear(mask);
+        return;
+    }
+
+    TraceRecord rec(14);
+    rec.begin();
+    gl.Clear(mask);
+    rec.end();
+    rec.argu(mask);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearColor(red, green, blue, alpha);
+        return;
+    }
+
+    TraceRecord rec(15);
+    rec.begin();
+    gl.ClearColor(red, green, blue, alpha);
+    rec.end();
+    rec.argf(red);
+    rec.argf(green);
+    rec.argf(blue);
+    rec.argf(alpha);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearStencil(GLint s) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearStencil(s);
+        return;
+    }
+
+    TraceRecord rec(16);
+    rec.begin();
+    gl.ClearStencil(s);
+    rec.end();
+    rec.argi(s);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearDepth(GLdouble depth) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearDepth(depth);
+        return;
+    }
+
+    TraceRecord rec(17);
+    rec.begin();
+    gl.ClearDepth(depth);
+    rec.end();
+    rec.argf(depth);
+    rec.commit();
+}
+
+static void GLAPI trace_StencilMask(GLuint mask) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.StencilMask(mask);
+        return;
+    }
+
+    TraceRecord rec(18);
+    rec.begin();
+    gl.StencilMask(mask);
+    rec.end();
+    rec.argu(mask);
+    rec.commit();
+}
+
+static void GLAPI trace_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ColorMask(red, green, blue, alpha);
+        return;
+    }
+
+    TraceRecord rec(19);
+    rec.begin();
+    gl.ColorMask(red, green, blue, alpha);
+    rec.end();
+    rec.argu(red);
+    rec.argu(green);
+    rec.argu(blue);
+    rec.argu(alpha);
+    rec.commit();
+}
+
+static void GLAPI trace_DepthMask(GLboolean flag) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DepthMask(flag);
+        return;
+    }
+
+    TraceRecord rec(20);
+    rec.begin();
+    gl.DepthMask(flag);
+    rec.end();
+    rec.argu(flag);
+    rec.commit();
+}
+
+static void GLAPI trace_Disable(GLenum cap) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Disable(cap);
+        return;
+    }
+
+    TraceRecord rec(21);
+    rec.begin();
+    gl.Disable(cap);
+    rec.end();
+    rec.argu(cap);
+    rec.commit();
+}
+
+static void GLAPI trace_Enable(GLenum cap) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Enable(cap);
+        return;
+    }
+
+    TraceRecord rec(22);
+    rec.begin();
+    gl.Enable(cap);
+    rec.end();
+    rec.argu(cap);
+    rec.commit();
+}
+
+static void GLAPI trace_Finish() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Finish();
+        return;
+    }
+
+    TraceRecord rec(23);
+    rec.begin();
+    gl.Finish();
+    rec.end();
+    rec.commit();
+}
+
+static void GLAPI trace_Flush() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Flush();
+        return;
+    }
+
+    TraceRecord rec(24);
+    rec.begin();
+    gl.Flush();
+    rec.end();
+    rec.commit();
+}
+
+static void GLAPI trace_BlendFunc(GLenum sfactor, GLenum dfactor) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlendFunc(sfactor, dfactor);
+        return;
+    }
+
+    TraceRecord rec(25);
+    rec.begin();
+    gl.BlendFunc(sfactor, dfactor);
+    rec.end();
+    rec.argu(sfactor);
+    rec.argu(dfactor);
+    rec.commit();
+}
+
+static void GLAPI trace_LogicOp(GLenum opcode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.LogicOp(opcode);
+        return;
+    }
+
+    TraceRecord rec(26);
+    rec.begin();
+    gl.LogicOp(opcode);
+    rec.end();
+    rec.argu(opcode);
+    rec.commit();
+}
+
+static void GLAPI trace_StencilFunc(GLenum func, GLint ref, GLuint mask) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.StencilFunc(func, ref, mask);
+        return;
+    }
+
+    TraceRecord rec(27);
+    rec.begin();
+    gl.StencilFunc(func, ref, mask);
+    rec.end();
+    rec.argu(func);
+    rec.argi(ref);
+    rec.argu(mask);
+    rec.commit();
+}
+
+static void GLAPI trace_StencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.StencilOp(fail, zfail, zpass);
+        return;
+    }
+
+    TraceRecord rec(28);
+    rec.begin();
+    gl.StencilOp(fail, zfail, zpass);
+    rec.end();
+    rec.argu(fail);
+    rec.argu(zfail);
+    rec.argu(zpass);
+    rec.commit();
+}
+
+static void GLAPI trace_DepthFunc(GLenum func) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DepthFunc(func);
+        return;
+    }
+
+    TraceRecord rec(29);
+    rec.begin();
+    gl.DepthFunc(func);
+    rec.end();
+    rec.argu(func);
+    rec.commit();
+}
+
+static void GLAPI trace_PixelStoref(GLenum pname, GLfloat param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PixelStoref(pname, param);
+        return;
+    }
+
+    TraceRecord rec(30);
+    rec.begin();
+    gl.PixelStoref(pname, param);
+    rec.end();
+    rec.argu(pname);
+    rec.argf(param);
+    rec.commit();
+}
+
+static void GLAPI trace_PixelStorei(GLenum pname, GLint param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PixelStorei(pname, param);
+        trace_pixel_store(pname, param);
+        return;
+    }
+
+    TraceRecord rec(31);
+    rec.begin();
+    gl.PixelStorei(pname, param);
+    rec.end();
+    trace_pixel_store(pname, param);
+    rec.argu(pname);
+    rec.argi(param);
+    rec.commit();
+}
+
+static void GLAPI trace_ReadBuffer(GLenum src) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ReadBuffer(src);
+        return;
+    }
+
+    TraceRecord rec(32);
+    rec.begin();
+    gl.ReadBuffer(src);
+    rec.end();
+    rec.argu(src);
+    rec.commit();
+}
+
+static void GLAPI trace_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ReadPixels(x, y, width, height, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(33);
+    rec.begin();
+    gl.ReadPixels(x, y, width, height, format, type, pixels);
+    rec.end();
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.commit();
+}
+
+static void GLAPI trace_GetBooleanv(GLenum pname, GLboolean * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetBooleanv(pname, data);
+        return;
+    }
+
+    TraceRecord rec(34);
+    rec.begin();
+    gl.GetBooleanv(pname, data);
+    rec.end();
+    rec.argu(pname);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_GetDoublev(GLenum pname, GLdouble * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetDoublev(pname, data);
+        return;
+    }
+
+    TraceRecord rec(35);
+    rec.begin();
+    gl.GetDoublev(pname, data);
+    rec.end();
+    rec.argu(pname);
+    rec.argp(data);
+    rec.commit();
+}
+
+static GLenum GLAPI trace_GetError() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLenum result = gl.GetError();
+        return result;
+    }
+
+    TraceRecord rec(36);
+    rec.begin();
+    GLenum result = gl.GetError();
+    rec.end();
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetFloatv(GLenum pname, GLfloat * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetFloatv(pname, data);
+        return;
+    }
+
+    TraceRecord rec(37);
+    rec.begin();
+    gl.GetFloatv(pname, data);
+    rec.end();
+    rec.argu(pname);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_GetIntegerv(GLenum pname, GLint * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetIntegerv(pname, data);
+        return;
+    }
+
+    TraceRecord rec(38);
+    rec.begin();
+    gl.GetIntegerv(pname, data);
+    rec.end();
+    rec.argu(pname);
+    rec.argp(data);
+    rec.commit();
+}
+
+static const GLubyte * GLAPI trace_GetString(GLenum name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        const GLubyte * result = gl.GetString(name);
+        return result;
+    }
+
+    TraceRecord rec(39);
+    rec.begin();
+    const GLubyte * result = gl.GetString(name);
+    rec.end();
+    rec.argu(name);
+    rec.argp(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTexImage(target, level, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(40);
+    rec.begin();
+    gl.GetTexImage(target, level, format, type, pixels);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTexParameterfv(GLenum target, GLenum pname, GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTexParameterfv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(41);
+    rec.begin();
+    gl.GetTexParameterfv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTexParameteriv(GLenum target, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTexParameteriv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(42);
+    rec.begin();
+    gl.GetTexParameteriv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTexLevelParameterfv(target, level, pname, params);
+        return;
+    }
+
+    TraceRecord rec(43);
+    rec.begin();
+    gl.GetTexLevelParameterfv(target, level, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTexLevelParameteriv(target, level, pname, params);
+        return;
+    }
+
+    TraceRecord rec(44);
+    rec.begin();
+    gl.GetTexLevelParameteriv(target, level, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsEnabled(GLenum cap) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsEnabled(cap);
+        return result;
+    }
+
+    TraceRecord rec(45);
+    rec.begin();
+    GLboolean result = gl.IsEnabled(cap);
+    rec.end();
+    rec.argu(cap);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_DepthRange(GLdouble n, GLdouble f) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DepthRange(n, f);
+        return;
+    }
+
+    TraceRecord rec(46);
+    rec.begin();
+    gl.DepthRange(n, f);
+    rec.end();
+    rec.argf(n);
+    rec.argf(f);
+    rec.commit();
+}
+
+static void GLAPI trace_Viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Viewport(x, y, width, height);
+        return;
+    }
+
+    TraceRecord rec(47);
+    rec.begin();
+    gl.Viewport(x, y, width, height);
+    rec.end();
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawArrays(GLenum mode, GLint first, GLsizei count) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawArrays(mode, first, count);
+        return;
+    }
+
+    TraceRecord rec(48);
+    rec.begin();
+    gl.DrawArrays(mode, first, count);
+    rec.end();
+    rec.argu(mode);
+    rec.argi(first);
+    rec.argi(count);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawElements(mode, count, type, indices);
+        return;
+    }
+
+    TraceRecord rec(49);
+    rec.begin();
+    gl.DrawElements(mode, count, type, indices);
+    rec.end();
+    rec.argu(mode);
+    rec.argi(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.commit();
+}
+
+static void GLAPI trace_GetPointerv(GLenum pname, void ** params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetPointerv(pname, params);
+        return;
+    }
+
+    TraceRecord rec(50);
+    rec.begin();
+    gl.GetPointerv(pname, params);
+    rec.end();
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_PolygonOffset(GLfloat factor, GLfloat units) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PolygonOffset(factor, units);
+        return;
+    }
+
+    TraceRecord rec(51);
+    rec.begin();
+    gl.PolygonOffset(factor, units);
+    rec.end();
+    rec.argf(factor);
+    rec.argf(units);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyTexImage1D(target, level, internalformat, x, y, width, border);
+        return;
+    }
+
+    TraceRecord rec(52);
+    rec.begin();
+    gl.CopyTexImage1D(target, level, internalformat, x, y, width, border);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argu(internalformat);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(border);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+        return;
+    }
+
+    TraceRecord rec(53);
+    rec.begin();
+    gl.CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argu(internalformat);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(border);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyTexSubImage1D(target, level, xoffset, x, y, width);
+        return;
+    }
+
+    TraceRecord rec(54);
+    rec.begin();
+    gl.CopyTexSubImage1D(target, level, xoffset, x, y, width);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+        return;
+    }
+
+    TraceRecord rec(55);
+    rec.begin();
+    gl.CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexSubImage1D(target, level, xoffset, width, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(56);
+    rec.begin();
+    gl.TexSubImage1D(target, level, xoffset, width, format, type, pixels);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(width);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.pixels(6, pixels, width, 1, 1, format, type);
+    rec.commit();
+}
+
+static void GLAPI trace_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(57);
+    rec.begin();
+    gl.TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.pixels(8, pixels, width, height, 1, format, type);
+    rec.commit();
+}
+
+static void GLAPI trace_BindTexture(GLenum target, GLuint texture) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindTexture(target, texture);
+        return;
+    }
+
+    TraceRecord rec(58);
+    rec.begin();
+    gl.BindTexture(target, texture);
+    rec.end();
+    rec.argu(target);
+    rec.argu(texture);
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteTextures(GLsizei n, const GLuint * textures) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteTextures(n, textures);
+        return;
+    }
+
+    TraceRecord rec(59);
+    rec.begin();
+    gl.DeleteTextures(n, textures);
+    rec.end();
+    rec.argi(n);
+    rec.argp(textures);
+    rec.data(1, textures, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_GenTextures(GLsizei n, GLuint * textures) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenTextures(n, textures);
+        return;
+    }
+
+    TraceRecord rec(60);
+    rec.begin();
+    gl.GenTextures(n, textures);
+    rec.end();
+    rec.argi(n);
+    rec.argp(textures);
+    rec.data(1, textures, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsTexture(GLuint texture) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsTexture(texture);
+        return result;
+    }
+
+    TraceRecord rec(61);
+    rec.begin();
+    GLboolean result = gl.IsTexture(texture);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawRangeElements(mode, start, end, count, type, indices);
+        return;
+    }
+
+    TraceRecord rec(62);
+    rec.begin();
+    gl.DrawRangeElements(mode, start, end, count, type, indices);
+    rec.end();
+    rec.argu(mode);
+    rec.argu(start);
+    rec.argu(end);
+    rec.argi(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.commit();
+}
+
+static void GLAPI trace_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(63);
+    rec.begin();
+    gl.TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argi(border);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.pixels(9, pixels, width, height, depth, format, type);
+    rec.commit();
+}
+
+static void GLAPI trace_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(64);
+    rec.begin();
+    gl.TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.pixels(10, pixels, width, height, depth, format, type);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+        return;
+    }
+
+    TraceRecord rec(65);
+    rec.begin();
+    gl.CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_ActiveTexture(GLenum texture) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ActiveTexture(texture);
+        return;
+    }
+
+    TraceRecord rec(66);
+    rec.begin();
+    gl.ActiveTexture(texture);
+    rec.end();
+    rec.argu(texture);
+    rec.commit();
+}
+
+static void GLAPI trace_SampleCoverage(GLfloat value, GLboolean invert) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.SampleCoverage(value, invert);
+        return;
+    }
+
+    TraceRecord rec(67);
+    rec.begin();
+    gl.SampleCoverage(value, invert);
+    rec.end();
+    rec.argf(value);
+    rec.argu(invert);
+    rec.commit();
+}
+
+static void GLAPI trace_CompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+        return;
+    }
+
+    TraceRecord rec(68);
+    rec.begin();
+    gl.CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argi(border);
+    rec.argi(imageSize);
+    rec.argp(data);
+    rec.compressed(8, data, imageSize);
+    rec.commit();
+}
+
+static void GLAPI trace_CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+        return;
+    }
+
+    TraceRecord rec(69);
+    rec.begin();
+    gl.CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(border);
+    rec.argi(imageSize);
+    rec.argp(data);
+    rec.compressed(7, data, imageSize);
+    rec.commit();
+}
+
+static void GLAPI trace_CompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+        return;
+    }
+
+    TraceRecord rec(70);
+    rec.begin();
+    gl.CompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(border);
+    rec.argi(imageSize);
+    rec.argp(data);
+    rec.compressed(6, data, imageSize);
+    rec.commit();
+}
+
+static void GLAPI trace_CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+        return;
+    }
+
+    TraceRecord rec(71);
+    rec.begin();
+    gl.CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argu(format);
+    rec.argi(imageSize);
+    rec.argp(data);
+    rec.compressed(10, data, imageSize);
+    rec.commit();
+}
+
+static void GLAPI trace_CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+        return;
+    }
+
+    TraceRecord rec(72);
+    rec.begin();
+    gl.CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argu(format);
+    rec.argi(imageSize);
+    rec.argp(data);
+    rec.compressed(8, data, imageSize);
+    rec.commit();
+}
+
+static void GLAPI trace_CompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+        return;
+    }
+
+    TraceRecord rec(73);
+    rec.begin();
+    gl.CompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(width);
+    rec.argu(format);
+    rec.argi(imageSize);
+    rec.argp(data);
+    rec.compressed(6, data, imageSize);
+    rec.commit();
+}
+
+static void GLAPI trace_GetCompressedTexImage(GLenum target, GLint level, void * img) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetCompressedTexImage(target, level, img);
+        return;
+    }
+
+    TraceRecord rec(74);
+    rec.begin();
+    gl.GetCompressedTexImage(target, level, img);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argp(img);
+    rec.commit();
+}
+
+static void GLAPI trace_BlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+        return;
+    }
+
+    TraceRecord rec(75);
+    rec.begin();
+    gl.BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    rec.end();
+    rec.argu(sfactorRGB);
+    rec.argu(dfactorRGB);
+    rec.argu(sfactorAlpha);
+    rec.argu(dfactorAlpha);
+    rec.commit();
+}
+
+static void GLAPI trace_MultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MultiDrawArrays(mode, first, count, drawcount);
+        return;
+    }
+
+    TraceRecord rec(76);
+    rec.begin();
+    gl.MultiDrawArrays(mode, first, count, drawcount);
+    rec.end();
+    rec.argu(mode);
+    rec.argp(first);
+    rec.argp(count);
+    rec.argi(drawcount);
+    rec.commit();
+}
+
+static void GLAPI trace_MultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const void * const * indices, GLsizei drawcount) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MultiDrawElements(mode, count, type, indices, drawcount);
+        return;
+    }
+
+    TraceRecord rec(77);
+    rec.begin();
+    gl.MultiDrawElements(mode, count, type, indices, drawcount);
+    rec.end();
+    rec.argu(mode);
+    rec.argp(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.argi(drawcount);
+    rec.commit();
+}
+
+static void GLAPI trace_PointParameterf(GLenum pname, GLfloat param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PointParameterf(pname, param);
+        return;
+    }
+
+    TraceRecord rec(78);
+    rec.begin();
+    gl.PointParameterf(pname, param);
+    rec.end();
+    rec.argu(pname);
+    rec.argf(param);
+    rec.commit();
+}
+
+static void GLAPI trace_PointParameterfv(GLenum pname, const GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PointParameterfv(pname, params);
+        return;
+    }
+
+    TraceRecord rec(79);
+    rec.begin();
+    gl.PointParameterfv(pname, params);
+    rec.end();
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_PointParameteri(GLenum pname, GLint param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PointParameteri(pname, param);
+        return;
+    }
+
+    TraceRecord rec(80);
+    rec.begin();
+    gl.PointParameteri(pname, param);
+    rec.end();
+    rec.argu(pname);
+    rec.argi(param);
+    rec.commit();
+}
+
+static void GLAPI trace_PointParameteriv(GLenum pname, const GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PointParameteriv(pname, params);
+        return;
+    }
+
+    TraceRecord rec(81);
+    rec.begin();
+    gl.PointParameteriv(pname, params);
+    rec.end();
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlendColor(red, green, blue, alpha);
+        return;
+    }
+
+    TraceRecord rec(82);
+    rec.begin();
+    gl.BlendColor(red, green, blue, alpha);
+    rec.end();
+    rec.argf(red);
+    rec.argf(green);
+    rec.argf(blue);
+    rec.argf(alpha);
+    rec.commit();
+}
+
+static void GLAPI trace_BlendEquation(GLenum mode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlendEquation(mode);
+        return;
+    }
+
+    TraceRecord rec(83);
+    rec.begin();
+    gl.BlendEquation(mode);
+    rec.end();
+    rec.argu(mode);
+    rec.commit();
+}
+
+static void GLAPI trace_GenQueries(GLsizei n, GLuint * ids) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenQueries(n, ids);
+        return;
+    }
+
+    TraceRecord rec(84);
+    rec.begin();
+    gl.GenQueries(n, ids);
+    rec.end();
+    rec.argi(n);
+    rec.argp(ids);
+    rec.data(1, ids, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteQueries(GLsizei n, const GLuint * ids) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteQueries(n, ids);
+        return;
+    }
+
+    TraceRecord rec(85);
+    rec.begin();
+    gl.DeleteQueries(n, ids);
+    rec.end();
+    rec.argi(n);
+    rec.argp(ids);
+    rec.data(1, ids, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsQuery(GLuint id) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsQuery(id);
+        return result;
+    }
+
+    TraceRecord rec(86);
+    rec.begin();
+    GLboolean result = gl.IsQuery(id);
+    rec.end();
+    rec.argu(id);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_BeginQuery(GLenum target, GLuint id) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BeginQuery(target, id);
+        return;
+    }
+
+    TraceRecord rec(87);
+    rec.begin();
+    gl.BeginQuery(target, id);
+    rec.end();
+    rec.argu(target);
+    rec.argu(id);
+    rec.commit();
+}
+
+static void GLAPI trace_EndQuery(GLenum target) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.EndQuery(target);
+        return;
+    }
+
+    TraceRecord rec(88);
+    rec.begin();
+    gl.EndQuery(target);
+    rec.end();
+    rec.argu(target);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryiv(GLenum target, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryiv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(89);
+    rec.begin();
+    gl.GetQueryiv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryObjectiv(GLuint id, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryObjectiv(id, pname, params);
+        return;
+    }
+
+    TraceRecord rec(90);
+    rec.begin();
+    gl.GetQueryObjectiv(id, pname, params);
+    rec.end();
+    rec.argu(id);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryObjectuiv(id, pname, params);
+        return;
+    }
+
+    TraceRecord rec(91);
+    rec.begin();
+    gl.GetQueryObjectuiv(id, pname, params);
+    rec.end();
+    rec.argu(id);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_BindBuffer(GLenum target, GLuint buffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindBuffer(target, buffer);
+        trace_bind_buffer(target, buffer);
+        return;
+    }
+
+    TraceRecord rec(92);
+    rec.begin();
+    gl.BindBuffer(target, buffer);
+    rec.end();
+    trace_bind_buffer(target, buffer);
+    rec.argu(target);
+    rec.argu(buffer);
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteBuffers(GLsizei n, const GLuint * buffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteBuffers(n, buffers);
+        return;
+    }
+
+    TraceRecord rec(93);
+    rec.begin();
+    gl.DeleteBuffers(n, buffers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(buffers);
+    rec.data(1, buffers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_GenBuffers(GLsizei n, GLuint * buffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenBuffers(n, buffers);
+        return;
+    }
+
+    TraceRecord rec(94);
+    rec.begin();
+    gl.GenBuffers(n, buffers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(buffers);
+    rec.data(1, buffers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsBuffer(GLuint buffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsBuffer(buffer);
+        return result;
+    }
+
+    TraceRecord rec(95);
+    rec.begin();
+    GLboolean result = gl.IsBuffer(buffer);
+    rec.end();
+    rec.argu(buffer);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_BufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BufferData(target, size, data, usage);
+        return;
+    }
+
+    TraceRecord rec(96);
+    rec.begin();
+    gl.BufferData(target, size, data, usage);
+    rec.end();
+    rec.argu(target);
+    rec.argi(size);
+    rec.argp(data);
+    rec.argu(usage);
+    rec.bulk(2, data, size);
+    rec.commit();
+}
+
+static void GLAPI trace_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BufferSubData(target, offset, size, data);
+        return;
+    }
+
+    TraceRecord rec(97);
+    rec.begin();
+    gl.BufferSubData(target, offset, size, data);
+    rec.end();
+    rec.argu(target);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.argp(data);
+    rec.bulk(3, data, size);
+    rec.commit();
+}
+
+static void GLAPI trace_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetBufferSubData(target, offset, size, data);
+        return;
+    }
+
+    TraceRecord rec(98);
+    rec.begin();
+    gl.GetBufferSubData(target, offset, size, data);
+    rec.end();
+    rec.argu(target);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void * GLAPI trace_MapBuffer(GLenum target, GLenum access) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        void * result = gl.MapBuffer(target, access);
+        trace_map(target, result, trace_buffer_size(target), access == GL_READ_ONLY ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT);
+        return result;
+    }
+
+    TraceRecord rec(99);
+    rec.begin();
+    void * result = gl.MapBuffer(target, access);
+    rec.end();
+    trace_map(target, result, trace_buffer_size(target), access == GL_READ_ONLY ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT);
+    rec.argu(target);
+    rec.argu(access);
+    rec.argp(result);
+    rec.commit();
+    return result;
+}
+
+static GLboolean GLAPI trace_UnmapBuffer(GLenum target) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.UnmapBuffer(target);
+        trace_unmap(target);
+        return result;
+    }
+
+    TraceRecord rec(100);
+    rec.argu(target);
+    size_t result_slot = rec.reserve();
+    rec.mapped(1, target);
+    rec.begin();
+    GLboolean result = gl.UnmapBuffer(target);
+    rec.end();
+    trace_unmap(target);
+    rec.patch(result_slot, (uint64_t)result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetBufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetBufferParameteriv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(101);
+    rec.begin();
+    gl.GetBufferParameteriv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetBufferPointerv(GLenum target, GLenum pname, void ** params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetBufferPointerv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(102);
+    rec.begin();
+    gl.GetBufferPointerv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlendEquationSeparate(modeRGB, modeAlpha);
+        return;
+    }
+
+    TraceRecord rec(103);
+    rec.begin();
+    gl.BlendEquationSeparate(modeRGB, modeAlpha);
+    rec.end();
+    rec.argu(modeRGB);
+    rec.argu(modeAlpha);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawBuffers(GLsizei n, const GLenum * bufs) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawBuffers(n, bufs);
+        return;
+    }
+
+    TraceRecord rec(104);
+    rec.begin();
+    gl.DrawBuffers(n, bufs);
+    rec.end();
+    rec.argi(n);
+    rec.argp(bufs);
+    rec.data(1, bufs, n * sizeof(GLenum));
+    rec.commit();
+}
+
+static void GLAPI trace_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.StencilOpSeparate(face, sfail, dpfail, dppass);
+        return;
+    }
+
+    TraceRecord rec(105);
+    rec.begin();
+    gl.StencilOpSeparate(face, sfail, dpfail, dppass);
+    rec.end();
+    rec.argu(face);
+    rec.argu(sfail);
+    rec.argu(dpfail);
+    rec.argu(dppass);
+    rec.commit();
+}
+
+static void GLAPI trace_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.StencilFuncSeparate(face, func, ref, mask);
+        return;
+    }
+
+    TraceRecord rec(106);
+    rec.begin();
+    gl.StencilFuncSeparate(face, func, ref, mask);
+    rec.end();
+    rec.argu(face);
+    rec.argu(func);
+    rec.argi(ref);
+    rec.argu(mask);
+    rec.commit();
+}
+
+static void GLAPI trace_StencilMaskSeparate(GLenum face, GLuint mask) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.StencilMaskSeparate(face, mask);
+        return;
+    }
+
+    TraceRecord rec(107);
+    rec.begin();
+    gl.StencilMaskSeparate(face, mask);
+    rec.end();
+    rec.argu(face);
+    rec.argu(mask);
+    rec.commit();
+}
+
+static void GLAPI trace_AttachShader(GLuint program, GLuint shader) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.AttachShader(program, shader);
+        return;
+    }
+
+    TraceRecord rec(108);
+    rec.begin();
+    gl.AttachShader(program, shader);
+    rec.end();
+    rec.argu(program);
+    rec.argu(shader);
+    rec.commit();
+}
+
+static void GLAPI trace_BindAttribLocation(GLuint program, GLuint index, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindAttribLocation(program, index, name);
+        return;
+    }
+
+    TraceRecord rec(109);
+    rec.begin();
+    gl.BindAttribLocation(program, index, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(index);
+    rec.argp(name);
+    rec.string(2, name, -1);
+    rec.commit();
+}
+
+static void GLAPI trace_CompileShader(GLuint shader) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompileShader(shader);
+        return;
+    }
+
+    TraceRecord rec(110);
+    rec.begin();
+    gl.CompileShader(shader);
+    rec.end();
+    rec.argu(shader);
+    rec.commit();
+}
+
+static GLuint GLAPI trace_CreateProgram() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLuint result = gl.CreateProgram();
+        return result;
+    }
+
+    TraceRecord rec(111);
+    rec.begin();
+    GLuint result = gl.CreateProgram();
+    rec.end();
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static GLuint GLAPI trace_CreateShader(GLenum type) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLuint result = gl.CreateShader(type);
+        return result;
+    }
+
+    TraceRecord rec(112);
+    rec.begin();
+    GLuint result = gl.CreateShader(type);
+    rec.end();
+    rec.argu(type);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_DeleteProgram(GLuint program) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteProgram(program);
+        return;
+    }
+
+    TraceRecord rec(113);
+    rec.begin();
+    gl.DeleteProgram(program);
+    rec.end();
+    rec.argu(program);
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteShader(GLuint shader) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteShader(shader);
+        return;
+    }
+
+    TraceRecord rec(114);
+    rec.begin();
+    gl.DeleteShader(shader);
+    rec.end();
+    rec.argu(shader);
+    rec.commit();
+}
+
+static void GLAPI trace_DetachShader(GLuint program, GLuint shader) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DetachShader(program, shader);
+        return;
+    }
+
+    TraceRecord rec(115);
+    rec.begin();
+    gl.DetachShader(program, shader);
+    rec.end();
+    rec.argu(program);
+    rec.argu(shader);
+    rec.commit();
+}
+
+static void GLAPI trace_DisableVertexAttribArray(GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DisableVertexAttribArray(index);
+        return;
+    }
+
+    TraceRecord rec(116);
+    rec.begin();
+    gl.DisableVertexAttribArray(index);
+    rec.end();
+    rec.argu(index);
+    rec.commit();
+}
+
+static void GLAPI trace_EnableVertexAttribArray(GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.EnableVertexAttribArray(index);
+        return;
+    }
+
+    TraceRecord rec(117);
+    rec.begin();
+    gl.EnableVertexAttribArray(index);
+    rec.end();
+    rec.argu(index);
+    rec.commit();
+}
+
+static void GLAPI trace_GetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveAttrib(program, index, bufSize, length, size, type, name);
+        return;
+    }
+
+    TraceRecord rec(118);
+    rec.begin();
+    gl.GetActiveAttrib(program, index, bufSize, length, size, type, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(index);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(size);
+    rec.argp(type);
+    rec.argp(name);
+    rec.commit();
+}
+
+static void GLAPI trace_GetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveUniform(program, index, bufSize, length, size, type, name);
+        return;
+    }
+
+    TraceRecord rec(119);
+    rec.begin();
+    gl.GetActiveUniform(program, index, bufSize, length, size, type, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(index);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(size);
+    rec.argp(type);
+    rec.argp(name);
+    rec.commit();
+}
+
+static void GLAPI trace_GetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetAttachedShaders(program, maxCount, count, shaders);
+        return;
+    }
+
+    TraceRecord rec(120);
+    rec.begin();
+    gl.GetAttachedShaders(program, maxCount, count, shaders);
+    rec.end();
+    rec.argu(program);
+    rec.argi(maxCount);
+    rec.argp(count);
+    rec.argp(shaders);
+    rec.commit();
+}
+
+static GLint GLAPI trace_GetAttribLocation(GLuint program, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLint result = gl.GetAttribLocation(program, name);
+        return result;
+    }
+
+    TraceRecord rec(121);
+    rec.begin();
+    GLint result = gl.GetAttribLocation(program, name);
+    rec.end();
+    rec.argu(program);
+    rec.argp(name);
+    rec.argi(result);
+    rec.string(1, name, -1);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetProgramiv(GLuint program, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetProgramiv(program, pname, params);
+        return;
+    }
+
+    TraceRecord rec(122);
+    rec.begin();
+    gl.GetProgramiv(program, pname, params);
+    rec.end();
+    rec.argu(program);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetProgramInfoLog(program, bufSize, length, infoLog);
+        return;
+    }
+
+    TraceRecord rec(123);
+    rec.begin();
+    gl.GetProgramInfoLog(program, bufSize, length, infoLog);
+    rec.end();
+    rec.argu(program);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(infoLog);
+    rec.commit();
+}
+
+static void GLAPI trace_GetShaderiv(GLuint shader, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetShaderiv(shader, pname, params);
+        return;
+    }
+
+    TraceRecord rec(124);
+    rec.begin();
+    gl.GetShaderiv(shader, pname, params);
+    rec.end();
+    rec.argu(shader);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetShaderInfoLog(shader, bufSize, length, infoLog);
+        return;
+    }
+
+    TraceRecord rec(125);
+    rec.begin();
+    gl.GetShaderInfoLog(shader, bufSize, length, infoLog);
+    rec.end();
+    rec.argu(shader);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(infoLog);
+    rec.commit();
+}
+
+static void GLAPI trace_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetShaderSource(shader, bufSize, length, source);
+        return;
+    }
+
+    TraceRecord rec(126);
+    rec.begin();
+    gl.GetShaderSource(shader, bufSize, length, source);
+    rec.end();
+    rec.argu(shader);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(source);
+    rec.commit();
+}
+
+static GLint GLAPI trace_GetUniformLocation(GLuint program, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLint result = gl.GetUniformLocation(program, name);
+        return result;
+    }
+
+    TraceRecord rec(127);
+    rec.begin();
+    GLint result = gl.GetUniformLocation(program, name);
+    rec.end();
+    rec.argu(program);
+    rec.argp(name);
+    rec.argi(result);
+    rec.string(1, name, -1);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetUniformfv(GLuint program, GLint location, GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetUniformfv(program, location, params);
+        return;
+    }
+
+    TraceRecord rec(128);
+    rec.begin();
+    gl.GetUniformfv(program, location, params);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetUniformiv(GLuint program, GLint location, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetUniformiv(program, location, params);
+        return;
+    }
+
+    TraceRecord rec(129);
+    rec.begin();
+    gl.GetUniformiv(program, location, params);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexAttribdv(index, pname, params);
+        return;
+    }
+
+    TraceRecord rec(130);
+    rec.begin();
+    gl.GetVertexAttribdv(index, pname, params);
+    rec.end();
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexAttribfv(index, pname, params);
+        return;
+    }
+
+    TraceRecord rec(131);
+    rec.begin();
+    gl.GetVertexAttribfv(index, pname, params);
+    rec.end();
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexAttribiv(GLuint index, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexAttribiv(index, pname, params);
+        return;
+    }
+
+    TraceRecord rec(132);
+    rec.begin();
+    gl.GetVertexAttribiv(index, pname, params);
+    rec.end();
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexAttribPointerv(GLuint index, GLenum pname, void ** pointer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexAttribPointerv(index, pname, pointer);
+        return;
+    }
+
+    TraceRecord rec(133);
+    rec.begin();
+    gl.GetVertexAttribPointerv(index, pname, pointer);
+    rec.end();
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(pointer);
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsProgram(GLuint program) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsProgram(program);
+        return result;
+    }
+
+    TraceRecord rec(134);
+    rec.begin();
+    GLboolean result = gl.IsProgram(program);
+    rec.end();
+    rec.argu(program);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static GLboolean GLAPI trace_IsShader(GLuint shader) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsShader(shader);
+        return result;
+    }
+
+    TraceRecord rec(135);
+    rec.begin();
+    GLboolean result = gl.IsShader(shader);
+    rec.end();
+    rec.argu(shader);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_LinkProgram(GLuint program) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.LinkProgram(program);
+        return;
+    }
+
+    TraceRecord rec(136);
+    rec.begin();
+    gl.LinkProgram(program);
+    rec.end();
+    rec.argu(program);
+    rec.commit();
+}
+
+static void GLAPI trace_ShaderSource(GLuint shader, GLsizei count, const GLchar * const * string, const GLint * length) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ShaderSource(shader, count, string, length);
+        return;
+    }
+
+    TraceRecord rec(137);
+    rec.begin();
+    gl.ShaderSource(shader, count, string, length);
+    rec.end();
+    rec.argu(shader);
+    rec.argi(count);
+    rec.argp(string);
+    rec.argp(length);
+    rec.strings(2, count, string, length);
+    rec.commit();
+}
+
+static void GLAPI trace_UseProgram(GLuint program) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UseProgram(program);
+        return;
+    }
+
+    TraceRecord rec(138);
+    rec.begin();
+    gl.UseProgram(program);
+    rec.end();
+    rec.argu(program);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform1f(GLint location, GLfloat v0) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform1f(location, v0);
+        return;
+    }
+
+    TraceRecord rec(139);
+    rec.begin();
+    gl.Uniform1f(location, v0);
+    rec.end();
+    rec.argi(location);
+    rec.argf(v0);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform2f(location, v0, v1);
+        return;
+    }
+
+    TraceRecord rec(140);
+    rec.begin();
+    gl.Uniform2f(location, v0, v1);
+    rec.end();
+    rec.argi(location);
+    rec.argf(v0);
+    rec.argf(v1);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform3f(location, v0, v1, v2);
+        return;
+    }
+
+    TraceRecord rec(141);
+    rec.begin();
+    gl.Uniform3f(location, v0, v1, v2);
+    rec.end();
+    rec.argi(location);
+    rec.argf(v0);
+    rec.argf(v1);
+    rec.argf(v2);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform4f(location, v0, v1, v2, v3);
+        return;
+    }
+
+    TraceRecord rec(142);
+    rec.begin();
+    gl.Uniform4f(location, v0, v1, v2, v3);
+    rec.end();
+    rec.argi(location);
+    rec.argf(v0);
+    rec.argf(v1);
+    rec.argf(v2);
+    rec.argf(v3);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform1i(GLint location, GLint v0) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform1i(location, v0);
+        return;
+    }
+
+    TraceRecord rec(143);
+    rec.begin();
+    gl.Uniform1i(location, v0);
+    rec.end();
+    rec.argi(location);
+    rec.argi(v0);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform2i(GLint location, GLint v0, GLint v1) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform2i(location, v0, v1);
+        return;
+    }
+
+    TraceRecord rec(144);
+    rec.begin();
+    gl.Uniform2i(location, v0, v1);
+    rec.end();
+    rec.argi(location);
+    rec.argi(v0);
+    rec.argi(v1);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform3i(location, v0, v1, v2);
+        return;
+    }
+
+    TraceRecord rec(145);
+    rec.begin();
+    gl.Uniform3i(location, v0, v1, v2);
+    rec.end();
+    rec.argi(location);
+    rec.argi(v0);
+    rec.argi(v1);
+    rec.argi(v2);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform4i(location, v0, v1, v2, v3);
+        return;
+    }
+
+    TraceRecord rec(146);
+    rec.begin();
+    gl.Uniform4i(location, v0, v1, v2, v3);
+    rec.end();
+    rec.argi(location);
+    rec.argi(v0);
+    rec.argi(v1);
+    rec.argi(v2);
+    rec.argi(v3);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform1fv(GLint location, GLsizei count, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform1fv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(147);
+    rec.begin();
+    gl.Uniform1fv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 1 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform2fv(GLint location, GLsizei count, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform2fv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(148);
+    rec.begin();
+    gl.Uniform2fv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 2 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform3fv(GLint location, GLsizei count, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform3fv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(149);
+    rec.begin();
+    gl.Uniform3fv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 3 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform4fv(GLint location, GLsizei count, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform4fv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(150);
+    rec.begin();
+    gl.Uniform4fv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 4 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform1iv(GLint location, GLsizei count, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform1iv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(151);
+    rec.begin();
+    gl.Uniform1iv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 1 * sizeof(GLint));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform2iv(GLint location, GLsizei count, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform2iv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(152);
+    rec.begin();
+    gl.Uniform2iv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 2 * sizeof(GLint));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform3iv(GLint location, GLsizei count, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform3iv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(153);
+    rec.begin();
+    gl.Uniform3iv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 3 * sizeof(GLint));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform4iv(GLint location, GLsizei count, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform4iv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(154);
+    rec.begin();
+    gl.Uniform4iv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 4 * sizeof(GLint));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix2fv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(155);
+    rec.begin();
+    gl.UniformMatrix2fv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * 2 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix3fv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(156);
+    rec.begin();
+    gl.UniformMatrix3fv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * 3 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix4fv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(157);
+    rec.begin();
+    gl.UniformMatrix4fv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * 4 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ValidateProgram(GLuint program) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ValidateProgram(program);
+        return;
+    }
+
+    TraceRecord rec(158);
+    rec.begin();
+    gl.ValidateProgram(program);
+    rec.end();
+    rec.argu(program);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib1d(GLuint index, GLdouble x) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib1d(index, x);
+        return;
+    }
+
+    TraceRecord rec(159);
+    rec.begin();
+    gl.VertexAttrib1d(index, x);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib1dv(GLuint index, const GLdouble * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib1dv(index, v);
+        return;
+    }
+
+    TraceRecord rec(160);
+    rec.begin();
+    gl.VertexAttrib1dv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 1 * 8);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib1f(GLuint index, GLfloat x) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib1f(index, x);
+        return;
+    }
+
+    TraceRecord rec(161);
+    rec.begin();
+    gl.VertexAttrib1f(index, x);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib1fv(GLuint index, const GLfloat * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib1fv(index, v);
+        return;
+    }
+
+    TraceRecord rec(162);
+    rec.begin();
+    gl.VertexAttrib1fv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 1 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib1s(GLuint index, GLshort x) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib1s(index, x);
+        return;
+    }
+
+    TraceRecord rec(163);
+    rec.begin();
+    gl.VertexAttrib1s(index, x);
+    rec.end();
+    rec.argu(index);
+    rec.argi(x);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib1sv(GLuint index, const GLshort * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib1sv(index, v);
+        return;
+    }
+
+    TraceRecord rec(164);
+    rec.begin();
+    gl.VertexAttrib1sv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 1 * 2);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib2d(index, x, y);
+        return;
+    }
+
+    TraceRecord rec(165);
+    rec.begin();
+    gl.VertexAttrib2d(index, x, y);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib2dv(GLuint index, const GLdouble * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib2dv(index, v);
+        return;
+    }
+
+    TraceRecord rec(166);
+    rec.begin();
+    gl.VertexAttrib2dv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 2 * 8);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib2f(index, x, y);
+        return;
+    }
+
+    TraceRecord rec(167);
+    rec.begin();
+    gl.VertexAttrib2f(index, x, y);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib2fv(GLuint index, const GLfloat * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib2fv(index, v);
+        return;
+    }
+
+    TraceRecord rec(168);
+    rec.begin();
+    gl.VertexAttrib2fv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 2 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib2s(index, x, y);
+        return;
+    }
+
+    TraceRecord rec(169);
+    rec.begin();
+    gl.VertexAttrib2s(index, x, y);
+    rec.end();
+    rec.argu(index);
+    rec.argi(x);
+    rec.argi(y);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib2sv(GLuint index, const GLshort * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib2sv(index, v);
+        return;
+    }
+
+    TraceRecord rec(170);
+    rec.begin();
+    gl.VertexAttrib2sv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 2 * 2);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib3d(index, x, y, z);
+        return;
+    }
+
+    TraceRecord rec(171);
+    rec.begin();
+    gl.VertexAttrib3d(index, x, y, z);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.argf(z);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib3dv(GLuint index, const GLdouble * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib3dv(index, v);
+        return;
+    }
+
+    TraceRecord rec(172);
+    rec.begin();
+    gl.VertexAttrib3dv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 3 * 8);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib3f(index, x, y, z);
+        return;
+    }
+
+    TraceRecord rec(173);
+    rec.begin();
+    gl.VertexAttrib3f(index, x, y, z);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.argf(z);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib3fv(GLuint index, const GLfloat * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib3fv(index, v);
+        return;
+    }
+
+    TraceRecord rec(174);
+    rec.begin();
+    gl.VertexAttrib3fv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 3 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib3s(index, x, y, z);
+        return;
+    }
+
+    TraceRecord rec(175);
+    rec.begin();
+    gl.VertexAttrib3s(index, x, y, z);
+    rec.end();
+    rec.argu(index);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(z);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib3sv(GLuint index, const GLshort * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib3sv(index, v);
+        return;
+    }
+
+    TraceRecord rec(176);
+    rec.begin();
+    gl.VertexAttrib3sv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 3 * 2);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4Nbv(GLuint index, const GLbyte * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4Nbv(index, v);
+        return;
+    }
+
+    TraceRecord rec(177);
+    rec.begin();
+    gl.VertexAttrib4Nbv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 1);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4Niv(GLuint index, const GLint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4Niv(index, v);
+        return;
+    }
+
+    TraceRecord rec(178);
+    rec.begin();
+    gl.VertexAttrib4Niv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4Nsv(GLuint index, const GLshort * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4Nsv(index, v);
+        return;
+    }
+
+    TraceRecord rec(179);
+    rec.begin();
+    gl.VertexAttrib4Nsv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 2);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4Nub(index, x, y, z, w);
+        return;
+    }
+
+    TraceRecord rec(180);
+    rec.begin();
+    gl.VertexAttrib4Nub(index, x, y, z, w);
+    rec.end();
+    rec.argu(index);
+    rec.argu(x);
+    rec.argu(y);
+    rec.argu(z);
+    rec.argu(w);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4Nubv(GLuint index, const GLubyte * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4Nubv(index, v);
+        return;
+    }
+
+    TraceRecord rec(181);
+    rec.begin();
+    gl.VertexAttrib4Nubv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 1);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4Nuiv(GLuint index, const GLuint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4Nuiv(index, v);
+        return;
+    }
+
+    TraceRecord rec(182);
+    rec.begin();
+    gl.VertexAttrib4Nuiv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4Nusv(GLuint index, const GLushort * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4Nusv(index, v);
+        return;
+    }
+
+    TraceRecord rec(183);
+    rec.begin();
+    gl.VertexAttrib4Nusv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 2);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4bv(GLuint index, const GLbyte * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4bv(index, v);
+        return;
+    }
+
+    TraceRecord rec(184);
+    rec.begin();
+    gl.VertexAttrib4bv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 1);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4d(index, x, y, z, w);
+        return;
+    }
+
+    TraceRecord rec(185);
+    rec.begin();
+    gl.VertexAttrib4d(index, x, y, z, w);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.argf(z);
+    rec.argf(w);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4dv(GLuint index, const GLdouble * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4dv(index, v);
+        return;
+    }
+
+    TraceRecord rec(186);
+    rec.begin();
+    gl.VertexAttrib4dv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 8);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4f(index, x, y, z, w);
+        return;
+    }
+
+    TraceRecord rec(187);
+    rec.begin();
+    gl.VertexAttrib4f(index, x, y, z, w);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.argf(z);
+    rec.argf(w);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4fv(GLuint index, const GLfloat * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4fv(index, v);
+        return;
+    }
+
+    TraceRecord rec(188);
+    rec.begin();
+    gl.VertexAttrib4fv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4iv(GLuint index, const GLint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4iv(index, v);
+        return;
+    }
+
+    TraceRecord rec(189);
+    rec.begin();
+    gl.VertexAttrib4iv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4s(index, x, y, z, w);
+        return;
+    }
+
+    TraceRecord rec(190);
+    rec.begin();
+    gl.VertexAttrib4s(index, x, y, z, w);
+    rec.end();
+    rec.argu(index);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(z);
+    rec.argi(w);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4sv(GLuint index, const GLshort * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4sv(index, v);
+        return;
+    }
+
+    TraceRecord rec(191);
+    rec.begin();
+    gl.VertexAttrib4sv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 2);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4ubv(GLuint index, const GLubyte * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4ubv(index, v);
+        return;
+    }
+
+    TraceRecord rec(192);
+    rec.begin();
+    gl.VertexAttrib4ubv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 1);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4uiv(GLuint index, const GLuint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4uiv(index, v);
+        return;
+    }
+
+    TraceRecord rec(193);
+    rec.begin();
+    gl.VertexAttrib4uiv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttrib4usv(GLuint index, const GLushort * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttrib4usv(index, v);
+        return;
+    }
+
+    TraceRecord rec(194);
+    rec.begin();
+    gl.VertexAttrib4usv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 2);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribPointer(index, size, type, normalized, stride, pointer);
+        return;
+    }
+
+    TraceRecord rec(195);
+    rec.begin();
+    gl.VertexAttribPointer(index, size, type, normalized, stride, pointer);
+    rec.end();
+    rec.argu(index);
+    rec.argi(size);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argi(stride);
+    rec.argp(pointer);
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix2x3fv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(196);
+    rec.begin();
+    gl.UniformMatrix2x3fv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * 3 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix3x2fv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(197);
+    rec.begin();
+    gl.UniformMatrix3x2fv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * 2 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix2x4fv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(198);
+    rec.begin();
+    gl.UniformMatrix2x4fv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * 4 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix4x2fv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(199);
+    rec.begin();
+    gl.UniformMatrix4x2fv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * 2 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix3x4fv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(200);
+    rec.begin();
+    gl.UniformMatrix3x4fv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * 4 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix4x3fv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(201);
+    rec.begin();
+    gl.UniformMatrix4x3fv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * 3 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ColorMaski(index, r, g, b, a);
+        return;
+    }
+
+    TraceRecord rec(202);
+    rec.begin();
+    gl.ColorMaski(index, r, g, b, a);
+    rec.end();
+    rec.argu(index);
+    rec.argu(r);
+    rec.argu(g);
+    rec.argu(b);
+    rec.argu(a);
+    rec.commit();
+}
+
+static void GLAPI trace_GetBooleani_v(GLenum target, GLuint index, GLboolean * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetBooleani_v(target, index, data);
+        return;
+    }
+
+    TraceRecord rec(203);
+    rec.begin();
+    gl.GetBooleani_v(target, index, data);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_GetIntegeri_v(GLenum target, GLuint index, GLint * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetIntegeri_v(target, index, data);
+        return;
+    }
+
+    TraceRecord rec(204);
+    rec.begin();
+    gl.GetIntegeri_v(target, index, data);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_Enablei(GLenum target, GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Enablei(target, index);
+        return;
+    }
+
+    TraceRecord rec(205);
+    rec.begin();
+    gl.Enablei(target, index);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.commit();
+}
+
+static void GLAPI trace_Disablei(GLenum target, GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Disablei(target, index);
+        return;
+    }
+
+    TraceRecord rec(206);
+    rec.begin();
+    gl.Disablei(target, index);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsEnabledi(GLenum target, GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsEnabledi(target, index);
+        return result;
+    }
+
+    TraceRecord rec(207);
+    rec.begin();
+    GLboolean result = gl.IsEnabledi(target, index);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_BeginTransformFeedback(GLenum primitiveMode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BeginTransformFeedback(primitiveMode);
+        return;
+    }
+
+    TraceRecord rec(208);
+    rec.begin();
+    gl.BeginTransformFeedback(primitiveMode);
+    rec.end();
+    rec.argu(primitiveMode);
+    rec.commit();
+}
+
+static void GLAPI trace_EndTransformFeedback() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.EndTransformFeedback();
+        return;
+    }
+
+    TraceRecord rec(209);
+    rec.begin();
+    gl.EndTransformFeedback();
+    rec.end();
+    rec.commit();
+}
+
+static void GLAPI trace_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindBufferRange(target, index, buffer, offset, size);
+        return;
+    }
+
+    TraceRecord rec(210);
+    rec.begin();
+    gl.BindBufferRange(target, index, buffer, offset, size);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.commit();
+}
+
+static void GLAPI trace_BindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindBufferBase(target, index, buffer);
+        return;
+    }
+
+    TraceRecord rec(211);
+    rec.begin();
+    gl.BindBufferBase(target, index, buffer);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argu(buffer);
+    rec.commit();
+}
+
+static void GLAPI trace_TransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar * const * varyings, GLenum bufferMode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TransformFeedbackVaryings(program, count, varyings, bufferMode);
+        return;
+    }
+
+    TraceRecord rec(212);
+    rec.begin();
+    gl.TransformFeedbackVaryings(program, count, varyings, bufferMode);
+    rec.end();
+    rec.argu(program);
+    rec.argi(count);
+    rec.argp(varyings);
+    rec.argu(bufferMode);
+    rec.strings(2, count, varyings, 0);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+        return;
+    }
+
+    TraceRecord rec(213);
+    rec.begin();
+    gl.GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(index);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(size);
+    rec.argp(type);
+    rec.argp(name);
+    rec.commit();
+}
+
+static void GLAPI trace_ClampColor(GLenum target, GLenum clamp) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClampColor(target, clamp);
+        return;
+    }
+
+    TraceRecord rec(214);
+    rec.begin();
+    gl.ClampColor(target, clamp);
+    rec.end();
+    rec.argu(target);
+    rec.argu(clamp);
+    rec.commit();
+}
+
+static void GLAPI trace_BeginConditionalRender(GLuint id, GLenum mode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BeginConditionalRender(id, mode);
+        return;
+    }
+
+    TraceRecord rec(215);
+    rec.begin();
+    gl.BeginConditionalRender(id, mode);
+    rec.end();
+    rec.argu(id);
+    rec.argu(mode);
+    rec.commit();
+}
+
+static void GLAPI trace_EndConditionalRender() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.EndConditionalRender();
+        return;
+    }
+
+    TraceRecord rec(216);
+    rec.begin();
+    gl.EndConditionalRender();
+    rec.end();
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribIPointer(index, size, type, stride, pointer);
+        return;
+    }
+
+    TraceRecord rec(217);
+    rec.begin();
+    gl.VertexAttribIPointer(index, size, type, stride, pointer);
+    rec.end();
+    rec.argu(index);
+    rec.argi(size);
+    rec.argu(type);
+    rec.argi(stride);
+    rec.argp(pointer);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexAttribIiv(GLuint index, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexAttribIiv(index, pname, params);
+        return;
+    }
+
+    TraceRecord rec(218);
+    rec.begin();
+    gl.GetVertexAttribIiv(index, pname, params);
+    rec.end();
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexAttribIuiv(index, pname, params);
+        return;
+    }
+
+    TraceRecord rec(219);
+    rec.begin();
+    gl.GetVertexAttribIuiv(index, pname, params);
+    rec.end();
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI1i(GLuint index, GLint x) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI1i(index, x);
+        return;
+    }
+
+    TraceRecord rec(220);
+    rec.begin();
+    gl.VertexAttribI1i(index, x);
+    rec.end();
+    rec.argu(index);
+    rec.argi(x);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI2i(GLuint index, GLint x, GLint y) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI2i(index, x, y);
+        return;
+    }
+
+    TraceRecord rec(221);
+    rec.begin();
+    gl.VertexAttribI2i(index, x, y);
+    rec.end();
+    rec.argu(index);
+    rec.argi(x);
+    rec.argi(y);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI3i(index, x, y, z);
+        return;
+    }
+
+    TraceRecord rec(222);
+    rec.begin();
+    gl.VertexAttribI3i(index, x, y, z);
+    rec.end();
+    rec.argu(index);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(z);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI4i(index, x, y, z, w);
+        return;
+    }
+
+    TraceRecord rec(223);
+    rec.begin();
+    gl.VertexAttribI4i(index, x, y, z, w);
+    rec.end();
+    rec.argu(index);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(z);
+    rec.argi(w);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI1ui(GLuint index, GLuint x) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI1ui(index, x);
+        return;
+    }
+
+    TraceRecord rec(224);
+    rec.begin();
+    gl.VertexAttribI1ui(index, x);
+    rec.end();
+    rec.argu(index);
+    rec.argu(x);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI2ui(index, x, y);
+        return;
+    }
+
+    TraceRecord rec(225);
+    rec.begin();
+    gl.VertexAttribI2ui(index, x, y);
+    rec.end();
+    rec.argu(index);
+    rec.argu(x);
+    rec.argu(y);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI3ui(index, x, y, z);
+        return;
+    }
+
+    TraceRecord rec(226);
+    rec.begin();
+    gl.VertexAttribI3ui(index, x, y, z);
+    rec.end();
+    rec.argu(index);
+    rec.argu(x);
+    rec.argu(y);
+    rec.argu(z);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI4ui(index, x, y, z, w);
+        return;
+    }
+
+    TraceRecord rec(227);
+    rec.begin();
+    gl.VertexAttribI4ui(index, x, y, z, w);
+    rec.end();
+    rec.argu(index);
+    rec.argu(x);
+    rec.argu(y);
+    rec.argu(z);
+    rec.argu(w);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI1iv(GLuint index, const GLint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI1iv(index, v);
+        return;
+    }
+
+    TraceRecord rec(228);
+    rec.begin();
+    gl.VertexAttribI1iv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 1 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI2iv(GLuint index, const GLint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI2iv(index, v);
+        return;
+    }
+
+    TraceRecord rec(229);
+    rec.begin();
+    gl.VertexAttribI2iv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 2 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI3iv(GLuint index, const GLint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI3iv(index, v);
+        return;
+    }
+
+    TraceRecord rec(230);
+    rec.begin();
+    gl.VertexAttribI3iv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 3 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI4iv(GLuint index, const GLint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI4iv(index, v);
+        return;
+    }
+
+    TraceRecord rec(231);
+    rec.begin();
+    gl.VertexAttribI4iv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI1uiv(GLuint index, const GLuint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI1uiv(index, v);
+        return;
+    }
+
+    TraceRecord rec(232);
+    rec.begin();
+    gl.VertexAttribI1uiv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 1 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI2uiv(GLuint index, const GLuint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI2uiv(index, v);
+        return;
+    }
+
+    TraceRecord rec(233);
+    rec.begin();
+    gl.VertexAttribI2uiv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 2 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI3uiv(GLuint index, const GLuint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI3uiv(index, v);
+        return;
+    }
+
+    TraceRecord rec(234);
+    rec.begin();
+    gl.VertexAttribI3uiv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 3 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI4uiv(GLuint index, const GLuint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI4uiv(index, v);
+        return;
+    }
+
+    TraceRecord rec(235);
+    rec.begin();
+    gl.VertexAttribI4uiv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI4bv(GLuint index, const GLbyte * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI4bv(index, v);
+        return;
+    }
+
+    TraceRecord rec(236);
+    rec.begin();
+    gl.VertexAttribI4bv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 1);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI4sv(GLuint index, const GLshort * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI4sv(index, v);
+        return;
+    }
+
+    TraceRecord rec(237);
+    rec.begin();
+    gl.VertexAttribI4sv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 2);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI4ubv(GLuint index, const GLubyte * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI4ubv(index, v);
+        return;
+    }
+
+    TraceRecord rec(238);
+    rec.begin();
+    gl.VertexAttribI4ubv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 1);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribI4usv(GLuint index, const GLushort * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribI4usv(index, v);
+        return;
+    }
+
+    TraceRecord rec(239);
+    rec.begin();
+    gl.VertexAttribI4usv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 2);
+    rec.commit();
+}
+
+static void GLAPI trace_GetUniformuiv(GLuint program, GLint location, GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetUniformuiv(program, location, params);
+        return;
+    }
+
+    TraceRecord rec(240);
+    rec.begin();
+    gl.GetUniformuiv(program, location, params);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_BindFragDataLocation(GLuint program, GLuint color, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindFragDataLocation(program, color, name);
+        return;
+    }
+
+    TraceRecord rec(241);
+    rec.begin();
+    gl.BindFragDataLocation(program, color, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(color);
+    rec.argp(name);
+    rec.string(2, name, -1);
+    rec.commit();
+}
+
+static GLint GLAPI trace_GetFragDataLocation(GLuint program, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLint result = gl.GetFragDataLocation(program, name);
+        return result;
+    }
+
+    TraceRecord rec(242);
+    rec.begin();
+    GLint result = gl.GetFragDataLocation(program, name);
+    rec.end();
+    rec.argu(program);
+    rec.argp(name);
+    rec.argi(result);
+    rec.string(1, name, -1);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_Uniform1ui(GLint location, GLuint v0) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform1ui(location, v0);
+        return;
+    }
+
+    TraceRecord rec(243);
+    rec.begin();
+    gl.Uniform1ui(location, v0);
+    rec.end();
+    rec.argi(location);
+    rec.argu(v0);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform2ui(GLint location, GLuint v0, GLuint v1) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform2ui(location, v0, v1);
+        return;
+    }
+
+    TraceRecord rec(244);
+    rec.begin();
+    gl.Uniform2ui(location, v0, v1);
+    rec.end();
+    rec.argi(location);
+    rec.argu(v0);
+    rec.argu(v1);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform3ui(location, v0, v1, v2);
+        return;
+    }
+
+    TraceRecord rec(245);
+    rec.begin();
+    gl.Uniform3ui(location, v0, v1, v2);
+    rec.end();
+    rec.argi(location);
+    rec.argu(v0);
+    rec.argu(v1);
+    rec.argu(v2);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform4ui(location, v0, v1, v2, v3);
+        return;
+    }
+
+    TraceRecord rec(246);
+    rec.begin();
+    gl.Uniform4ui(location, v0, v1, v2, v3);
+    rec.end();
+    rec.argi(location);
+    rec.argu(v0);
+    rec.argu(v1);
+    rec.argu(v2);
+    rec.argu(v3);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform1uiv(GLint location, GLsizei count, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform1uiv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(247);
+    rec.begin();
+    gl.Uniform1uiv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 1 * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform2uiv(GLint location, GLsizei count, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform2uiv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(248);
+    rec.begin();
+    gl.Uniform2uiv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 2 * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform3uiv(GLint location, GLsizei count, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform3uiv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(249);
+    rec.begin();
+    gl.Uniform3uiv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 3 * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform4uiv(GLint location, GLsizei count, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform4uiv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(250);
+    rec.begin();
+    gl.Uniform4uiv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 4 * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_TexParameterIiv(GLenum target, GLenum pname, const GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexParameterIiv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(251);
+    rec.begin();
+    gl.TexParameterIiv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.data(2, params, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_TexParameterIuiv(GLenum target, GLenum pname, const GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexParameterIuiv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(252);
+    rec.begin();
+    gl.TexParameterIuiv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.data(2, params, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTexParameterIiv(GLenum target, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTexParameterIiv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(253);
+    rec.begin();
+    gl.GetTexParameterIiv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTexParameterIuiv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(254);
+    rec.begin();
+    gl.GetTexParameterIuiv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearBufferiv(buffer, drawbuffer, value);
+        return;
+    }
+
+    TraceRecord rec(255);
+    rec.begin();
+    gl.ClearBufferiv(buffer, drawbuffer, value);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(drawbuffer);
+    rec.argp(value);
+    rec.data(2, value, buffer == GL_COLOR ? 16 : 4);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearBufferuiv(buffer, drawbuffer, value);
+        return;
+    }
+
+    TraceRecord rec(256);
+    rec.begin();
+    gl.ClearBufferuiv(buffer, drawbuffer, value);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(drawbuffer);
+    rec.argp(value);
+    rec.data(2, value, buffer == GL_COLOR ? 16 : 4);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearBufferfv(buffer, drawbuffer, value);
+        return;
+    }
+
+    TraceRecord rec(257);
+    rec.begin();
+    gl.ClearBufferfv(buffer, drawbuffer, value);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(drawbuffer);
+    rec.argp(value);
+    rec.data(2, value, buffer == GL_COLOR ? 16 : 4);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearBufferfi(buffer, drawbuffer, depth, stencil);
+        return;
+    }
+
+    TraceRecord rec(258);
+    rec.begin();
+    gl.ClearBufferfi(buffer, drawbuffer, depth, stencil);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(drawbuffer);
+    rec.argf(depth);
+    rec.argi(stencil);
+    rec.commit();
+}
+
+static const GLubyte * GLAPI trace_GetStringi(GLenum name, GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        const GLubyte * result = gl.GetStringi(name, index);
+        return result;
+    }
+
+    TraceRecord rec(259);
+    rec.begin();
+    const GLubyte * result = gl.GetStringi(name, index);
+    rec.end();
+    rec.argu(name);
+    rec.argu(index);
+    rec.argp(result);
+    rec.commit();
+    return result;
+}
+
+static GLboolean GLAPI trace_IsRenderbuffer(GLuint renderbuffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsRenderbuffer(renderbuffer);
+        return result;
+    }
+
+    TraceRecord rec(260);
+    rec.begin();
+    GLboolean result = gl.IsRenderbuffer(renderbuffer);
+    rec.end();
+    rec.argu(renderbuffer);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_BindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindRenderbuffer(target, renderbuffer);
+        return;
+    }
+
+    TraceRecord rec(261);
+    rec.begin();
+    gl.BindRenderbuffer(target, renderbuffer);
+    rec.end();
+    rec.argu(target);
+    rec.argu(renderbuffer);
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteRenderbuffers(n, renderbuffers);
+        return;
+    }
+
+    TraceRecord rec(262);
+    rec.begin();
+    gl.DeleteRenderbuffers(n, renderbuffers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(renderbuffers);
+    rec.data(1, renderbuffers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_GenRenderbuffers(GLsizei n, GLuint * renderbuffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenRenderbuffers(n, renderbuffers);
+        return;
+    }
+
+    TraceRecord rec(263);
+    rec.begin();
+    gl.GenRenderbuffers(n, renderbuffers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(renderbuffers);
+    rec.data(1, renderbuffers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.RenderbufferStorage(target, internalformat, width, height);
+        return;
+    }
+
+    TraceRecord rec(264);
+    rec.begin();
+    gl.RenderbufferStorage(target, internalformat, width, height);
+    rec.end();
+    rec.argu(target);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetRenderbufferParameteriv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(265);
+    rec.begin();
+    gl.GetRenderbufferParameteriv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsFramebuffer(GLuint framebuffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsFramebuffer(framebuffer);
+        return result;
+    }
+
+    TraceRecord rec(266);
+    rec.begin();
+    GLboolean result = gl.IsFramebuffer(framebuffer);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_BindFramebuffer(GLenum target, GLuint framebuffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindFramebuffer(target, framebuffer);
+        return;
+    }
+
+    TraceRecord rec(267);
+    rec.begin();
+    gl.BindFramebuffer(target, framebuffer);
+    rec.end();
+    rec.argu(target);
+    rec.argu(framebuffer);
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteFramebuffers(GLsizei n, const GLuint * framebuffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteFramebuffers(n, framebuffers);
+        return;
+    }
+
+    TraceRecord rec(268);
+    rec.begin();
+    gl.DeleteFramebuffers(n, framebuffers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(framebuffers);
+    rec.data(1, framebuffers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_GenFramebuffers(GLsizei n, GLuint * framebuffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenFramebuffers(n, framebuffers);
+        return;
+    }
+
+    TraceRecord rec(269);
+    rec.begin();
+    gl.GenFramebuffers(n, framebuffers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(framebuffers);
+    rec.data(1, framebuffers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static GLenum GLAPI trace_CheckFramebufferStatus(GLenum target) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLenum result = gl.CheckFramebufferStatus(target);
+        return result;
+    }
+
+    TraceRecord rec(270);
+    rec.begin();
+    GLenum result = gl.CheckFramebufferStatus(target);
+    rec.end();
+    rec.argu(target);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_FramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FramebufferTexture1D(target, attachment, textarget, texture, level);
+        return;
+    }
+
+    TraceRecord rec(271);
+    rec.begin();
+    gl.FramebufferTexture1D(target, attachment, textarget, texture, level);
+    rec.end();
+    rec.argu(target);
+    rec.argu(attachment);
+    rec.argu(textarget);
+    rec.argu(texture);
+    rec.argi(level);
+    rec.commit();
+}
+
+static void GLAPI trace_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FramebufferTexture2D(target, attachment, textarget, texture, level);
+        return;
+    }
+
+    TraceRecord rec(272);
+    rec.begin();
+    gl.FramebufferTexture2D(target, attachment, textarget, texture, level);
+    rec.end();
+    rec.argu(target);
+    rec.argu(attachment);
+    rec.argu(textarget);
+    rec.argu(texture);
+    rec.argi(level);
+    rec.commit();
+}
+
+static void GLAPI trace_FramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+        return;
+    }
+
+    TraceRecord rec(273);
+    rec.begin();
+    gl.FramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+    rec.end();
+    rec.argu(target);
+    rec.argu(attachment);
+    rec.argu(textarget);
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(zoffset);
+    rec.commit();
+}
+
+static void GLAPI trace_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+        return;
+    }
+
+    TraceRecord rec(274);
+    rec.begin();
+    gl.FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    rec.end();
+    rec.argu(target);
+    rec.argu(attachment);
+    rec.argu(renderbuffertarget);
+    rec.argu(renderbuffer);
+    rec.commit();
+}
+
+static void GLAPI trace_GetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+        return;
+    }
+
+    TraceRecord rec(275);
+    rec.begin();
+    gl.GetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(attachment);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GenerateMipmap(GLenum target) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenerateMipmap(target);
+        return;
+    }
+
+    TraceRecord rec(276);
+    rec.begin();
+    gl.GenerateMipmap(target);
+    rec.end();
+    rec.argu(target);
+    rec.commit();
+}
+
+static void GLAPI trace_BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+        return;
+    }
+
+    TraceRecord rec(277);
+    rec.begin();
+    gl.BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    rec.end();
+    rec.argi(srcX0);
+    rec.argi(srcY0);
+    rec.argi(srcX1);
+    rec.argi(srcY1);
+    rec.argi(dstX0);
+    rec.argi(dstY0);
+    rec.argi(dstX1);
+    rec.argi(dstY1);
+    rec.argu(mask);
+    rec.argu(filter);
+    rec.commit();
+}
+
+static void GLAPI trace_RenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+        return;
+    }
+
+    TraceRecord rec(278);
+    rec.begin();
+    gl.RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+    rec.end();
+    rec.argu(target);
+    rec.argi(samples);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FramebufferTextureLayer(target, attachment, texture, level, layer);
+        return;
+    }
+
+    TraceRecord rec(279);
+    rec.begin();
+    gl.FramebufferTextureLayer(target, attachment, texture, level, layer);
+    rec.end();
+    rec.argu(target);
+    rec.argu(attachment);
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(layer);
+    rec.commit();
+}
+
+static void * GLAPI trace_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        void * result = gl.MapBufferRange(target, offset, length, access);
+        trace_map(target, result, length, access);
+        return result;
+    }
+
+    TraceRecord rec(280);
+    rec.begin();
+    void * result = gl.MapBufferRange(target, offset, length, access);
+    rec.end();
+    trace_map(target, result, length, access);
+    rec.argu(target);
+    rec.argi(offset);
+    rec.argi(length);
+    rec.argu(access);
+    rec.argp(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FlushMappedBufferRange(target, offset, length);
+        return;
+    }
+
+    TraceRecord rec(281);
+    rec.begin();
+    gl.FlushMappedBufferRange(target, offset, length);
+    rec.end();
+    rec.argu(target);
+    rec.argi(offset);
+    rec.argi(length);
+    rec.commit();
+}
+
+static void GLAPI trace_BindVertexArray(GLuint array) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindVertexArray(array);
+        return;
+    }
+
+    TraceRecord rec(282);
+    rec.begin();
+    gl.BindVertexArray(array);
+    rec.end();
+    rec.argu(array);
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteVertexArrays(GLsizei n, const GLuint * arrays) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteVertexArrays(n, arrays);
+        return;
+    }
+
+    TraceRecord rec(283);
+    rec.begin();
+    gl.DeleteVertexArrays(n, arrays);
+    rec.end();
+    rec.argi(n);
+    rec.argp(arrays);
+    rec.data(1, arrays, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_GenVertexArrays(GLsizei n, GLuint * arrays) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenVertexArrays(n, arrays);
+        return;
+    }
+
+    TraceRecord rec(284);
+    rec.begin();
+    gl.GenVertexArrays(n, arrays);
+    rec.end();
+    rec.argi(n);
+    rec.argp(arrays);
+    rec.data(1, arrays, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsVertexArray(GLuint array) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsVertexArray(array);
+        return result;
+    }
+
+    TraceRecord rec(285);
+    rec.begin();
+    GLboolean result = gl.IsVertexArray(array);
+    rec.end();
+    rec.argu(array);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawArraysInstanced(mode, first, count, instancecount);
+        return;
+    }
+
+    TraceRecord rec(286);
+    rec.begin();
+    gl.DrawArraysInstanced(mode, first, count, instancecount);
+    rec.end();
+    rec.argu(mode);
+    rec.argi(first);
+    rec.argi(count);
+    rec.argi(instancecount);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawElementsInstanced(mode, count, type, indices, instancecount);
+        return;
+    }
+
+    TraceRecord rec(287);
+    rec.begin();
+    gl.DrawElementsInstanced(mode, count, type, indices, instancecount);
+    rec.end();
+    rec.argu(mode);
+    rec.argi(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.argi(instancecount);
+    rec.commit();
+}
+
+static void GLAPI trace_TexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexBuffer(target, internalformat, buffer);
+        return;
+    }
+
+    TraceRecord rec(288);
+    rec.begin();
+    gl.TexBuffer(target, internalformat, buffer);
+    rec.end();
+    rec.argu(target);
+    rec.argu(internalformat);
+    rec.argu(buffer);
+    rec.commit();
+}
+
+static void GLAPI trace_PrimitiveRestartIndex(GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PrimitiveRestartIndex(index);
+        return;
+    }
+
+    TraceRecord rec(289);
+    rec.begin();
+    gl.PrimitiveRestartIndex(index);
+    rec.end();
+    rec.argu(index);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+        return;
+    }
+
+    TraceRecord rec(290);
+    rec.begin();
+    gl.CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+    rec.end();
+    rec.argu(readTarget);
+    rec.argu(writeTarget);
+    rec.argi(readOffset);
+    rec.argi(writeOffset);
+    rec.argi(size);
+    rec.commit();
+}
+
+static void GLAPI trace_GetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar * const * uniformNames, GLuint * uniformIndices) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+        return;
+    }
+
+    TraceRecord rec(291);
+    rec.begin();
+    gl.GetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+    rec.end();
+    rec.argu(program);
+    rec.argi(uniformCount);
+    rec.argp(uniformNames);
+    rec.argp(uniformIndices);
+    rec.strings(2, uniformCount, uniformNames, 0);
+    rec.commit();
+}
+
+static void GLAPI trace_GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+        return;
+    }
+
+    TraceRecord rec(292);
+    rec.begin();
+    gl.GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+    rec.end();
+    rec.argu(program);
+    rec.argi(uniformCount);
+    rec.argp(uniformIndices);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+        return;
+    }
+
+    TraceRecord rec(293);
+    rec.begin();
+    gl.GetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+    rec.end();
+    rec.argu(program);
+    rec.argu(uniformIndex);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(uniformName);
+    rec.commit();
+}
+
+static GLuint GLAPI trace_GetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLuint result = gl.GetUniformBlockIndex(program, uniformBlockName);
+        return result;
+    }
+
+    TraceRecord rec(294);
+    rec.begin();
+    GLuint result = gl.GetUniformBlockIndex(program, uniformBlockName);
+    rec.end();
+    rec.argu(program);
+    rec.argp(uniformBlockName);
+    rec.argu(result);
+    rec.string(1, uniformBlockName, -1);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+        return;
+    }
+
+    TraceRecord rec(295);
+    rec.begin();
+    gl.GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+    rec.end();
+    rec.argu(program);
+    rec.argu(uniformBlockIndex);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+        return;
+    }
+
+    TraceRecord rec(296);
+    rec.begin();
+    gl.GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    rec.end();
+    rec.argu(program);
+    rec.argu(uniformBlockIndex);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(uniformBlockName);
+    rec.commit();
+}
+
+static void GLAPI trace_UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+        return;
+    }
+
+    TraceRecord rec(297);
+    rec.begin();
+    gl.UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+    rec.end();
+    rec.argu(program);
+    rec.argu(uniformBlockIndex);
+    rec.argu(uniformBlockBinding);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawElementsBaseVertex(mode, count, type, indices, basevertex);
+        return;
+    }
+
+    TraceRecord rec(298);
+    rec.begin();
+    gl.DrawElementsBaseVertex(mode, count, type, indices, basevertex);
+    rec.end();
+    rec.argu(mode);
+    rec.argi(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.argi(basevertex);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+        return;
+    }
+
+    TraceRecord rec(299);
+    rec.begin();
+    gl.DrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+    rec.end();
+    rec.argu(mode);
+    rec.argu(start);
+    rec.argu(end);
+    rec.argi(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.argi(basevertex);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+        return;
+    }
+
+    TraceRecord rec(300);
+    rec.begin();
+    gl.DrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+    rec.end();
+    rec.argu(mode);
+    rec.argi(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.argi(instancecount);
+    rec.argi(basevertex);
+    rec.commit();
+}
+
+static void GLAPI trace_MultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const void * const * indices, GLsizei drawcount, const GLint * basevertex) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+        return;
+    }
+
+    TraceRecord rec(301);
+    rec.begin();
+    gl.MultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+    rec.end();
+    rec.argu(mode);
+    rec.argp(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.argi(drawcount);
+    rec.argp(basevertex);
+    rec.commit();
+}
+
+static void GLAPI trace_ProvokingVertex(GLenum mode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProvokingVertex(mode);
+        return;
+    }
+
+    TraceRecord rec(302);
+    rec.begin();
+    gl.ProvokingVertex(mode);
+    rec.end();
+    rec.argu(mode);
+    rec.commit();
+}
+
+static GLsync GLAPI trace_FenceSync(GLenum condition, GLbitfield flags) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLsync result = gl.FenceSync(condition, flags);
+        return result;
+    }
+
+    TraceRecord rec(303);
+    rec.begin();
+    GLsync result = gl.FenceSync(condition, flags);
+    rec.end();
+    rec.argu(condition);
+    rec.argu(flags);
+    rec.argp(result);
+    rec.commit();
+    return result;
+}
+
+static GLboolean GLAPI trace_IsSync(GLsync sync) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsSync(sync);
+        return result;
+    }
+
+    TraceRecord rec(304);
+    rec.begin();
+    GLboolean result = gl.IsSync(sync);
+    rec.end();
+    rec.argp(sync);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_DeleteSync(GLsync sync) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteSync(sync);
+        return;
+    }
+
+    TraceRecord rec(305);
+    rec.begin();
+    gl.DeleteSync(sync);
+    rec.end();
+    rec.argp(sync);
+    rec.commit();
+}
+
+static GLenum GLAPI trace_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLenum result = gl.ClientWaitSync(sync, flags, timeout);
+        return result;
+    }
+
+    TraceRecord rec(306);
+    rec.begin();
+    GLenum result = gl.ClientWaitSync(sync, flags, timeout);
+    rec.end();
+    rec.argp(sync);
+    rec.argu(flags);
+    rec.argu(timeout);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.WaitSync(sync, flags, timeout);
+        return;
+    }
+
+    TraceRecord rec(307);
+    rec.begin();
+    gl.WaitSync(sync, flags, timeout);
+    rec.end();
+    rec.argp(sync);
+    rec.argu(flags);
+    rec.argu(timeout);
+    rec.commit();
+}
+
+static void GLAPI trace_GetInteger64v(GLenum pname, GLint64 * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetInteger64v(pname, data);
+        return;
+    }
+
+    TraceRecord rec(308);
+    rec.begin();
+    gl.GetInteger64v(pname, data);
+    rec.end();
+    rec.argu(pname);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetSynciv(sync, pname, bufSize, length, values);
+        return;
+    }
+
+    TraceRecord rec(309);
+    rec.begin();
+    gl.GetSynciv(sync, pname, bufSize, length, values);
+    rec.end();
+    rec.argp(sync);
+    rec.argu(pname);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(values);
+    rec.commit();
+}
+
+static void GLAPI trace_GetInteger64i_v(GLenum target, GLuint index, GLint64 * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetInteger64i_v(target, index, data);
+        return;
+    }
+
+    TraceRecord rec(310);
+    rec.begin();
+    gl.GetInteger64i_v(target, index, data);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetBufferParameteri64v(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(311);
+    rec.begin();
+    gl.GetBufferParameteri64v(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_FramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FramebufferTexture(target, attachment, texture, level);
+        return;
+    }
+
+    TraceRecord rec(312);
+    rec.begin();
+    gl.FramebufferTexture(target, attachment, texture, level);
+    rec.end();
+    rec.argu(target);
+    rec.argu(attachment);
+    rec.argu(texture);
+    rec.argi(level);
+    rec.commit();
+}
+
+static void GLAPI trace_TexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+        return;
+    }
+
+    TraceRecord rec(313);
+    rec.begin();
+    gl.TexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    rec.end();
+    rec.argu(target);
+    rec.argi(samples);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argu(fixedsamplelocations);
+    rec.commit();
+}
+
+static void GLAPI trace_TexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+        return;
+    }
+
+    TraceRecord rec(314);
+    rec.begin();
+    gl.TexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    rec.end();
+    rec.argu(target);
+    rec.argi(samples);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argu(fixedsamplelocations);
+    rec.commit();
+}
+
+static void GLAPI trace_GetMultisamplefv(GLenum pname, GLuint index, GLfloat * val) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetMultisamplefv(pname, index, val);
+        return;
+    }
+
+    TraceRecord rec(315);
+    rec.begin();
+    gl.GetMultisamplefv(pname, index, val);
+    rec.end();
+    rec.argu(pname);
+    rec.argu(index);
+    rec.argp(val);
+    rec.commit();
+}
+
+static void GLAPI trace_SampleMaski(GLuint maskNumber, GLbitfield mask) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.SampleMaski(maskNumber, mask);
+        return;
+    }
+
+    TraceRecord rec(316);
+    rec.begin();
+    gl.SampleMaski(maskNumber, mask);
+    rec.end();
+    rec.argu(maskNumber);
+    rec.argu(mask);
+    rec.commit();
+}
+
+static void GLAPI trace_BindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindFragDataLocationIndexed(program, colorNumber, index, name);
+        return;
+    }
+
+    TraceRecord rec(317);
+    rec.begin();
+    gl.BindFragDataLocationIndexed(program, colorNumber, index, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(colorNumber);
+    rec.argu(index);
+    rec.argp(name);
+    rec.string(3, name, -1);
+    rec.commit();
+}
+
+static GLint GLAPI trace_GetFragDataIndex(GLuint program, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLint result = gl.GetFragDataIndex(program, name);
+        return result;
+    }
+
+    TraceRecord rec(318);
+    rec.begin();
+    GLint result = gl.GetFragDataIndex(program, name);
+    rec.end();
+    rec.argu(program);
+    rec.argp(name);
+    rec.argi(result);
+    rec.string(1, name, -1);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GenSamplers(GLsizei count, GLuint * samplers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenSamplers(count, samplers);
+        return;
+    }
+
+    TraceRecord rec(319);
+    rec.begin();
+    gl.GenSamplers(count, samplers);
+    rec.end();
+    rec.argi(count);
+    rec.argp(samplers);
+    rec.data(1, samplers, count * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteSamplers(GLsizei count, const GLuint * samplers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteSamplers(count, samplers);
+        return;
+    }
+
+    TraceRecord rec(320);
+    rec.begin();
+    gl.DeleteSamplers(count, samplers);
+    rec.end();
+    rec.argi(count);
+    rec.argp(samplers);
+    rec.data(1, samplers, count * sizeof(GLuint));
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsSampler(GLuint sampler) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsSampler(sampler);
+        return result;
+    }
+
+    TraceRecord rec(321);
+    rec.begin();
+    GLboolean result = gl.IsSampler(sampler);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_BindSampler(GLuint unit, GLuint sampler) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindSampler(unit, sampler);
+        return;
+    }
+
+    TraceRecord rec(322);
+    rec.begin();
+    gl.BindSampler(unit, sampler);
+    rec.end();
+    rec.argu(unit);
+    rec.argu(sampler);
+    rec.commit();
+}
+
+static void GLAPI trace_SamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.SamplerParameteri(sampler, pname, param);
+        return;
+    }
+
+    TraceRecord rec(323);
+    rec.begin();
+    gl.SamplerParameteri(sampler, pname, param);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argi(param);
+    rec.commit();
+}
+
+static void GLAPI trace_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.SamplerParameteriv(sampler, pname, param);
+        return;
+    }
+
+    TraceRecord rec(324);
+    rec.begin();
+    gl.SamplerParameteriv(sampler, pname, param);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.data(2, param, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.SamplerParameterf(sampler, pname, param);
+        return;
+    }
+
+    TraceRecord rec(325);
+    rec.begin();
+    gl.SamplerParameterf(sampler, pname, param);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argf(param);
+    rec.commit();
+}
+
+static void GLAPI trace_SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.SamplerParameterfv(sampler, pname, param);
+        return;
+    }
+
+    TraceRecord rec(326);
+    rec.begin();
+    gl.SamplerParameterfv(sampler, pname, param);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.data(2, param, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.SamplerParameterIiv(sampler, pname, param);
+        return;
+    }
+
+    TraceRecord rec(327);
+    rec.begin();
+    gl.SamplerParameterIiv(sampler, pname, param);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.data(2, param, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.SamplerParameterIuiv(sampler, pname, param);
+        return;
+    }
+
+    TraceRecord rec(328);
+    rec.begin();
+    gl.SamplerParameterIuiv(sampler, pname, param);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.data(2, param, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetSamplerParameteriv(sampler, pname, params);
+        return;
+    }
+
+    TraceRecord rec(329);
+    rec.begin();
+    gl.GetSamplerParameteriv(sampler, pname, params);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetSamplerParameterIiv(sampler, pname, params);
+        return;
+    }
+
+    TraceRecord rec(330);
+    rec.begin();
+    gl.GetSamplerParameterIiv(sampler, pname, params);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetSamplerParameterfv(sampler, pname, params);
+        return;
+    }
+
+    TraceRecord rec(331);
+    rec.begin();
+    gl.GetSamplerParameterfv(sampler, pname, params);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetSamplerParameterIuiv(sampler, pname, params);
+        return;
+    }
+
+    TraceRecord rec(332);
+    rec.begin();
+    gl.GetSamplerParameterIuiv(sampler, pname, params);
+    rec.end();
+    rec.argu(sampler);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_QueryCounter(GLuint id, GLenum target) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.QueryCounter(id, target);
+        return;
+    }
+
+    TraceRecord rec(333);
+    rec.begin();
+    gl.QueryCounter(id, target);
+    rec.end();
+    rec.argu(id);
+    rec.argu(target);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryObjecti64v(id, pname, params);
+        return;
+    }
+
+    TraceRecord rec(334);
+    rec.begin();
+    gl.GetQueryObjecti64v(id, pname, params);
+    rec.end();
+    rec.argu(id);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryObjectui64v(id, pname, params);
+        return;
+    }
+
+    TraceRecord rec(335);
+    rec.begin();
+    gl.GetQueryObjectui64v(id, pname, params);
+    rec.end();
+    rec.argu(id);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribDivisor(GLuint index, GLuint divisor) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribDivisor(index, divisor);
+        return;
+    }
+
+    TraceRecord rec(336);
+    rec.begin();
+    gl.VertexAttribDivisor(index, divisor);
+    rec.end();
+    rec.argu(index);
+    rec.argu(divisor);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribP1ui(index, type, normalized, value);
+        return;
+    }
+
+    TraceRecord rec(337);
+    rec.begin();
+    gl.VertexAttribP1ui(index, type, normalized, value);
+    rec.end();
+    rec.argu(index);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argu(value);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribP1uiv(index, type, normalized, value);
+        return;
+    }
+
+    TraceRecord rec(338);
+    rec.begin();
+    gl.VertexAttribP1uiv(index, type, normalized, value);
+    rec.end();
+    rec.argu(index);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argp(value);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribP2ui(index, type, normalized, value);
+        return;
+    }
+
+    TraceRecord rec(339);
+    rec.begin();
+    gl.VertexAttribP2ui(index, type, normalized, value);
+    rec.end();
+    rec.argu(index);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argu(value);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribP2uiv(index, type, normalized, value);
+        return;
+    }
+
+    TraceRecord rec(340);
+    rec.begin();
+    gl.VertexAttribP2uiv(index, type, normalized, value);
+    rec.end();
+    rec.argu(index);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argp(value);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribP3ui(index, type, normalized, value);
+        return;
+    }
+
+    TraceRecord rec(341);
+    rec.begin();
+    gl.VertexAttribP3ui(index, type, normalized, value);
+    rec.end();
+    rec.argu(index);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argu(value);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribP3uiv(index, type, normalized, value);
+        return;
+    }
+
+    TraceRecord rec(342);
+    rec.begin();
+    gl.VertexAttribP3uiv(index, type, normalized, value);
+    rec.end();
+    rec.argu(index);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argp(value);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribP4ui(index, type, normalized, value);
+        return;
+    }
+
+    TraceRecord rec(343);
+    rec.begin();
+    gl.VertexAttribP4ui(index, type, normalized, value);
+    rec.end();
+    rec.argu(index);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argu(value);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribP4uiv(index, type, normalized, value);
+        return;
+    }
+
+    TraceRecord rec(344);
+    rec.begin();
+    gl.VertexAttribP4uiv(index, type, normalized, value);
+    rec.end();
+    rec.argu(index);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argp(value);
+    rec.commit();
+}
+
+static void GLAPI trace_MinSampleShading(GLfloat value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MinSampleShading(value);
+        return;
+    }
+
+    TraceRecord rec(345);
+    rec.begin();
+    gl.MinSampleShading(value);
+    rec.end();
+    rec.argf(value);
+    rec.commit();
+}
+
+static void GLAPI trace_BlendEquationi(GLuint buf, GLenum mode) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlendEquationi(buf, mode);
+        return;
+    }
+
+    TraceRecord rec(346);
+    rec.begin();
+    gl.BlendEquationi(buf, mode);
+    rec.end();
+    rec.argu(buf);
+    rec.argu(mode);
+    rec.commit();
+}
+
+static void GLAPI trace_BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlendEquationSeparatei(buf, modeRGB, modeAlpha);
+        return;
+    }
+
+    TraceRecord rec(347);
+    rec.begin();
+    gl.BlendEquationSeparatei(buf, modeRGB, modeAlpha);
+    rec.end();
+    rec.argu(buf);
+    rec.argu(modeRGB);
+    rec.argu(modeAlpha);
+    rec.commit();
+}
+
+static void GLAPI trace_BlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlendFunci(buf, src, dst);
+        return;
+    }
+
+    TraceRecord rec(348);
+    rec.begin();
+    gl.BlendFunci(buf, src, dst);
+    rec.end();
+    rec.argu(buf);
+    rec.argu(src);
+    rec.argu(dst);
+    rec.commit();
+}
+
+static void GLAPI trace_BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+        return;
+    }
+
+    TraceRecord rec(349);
+    rec.begin();
+    gl.BlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+    rec.end();
+    rec.argu(buf);
+    rec.argu(srcRGB);
+    rec.argu(dstRGB);
+    rec.argu(srcAlpha);
+    rec.argu(dstAlpha);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawArraysIndirect(GLenum mode, const void * indirect) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawArraysIndirect(mode, indirect);
+        return;
+    }
+
+    TraceRecord rec(350);
+    rec.begin();
+    gl.DrawArraysIndirect(mode, indirect);
+    rec.end();
+    rec.argu(mode);
+    rec.argp(indirect);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawElementsIndirect(GLenum mode, GLenum type, const void * indirect) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawElementsIndirect(mode, type, indirect);
+        return;
+    }
+
+    TraceRecord rec(351);
+    rec.begin();
+    gl.DrawElementsIndirect(mode, type, indirect);
+    rec.end();
+    rec.argu(mode);
+    rec.argu(type);
+    rec.argp(indirect);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform1d(GLint location, GLdouble x) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform1d(location, x);
+        return;
+    }
+
+    TraceRecord rec(352);
+    rec.begin();
+    gl.Uniform1d(location, x);
+    rec.end();
+    rec.argi(location);
+    rec.argf(x);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform2d(GLint location, GLdouble x, GLdouble y) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform2d(location, x, y);
+        return;
+    }
+
+    TraceRecord rec(353);
+    rec.begin();
+    gl.Uniform2d(location, x, y);
+    rec.end();
+    rec.argi(location);
+    rec.argf(x);
+    rec.argf(y);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform3d(location, x, y, z);
+        return;
+    }
+
+    TraceRecord rec(354);
+    rec.begin();
+    gl.Uniform3d(location, x, y, z);
+    rec.end();
+    rec.argi(location);
+    rec.argf(x);
+    rec.argf(y);
+    rec.argf(z);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform4d(location, x, y, z, w);
+        return;
+    }
+
+    TraceRecord rec(355);
+    rec.begin();
+    gl.Uniform4d(location, x, y, z, w);
+    rec.end();
+    rec.argi(location);
+    rec.argf(x);
+    rec.argf(y);
+    rec.argf(z);
+    rec.argf(w);
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform1dv(GLint location, GLsizei count, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform1dv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(356);
+    rec.begin();
+    gl.Uniform1dv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 1 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform2dv(GLint location, GLsizei count, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform2dv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(357);
+    rec.begin();
+    gl.Uniform2dv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 2 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform3dv(GLint location, GLsizei count, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform3dv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(358);
+    rec.begin();
+    gl.Uniform3dv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 3 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_Uniform4dv(GLint location, GLsizei count, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.Uniform4dv(location, count, value);
+        return;
+    }
+
+    TraceRecord rec(359);
+    rec.begin();
+    gl.Uniform4dv(location, count, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(2, value, count * 4 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix2dv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(360);
+    rec.begin();
+    gl.UniformMatrix2dv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * 2 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix3dv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(361);
+    rec.begin();
+    gl.UniformMatrix3dv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * 3 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix4dv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(362);
+    rec.begin();
+    gl.UniformMatrix4dv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * 4 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix2x3dv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(363);
+    rec.begin();
+    gl.UniformMatrix2x3dv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * 3 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix2x4dv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(364);
+    rec.begin();
+    gl.UniformMatrix2x4dv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * 4 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix3x2dv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(365);
+    rec.begin();
+    gl.UniformMatrix3x2dv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * 2 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix3x4dv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(366);
+    rec.begin();
+    gl.UniformMatrix3x4dv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * 4 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix4x2dv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(367);
+    rec.begin();
+    gl.UniformMatrix4x2dv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * 2 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_UniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformMatrix4x3dv(location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(368);
+    rec.begin();
+    gl.UniformMatrix4x3dv(location, count, transpose, value);
+    rec.end();
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * 3 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_GetUniformdv(GLuint program, GLint location, GLdouble * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetUniformdv(program, location, params);
+        return;
+    }
+
+    TraceRecord rec(369);
+    rec.begin();
+    gl.GetUniformdv(program, location, params);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argp(params);
+    rec.commit();
+}
+
+static GLint GLAPI trace_GetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLint result = gl.GetSubroutineUniformLocation(program, shadertype, name);
+        return result;
+    }
+
+    TraceRecord rec(370);
+    rec.begin();
+    GLint result = gl.GetSubroutineUniformLocation(program, shadertype, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(shadertype);
+    rec.argp(name);
+    rec.argi(result);
+    rec.string(2, name, -1);
+    rec.commit();
+    return result;
+}
+
+static GLuint GLAPI trace_GetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLuint result = gl.GetSubroutineIndex(program, shadertype, name);
+        return result;
+    }
+
+    TraceRecord rec(371);
+    rec.begin();
+    GLuint result = gl.GetSubroutineIndex(program, shadertype, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(shadertype);
+    rec.argp(name);
+    rec.argu(result);
+    rec.string(2, name, -1);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint * values) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+        return;
+    }
+
+    TraceRecord rec(372);
+    rec.begin();
+    gl.GetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+    rec.end();
+    rec.argu(program);
+    rec.argu(shadertype);
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(values);
+    rec.commit();
+}
+
+static void GLAPI trace_GetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei * length, GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+        return;
+    }
+
+    TraceRecord rec(373);
+    rec.begin();
+    gl.GetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(shadertype);
+    rec.argu(index);
+    rec.argi(bufsize);
+    rec.argp(length);
+    rec.argp(name);
+    rec.commit();
+}
+
+static void GLAPI trace_GetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei * length, GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+        return;
+    }
+
+    TraceRecord rec(374);
+    rec.begin();
+    gl.GetActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(shadertype);
+    rec.argu(index);
+    rec.argi(bufsize);
+    rec.argp(length);
+    rec.argp(name);
+    rec.commit();
+}
+
+static void GLAPI trace_UniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint * indices) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UniformSubroutinesuiv(shadertype, count, indices);
+        return;
+    }
+
+    TraceRecord rec(375);
+    rec.begin();
+    gl.UniformSubroutinesuiv(shadertype, count, indices);
+    rec.end();
+    rec.argu(shadertype);
+    rec.argi(count);
+    rec.argp(indices);
+    rec.commit();
+}
+
+static void GLAPI trace_GetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetUniformSubroutineuiv(shadertype, location, params);
+        return;
+    }
+
+    TraceRecord rec(376);
+    rec.begin();
+    gl.GetUniformSubroutineuiv(shadertype, location, params);
+    rec.end();
+    rec.argu(shadertype);
+    rec.argi(location);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint * values) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetProgramStageiv(program, shadertype, pname, values);
+        return;
+    }
+
+    TraceRecord rec(377);
+    rec.begin();
+    gl.GetProgramStageiv(program, shadertype, pname, values);
+    rec.end();
+    rec.argu(program);
+    rec.argu(shadertype);
+    rec.argu(pname);
+    rec.argp(values);
+    rec.commit();
+}
+
+static void GLAPI trace_PatchParameteri(GLenum pname, GLint value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PatchParameteri(pname, value);
+        return;
+    }
+
+    TraceRecord rec(378);
+    rec.begin();
+    gl.PatchParameteri(pname, value);
+    rec.end();
+    rec.argu(pname);
+    rec.argi(value);
+    rec.commit();
+}
+
+static void GLAPI trace_PatchParameterfv(GLenum pname, const GLfloat * values) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PatchParameterfv(pname, values);
+        return;
+    }
+
+    TraceRecord rec(379);
+    rec.begin();
+    gl.PatchParameterfv(pname, values);
+    rec.end();
+    rec.argu(pname);
+    rec.argp(values);
+    rec.commit();
+}
+
+static void GLAPI trace_BindTransformFeedback(GLenum target, GLuint id) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindTransformFeedback(target, id);
+        return;
+    }
+
+    TraceRecord rec(380);
+    rec.begin();
+    gl.BindTransformFeedback(target, id);
+    rec.end();
+    rec.argu(target);
+    rec.argu(id);
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteTransformFeedbacks(GLsizei n, const GLuint * ids) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteTransformFeedbacks(n, ids);
+        return;
+    }
+
+    TraceRecord rec(381);
+    rec.begin();
+    gl.DeleteTransformFeedbacks(n, ids);
+    rec.end();
+    rec.argi(n);
+    rec.argp(ids);
+    rec.data(1, ids, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_GenTransformFeedbacks(GLsizei n, GLuint * ids) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenTransformFeedbacks(n, ids);
+        return;
+    }
+
+    TraceRecord rec(382);
+    rec.begin();
+    gl.GenTransformFeedbacks(n, ids);
+    rec.end();
+    rec.argi(n);
+    rec.argp(ids);
+    rec.data(1, ids, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsTransformFeedback(GLuint id) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsTransformFeedback(id);
+        return result;
+    }
+
+    TraceRecord rec(383);
+    rec.begin();
+    GLboolean result = gl.IsTransformFeedback(id);
+    rec.end();
+    rec.argu(id);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_PauseTransformFeedback() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PauseTransformFeedback();
+        return;
+    }
+
+    TraceRecord rec(384);
+    rec.begin();
+    gl.PauseTransformFeedback();
+    rec.end();
+    rec.commit();
+}
+
+static void GLAPI trace_ResumeTransformFeedback() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ResumeTransformFeedback();
+        return;
+    }
+
+    TraceRecord rec(385);
+    rec.begin();
+    gl.ResumeTransformFeedback();
+    rec.end();
+    rec.commit();
+}
+
+static void GLAPI trace_DrawTransformFeedback(GLenum mode, GLuint id) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawTransformFeedback(mode, id);
+        return;
+    }
+
+    TraceRecord rec(386);
+    rec.begin();
+    gl.DrawTransformFeedback(mode, id);
+    rec.end();
+    rec.argu(mode);
+    rec.argu(id);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawTransformFeedbackStream(mode, id, stream);
+        return;
+    }
+
+    TraceRecord rec(387);
+    rec.begin();
+    gl.DrawTransformFeedbackStream(mode, id, stream);
+    rec.end();
+    rec.argu(mode);
+    rec.argu(id);
+    rec.argu(stream);
+    rec.commit();
+}
+
+static void GLAPI trace_BeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BeginQueryIndexed(target, index, id);
+        return;
+    }
+
+    TraceRecord rec(388);
+    rec.begin();
+    gl.BeginQueryIndexed(target, index, id);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argu(id);
+    rec.commit();
+}
+
+static void GLAPI trace_EndQueryIndexed(GLenum target, GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.EndQueryIndexed(target, index);
+        return;
+    }
+
+    TraceRecord rec(389);
+    rec.begin();
+    gl.EndQueryIndexed(target, index);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryIndexediv(target, index, pname, params);
+        return;
+    }
+
+    TraceRecord rec(390);
+    rec.begin();
+    gl.GetQueryIndexediv(target, index, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_ReleaseShaderCompiler() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ReleaseShaderCompiler();
+        return;
+    }
+
+    TraceRecord rec(391);
+    rec.begin();
+    gl.ReleaseShaderCompiler();
+    rec.end();
+    rec.commit();
+}
+
+static void GLAPI trace_ShaderBinary(GLsizei count, const GLuint * shaders, GLenum binaryformat, const void * binary, GLsizei length) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ShaderBinary(count, shaders, binaryformat, binary, length);
+        return;
+    }
+
+    TraceRecord rec(392);
+    rec.begin();
+    gl.ShaderBinary(count, shaders, binaryformat, binary, length);
+    rec.end();
+    rec.argi(count);
+    rec.argp(shaders);
+    rec.argu(binaryformat);
+    rec.argp(binary);
+    rec.argi(length);
+    rec.commit();
+}
+
+static void GLAPI trace_GetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint * range, GLint * precision) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+        return;
+    }
+
+    TraceRecord rec(393);
+    rec.begin();
+    gl.GetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+    rec.end();
+    rec.argu(shadertype);
+    rec.argu(precisiontype);
+    rec.argp(range);
+    rec.argp(precision);
+    rec.commit();
+}
+
+static void GLAPI trace_DepthRangef(GLfloat n, GLfloat f) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DepthRangef(n, f);
+        return;
+    }
+
+    TraceRecord rec(394);
+    rec.begin();
+    gl.DepthRangef(n, f);
+    rec.end();
+    rec.argf(n);
+    rec.argf(f);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearDepthf(GLfloat d) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearDepthf(d);
+        return;
+    }
+
+    TraceRecord rec(395);
+    rec.begin();
+    gl.ClearDepthf(d);
+    rec.end();
+    rec.argf(d);
+    rec.commit();
+}
+
+static void GLAPI trace_GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+        return;
+    }
+
+    TraceRecord rec(396);
+    rec.begin();
+    gl.GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+    rec.end();
+    rec.argu(program);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(binaryFormat);
+    rec.argp(binary);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramBinary(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramBinary(program, binaryFormat, binary, length);
+        return;
+    }
+
+    TraceRecord rec(397);
+    rec.begin();
+    gl.ProgramBinary(program, binaryFormat, binary, length);
+    rec.end();
+    rec.argu(program);
+    rec.argu(binaryFormat);
+    rec.argp(binary);
+    rec.argi(length);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramParameteri(program, pname, value);
+        return;
+    }
+
+    TraceRecord rec(398);
+    rec.begin();
+    gl.ProgramParameteri(program, pname, value);
+    rec.end();
+    rec.argu(program);
+    rec.argu(pname);
+    rec.argi(value);
+    rec.commit();
+}
+
+static void GLAPI trace_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.UseProgramStages(pipeline, stages, program);
+        return;
+    }
+
+    TraceRecord rec(399);
+    rec.begin();
+    gl.UseProgramStages(pipeline, stages, program);
+    rec.end();
+    rec.argu(pipeline);
+    rec.argu(stages);
+    rec.argu(program);
+    rec.commit();
+}
+
+static void GLAPI trace_ActiveShaderProgram(GLuint pipeline, GLuint program) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ActiveShaderProgram(pipeline, program);
+        return;
+    }
+
+    TraceRecord rec(400);
+    rec.begin();
+    gl.ActiveShaderProgram(pipeline, program);
+    rec.end();
+    rec.argu(pipeline);
+    rec.argu(program);
+    rec.commit();
+}
+
+static GLuint GLAPI trace_CreateShaderProgramv(GLenum type, GLsizei count, const GLchar * const * strings) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLuint result = gl.CreateShaderProgramv(type, count, strings);
+        return result;
+    }
+
+    TraceRecord rec(401);
+    rec.begin();
+    GLuint result = gl.CreateShaderProgramv(type, count, strings);
+    rec.end();
+    rec.argu(type);
+    rec.argi(count);
+    rec.argp(strings);
+    rec.argu(result);
+    rec.strings(2, count, strings, 0);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_BindProgramPipeline(GLuint pipeline) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindProgramPipeline(pipeline);
+        return;
+    }
+
+    TraceRecord rec(402);
+    rec.begin();
+    gl.BindProgramPipeline(pipeline);
+    rec.end();
+    rec.argu(pipeline);
+    rec.commit();
+}
+
+static void GLAPI trace_DeleteProgramPipelines(GLsizei n, const GLuint * pipelines) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DeleteProgramPipelines(n, pipelines);
+        return;
+    }
+
+    TraceRecord rec(403);
+    rec.begin();
+    gl.DeleteProgramPipelines(n, pipelines);
+    rec.end();
+    rec.argi(n);
+    rec.argp(pipelines);
+    rec.data(1, pipelines, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_GenProgramPipelines(GLsizei n, GLuint * pipelines) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenProgramPipelines(n, pipelines);
+        return;
+    }
+
+    TraceRecord rec(404);
+    rec.begin();
+    gl.GenProgramPipelines(n, pipelines);
+    rec.end();
+    rec.argi(n);
+    rec.argp(pipelines);
+    rec.data(1, pipelines, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static GLboolean GLAPI trace_IsProgramPipeline(GLuint pipeline) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.IsProgramPipeline(pipeline);
+        return result;
+    }
+
+    TraceRecord rec(405);
+    rec.begin();
+    GLboolean result = gl.IsProgramPipeline(pipeline);
+    rec.end();
+    rec.argu(pipeline);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetProgramPipelineiv(pipeline, pname, params);
+        return;
+    }
+
+    TraceRecord rec(406);
+    rec.begin();
+    gl.GetProgramPipelineiv(pipeline, pname, params);
+    rec.end();
+    rec.argu(pipeline);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform1i(program, location, v0);
+        return;
+    }
+
+    TraceRecord rec(407);
+    rec.begin();
+    gl.ProgramUniform1i(program, location, v0);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(v0);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform1iv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(408);
+    rec.begin();
+    gl.ProgramUniform1iv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 1 * sizeof(GLint));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform1f(program, location, v0);
+        return;
+    }
+
+    TraceRecord rec(409);
+    rec.begin();
+    gl.ProgramUniform1f(program, location, v0);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argf(v0);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform1fv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(410);
+    rec.begin();
+    gl.ProgramUniform1fv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 1 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform1d(program, location, v0);
+        return;
+    }
+
+    TraceRecord rec(411);
+    rec.begin();
+    gl.ProgramUniform1d(program, location, v0);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argf(v0);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform1dv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(412);
+    rec.begin();
+    gl.ProgramUniform1dv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 1 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform1ui(program, location, v0);
+        return;
+    }
+
+    TraceRecord rec(413);
+    rec.begin();
+    gl.ProgramUniform1ui(program, location, v0);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argu(v0);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform1uiv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(414);
+    rec.begin();
+    gl.ProgramUniform1uiv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 1 * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform2i(program, location, v0, v1);
+        return;
+    }
+
+    TraceRecord rec(415);
+    rec.begin();
+    gl.ProgramUniform2i(program, location, v0, v1);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(v0);
+    rec.argi(v1);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform2iv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(416);
+    rec.begin();
+    gl.ProgramUniform2iv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * sizeof(GLint));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform2f(program, location, v0, v1);
+        return;
+    }
+
+    TraceRecord rec(417);
+    rec.begin();
+    gl.ProgramUniform2f(program, location, v0, v1);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argf(v0);
+    rec.argf(v1);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform2fv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(418);
+    rec.begin();
+    gl.ProgramUniform2fv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform2d(program, location, v0, v1);
+        return;
+    }
+
+    TraceRecord rec(419);
+    rec.begin();
+    gl.ProgramUniform2d(program, location, v0, v1);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argf(v0);
+    rec.argf(v1);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform2dv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(420);
+    rec.begin();
+    gl.ProgramUniform2dv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform2ui(program, location, v0, v1);
+        return;
+    }
+
+    TraceRecord rec(421);
+    rec.begin();
+    gl.ProgramUniform2ui(program, location, v0, v1);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argu(v0);
+    rec.argu(v1);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform2uiv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(422);
+    rec.begin();
+    gl.ProgramUniform2uiv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 2 * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform3i(program, location, v0, v1, v2);
+        return;
+    }
+
+    TraceRecord rec(423);
+    rec.begin();
+    gl.ProgramUniform3i(program, location, v0, v1, v2);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(v0);
+    rec.argi(v1);
+    rec.argi(v2);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform3iv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(424);
+    rec.begin();
+    gl.ProgramUniform3iv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * sizeof(GLint));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform3f(program, location, v0, v1, v2);
+        return;
+    }
+
+    TraceRecord rec(425);
+    rec.begin();
+    gl.ProgramUniform3f(program, location, v0, v1, v2);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argf(v0);
+    rec.argf(v1);
+    rec.argf(v2);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform3fv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(426);
+    rec.begin();
+    gl.ProgramUniform3fv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform3d(program, location, v0, v1, v2);
+        return;
+    }
+
+    TraceRecord rec(427);
+    rec.begin();
+    gl.ProgramUniform3d(program, location, v0, v1, v2);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argf(v0);
+    rec.argf(v1);
+    rec.argf(v2);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform3dv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(428);
+    rec.begin();
+    gl.ProgramUniform3dv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform3ui(program, location, v0, v1, v2);
+        return;
+    }
+
+    TraceRecord rec(429);
+    rec.begin();
+    gl.ProgramUniform3ui(program, location, v0, v1, v2);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argu(v0);
+    rec.argu(v1);
+    rec.argu(v2);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform3uiv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(430);
+    rec.begin();
+    gl.ProgramUniform3uiv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 3 * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform4i(program, location, v0, v1, v2, v3);
+        return;
+    }
+
+    TraceRecord rec(431);
+    rec.begin();
+    gl.ProgramUniform4i(program, location, v0, v1, v2, v3);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(v0);
+    rec.argi(v1);
+    rec.argi(v2);
+    rec.argi(v3);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform4iv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(432);
+    rec.begin();
+    gl.ProgramUniform4iv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * sizeof(GLint));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform4f(program, location, v0, v1, v2, v3);
+        return;
+    }
+
+    TraceRecord rec(433);
+    rec.begin();
+    gl.ProgramUniform4f(program, location, v0, v1, v2, v3);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argf(v0);
+    rec.argf(v1);
+    rec.argf(v2);
+    rec.argf(v3);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform4fv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(434);
+    rec.begin();
+    gl.ProgramUniform4fv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform4d(program, location, v0, v1, v2, v3);
+        return;
+    }
+
+    TraceRecord rec(435);
+    rec.begin();
+    gl.ProgramUniform4d(program, location, v0, v1, v2, v3);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argf(v0);
+    rec.argf(v1);
+    rec.argf(v2);
+    rec.argf(v3);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform4dv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(436);
+    rec.begin();
+    gl.ProgramUniform4dv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform4ui(program, location, v0, v1, v2, v3);
+        return;
+    }
+
+    TraceRecord rec(437);
+    rec.begin();
+    gl.ProgramUniform4ui(program, location, v0, v1, v2, v3);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argu(v0);
+    rec.argu(v1);
+    rec.argu(v2);
+    rec.argu(v3);
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniform4uiv(program, location, count, value);
+        return;
+    }
+
+    TraceRecord rec(438);
+    rec.begin();
+    gl.ProgramUniform4uiv(program, location, count, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argp(value);
+    rec.data(3, value, count * 4 * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix2fv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(439);
+    rec.begin();
+    gl.ProgramUniformMatrix2fv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 2 * 2 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix3fv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(440);
+    rec.begin();
+    gl.ProgramUniformMatrix3fv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 3 * 3 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix4fv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(441);
+    rec.begin();
+    gl.ProgramUniformMatrix4fv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 4 * 4 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix2dv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(442);
+    rec.begin();
+    gl.ProgramUniformMatrix2dv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 2 * 2 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix3dv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(443);
+    rec.begin();
+    gl.ProgramUniformMatrix3dv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 3 * 3 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix4dv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(444);
+    rec.begin();
+    gl.ProgramUniformMatrix4dv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 4 * 4 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(445);
+    rec.begin();
+    gl.ProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 2 * 3 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(446);
+    rec.begin();
+    gl.ProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 3 * 2 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(447);
+    rec.begin();
+    gl.ProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 2 * 4 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(448);
+    rec.begin();
+    gl.ProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 4 * 2 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(449);
+    rec.begin();
+    gl.ProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 3 * 4 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(450);
+    rec.begin();
+    gl.ProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 4 * 3 * sizeof(GLfloat));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(451);
+    rec.begin();
+    gl.ProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 2 * 3 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(452);
+    rec.begin();
+    gl.ProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 3 * 2 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(453);
+    rec.begin();
+    gl.ProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 2 * 4 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(454);
+    rec.begin();
+    gl.ProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 4 * 2 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(455);
+    rec.begin();
+    gl.ProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 3 * 4 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+        return;
+    }
+
+    TraceRecord rec(456);
+    rec.begin();
+    gl.ProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(count);
+    rec.argu(transpose);
+    rec.argp(value);
+    rec.data(4, value, count * 4 * 3 * sizeof(GLdouble));
+    rec.commit();
+}
+
+static void GLAPI trace_ValidateProgramPipeline(GLuint pipeline) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ValidateProgramPipeline(pipeline);
+        return;
+    }
+
+    TraceRecord rec(457);
+    rec.begin();
+    gl.ValidateProgramPipeline(pipeline);
+    rec.end();
+    rec.argu(pipeline);
+    rec.commit();
+}
+
+static void GLAPI trace_GetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+        return;
+    }
+
+    TraceRecord rec(458);
+    rec.begin();
+    gl.GetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+    rec.end();
+    rec.argu(pipeline);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(infoLog);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribL1d(GLuint index, GLdouble x) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribL1d(index, x);
+        return;
+    }
+
+    TraceRecord rec(459);
+    rec.begin();
+    gl.VertexAttribL1d(index, x);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribL2d(index, x, y);
+        return;
+    }
+
+    TraceRecord rec(460);
+    rec.begin();
+    gl.VertexAttribL2d(index, x, y);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribL3d(index, x, y, z);
+        return;
+    }
+
+    TraceRecord rec(461);
+    rec.begin();
+    gl.VertexAttribL3d(index, x, y, z);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.argf(z);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribL4d(index, x, y, z, w);
+        return;
+    }
+
+    TraceRecord rec(462);
+    rec.begin();
+    gl.VertexAttribL4d(index, x, y, z, w);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.argf(z);
+    rec.argf(w);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribL1dv(GLuint index, const GLdouble * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribL1dv(index, v);
+        return;
+    }
+
+    TraceRecord rec(463);
+    rec.begin();
+    gl.VertexAttribL1dv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 1 * 8);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribL2dv(GLuint index, const GLdouble * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribL2dv(index, v);
+        return;
+    }
+
+    TraceRecord rec(464);
+    rec.begin();
+    gl.VertexAttribL2dv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 2 * 8);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribL3dv(GLuint index, const GLdouble * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribL3dv(index, v);
+        return;
+    }
+
+    TraceRecord rec(465);
+    rec.begin();
+    gl.VertexAttribL3dv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 3 * 8);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribL4dv(GLuint index, const GLdouble * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribL4dv(index, v);
+        return;
+    }
+
+    TraceRecord rec(466);
+    rec.begin();
+    gl.VertexAttribL4dv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.data(1, v, 4 * 8);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribLPointer(index, size, type, stride, pointer);
+        return;
+    }
+
+    TraceRecord rec(467);
+    rec.begin();
+    gl.VertexAttribLPointer(index, size, type, stride, pointer);
+    rec.end();
+    rec.argu(index);
+    rec.argi(size);
+    rec.argu(type);
+    rec.argi(stride);
+    rec.argp(pointer);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexAttribLdv(GLuint index, GLenum pname, GLdouble * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexAttribLdv(index, pname, params);
+        return;
+    }
+
+    TraceRecord rec(468);
+    rec.begin();
+    gl.GetVertexAttribLdv(index, pname, params);
+    rec.end();
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_ViewportArrayv(GLuint first, GLsizei count, const GLfloat * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ViewportArrayv(first, count, v);
+        return;
+    }
+
+    TraceRecord rec(469);
+    rec.begin();
+    gl.ViewportArrayv(first, count, v);
+    rec.end();
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(v);
+    rec.commit();
+}
+
+static void GLAPI trace_ViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ViewportIndexedf(index, x, y, w, h);
+        return;
+    }
+
+    TraceRecord rec(470);
+    rec.begin();
+    gl.ViewportIndexedf(index, x, y, w, h);
+    rec.end();
+    rec.argu(index);
+    rec.argf(x);
+    rec.argf(y);
+    rec.argf(w);
+    rec.argf(h);
+    rec.commit();
+}
+
+static void GLAPI trace_ViewportIndexedfv(GLuint index, const GLfloat * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ViewportIndexedfv(index, v);
+        return;
+    }
+
+    TraceRecord rec(471);
+    rec.begin();
+    gl.ViewportIndexedfv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.commit();
+}
+
+static void GLAPI trace_ScissorArrayv(GLuint first, GLsizei count, const GLint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ScissorArrayv(first, count, v);
+        return;
+    }
+
+    TraceRecord rec(472);
+    rec.begin();
+    gl.ScissorArrayv(first, count, v);
+    rec.end();
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(v);
+    rec.commit();
+}
+
+static void GLAPI trace_ScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ScissorIndexed(index, left, bottom, width, height);
+        return;
+    }
+
+    TraceRecord rec(473);
+    rec.begin();
+    gl.ScissorIndexed(index, left, bottom, width, height);
+    rec.end();
+    rec.argu(index);
+    rec.argi(left);
+    rec.argi(bottom);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_ScissorIndexedv(GLuint index, const GLint * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ScissorIndexedv(index, v);
+        return;
+    }
+
+    TraceRecord rec(474);
+    rec.begin();
+    gl.ScissorIndexedv(index, v);
+    rec.end();
+    rec.argu(index);
+    rec.argp(v);
+    rec.commit();
+}
+
+static void GLAPI trace_DepthRangeArrayv(GLuint first, GLsizei count, const GLdouble * v) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DepthRangeArrayv(first, count, v);
+        return;
+    }
+
+    TraceRecord rec(475);
+    rec.begin();
+    gl.DepthRangeArrayv(first, count, v);
+    rec.end();
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(v);
+    rec.commit();
+}
+
+static void GLAPI trace_DepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DepthRangeIndexed(index, n, f);
+        return;
+    }
+
+    TraceRecord rec(476);
+    rec.begin();
+    gl.DepthRangeIndexed(index, n, f);
+    rec.end();
+    rec.argu(index);
+    rec.argf(n);
+    rec.argf(f);
+    rec.commit();
+}
+
+static void GLAPI trace_GetFloati_v(GLenum target, GLuint index, GLfloat * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetFloati_v(target, index, data);
+        return;
+    }
+
+    TraceRecord rec(477);
+    rec.begin();
+    gl.GetFloati_v(target, index, data);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_GetDoublei_v(GLenum target, GLuint index, GLdouble * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetDoublei_v(target, index, data);
+        return;
+    }
+
+    TraceRecord rec(478);
+    rec.begin();
+    gl.GetDoublei_v(target, index, data);
+    rec.end();
+    rec.argu(target);
+    rec.argu(index);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+        return;
+    }
+
+    TraceRecord rec(479);
+    rec.begin();
+    gl.DrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+    rec.end();
+    rec.argu(mode);
+    rec.argi(first);
+    rec.argi(count);
+    rec.argi(instancecount);
+    rec.argu(baseinstance);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLuint baseinstance) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+        return;
+    }
+
+    TraceRecord rec(480);
+    rec.begin();
+    gl.DrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+    rec.end();
+    rec.argu(mode);
+    rec.argi(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.argi(instancecount);
+    rec.argu(baseinstance);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+        return;
+    }
+
+    TraceRecord rec(481);
+    rec.begin();
+    gl.DrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+    rec.end();
+    rec.argu(mode);
+    rec.argi(count);
+    rec.argu(type);
+    rec.argp(indices);
+    rec.argi(instancecount);
+    rec.argi(basevertex);
+    rec.argu(baseinstance);
+    rec.commit();
+}
+
+static void GLAPI trace_GetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetInternalformativ(target, internalformat, pname, bufSize, params);
+        return;
+    }
+
+    TraceRecord rec(482);
+    rec.begin();
+    gl.GetInternalformativ(target, internalformat, pname, bufSize, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(internalformat);
+    rec.argu(pname);
+    rec.argi(bufSize);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+        return;
+    }
+
+    TraceRecord rec(483);
+    rec.begin();
+    gl.GetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+    rec.end();
+    rec.argu(program);
+    rec.argu(bufferIndex);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_BindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindImageTexture(unit, texture, level, layered, layer, access, format);
+        return;
+    }
+
+    TraceRecord rec(484);
+    rec.begin();
+    gl.BindImageTexture(unit, texture, level, layered, layer, access, format);
+    rec.end();
+    rec.argu(unit);
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argu(layered);
+    rec.argi(layer);
+    rec.argu(access);
+    rec.argu(format);
+    rec.commit();
+}
+
+static void GLAPI trace_MemoryBarrier(GLbitfield barriers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MemoryBarrier(barriers);
+        return;
+    }
+
+    TraceRecord rec(485);
+    rec.begin();
+    gl.MemoryBarrier(barriers);
+    rec.end();
+    rec.argu(barriers);
+    rec.commit();
+}
+
+static void GLAPI trace_TexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexStorage1D(target, levels, internalformat, width);
+        return;
+    }
+
+    TraceRecord rec(486);
+    rec.begin();
+    gl.TexStorage1D(target, levels, internalformat, width);
+    rec.end();
+    rec.argu(target);
+    rec.argi(levels);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.commit();
+}
+
+static void GLAPI trace_TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexStorage2D(target, levels, internalformat, width, height);
+        return;
+    }
+
+    TraceRecord rec(487);
+    rec.begin();
+    gl.TexStorage2D(target, levels, internalformat, width, height);
+    rec.end();
+    rec.argu(target);
+    rec.argi(levels);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_TexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexStorage3D(target, levels, internalformat, width, height, depth);
+        return;
+    }
+
+    TraceRecord rec(488);
+    rec.begin();
+    gl.TexStorage3D(target, levels, internalformat, width, height, depth);
+    rec.end();
+    rec.argu(target);
+    rec.argi(levels);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawTransformFeedbackInstanced(mode, id, instancecount);
+        return;
+    }
+
+    TraceRecord rec(489);
+    rec.begin();
+    gl.DrawTransformFeedbackInstanced(mode, id, instancecount);
+    rec.end();
+    rec.argu(mode);
+    rec.argu(id);
+    rec.argi(instancecount);
+    rec.commit();
+}
+
+static void GLAPI trace_DrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+        return;
+    }
+
+    TraceRecord rec(490);
+    rec.begin();
+    gl.DrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+    rec.end();
+    rec.argu(mode);
+    rec.argu(id);
+    rec.argu(stream);
+    rec.argi(instancecount);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearBufferData(target, internalformat, format, type, data);
+        return;
+    }
+
+    TraceRecord rec(491);
+    rec.begin();
+    gl.ClearBufferData(target, internalformat, format, type, data);
+    rec.end();
+    rec.argu(target);
+    rec.argu(internalformat);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(data);
+    rec.data(4, data, trace_pixel_size(format, type));
+    rec.commit();
+}
+
+static void GLAPI trace_ClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearBufferSubData(target, internalformat, offset, size, format, type, data);
+        return;
+    }
+
+    TraceRecord rec(492);
+    rec.begin();
+    gl.ClearBufferSubData(target, internalformat, offset, size, format, type, data);
+    rec.end();
+    rec.argu(target);
+    rec.argu(internalformat);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(data);
+    rec.data(6, data, trace_pixel_size(format, type));
+    rec.commit();
+}
+
+static void GLAPI trace_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+        return;
+    }
+
+    TraceRecord rec(493);
+    rec.begin();
+    gl.DispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+    rec.end();
+    rec.argu(num_groups_x);
+    rec.argu(num_groups_y);
+    rec.argu(num_groups_z);
+    rec.commit();
+}
+
+static void GLAPI trace_DispatchComputeIndirect(GLintptr indirect) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DispatchComputeIndirect(indirect);
+        return;
+    }
+
+    TraceRecord rec(494);
+    rec.begin();
+    gl.DispatchComputeIndirect(indirect);
+    rec.end();
+    rec.argi(indirect);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+        return;
+    }
+
+    TraceRecord rec(495);
+    rec.begin();
+    gl.CopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+    rec.end();
+    rec.argu(srcName);
+    rec.argu(srcTarget);
+    rec.argi(srcLevel);
+    rec.argi(srcX);
+    rec.argi(srcY);
+    rec.argi(srcZ);
+    rec.argu(dstName);
+    rec.argu(dstTarget);
+    rec.argi(dstLevel);
+    rec.argi(dstX);
+    rec.argi(dstY);
+    rec.argi(dstZ);
+    rec.argi(srcWidth);
+    rec.argi(srcHeight);
+    rec.argi(srcDepth);
+    rec.commit();
+}
+
+static void GLAPI trace_FramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FramebufferParameteri(target, pname, param);
+        return;
+    }
+
+    TraceRecord rec(496);
+    rec.begin();
+    gl.FramebufferParameteri(target, pname, param);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argi(param);
+    rec.commit();
+}
+
+static void GLAPI trace_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetFramebufferParameteriv(target, pname, params);
+        return;
+    }
+
+    TraceRecord rec(497);
+    rec.begin();
+    gl.GetFramebufferParameteriv(target, pname, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetInternalformati64v(target, internalformat, pname, bufSize, params);
+        return;
+    }
+
+    TraceRecord rec(498);
+    rec.begin();
+    gl.GetInternalformati64v(target, internalformat, pname, bufSize, params);
+    rec.end();
+    rec.argu(target);
+    rec.argu(internalformat);
+    rec.argu(pname);
+    rec.argi(bufSize);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_InvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.InvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+        return;
+    }
+
+    TraceRecord rec(499);
+    rec.begin();
+    gl.InvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.commit();
+}
+
+static void GLAPI trace_InvalidateTexImage(GLuint texture, GLint level) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.InvalidateTexImage(texture, level);
+        return;
+    }
+
+    TraceRecord rec(500);
+    rec.begin();
+    gl.InvalidateTexImage(texture, level);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.commit();
+}
+
+static void GLAPI trace_InvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.InvalidateBufferSubData(buffer, offset, length);
+        return;
+    }
+
+    TraceRecord rec(501);
+    rec.begin();
+    gl.InvalidateBufferSubData(buffer, offset, length);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(length);
+    rec.commit();
+}
+
+static void GLAPI trace_InvalidateBufferData(GLuint buffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.InvalidateBufferData(buffer);
+        return;
+    }
+
+    TraceRecord rec(502);
+    rec.begin();
+    gl.InvalidateBufferData(buffer);
+    rec.end();
+    rec.argu(buffer);
+    rec.commit();
+}
+
+static void GLAPI trace_InvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.InvalidateFramebuffer(target, numAttachments, attachments);
+        return;
+    }
+
+    TraceRecord rec(503);
+    rec.begin();
+    gl.InvalidateFramebuffer(target, numAttachments, attachments);
+    rec.end();
+    rec.argu(target);
+    rec.argi(numAttachments);
+    rec.argp(attachments);
+    rec.data(2, attachments, numAttachments * sizeof(GLenum));
+    rec.commit();
+}
+
+static void GLAPI trace_InvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.InvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+        return;
+    }
+
+    TraceRecord rec(504);
+    rec.begin();
+    gl.InvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+    rec.end();
+    rec.argu(target);
+    rec.argi(numAttachments);
+    rec.argp(attachments);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.data(2, attachments, numAttachments * sizeof(GLenum));
+    rec.commit();
+}
+
+static void GLAPI trace_MultiDrawArraysIndirect(GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+        return;
+    }
+
+    TraceRecord rec(505);
+    rec.begin();
+    gl.MultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+    rec.end();
+    rec.argu(mode);
+    rec.argp(indirect);
+    rec.argi(drawcount);
+    rec.argi(stride);
+    rec.commit();
+}
+
+static void GLAPI trace_MultiDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+        return;
+    }
+
+    TraceRecord rec(506);
+    rec.begin();
+    gl.MultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+    rec.end();
+    rec.argu(mode);
+    rec.argu(type);
+    rec.argp(indirect);
+    rec.argi(drawcount);
+    rec.argi(stride);
+    rec.commit();
+}
+
+static void GLAPI trace_GetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetProgramInterfaceiv(program, programInterface, pname, params);
+        return;
+    }
+
+    TraceRecord rec(507);
+    rec.begin();
+    gl.GetProgramInterfaceiv(program, programInterface, pname, params);
+    rec.end();
+    rec.argu(program);
+    rec.argu(programInterface);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static GLuint GLAPI trace_GetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLuint result = gl.GetProgramResourceIndex(program, programInterface, name);
+        return result;
+    }
+
+    TraceRecord rec(508);
+    rec.begin();
+    GLuint result = gl.GetProgramResourceIndex(program, programInterface, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(programInterface);
+    rec.argp(name);
+    rec.argu(result);
+    rec.string(2, name, -1);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetProgramResourceName(program, programInterface, index, bufSize, length, name);
+        return;
+    }
+
+    TraceRecord rec(509);
+    rec.begin();
+    gl.GetProgramResourceName(program, programInterface, index, bufSize, length, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(programInterface);
+    rec.argu(index);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(name);
+    rec.commit();
+}
+
+static void GLAPI trace_GetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei bufSize, GLsizei * length, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+        return;
+    }
+
+    TraceRecord rec(510);
+    rec.begin();
+    gl.GetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+    rec.end();
+    rec.argu(program);
+    rec.argu(programInterface);
+    rec.argu(index);
+    rec.argi(propCount);
+    rec.argp(props);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(params);
+    rec.commit();
+}
+
+static GLint GLAPI trace_GetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLint result = gl.GetProgramResourceLocation(program, programInterface, name);
+        return result;
+    }
+
+    TraceRecord rec(511);
+    rec.begin();
+    GLint result = gl.GetProgramResourceLocation(program, programInterface, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(programInterface);
+    rec.argp(name);
+    rec.argi(result);
+    rec.string(2, name, -1);
+    rec.commit();
+    return result;
+}
+
+static GLint GLAPI trace_GetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar * name) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLint result = gl.GetProgramResourceLocationIndex(program, programInterface, name);
+        return result;
+    }
+
+    TraceRecord rec(512);
+    rec.begin();
+    GLint result = gl.GetProgramResourceLocationIndex(program, programInterface, name);
+    rec.end();
+    rec.argu(program);
+    rec.argu(programInterface);
+    rec.argp(name);
+    rec.argi(result);
+    rec.string(2, name, -1);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_ShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+        return;
+    }
+
+    TraceRecord rec(513);
+    rec.begin();
+    gl.ShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+    rec.end();
+    rec.argu(program);
+    rec.argu(storageBlockIndex);
+    rec.argu(storageBlockBinding);
+    rec.commit();
+}
+
+static void GLAPI trace_TexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexBufferRange(target, internalformat, buffer, offset, size);
+        return;
+    }
+
+    TraceRecord rec(514);
+    rec.begin();
+    gl.TexBufferRange(target, internalformat, buffer, offset, size);
+    rec.end();
+    rec.argu(target);
+    rec.argu(internalformat);
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.commit();
+}
+
+static void GLAPI trace_TexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+        return;
+    }
+
+    TraceRecord rec(515);
+    rec.begin();
+    gl.TexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    rec.end();
+    rec.argu(target);
+    rec.argi(samples);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argu(fixedsamplelocations);
+    rec.commit();
+}
+
+static void GLAPI trace_TexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+        return;
+    }
+
+    TraceRecord rec(516);
+    rec.begin();
+    gl.TexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    rec.end();
+    rec.argu(target);
+    rec.argi(samples);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argu(fixedsamplelocations);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+        return;
+    }
+
+    TraceRecord rec(517);
+    rec.begin();
+    gl.TextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(target);
+    rec.argu(origtexture);
+    rec.argu(internalformat);
+    rec.argu(minlevel);
+    rec.argu(numlevels);
+    rec.argu(minlayer);
+    rec.argu(numlayers);
+    rec.commit();
+}
+
+static void GLAPI trace_BindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindVertexBuffer(bindingindex, buffer, offset, stride);
+        return;
+    }
+
+    TraceRecord rec(518);
+    rec.begin();
+    gl.BindVertexBuffer(bindingindex, buffer, offset, stride);
+    rec.end();
+    rec.argu(bindingindex);
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(stride);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+        return;
+    }
+
+    TraceRecord rec(519);
+    rec.begin();
+    gl.VertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+    rec.end();
+    rec.argu(attribindex);
+    rec.argi(size);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argu(relativeoffset);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribIFormat(attribindex, size, type, relativeoffset);
+        return;
+    }
+
+    TraceRecord rec(520);
+    rec.begin();
+    gl.VertexAttribIFormat(attribindex, size, type, relativeoffset);
+    rec.end();
+    rec.argu(attribindex);
+    rec.argi(size);
+    rec.argu(type);
+    rec.argu(relativeoffset);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribLFormat(attribindex, size, type, relativeoffset);
+        return;
+    }
+
+    TraceRecord rec(521);
+    rec.begin();
+    gl.VertexAttribLFormat(attribindex, size, type, relativeoffset);
+    rec.end();
+    rec.argu(attribindex);
+    rec.argi(size);
+    rec.argu(type);
+    rec.argu(relativeoffset);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexAttribBinding(attribindex, bindingindex);
+        return;
+    }
+
+    TraceRecord rec(522);
+    rec.begin();
+    gl.VertexAttribBinding(attribindex, bindingindex);
+    rec.end();
+    rec.argu(attribindex);
+    rec.argu(bindingindex);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexBindingDivisor(bindingindex, divisor);
+        return;
+    }
+
+    TraceRecord rec(523);
+    rec.begin();
+    gl.VertexBindingDivisor(bindingindex, divisor);
+    rec.end();
+    rec.argu(bindingindex);
+    rec.argu(divisor);
+    rec.commit();
+}
+
+static void GLAPI trace_DebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DebugMessageControl(source, type, severity, count, ids, enabled);
+        return;
+    }
+
+    TraceRecord rec(524);
+    rec.begin();
+    gl.DebugMessageControl(source, type, severity, count, ids, enabled);
+    rec.end();
+    rec.argu(source);
+    rec.argu(type);
+    rec.argu(severity);
+    rec.argi(count);
+    rec.argp(ids);
+    rec.argu(enabled);
+    rec.data(4, ids, count * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_DebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DebugMessageInsert(source, type, id, severity, length, buf);
+        return;
+    }
+
+    TraceRecord rec(525);
+    rec.begin();
+    gl.DebugMessageInsert(source, type, id, severity, length, buf);
+    rec.end();
+    rec.argu(source);
+    rec.argu(type);
+    rec.argu(id);
+    rec.argu(severity);
+    rec.argi(length);
+    rec.argp(buf);
+    rec.string(5, buf, length);
+    rec.commit();
+}
+
+static void GLAPI trace_DebugMessageCallback(GLDEBUGPROC callback, const void * userParam) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DebugMessageCallback(callback, userParam);
+        return;
+    }
+
+    TraceRecord rec(526);
+    rec.begin();
+    gl.DebugMessageCallback(callback, userParam);
+    rec.end();
+    rec.argp((const void *)callback);
+    rec.argp(userParam);
+    rec.commit();
+}
+
+static GLuint GLAPI trace_GetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLuint result = gl.GetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+        return result;
+    }
+
+    TraceRecord rec(527);
+    rec.begin();
+    GLuint result = gl.GetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+    rec.end();
+    rec.argu(count);
+    rec.argi(bufSize);
+    rec.argp(sources);
+    rec.argp(types);
+    rec.argp(ids);
+    rec.argp(severities);
+    rec.argp(lengths);
+    rec.argp(messageLog);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_PushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar * message) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PushDebugGroup(source, id, length, message);
+        return;
+    }
+
+    TraceRecord rec(528);
+    rec.begin();
+    gl.PushDebugGroup(source, id, length, message);
+    rec.end();
+    rec.argu(source);
+    rec.argu(id);
+    rec.argi(length);
+    rec.argp(message);
+    rec.string(3, message, length);
+    rec.commit();
+}
+
+static void GLAPI trace_PopDebugGroup() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PopDebugGroup();
+        return;
+    }
+
+    TraceRecord rec(529);
+    rec.begin();
+    gl.PopDebugGroup();
+    rec.end();
+    rec.commit();
+}
+
+static void GLAPI trace_ObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar * label) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ObjectLabel(identifier, name, length, label);
+        return;
+    }
+
+    TraceRecord rec(530);
+    rec.begin();
+    gl.ObjectLabel(identifier, name, length, label);
+    rec.end();
+    rec.argu(identifier);
+    rec.argu(name);
+    rec.argi(length);
+    rec.argp(label);
+    rec.string(3, label, length);
+    rec.commit();
+}
+
+static void GLAPI trace_GetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetObjectLabel(identifier, name, bufSize, length, label);
+        return;
+    }
+
+    TraceRecord rec(531);
+    rec.begin();
+    gl.GetObjectLabel(identifier, name, bufSize, length, label);
+    rec.end();
+    rec.argu(identifier);
+    rec.argu(name);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(label);
+    rec.commit();
+}
+
+static void GLAPI trace_ObjectPtrLabel(const void * ptr, GLsizei length, const GLchar * label) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ObjectPtrLabel(ptr, length, label);
+        return;
+    }
+
+    TraceRecord rec(532);
+    rec.begin();
+    gl.ObjectPtrLabel(ptr, length, label);
+    rec.end();
+    rec.argp(ptr);
+    rec.argi(length);
+    rec.argp(label);
+    rec.string(2, label, length);
+    rec.commit();
+}
+
+static void GLAPI trace_GetObjectPtrLabel(const void * ptr, GLsizei bufSize, GLsizei * length, GLchar * label) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetObjectPtrLabel(ptr, bufSize, length, label);
+        return;
+    }
+
+    TraceRecord rec(533);
+    rec.begin();
+    gl.GetObjectPtrLabel(ptr, bufSize, length, label);
+    rec.end();
+    rec.argp(ptr);
+    rec.argi(bufSize);
+    rec.argp(length);
+    rec.argp(label);
+    rec.commit();
+}
+
+static void GLAPI trace_BufferStorage(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BufferStorage(target, size, data, flags);
+        return;
+    }
+
+    TraceRecord rec(534);
+    rec.begin();
+    gl.BufferStorage(target, size, data, flags);
+    rec.end();
+    rec.argu(target);
+    rec.argi(size);
+    rec.argp(data);
+    rec.argu(flags);
+    rec.bulk(2, data, size);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearTexImage(texture, level, format, type, data);
+        return;
+    }
+
+    TraceRecord rec(535);
+    rec.begin();
+    gl.ClearTexImage(texture, level, format, type, data);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(data);
+    rec.data(4, data, trace_pixel_size(format, type));
+    rec.commit();
+}
+
+static void GLAPI trace_ClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+        return;
+    }
+
+    TraceRecord rec(536);
+    rec.begin();
+    gl.ClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(data);
+    rec.data(10, data, trace_pixel_size(format, type));
+    rec.commit();
+}
+
+static void GLAPI trace_BindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint * buffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindBuffersBase(target, first, count, buffers);
+        return;
+    }
+
+    TraceRecord rec(537);
+    rec.begin();
+    gl.BindBuffersBase(target, first, count, buffers);
+    rec.end();
+    rec.argu(target);
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(buffers);
+    rec.commit();
+}
+
+static void GLAPI trace_BindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizeiptr * sizes) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindBuffersRange(target, first, count, buffers, offsets, sizes);
+        return;
+    }
+
+    TraceRecord rec(538);
+    rec.begin();
+    gl.BindBuffersRange(target, first, count, buffers, offsets, sizes);
+    rec.end();
+    rec.argu(target);
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(buffers);
+    rec.argp(offsets);
+    rec.argp(sizes);
+    rec.commit();
+}
+
+static void GLAPI trace_BindTextures(GLuint first, GLsizei count, const GLuint * textures) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindTextures(first, count, textures);
+        return;
+    }
+
+    TraceRecord rec(539);
+    rec.begin();
+    gl.BindTextures(first, count, textures);
+    rec.end();
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(textures);
+    rec.commit();
+}
+
+static void GLAPI trace_BindSamplers(GLuint first, GLsizei count, const GLuint * samplers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindSamplers(first, count, samplers);
+        return;
+    }
+
+    TraceRecord rec(540);
+    rec.begin();
+    gl.BindSamplers(first, count, samplers);
+    rec.end();
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(samplers);
+    rec.commit();
+}
+
+static void GLAPI trace_BindImageTextures(GLuint first, GLsizei count, const GLuint * textures) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindImageTextures(first, count, textures);
+        return;
+    }
+
+    TraceRecord rec(541);
+    rec.begin();
+    gl.BindImageTextures(first, count, textures);
+    rec.end();
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(textures);
+    rec.commit();
+}
+
+static void GLAPI trace_BindVertexBuffers(GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindVertexBuffers(first, count, buffers, offsets, strides);
+        return;
+    }
+
+    TraceRecord rec(542);
+    rec.begin();
+    gl.BindVertexBuffers(first, count, buffers, offsets, strides);
+    rec.end();
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(buffers);
+    rec.argp(offsets);
+    rec.argp(strides);
+    rec.commit();
+}
+
+static void GLAPI trace_ClipControl(GLenum origin, GLenum depth) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClipControl(origin, depth);
+        return;
+    }
+
+    TraceRecord rec(543);
+    rec.begin();
+    gl.ClipControl(origin, depth);
+    rec.end();
+    rec.argu(origin);
+    rec.argu(depth);
+    rec.commit();
+}
+
+static void GLAPI trace_CreateTransformFeedbacks(GLsizei n, GLuint * ids) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CreateTransformFeedbacks(n, ids);
+        return;
+    }
+
+    TraceRecord rec(544);
+    rec.begin();
+    gl.CreateTransformFeedbacks(n, ids);
+    rec.end();
+    rec.argi(n);
+    rec.argp(ids);
+    rec.data(1, ids, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_TransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TransformFeedbackBufferBase(xfb, index, buffer);
+        return;
+    }
+
+    TraceRecord rec(545);
+    rec.begin();
+    gl.TransformFeedbackBufferBase(xfb, index, buffer);
+    rec.end();
+    rec.argu(xfb);
+    rec.argu(index);
+    rec.argu(buffer);
+    rec.commit();
+}
+
+static void GLAPI trace_TransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+        return;
+    }
+
+    TraceRecord rec(546);
+    rec.begin();
+    gl.TransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+    rec.end();
+    rec.argu(xfb);
+    rec.argu(index);
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTransformFeedbackiv(xfb, pname, param);
+        return;
+    }
+
+    TraceRecord rec(547);
+    rec.begin();
+    gl.GetTransformFeedbackiv(xfb, pname, param);
+    rec.end();
+    rec.argu(xfb);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTransformFeedbacki_v(xfb, pname, index, param);
+        return;
+    }
+
+    TraceRecord rec(548);
+    rec.begin();
+    gl.GetTransformFeedbacki_v(xfb, pname, index, param);
+    rec.end();
+    rec.argu(xfb);
+    rec.argu(pname);
+    rec.argu(index);
+    rec.argp(param);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTransformFeedbacki64_v(xfb, pname, index, param);
+        return;
+    }
+
+    TraceRecord rec(549);
+    rec.begin();
+    gl.GetTransformFeedbacki64_v(xfb, pname, index, param);
+    rec.end();
+    rec.argu(xfb);
+    rec.argu(pname);
+    rec.argu(index);
+    rec.argp(param);
+    rec.commit();
+}
+
+static void GLAPI trace_CreateBuffers(GLsizei n, GLuint * buffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CreateBuffers(n, buffers);
+        return;
+    }
+
+    TraceRecord rec(550);
+    rec.begin();
+    gl.CreateBuffers(n, buffers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(buffers);
+    rec.data(1, buffers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_NamedBufferStorage(GLuint buffer, GLsizeiptr size, const void * data, GLbitfield flags) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedBufferStorage(buffer, size, data, flags);
+        return;
+    }
+
+    TraceRecord rec(551);
+    rec.begin();
+    gl.NamedBufferStorage(buffer, size, data, flags);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(size);
+    rec.argp(data);
+    rec.argu(flags);
+    rec.bulk(2, data, size);
+    rec.commit();
+}
+
+static void GLAPI trace_NamedBufferData(GLuint buffer, GLsizeiptr size, const void * data, GLenum usage) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedBufferData(buffer, size, data, usage);
+        return;
+    }
+
+    TraceRecord rec(552);
+    rec.begin();
+    gl.NamedBufferData(buffer, size, data, usage);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(size);
+    rec.argp(data);
+    rec.argu(usage);
+    rec.bulk(2, data, size);
+    rec.commit();
+}
+
+static void GLAPI trace_NamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedBufferSubData(buffer, offset, size, data);
+        return;
+    }
+
+    TraceRecord rec(553);
+    rec.begin();
+    gl.NamedBufferSubData(buffer, offset, size, data);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.argp(data);
+    rec.bulk(3, data, size);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+        return;
+    }
+
+    TraceRecord rec(554);
+    rec.begin();
+    gl.CopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+    rec.end();
+    rec.argu(readBuffer);
+    rec.argu(writeBuffer);
+    rec.argi(readOffset);
+    rec.argi(writeOffset);
+    rec.argi(size);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearNamedBufferData(buffer, internalformat, format, type, data);
+        return;
+    }
+
+    TraceRecord rec(555);
+    rec.begin();
+    gl.ClearNamedBufferData(buffer, internalformat, format, type, data);
+    rec.end();
+    rec.argu(buffer);
+    rec.argu(internalformat);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(data);
+    rec.data(4, data, trace_pixel_size(format, type));
+    rec.commit();
+}
+
+static void GLAPI trace_ClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+        return;
+    }
+
+    TraceRecord rec(556);
+    rec.begin();
+    gl.ClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+    rec.end();
+    rec.argu(buffer);
+    rec.argu(internalformat);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(data);
+    rec.data(6, data, trace_pixel_size(format, type));
+    rec.commit();
+}
+
+static void * GLAPI trace_MapNamedBuffer(GLuint buffer, GLenum access) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        void * result = gl.MapNamedBuffer(buffer, access);
+        return result;
+    }
+
+    TraceRecord rec(557);
+    rec.begin();
+    void * result = gl.MapNamedBuffer(buffer, access);
+    rec.end();
+    rec.argu(buffer);
+    rec.argu(access);
+    rec.argp(result);
+    rec.commit();
+    return result;
+}
+
+static void * GLAPI trace_MapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        void * result = gl.MapNamedBufferRange(buffer, offset, length, access);
+        return result;
+    }
+
+    TraceRecord rec(558);
+    rec.begin();
+    void * result = gl.MapNamedBufferRange(buffer, offset, length, access);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(length);
+    rec.argu(access);
+    rec.argp(result);
+    rec.commit();
+    return result;
+}
+
+static GLboolean GLAPI trace_UnmapNamedBuffer(GLuint buffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLboolean result = gl.UnmapNamedBuffer(buffer);
+        return result;
+    }
+
+    TraceRecord rec(559);
+    rec.begin();
+    GLboolean result = gl.UnmapNamedBuffer(buffer);
+    rec.end();
+    rec.argu(buffer);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_FlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.FlushMappedNamedBufferRange(buffer, offset, length);
+        return;
+    }
+
+    TraceRecord rec(560);
+    rec.begin();
+    gl.FlushMappedNamedBufferRange(buffer, offset, length);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(length);
+    rec.commit();
+}
+
+static void GLAPI trace_GetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetNamedBufferParameteriv(buffer, pname, params);
+        return;
+    }
+
+    TraceRecord rec(561);
+    rec.begin();
+    gl.GetNamedBufferParameteriv(buffer, pname, params);
+    rec.end();
+    rec.argu(buffer);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetNamedBufferParameteri64v(buffer, pname, params);
+        return;
+    }
+
+    TraceRecord rec(562);
+    rec.begin();
+    gl.GetNamedBufferParameteri64v(buffer, pname, params);
+    rec.end();
+    rec.argu(buffer);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetNamedBufferPointerv(GLuint buffer, GLenum pname, void ** params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetNamedBufferPointerv(buffer, pname, params);
+        return;
+    }
+
+    TraceRecord rec(563);
+    rec.begin();
+    gl.GetNamedBufferPointerv(buffer, pname, params);
+    rec.end();
+    rec.argu(buffer);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetNamedBufferSubData(buffer, offset, size, data);
+        return;
+    }
+
+    TraceRecord rec(564);
+    rec.begin();
+    gl.GetNamedBufferSubData(buffer, offset, size, data);
+    rec.end();
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_CreateFramebuffers(GLsizei n, GLuint * framebuffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CreateFramebuffers(n, framebuffers);
+        return;
+    }
+
+    TraceRecord rec(565);
+    rec.begin();
+    gl.CreateFramebuffers(n, framebuffers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(framebuffers);
+    rec.data(1, framebuffers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_NamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+        return;
+    }
+
+    TraceRecord rec(566);
+    rec.begin();
+    gl.NamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(attachment);
+    rec.argu(renderbuffertarget);
+    rec.argu(renderbuffer);
+    rec.commit();
+}
+
+static void GLAPI trace_NamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedFramebufferParameteri(framebuffer, pname, param);
+        return;
+    }
+
+    TraceRecord rec(567);
+    rec.begin();
+    gl.NamedFramebufferParameteri(framebuffer, pname, param);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(pname);
+    rec.argi(param);
+    rec.commit();
+}
+
+static void GLAPI trace_NamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedFramebufferTexture(framebuffer, attachment, texture, level);
+        return;
+    }
+
+    TraceRecord rec(568);
+    rec.begin();
+    gl.NamedFramebufferTexture(framebuffer, attachment, texture, level);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(attachment);
+    rec.argu(texture);
+    rec.argi(level);
+    rec.commit();
+}
+
+static void GLAPI trace_NamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+        return;
+    }
+
+    TraceRecord rec(569);
+    rec.begin();
+    gl.NamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(attachment);
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(layer);
+    rec.commit();
+}
+
+static void GLAPI trace_NamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedFramebufferDrawBuffer(framebuffer, buf);
+        return;
+    }
+
+    TraceRecord rec(570);
+    rec.begin();
+    gl.NamedFramebufferDrawBuffer(framebuffer, buf);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(buf);
+    rec.commit();
+}
+
+static void GLAPI trace_NamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum * bufs) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedFramebufferDrawBuffers(framebuffer, n, bufs);
+        return;
+    }
+
+    TraceRecord rec(571);
+    rec.begin();
+    gl.NamedFramebufferDrawBuffers(framebuffer, n, bufs);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argi(n);
+    rec.argp(bufs);
+    rec.commit();
+}
+
+static void GLAPI trace_NamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedFramebufferReadBuffer(framebuffer, src);
+        return;
+    }
+
+    TraceRecord rec(572);
+    rec.begin();
+    gl.NamedFramebufferReadBuffer(framebuffer, src);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(src);
+    rec.commit();
+}
+
+static void GLAPI trace_InvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.InvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+        return;
+    }
+
+    TraceRecord rec(573);
+    rec.begin();
+    gl.InvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argi(numAttachments);
+    rec.argp(attachments);
+    rec.commit();
+}
+
+static void GLAPI trace_InvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.InvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+        return;
+    }
+
+    TraceRecord rec(574);
+    rec.begin();
+    gl.InvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argi(numAttachments);
+    rec.argp(attachments);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+        return;
+    }
+
+    TraceRecord rec(575);
+    rec.begin();
+    gl.ClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(buffer);
+    rec.argi(drawbuffer);
+    rec.argp(value);
+    rec.data(3, value, buffer == GL_COLOR ? 16 : 4);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+        return;
+    }
+
+    TraceRecord rec(576);
+    rec.begin();
+    gl.ClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(buffer);
+    rec.argi(drawbuffer);
+    rec.argp(value);
+    rec.data(3, value, buffer == GL_COLOR ? 16 : 4);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat * value) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+        return;
+    }
+
+    TraceRecord rec(577);
+    rec.begin();
+    gl.ClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(buffer);
+    rec.argi(drawbuffer);
+    rec.argp(value);
+    rec.data(3, value, buffer == GL_COLOR ? 16 : 4);
+    rec.commit();
+}
+
+static void GLAPI trace_ClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+        return;
+    }
+
+    TraceRecord rec(578);
+    rec.begin();
+    gl.ClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(buffer);
+    rec.argi(drawbuffer);
+    rec.argf(depth);
+    rec.argi(stencil);
+    rec.commit();
+}
+
+static void GLAPI trace_BlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+        return;
+    }
+
+    TraceRecord rec(579);
+    rec.begin();
+    gl.BlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    rec.end();
+    rec.argu(readFramebuffer);
+    rec.argu(drawFramebuffer);
+    rec.argi(srcX0);
+    rec.argi(srcY0);
+    rec.argi(srcX1);
+    rec.argi(srcY1);
+    rec.argi(dstX0);
+    rec.argi(dstY0);
+    rec.argi(dstX1);
+    rec.argi(dstY1);
+    rec.argu(mask);
+    rec.argu(filter);
+    rec.commit();
+}
+
+static GLenum GLAPI trace_CheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLenum result = gl.CheckNamedFramebufferStatus(framebuffer, target);
+        return result;
+    }
+
+    TraceRecord rec(580);
+    rec.begin();
+    GLenum result = gl.CheckNamedFramebufferStatus(framebuffer, target);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(target);
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetNamedFramebufferParameteriv(framebuffer, pname, param);
+        return;
+    }
+
+    TraceRecord rec(581);
+    rec.begin();
+    gl.GetNamedFramebufferParameteriv(framebuffer, pname, param);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.commit();
+}
+
+static void GLAPI trace_GetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+        return;
+    }
+
+    TraceRecord rec(582);
+    rec.begin();
+    gl.GetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+    rec.end();
+    rec.argu(framebuffer);
+    rec.argu(attachment);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_CreateRenderbuffers(GLsizei n, GLuint * renderbuffers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CreateRenderbuffers(n, renderbuffers);
+        return;
+    }
+
+    TraceRecord rec(583);
+    rec.begin();
+    gl.CreateRenderbuffers(n, renderbuffers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(renderbuffers);
+    rec.data(1, renderbuffers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_NamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+        return;
+    }
+
+    TraceRecord rec(584);
+    rec.begin();
+    gl.NamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+    rec.end();
+    rec.argu(renderbuffer);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_NamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.NamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+        return;
+    }
+
+    TraceRecord rec(585);
+    rec.begin();
+    gl.NamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+    rec.end();
+    rec.argu(renderbuffer);
+    rec.argi(samples);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_GetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+        return;
+    }
+
+    TraceRecord rec(586);
+    rec.begin();
+    gl.GetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+    rec.end();
+    rec.argu(renderbuffer);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_CreateTextures(GLenum target, GLsizei n, GLuint * textures) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CreateTextures(target, n, textures);
+        return;
+    }
+
+    TraceRecord rec(587);
+    rec.begin();
+    gl.CreateTextures(target, n, textures);
+    rec.end();
+    rec.argu(target);
+    rec.argi(n);
+    rec.argp(textures);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureBuffer(texture, internalformat, buffer);
+        return;
+    }
+
+    TraceRecord rec(588);
+    rec.begin();
+    gl.TextureBuffer(texture, internalformat, buffer);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(internalformat);
+    rec.argu(buffer);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureBufferRange(texture, internalformat, buffer, offset, size);
+        return;
+    }
+
+    TraceRecord rec(589);
+    rec.begin();
+    gl.TextureBufferRange(texture, internalformat, buffer, offset, size);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(internalformat);
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(size);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureStorage1D(texture, levels, internalformat, width);
+        return;
+    }
+
+    TraceRecord rec(590);
+    rec.begin();
+    gl.TextureStorage1D(texture, levels, internalformat, width);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(levels);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureStorage2D(texture, levels, internalformat, width, height);
+        return;
+    }
+
+    TraceRecord rec(591);
+    rec.begin();
+    gl.TextureStorage2D(texture, levels, internalformat, width, height);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(levels);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureStorage3D(texture, levels, internalformat, width, height, depth);
+        return;
+    }
+
+    TraceRecord rec(592);
+    rec.begin();
+    gl.TextureStorage3D(texture, levels, internalformat, width, height, depth);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(levels);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+        return;
+    }
+
+    TraceRecord rec(593);
+    rec.begin();
+    gl.TextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(samples);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argu(fixedsamplelocations);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+        return;
+    }
+
+    TraceRecord rec(594);
+    rec.begin();
+    gl.TextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(samples);
+    rec.argu(internalformat);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argu(fixedsamplelocations);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(595);
+    rec.begin();
+    gl.TextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(width);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.pixels(6, pixels, width, 1, 1, format, type);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(596);
+    rec.begin();
+    gl.TextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.pixels(8, pixels, width, height, 1, format, type);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+        return;
+    }
+
+    TraceRecord rec(597);
+    rec.begin();
+    gl.TextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argp(pixels);
+    rec.pixels(10, pixels, width, height, depth, format, type);
+    rec.commit();
+}
+
+static void GLAPI trace_CompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+        return;
+    }
+
+    TraceRecord rec(598);
+    rec.begin();
+    gl.CompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(width);
+    rec.argu(format);
+    rec.argi(imageSize);
+    rec.argp(data);
+    rec.compressed(6, data, imageSize);
+    rec.commit();
+}
+
+static void GLAPI trace_CompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+        return;
+    }
+
+    TraceRecord rec(599);
+    rec.begin();
+    gl.CompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argu(format);
+    rec.argi(imageSize);
+    rec.argp(data);
+    rec.compressed(8, data, imageSize);
+    rec.commit();
+}
+
+static void GLAPI trace_CompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+        return;
+    }
+
+    TraceRecord rec(600);
+    rec.begin();
+    gl.CompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argu(format);
+    rec.argi(imageSize);
+    rec.argp(data);
+    rec.compressed(10, data, imageSize);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+        return;
+    }
+
+    TraceRecord rec(601);
+    rec.begin();
+    gl.CopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+        return;
+    }
+
+    TraceRecord rec(602);
+    rec.begin();
+    gl.CopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_CopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+        return;
+    }
+
+    TraceRecord rec(603);
+    rec.begin();
+    gl.CopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureParameterf(texture, pname, param);
+        return;
+    }
+
+    TraceRecord rec(604);
+    rec.begin();
+    gl.TextureParameterf(texture, pname, param);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argf(param);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureParameterfv(GLuint texture, GLenum pname, const GLfloat * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureParameterfv(texture, pname, param);
+        return;
+    }
+
+    TraceRecord rec(605);
+    rec.begin();
+    gl.TextureParameterfv(texture, pname, param);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.data(2, param, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureParameteri(GLuint texture, GLenum pname, GLint param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureParameteri(texture, pname, param);
+        return;
+    }
+
+    TraceRecord rec(606);
+    rec.begin();
+    gl.TextureParameteri(texture, pname, param);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argi(param);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureParameterIiv(GLuint texture, GLenum pname, const GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureParameterIiv(texture, pname, params);
+        return;
+    }
+
+    TraceRecord rec(607);
+    rec.begin();
+    gl.TextureParameterIiv(texture, pname, params);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.data(2, params, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureParameterIuiv(GLuint texture, GLenum pname, const GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureParameterIuiv(texture, pname, params);
+        return;
+    }
+
+    TraceRecord rec(608);
+    rec.begin();
+    gl.TextureParameterIuiv(texture, pname, params);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.data(2, params, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureParameteriv(GLuint texture, GLenum pname, const GLint * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureParameteriv(texture, pname, param);
+        return;
+    }
+
+    TraceRecord rec(609);
+    rec.begin();
+    gl.TextureParameteriv(texture, pname, param);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.data(2, param, trace_parameter_count(pname) * 4);
+    rec.commit();
+}
+
+static void GLAPI trace_GenerateTextureMipmap(GLuint texture) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GenerateTextureMipmap(texture);
+        return;
+    }
+
+    TraceRecord rec(610);
+    rec.begin();
+    gl.GenerateTextureMipmap(texture);
+    rec.end();
+    rec.argu(texture);
+    rec.commit();
+}
+
+static void GLAPI trace_BindTextureUnit(GLuint unit, GLuint texture) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.BindTextureUnit(unit, texture);
+        return;
+    }
+
+    TraceRecord rec(611);
+    rec.begin();
+    gl.BindTextureUnit(unit, texture);
+    rec.end();
+    rec.argu(unit);
+    rec.argu(texture);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTextureImage(texture, level, format, type, bufSize, pixels);
+        return;
+    }
+
+    TraceRecord rec(612);
+    rec.begin();
+    gl.GetTextureImage(texture, level, format, type, bufSize, pixels);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argi(bufSize);
+    rec.argp(pixels);
+    rec.commit();
+}
+
+static void GLAPI trace_GetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetCompressedTextureImage(texture, level, bufSize, pixels);
+        return;
+    }
+
+    TraceRecord rec(613);
+    rec.begin();
+    gl.GetCompressedTextureImage(texture, level, bufSize, pixels);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(bufSize);
+    rec.argp(pixels);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTextureLevelParameterfv(texture, level, pname, params);
+        return;
+    }
+
+    TraceRecord rec(614);
+    rec.begin();
+    gl.GetTextureLevelParameterfv(texture, level, pname, params);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTextureLevelParameteriv(texture, level, pname, params);
+        return;
+    }
+
+    TraceRecord rec(615);
+    rec.begin();
+    gl.GetTextureLevelParameteriv(texture, level, pname, params);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTextureParameterfv(GLuint texture, GLenum pname, GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTextureParameterfv(texture, pname, params);
+        return;
+    }
+
+    TraceRecord rec(616);
+    rec.begin();
+    gl.GetTextureParameterfv(texture, pname, params);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTextureParameterIiv(GLuint texture, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTextureParameterIiv(texture, pname, params);
+        return;
+    }
+
+    TraceRecord rec(617);
+    rec.begin();
+    gl.GetTextureParameterIiv(texture, pname, params);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTextureParameterIuiv(texture, pname, params);
+        return;
+    }
+
+    TraceRecord rec(618);
+    rec.begin();
+    gl.GetTextureParameterIuiv(texture, pname, params);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTextureParameteriv(GLuint texture, GLenum pname, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTextureParameteriv(texture, pname, params);
+        return;
+    }
+
+    TraceRecord rec(619);
+    rec.begin();
+    gl.GetTextureParameteriv(texture, pname, params);
+    rec.end();
+    rec.argu(texture);
+    rec.argu(pname);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_CreateVertexArrays(GLsizei n, GLuint * arrays) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CreateVertexArrays(n, arrays);
+        return;
+    }
+
+    TraceRecord rec(620);
+    rec.begin();
+    gl.CreateVertexArrays(n, arrays);
+    rec.end();
+    rec.argi(n);
+    rec.argp(arrays);
+    rec.data(1, arrays, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_DisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.DisableVertexArrayAttrib(vaobj, index);
+        return;
+    }
+
+    TraceRecord rec(621);
+    rec.begin();
+    gl.DisableVertexArrayAttrib(vaobj, index);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(index);
+    rec.commit();
+}
+
+static void GLAPI trace_EnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.EnableVertexArrayAttrib(vaobj, index);
+        return;
+    }
+
+    TraceRecord rec(622);
+    rec.begin();
+    gl.EnableVertexArrayAttrib(vaobj, index);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(index);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexArrayElementBuffer(vaobj, buffer);
+        return;
+    }
+
+    TraceRecord rec(623);
+    rec.begin();
+    gl.VertexArrayElementBuffer(vaobj, buffer);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(buffer);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+        return;
+    }
+
+    TraceRecord rec(624);
+    rec.begin();
+    gl.VertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(bindingindex);
+    rec.argu(buffer);
+    rec.argi(offset);
+    rec.argi(stride);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+        return;
+    }
+
+    TraceRecord rec(625);
+    rec.begin();
+    gl.VertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(first);
+    rec.argi(count);
+    rec.argp(buffers);
+    rec.argp(offsets);
+    rec.argp(strides);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+        return;
+    }
+
+    TraceRecord rec(626);
+    rec.begin();
+    gl.VertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(attribindex);
+    rec.argu(bindingindex);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+        return;
+    }
+
+    TraceRecord rec(627);
+    rec.begin();
+    gl.VertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(attribindex);
+    rec.argi(size);
+    rec.argu(type);
+    rec.argu(normalized);
+    rec.argu(relativeoffset);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+        return;
+    }
+
+    TraceRecord rec(628);
+    rec.begin();
+    gl.VertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(attribindex);
+    rec.argi(size);
+    rec.argu(type);
+    rec.argu(relativeoffset);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+        return;
+    }
+
+    TraceRecord rec(629);
+    rec.begin();
+    gl.VertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(attribindex);
+    rec.argi(size);
+    rec.argu(type);
+    rec.argu(relativeoffset);
+    rec.commit();
+}
+
+static void GLAPI trace_VertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.VertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+        return;
+    }
+
+    TraceRecord rec(630);
+    rec.begin();
+    gl.VertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(bindingindex);
+    rec.argu(divisor);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexArrayiv(GLuint vaobj, GLenum pname, GLint * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexArrayiv(vaobj, pname, param);
+        return;
+    }
+
+    TraceRecord rec(631);
+    rec.begin();
+    gl.GetVertexArrayiv(vaobj, pname, param);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexArrayIndexediv(vaobj, index, pname, param);
+        return;
+    }
+
+    TraceRecord rec(632);
+    rec.begin();
+    gl.GetVertexArrayIndexediv(vaobj, index, pname, param);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.commit();
+}
+
+static void GLAPI trace_GetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 * param) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetVertexArrayIndexed64iv(vaobj, index, pname, param);
+        return;
+    }
+
+    TraceRecord rec(633);
+    rec.begin();
+    gl.GetVertexArrayIndexed64iv(vaobj, index, pname, param);
+    rec.end();
+    rec.argu(vaobj);
+    rec.argu(index);
+    rec.argu(pname);
+    rec.argp(param);
+    rec.commit();
+}
+
+static void GLAPI trace_CreateSamplers(GLsizei n, GLuint * samplers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CreateSamplers(n, samplers);
+        return;
+    }
+
+    TraceRecord rec(634);
+    rec.begin();
+    gl.CreateSamplers(n, samplers);
+    rec.end();
+    rec.argi(n);
+    rec.argp(samplers);
+    rec.data(1, samplers, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_CreateProgramPipelines(GLsizei n, GLuint * pipelines) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CreateProgramPipelines(n, pipelines);
+        return;
+    }
+
+    TraceRecord rec(635);
+    rec.begin();
+    gl.CreateProgramPipelines(n, pipelines);
+    rec.end();
+    rec.argi(n);
+    rec.argp(pipelines);
+    rec.data(1, pipelines, n * sizeof(GLuint));
+    rec.commit();
+}
+
+static void GLAPI trace_CreateQueries(GLenum target, GLsizei n, GLuint * ids) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.CreateQueries(target, n, ids);
+        return;
+    }
+
+    TraceRecord rec(636);
+    rec.begin();
+    gl.CreateQueries(target, n, ids);
+    rec.end();
+    rec.argu(target);
+    rec.argi(n);
+    rec.argp(ids);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryBufferObjecti64v(id, buffer, pname, offset);
+        return;
+    }
+
+    TraceRecord rec(637);
+    rec.begin();
+    gl.GetQueryBufferObjecti64v(id, buffer, pname, offset);
+    rec.end();
+    rec.argu(id);
+    rec.argu(buffer);
+    rec.argu(pname);
+    rec.argi(offset);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryBufferObjectiv(id, buffer, pname, offset);
+        return;
+    }
+
+    TraceRecord rec(638);
+    rec.begin();
+    gl.GetQueryBufferObjectiv(id, buffer, pname, offset);
+    rec.end();
+    rec.argu(id);
+    rec.argu(buffer);
+    rec.argu(pname);
+    rec.argi(offset);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryBufferObjectui64v(id, buffer, pname, offset);
+        return;
+    }
+
+    TraceRecord rec(639);
+    rec.begin();
+    gl.GetQueryBufferObjectui64v(id, buffer, pname, offset);
+    rec.end();
+    rec.argu(id);
+    rec.argu(buffer);
+    rec.argu(pname);
+    rec.argi(offset);
+    rec.commit();
+}
+
+static void GLAPI trace_GetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetQueryBufferObjectuiv(id, buffer, pname, offset);
+        return;
+    }
+
+    TraceRecord rec(640);
+    rec.begin();
+    gl.GetQueryBufferObjectuiv(id, buffer, pname, offset);
+    rec.end();
+    rec.argu(id);
+    rec.argu(buffer);
+    rec.argu(pname);
+    rec.argi(offset);
+    rec.commit();
+}
+
+static void GLAPI trace_MemoryBarrierByRegion(GLbitfield barriers) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MemoryBarrierByRegion(barriers);
+        return;
+    }
+
+    TraceRecord rec(641);
+    rec.begin();
+    gl.MemoryBarrierByRegion(barriers);
+    rec.end();
+    rec.argu(barriers);
+    rec.commit();
+}
+
+static void GLAPI trace_GetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+        return;
+    }
+
+    TraceRecord rec(642);
+    rec.begin();
+    gl.GetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argi(bufSize);
+    rec.argp(pixels);
+    rec.commit();
+}
+
+static void GLAPI trace_GetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+        return;
+    }
+
+    TraceRecord rec(643);
+    rec.begin();
+    gl.GetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+    rec.end();
+    rec.argu(texture);
+    rec.argi(level);
+    rec.argi(xoffset);
+    rec.argi(yoffset);
+    rec.argi(zoffset);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argi(depth);
+    rec.argi(bufSize);
+    rec.argp(pixels);
+    rec.commit();
+}
+
+static GLenum GLAPI trace_GetGraphicsResetStatus() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        GLenum result = gl.GetGraphicsResetStatus();
+        return result;
+    }
+
+    TraceRecord rec(644);
+    rec.begin();
+    GLenum result = gl.GetGraphicsResetStatus();
+    rec.end();
+    rec.argu(result);
+    rec.commit();
+    return result;
+}
+
+static void GLAPI trace_GetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetnCompressedTexImage(target, lod, bufSize, pixels);
+        return;
+    }
+
+    TraceRecord rec(645);
+    rec.begin();
+    gl.GetnCompressedTexImage(target, lod, bufSize, pixels);
+    rec.end();
+    rec.argu(target);
+    rec.argi(lod);
+    rec.argi(bufSize);
+    rec.argp(pixels);
+    rec.commit();
+}
+
+static void GLAPI trace_GetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void * pixels) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetnTexImage(target, level, format, type, bufSize, pixels);
+        return;
+    }
+
+    TraceRecord rec(646);
+    rec.begin();
+    gl.GetnTexImage(target, level, format, type, bufSize, pixels);
+    rec.end();
+    rec.argu(target);
+    rec.argi(level);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argi(bufSize);
+    rec.argp(pixels);
+    rec.commit();
+}
+
+static void GLAPI trace_GetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetnUniformdv(program, location, bufSize, params);
+        return;
+    }
+
+    TraceRecord rec(647);
+    rec.begin();
+    gl.GetnUniformdv(program, location, bufSize, params);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(bufSize);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetnUniformfv(program, location, bufSize, params);
+        return;
+    }
+
+    TraceRecord rec(648);
+    rec.begin();
+    gl.GetnUniformfv(program, location, bufSize, params);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(bufSize);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetnUniformiv(program, location, bufSize, params);
+        return;
+    }
+
+    TraceRecord rec(649);
+    rec.begin();
+    gl.GetnUniformiv(program, location, bufSize, params);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(bufSize);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_GetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint * params) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.GetnUniformuiv(program, location, bufSize, params);
+        return;
+    }
+
+    TraceRecord rec(650);
+    rec.begin();
+    gl.GetnUniformuiv(program, location, bufSize, params);
+    rec.end();
+    rec.argu(program);
+    rec.argi(location);
+    rec.argi(bufSize);
+    rec.argp(params);
+    rec.commit();
+}
+
+static void GLAPI trace_ReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void * data) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.ReadnPixels(x, y, width, height, format, type, bufSize, data);
+        return;
+    }
+
+    TraceRecord rec(651);
+    rec.begin();
+    gl.ReadnPixels(x, y, width, height, format, type, bufSize, data);
+    rec.end();
+    rec.argi(x);
+    rec.argi(y);
+    rec.argi(width);
+    rec.argi(height);
+    rec.argu(format);
+    rec.argu(type);
+    rec.argi(bufSize);
+    rec.argp(data);
+    rec.commit();
+}
+
+static void GLAPI trace_TextureBarrier() {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.TextureBarrier();
+        return;
+    }
+
+    TraceRecord rec(652);
+    rec.begin();
+    gl.TextureBarrier();
+    rec.end();
+    rec.commit();
+}
+
+static void GLAPI trace_SpecializeShader(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.SpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+        return;
+    }
+
+    TraceRecord rec(653);
+    rec.begin();
+    gl.SpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+    rec.end();
+    rec.argu(shader);
+    rec.argp(pEntryPoint);
+    rec.argu(numSpecializationConstants);
+    rec.argp(pConstantIndex);
+    rec.argp(pConstantValue);
+    rec.string(1, pEntryPoint, -1);
+    rec.commit();
+}
+
+static void GLAPI trace_MultiDrawArraysIndirectCount(GLenum mode, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+        return;
+    }
+
+    TraceRecord rec(654);
+    rec.begin();
+    gl.MultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+    rec.end();
+    rec.argu(mode);
+    rec.argp(indirect);
+    rec.argi(drawcount);
+    rec.argi(maxdrawcount);
+    rec.argi(stride);
+    rec.commit();
+}
+
+static void GLAPI trace_MultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.MultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+        return;
+    }
+
+    TraceRecord rec(655);
+    rec.begin();
+    gl.MultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+    rec.end();
+    rec.argu(mode);
+    rec.argu(type);
+    rec.argp(indirect);
+    rec.argi(drawcount);
+    rec.argi(maxdrawcount);
+    rec.argi(stride);
+    rec.commit();
+}
+
+static void GLAPI trace_PolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+    if (!trace_recording.load(std::memory_order_relaxed)) {
+        gl.PolygonOffsetClamp(factor, units, clamp);
+        return;
+    }
+
+    TraceRecord rec(656);
+    rec.begin();
+    gl.PolygonOffsetClamp(factor, units, clamp);
+    rec.end();
+    rec.argf(factor);
+    rec.argf(units);
+    rec.argf(clamp);
+    rec.commit();
+}
+
+const GLMethods traces = {
+    trace_CullFace,
+    trace_FrontFace,
+    trace_Hint,
+    trace_LineWidth,
+    trace_PointSize,
+    trace_PolygonMode,
+    trace_Scissor,
+    trace_TexParameterf,
+    trace_TexParameterfv,
+    trace_TexParameteri,
+    trace_TexParameteriv,
+    trace_TexImage1D,
+    trace_TexImage2D,
+    trace_DrawBuffer,
+    trace_Clear,
+    trace_ClearColor,
+    trace_ClearStencil,
+    trace_ClearDepth,
+    trace_StencilMask,
+    trace_ColorMask,
+    trace_DepthMask,
+    trace_Disable,
+    trace_Enable,
+    trace_Finish,
+    trace_Flush,
+    trace_BlendFunc,
+    trace_LogicOp,
+    trace_StencilFunc,
+    trace_StencilOp,
+    trace_DepthFunc,
+    trace_PixelStoref,
+    trace_PixelStorei,
+    trace_ReadBuffer,
+    trace_ReadPixels,
+    trace_GetBooleanv,
+    trace_GetDoublev,
+    trace_GetError,
+    trace_GetFloatv,
+    trace_GetIntegerv,
+    trace_GetString,
+    trace_GetTexImage,
+    trace_GetTexParameterfv,
+    trace_GetTexParameteriv,
+    trace_GetTexLevelParameterfv,
+    trace_GetTexLevelParameteriv,
+    trace_IsEnabled,
+    trace_DepthRange,
+    trace_Viewport,
+    trace_DrawArrays,
+    trace_DrawElements,
+    trace_GetPointerv,
+    trace_PolygonOffset,
+    trace_CopyTexImage1D,
+    trace_CopyTexImage2D,
+    trace_CopyTexSubImage1D,
+    trace_CopyTexSubImage2D,
+    trace_TexSubImage1D,
+    trace_TexSubImage2D,
+    trace_BindTexture,
+    trace_DeleteTextures,
+    trace_GenTextures,
+    trace_IsTexture,
+    trace_DrawRangeElements,
+    trace_TexImage3D,
+    trace_TexSubImage3D,
+    trace_CopyTexSubImage3D,
+    trace_ActiveTexture,
+    trace_SampleCoverage,
+    trace_CompressedTexImage3D,
+    trace_CompressedTexImage2D,
+    trace_CompressedTexImage1D,
+    trace_CompressedTexSubImage3D,
+    trace_CompressedTexSubImage2D,
+    trace_CompressedTexSubImage1D,
+    trace_GetCompressedTexImage,
+    trace_BlendFuncSeparate,
+    trace_MultiDrawArrays,
+    trace_MultiDrawElements,
+    trace_PointParameterf,
+    trace_PointParameterfv,
+    trace_PointParameteri,
+    trace_PointParameteriv,
+    trace_BlendColor,
+    trace_BlendEquation,
+    trace_GenQueries,
+    trace_DeleteQueries,
+    trace_IsQuery,
+    trace_BeginQuery,
+    trace_EndQuery,
+    trace_GetQueryiv,
+    trace_GetQueryObjectiv,
+    trace_GetQueryObjectuiv,
+    trace_BindBuffer,
+    trace_DeleteBuffers,
+    trace_GenBuffers,
+    trace_IsBuffer,
+    trace_BufferData,
+    trace_BufferSubData,
+    trace_GetBufferSubData,
+    trace_MapBuffer,
+    trace_UnmapBuffer,
+    trace_GetBufferParameteriv,
+    trace_GetBufferPointerv,
+    trace_BlendEquationSeparate,
+    trace_DrawBuffers,
+    trace_StencilOpSeparate,
+    trace_StencilFuncSeparate,
+    trace_StencilMaskSeparate,
+    trace_AttachShader,
+    trace_BindAttribLocation,
+    trace_CompileShader,
+    trace_CreateProgram,
+    trace_CreateShader,
+    trace_DeleteProgram,
+    trace_DeleteShader,
+    trace_DetachShader,
+    trace_DisableVertexAttribArray,
+    trace_EnableVertexAttribArray,
+    trace_GetActiveAttrib,
+    trace_GetActiveUniform,
+    trace_GetAttachedShaders,
+    trace_GetAttribLocation,
+    trace_GetProgramiv,
+    trace_GetProgramInfoLog,
+    trace_GetShaderiv,
+    trace_GetShaderInfoLog,
+    trace_GetShaderSource,
+    trace_GetUniformLocation,
+    trace_GetUniformfv,
+    trace_GetUniformiv,
+    trace_GetVertexAttribdv,
+    trace_GetVertexAttribfv,
+    trace_GetVertexAttribiv,
+    trace_GetVertexAttribPointerv,
+    trace_IsProgram,
+    trace_IsShader,
+    trace_LinkProgram,
+    trace_ShaderSource,
+    trace_UseProgram,
+    trace_Uniform1f,
+    trace_Uniform2f,
+    trace_Uniform3f,
+    trace_Uniform4f,
+    trace_Uniform1i,
+    trace_Uniform2i,
+    trace_Uniform3i,
+    trace_Uniform4i,
+    trace_Uniform1fv,
+    trace_Uniform2fv,
+    trace_Uniform3fv,
+    trace_Uniform4fv,
+    trace_Uniform1iv,
+    trace_Uniform2iv,
+    trace_Uniform3iv,
+    trace_Uniform4iv,
+    trace_UniformMatrix2fv,
+    trace_UniformMatrix3fv,
+    trace_UniformMatrix4fv,
+    trace_ValidateProgram,
+    trace_VertexAttrib1d,
+    trace_VertexAttrib1dv,
+    trace_VertexAttrib1f,
+    trace_VertexAttrib1fv,
+    trace_VertexAttrib1s,
+    trace_VertexAttrib1sv,
+    trace_VertexAttrib2d,
+    trace_VertexAttrib2dv,
+    trace_VertexAttrib2f,
+    trace_VertexAttrib2fv,
+    trace_VertexAttrib2s,
+    trace_VertexAttrib2sv,
+    trace_VertexAttrib3d,
+    trace_VertexAttrib3dv,
+    trace_VertexAttrib3f,
+    trace_VertexAttrib3fv,
+    trace_VertexAttrib3s,
+    trace_VertexAttrib3sv,
+    trace_VertexAttrib4Nbv,
+    trace_VertexAttrib4Niv,
+    trace_VertexAttrib4Nsv,
+    trace_VertexAttrib4Nub,
+    trace_VertexAttrib4Nubv,
+    trace_VertexAttrib4Nuiv,
+    trace_VertexAttrib4Nusv,
+    trace_VertexAttrib4bv,
+    trace_VertexAttrib4d,
+    trace_VertexAttrib4dv,
+    trace_VertexAttrib4f,
+    trace_VertexAttrib4fv,
+    trace_VertexAttrib4iv,
+    trace_VertexAttrib4s,
+    trace_VertexAttrib4sv,
+    trace_VertexAttrib4ubv,
+    trace_VertexAttrib4uiv,
+    trace_VertexAttrib4usv,
+    trace_VertexAttribPointer,
+    trace_UniformMatrix2x3fv,
+    trace_UniformMatrix3x2fv,
+    trace_UniformMatrix2x4fv,
+    trace_UniformMatrix4x2fv,
+    trace_UniformMatrix3x4fv,
+    trace_UniformMatrix4x3fv,
+    trace_ColorMaski,
+    trace_GetBooleani_v,
+    trace_GetIntegeri_v,
+    trace_Enablei,
+    trace_Disablei,
+    trace_IsEnabledi,
+    trace_BeginTransformFeedback,
+    trace_EndTransformFeedback,
+    trace_BindBufferRange,
+    trace_BindBufferBase,
+    trace_TransformFeedbackVaryings,
+    trace_GetTransformFeedbackVarying,
+    trace_ClampColor,
+    trace_BeginConditionalRender,
+    trace_EndConditionalRender,
+    trace_VertexAttribIPointer,
+    trace_GetVertexAttribIiv,
+    trace_GetVertexAttribIuiv,
+    trace_VertexAttribI1i,
+    trace_VertexAttribI2i,
+    trace_VertexAttribI3i,
+    trace_VertexAttribI4i,
+    trace_VertexAttribI1ui,
+    trace_VertexAttribI2ui,
+    trace_VertexAttribI3ui,
+    trace_VertexAttribI4ui,
+    trace_VertexAttribI1iv,
+    trace_VertexAttribI2iv,
+    trace_VertexAttribI3iv,
+    trace_VertexAttribI4iv,
+    trace_VertexAttribI1uiv,
+    trace_VertexAttribI2uiv,
+    trace_VertexAttribI3uiv,
+    trace_VertexAttribI4uiv,
+    trace_VertexAttribI4bv,
+    trace_VertexAttribI4sv,
+    trace_VertexAttribI4ubv,
+    trace_VertexAttribI4usv,
+    trace_GetUniformuiv,
+    trace_BindFragDataLocation,
+    trace_GetFragDataLocation,
+    trace_Uniform1ui,
+    trace_Uniform2ui,
+    trace_Uniform3ui,
+    trace_Uniform4ui,
+    trace_Uniform1uiv,
+    trace_Uniform2uiv,
+    trace_Uniform3uiv,
+    trace_Uniform4uiv,
+    trace_TexParameterIiv,
+    trace_TexParameterIuiv,
+    trace_GetTexParameterIiv,
+    trace_GetTexParameterIuiv,
+    trace_ClearBufferiv,
+    trace_ClearBufferuiv,
+    trace_ClearBufferfv,
+    trace_ClearBufferfi,
+    trace_GetStringi,
+    trace_IsRenderbuffer,
+    trace_BindRenderbuffer,
+    trace_DeleteRenderbuffers,
+    trace_GenRenderbuffers,
+    trace_RenderbufferStorage,
+    trace_GetRenderbufferParameteriv,
+    trace_IsFramebuffer,
+    trace_BindFramebuffer,
+    trace_DeleteFramebuffers,
+    trace_GenFramebuffers,
+    trace_CheckFramebufferStatus,
+    trace_FramebufferTexture1D,
+    trace_FramebufferTexture2D,
+    trace_FramebufferTexture3D,
+    trace_FramebufferRenderbuffer,
+    trace_GetFramebufferAttachmentParameteriv,
+    trace_GenerateMipmap,
+    trace_BlitFramebuffer,
+    trace_RenderbufferStorageMultisample,
+    trace_FramebufferTextureLayer,
+    trace_MapBufferRange,
+    trace_FlushMappedBufferRange,
+    trace_BindVertexArray,
+    trace_DeleteVertexArrays,
+    trace_GenVertexArrays,
+    trace_IsVertexArray,
+    trace_DrawArraysInstanced,
+    trace_DrawElementsInstanced,
+    trace_TexBuffer,
+    trace_PrimitiveRestartIndex,
+    trace_CopyBufferSubData,
+    trace_GetUniformIndices,
+    trace_GetActiveUniformsiv,
+    trace_GetActiveUniformName,
+    trace_GetUniformBlockIndex,
+    trace_GetActiveUniformBlockiv,
+    trace_GetActiveUniformBlockName,
+    trace_UniformBlockBinding,
+    trace_DrawElementsBaseVertex,
+    trace_DrawRangeElementsBaseVertex,
+    trace_DrawElementsInstancedBaseVertex,
+    trace_MultiDrawElementsBaseVertex,
+    trace_ProvokingVertex,
+    trace_FenceSync,
+    trace_IsSync,
+    trace_DeleteSync,
+    trace_ClientWaitSync,
+    trace_WaitSync,
+    trace_GetInteger64v,
+    trace_GetSynciv,
+    trace_GetInteger64i_v,
+    trace_GetBufferParameteri64v,
+    trace_FramebufferTexture,
+    trace_TexImage2DMultisample,
+    trace_TexImage3DMultisample,
+    trace_GetMultisamplefv,
+    trace_SampleMaski,
+    trace_BindFragDataLocationIndexed,
+    trace_GetFragDataIndex,
+    trace_GenSamplers,
+    trace_DeleteSamplers,
+    trace_IsSampler,
+    trace_BindSampler,
+    trace_SamplerParameteri,
+    trace_SamplerParameteriv,
+    trace_SamplerParameterf,
+    trace_SamplerParameterfv,
+    trace_SamplerParameterIiv,
+    trace_SamplerParameterIuiv,
+    trace_GetSamplerParameteriv,
+    trace_GetSamplerParameterIiv,
+    trace_GetSamplerParameterfv,
+    trace_GetSamplerParameterIuiv,
+    trace_QueryCounter,
+    trace_GetQueryObjecti64v,
+    trace_GetQueryObjectui64v,
+    trace_VertexAttribDivisor,
+    trace_VertexAttribP1ui,
+    trace_VertexAttribP1uiv,
+    trace_VertexAttribP2ui,
+    trace_VertexAttribP2uiv,
+    trace_VertexAttribP3ui,
+    trace_VertexAttribP3uiv,
+    trace_VertexAttribP4ui,
+    trace_VertexAttribP4uiv,
+    trace_MinSampleShading,
+    trace_BlendEquationi,
+    trace_BlendEquationSeparatei,
+    trace_BlendFunci,
+    trace_BlendFuncSeparatei,
+    trace_DrawArraysIndirect,
+    trace_DrawElementsIndirect,
+    trace_Uniform1d,
+    trace_Uniform2d,
+    trace_Uniform3d,
+    trace_Uniform4d,
+    trace_Uniform1dv,
+    trace_Uniform2dv,
+    trace_Uniform3dv,
+    trace_Uniform4dv,
+    trace_UniformMatrix2dv,
+    trace_UniformMatrix3dv,
+    trace_UniformMatrix4dv,
+    trace_UniformMatrix2x3dv,
+    trace_UniformMatrix2x4dv,
+    trace_UniformMatrix3x2dv,
+    trace_UniformMatrix3x4dv,
+    trace_UniformMatrix4x2dv,
+    trace_UniformMatrix4x3dv,
+    trace_GetUniformdv,
+    trace_GetSubroutineUniformLocation,
+    trace_GetSubroutineIndex,
+    trace_GetActiveSubroutineUniformiv,
+    trace_GetActiveSubroutineUniformName,
+    trace_GetActiveSubroutineName,
+    trace_UniformSubroutinesuiv,
+    trace_GetUniformSubroutineuiv,
+    trace_GetProgramStageiv,
+    trace_PatchParameteri,
+    trace_PatchParameterfv,
+    trace_BindTransformFeedback,
+    trace_DeleteTransformFeedbacks,
+    trace_GenTransformFeedbacks,
+    trace_IsTransformFeedback,
+    trace_PauseTransformFeedback,
+    trace_ResumeTransformFeedback,
+    trace_DrawTransformFeedback,
+    trace_DrawTransformFeedbackStream,
+    trace_BeginQueryIndexed,
+    trace_EndQueryIndexed,
+    trace_GetQueryIndexediv,
+    trace_ReleaseShaderCompiler,
+    trace_ShaderBinary,
+    trace_GetShaderPrecisionFormat,
+    trace_DepthRangef,
+    trace_ClearDepthf,
+    trace_GetProgramBinary,
+    trace_ProgramBinary,
+    trace_ProgramParameteri,
+    trace_UseProgramStages,
+    trace_ActiveShaderProgram,
+    trace_CreateShaderProgramv,
+    trace_BindProgramPipeline,
+    trace_DeleteProgramPipelines,
+    trace_GenProgramPipelines,
+    trace_IsProgramPipeline,
+    trace_GetProgramPipelineiv,
+    trace_ProgramUniform1i,
+    trace_ProgramUniform1iv,
+    trace_ProgramUniform1f,
+    trace_ProgramUniform1fv,
+    trace_ProgramUniform1d,
+    trace_ProgramUniform1dv,
+    trace_ProgramUniform1ui,
+    trace_ProgramUniform1uiv,
+    trace_ProgramUniform2i,
+    trace_ProgramUniform2iv,
+    trace_ProgramUniform2f,
+    trace_ProgramUniform2fv,
+    trace_ProgramUniform2d,
+    trace_ProgramUniform2dv,
+    trace_ProgramUniform2ui,
+    trace_ProgramUniform2uiv,
+    trace_ProgramUniform3i,
+    trace_ProgramUniform3iv,
+    trace_ProgramUniform3f,
+    trace_ProgramUniform3fv,
+    trace_ProgramUniform3d,
+    trace_ProgramUniform3dv,
+    trace_ProgramUniform3ui,
+    trace_ProgramUniform3uiv,
+    trace_ProgramUniform4i,
+    trace_ProgramUniform4iv,
+    trace_ProgramUniform4f,
+    trace_ProgramUniform4fv,
+    trace_ProgramUniform4d,
+    trace_ProgramUniform4dv,
+    trace_ProgramUniform4ui,
+    trace_ProgramUniform4uiv,
+    trace_ProgramUniformMatrix2fv,
+    trace_ProgramUniformMatrix3fv,
+    trace_ProgramUniformMatrix4fv,
+    trace_ProgramUniformMatrix2dv,
+    trace_ProgramUniformMatrix3dv,
+    trace_ProgramUniformMatrix4dv,
+    trace_ProgramUniformMatrix2x3fv,
+    trace_ProgramUniformMatrix3x2fv,
+    trace_ProgramUniformMatrix2x4fv,
+    trace_ProgramUniformMatrix4x2fv,
+    trace_ProgramUniformMatrix3x4fv,
+    trace_ProgramUniformMatrix4x3fv,
+    trace_ProgramUniformMatrix2x3dv,
+    trace_ProgramUniformMatrix3x2dv,
+    trace_ProgramUniformMatrix2x4dv,
+    trace_ProgramUniformMatrix4x2dv,
+    trace_ProgramUniformMatrix3x4dv,
+    trace_ProgramUniformMatrix4x3dv,
+    trace_ValidateProgramPipeline,
+    trace_GetProgramPipelineInfoLog,
+    trace_VertexAttribL1d,
+    trace_VertexAttribL2d,
+    trace_VertexAttribL3d,
+    trace_VertexAttribL4d,
+    trace_VertexAttribL1dv,
+    trace_VertexAttribL2dv,
+    trace_VertexAttribL3dv,
+    trace_VertexAttribL4dv,
+    trace_VertexAttribLPointer,
+    trace_GetVertexAttribLdv,
+    trace_ViewportArrayv,
+    trace_ViewportIndexedf,
+    trace_ViewportIndexedfv,
+    trace_ScissorArrayv,
+    trace_ScissorIndexed,
+    trace_ScissorIndexedv,
+    trace_DepthRangeArrayv,
+    trace_DepthRangeIndexed,
+    trace_GetFloati_v,
+    trace_GetDoublei_v,
+    trace_DrawArraysInstancedBaseInstance,
+    trace_DrawElementsInstancedBaseInstance,
+    trace_DrawElementsInstancedBaseVertexBaseInstance,
+    trace_GetInternalformativ,
+    trace_GetActiveAtomicCounterBufferiv,
+    trace_BindImageTexture,
+    trace_MemoryBarrier,
+    trace_TexStorage1D,
+    trace_TexStorage2D,
+    trace_TexStorage3D,
+    trace_DrawTransformFeedbackInstanced,
+    trace_DrawTransformFeedbackStreamInstanced,
+    trace_ClearBufferData,
+    trace_ClearBufferSubData,
+    trace_DispatchCompute,
+    trace_DispatchComputeIndirect,
+    trace_CopyImageSubData,
+    trace_FramebufferParameteri,
+    trace_GetFramebufferParameteriv,
+    trace_GetInternalformati64v,
+    trace_InvalidateTexSubImage,
+    trace_InvalidateTexImage,
+    trace_InvalidateBufferSubData,
+    trace_InvalidateBufferData,
+    trace_InvalidateFramebuffer,
+    trace_InvalidateSubFramebuffer,
+    trace_MultiDrawArraysIndirect,
+    trace_MultiDrawElementsIndirect,
+    trace_GetProgramInterfaceiv,
+    trace_GetProgramResourceIndex,
+    trace_GetProgramResourceName,
+    trace_GetProgramResourceiv,
+    trace_GetProgramResourceLocation,
+    trace_GetProgramResourceLocationIndex,
+    trace_ShaderStorageBlockBinding,
+    trace_TexBufferRange,
+    trace_TexStorage2DMultisample,
+    trace_TexStorage3DMultisample,
+    trace_TextureView,
+    trace_BindVertexBuffer,
+    trace_VertexAttribFormat,
+    trace_VertexAttribIFormat,
+    trace_VertexAttribLFormat,
+    trace_VertexAttribBinding,
+    trace_VertexBindingDivisor,
+    trace_DebugMessageControl,
+    trace_DebugMessageInsert,
+    trace_DebugMessageCallback,
+    trace_GetDebugMessageLog,
+    trace_PushDebugGroup,
+    trace_PopDebugGroup,
+    trace_ObjectLabel,
+    trace_GetObjectLabel,
+    trace_ObjectPtrLabel,
+    trace_GetObjectPtrLabel,
+    trace_BufferStorage,
+    trace_ClearTexImage,
+    trace_ClearTexSubImage,
+    trace_BindBuffersBase,
+    trace_BindBuffersRange,
+    trace_BindTextures,
+    trace_BindSamplers,
+    trace_BindImageTextures,
+    trace_BindVertexBuffers,
+    trace_ClipControl,
+    trace_CreateTransformFeedbacks,
+    trace_TransformFeedbackBufferBase,
+    trace_TransformFeedbackBufferRange,
+    trace_GetTransformFeedbackiv,
+    trace_GetTransformFeedbacki_v,
+    trace_GetTransformFeedbacki64_v,
+    trace_CreateBuffers,
+    trace_NamedBufferStorage,
+    trace_NamedBufferData,
+    trace_NamedBufferSubData,
+    trace_CopyNamedBufferSubData,
+    trace_ClearNamedBufferData,
+    trace_ClearNamedBufferSubData,
+    trace_MapNamedBuffer,
+    trace_MapNamedBufferRange,
+    trace_UnmapNamedBuffer,
+    trace_FlushMappedNamedBufferRange,
+    trace_GetNamedBufferParameteriv,
+    trace_GetNamedBufferParameteri64v,
+    trace_GetNamedBufferPointerv,
+    trace_GetNamedBufferSubData,
+    trace_CreateFramebuffers,
+    trace_NamedFramebufferRenderbuffer,
+    trace_NamedFramebufferParameteri,
+    trace_NamedFramebufferTexture,
+    trace_NamedFramebufferTextureLayer,
+    trace_NamedFramebufferDrawBuffer,
+    trace_NamedFramebufferDrawBuffers,
+    trace_NamedFramebufferReadBuffer,
+    trace_InvalidateNamedFramebufferData,
+    trace_InvalidateNamedFramebufferSubData,
+    trace_ClearNamedFramebufferiv,
+    trace_ClearNamedFramebufferuiv,
+    trace_ClearNamedFramebufferfv,
+    trace_ClearNamedFramebufferfi,
+    trace_BlitNamedFramebuffer,
+    trace_CheckNamedFramebufferStatus,
+    trace_GetNamedFramebufferParameteriv,
+    trace_GetNamedFramebufferAttachmentParameteriv,
+    trace_CreateRenderbuffers,
+    trace_NamedRenderbufferStorage,
+    trace_NamedRenderbufferStorageMultisample,
+    trace_GetNamedRenderbufferParameteriv,
+    trace_CreateTextures,
+    trace_TextureBuffer,
+    trace_TextureBufferRange,
+    trace_TextureStorage1D,
+    trace_TextureStorage2D,
+    trace_TextureStorage3D,
+    trace_TextureStorage2DMultisample,
+    trace_TextureStorage3DMultisample,
+    trace_TextureSubImage1D,
+    trace_TextureSubImage2D,
+    trace_TextureSubImage3D,
+    trace_CompressedTextureSubImage1D,
+    trace_CompressedTextureSubImage2D,
+    trace_CompressedTextureSubImage3D,
+    trace_CopyTextureSubImage1D,
+    trace_CopyTextureSubImage2D,
+    trace_CopyTextureSubImage3D,
+    trace_TextureParameterf,
+    trace_TextureParameterfv,
+    trace_TextureParameteri,
+    trace_TextureParameterIiv,
+    trace_TextureParameterIuiv,
+    trace_TextureParameteriv,
+    trace_GenerateTextureMipmap,
+    trace_BindTextureUnit,
+    trace_GetTextureImage,
+    trace_GetCompressedTextureImage,
+    trace_GetTextureLevelParameterfv,
+    trace_GetTextureLevelParameteriv,
+    trace_GetTextureParameterfv,
+    trace_GetTextureParameterIiv,
+    trace_GetTextureParameterIuiv,
+    trace_GetTextureParameteriv,
+    trace_CreateVertexArrays,
+    trace_DisableVertexArrayAttrib,
+    trace_EnableVertexArrayAttrib,
+    trace_VertexArrayElementBuffer,
+    trace_VertexArrayVertexBuffer,
+    trace_VertexArrayVertexBuffers,
+    trace_VertexArrayAttribBinding,
+    trace_VertexArrayAttribFormat,
+    trace_VertexArrayAttribIFormat,
+    trace_VertexArrayAttribLFormat,
+    trace_VertexArrayBindingDivisor,
+    trace_GetVertexArrayiv,
+    trace_GetVertexArrayIndexediv,
+    trace_GetVertexArrayIndexed64iv,
+    trace_CreateSamplers,
+    trace_CreateProgramPipelines,
+    trace_CreateQueries,
+    trace_GetQueryBufferObjecti64v,
+    trace_GetQueryBufferObjectiv,
+    trace_GetQueryBufferObjectui64v,
+    trace_GetQueryBufferObjectuiv,
+    trace_MemoryBarrierByRegion,
+    trace_GetTextureSubImage,
+    trace_GetCompressedTextureSubImage,
+    trace_GetGraphicsResetStatus,
+    trace_GetnCompressedTexImage,
+    trace_GetnTexImage,
+    trace_GetnUniformdv,
+    trace_GetnUniformfv,
+    trace_GetnUniformiv,
+    trace_GetnUniformuiv,
+    trace_ReadnPixels,
+    trace_TextureBarrier,
+    trace_SpecializeShader,
+    trace_MultiDrawArraysIndirectCount,
+    trace_MultiDrawElementsIndirectCount,
+    trace_PolygonOffsetClamp,
+};
+
+const char * const trace_names[] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glDrawArrays",
+    "glDrawElements",
+    "glGetPointerv",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glBlendColor",
+    "glBlendEquation",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribDivisor",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glMinSampleShading",
+    "glBlendEquationi",
+    "glBlendEquationSeparatei",
+    "glBlendFunci",
+    "glBlendFuncSeparatei",
+    "glDrawArraysIndirect",
+    "glDrawElementsIndirect",
+    "glUniform1d",
+    "glUniform2d",
+    "glUniform3d",
+    "glUniform4d",
+    "glUniform1dv",
+    "glUniform2dv",
+    "glUniform3dv",
+    "glUniform4dv",
+    "glUniformMatrix2dv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x3dv",
+    "glGetUniformdv",
+    "glGetSubroutineUniformLocation",
+    "glGetSubroutineIndex",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineName",
+    "glUniformSubroutinesuiv",
+    "glGetUniformSubroutineuiv",
+    "glGetProgramStageiv",
+    "glPatchParameteri",
+    "glPatchParameterfv",
+    "glBindTransformFeedback",
+    "glDeleteTransformFeedbacks",
+    "glGenTransformFeedbacks",
+    "glIsTransformFeedback",
+    "glPauseTransformFeedback",
+    "glResumeTransformFeedback",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackStream",
+    "glBeginQueryIndexed",
+    "glEndQueryIndexed",
+    "glGetQueryIndexediv",
+    "glReleaseShaderCompiler",
+    "glShaderBinary",
+    "glGetShaderPrecisionFormat",
+    "glDepthRangef",
+    "glClearDepthf",
+    "glGetProgramBinary",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glUseProgramStages",
+    "glActiveShaderProgram",
+    "glCreateShaderProgramv",
+    "glBindProgramPipeline",
+    "glDeleteProgramPipelines",
+    "glGenProgramPipelines",
+    "glIsProgramPipeline",
+    "glGetProgramPipelineiv",
+    "glProgramUniform1i",
+    "glProgramUniform1iv",
+    "glProgramUniform1f",
+    "glProgramUniform1fv",
+    "glProgramUniform1d",
+    "glProgramUniform1dv",
+    "glProgramUniform1ui",
+    "glProgramUniform1uiv",
+    "glProgramUniform2i",
+    "glProgramUniform2iv",
+    "glProgramUniform2f",
+    "glProgramUniform2fv",
+    "glProgramUniform2d",
+    "glProgramUniform2dv",
+    "glProgramUniform2ui",
+    "glProgramUniform2uiv",
+    "glProgramUniform3i",
+    "glProgramUniform3iv",
+    "glProgramUniform3f",
+    "glProgramUniform3fv",
+    "glProgramUniform3d",
+    "glProgramUniform3dv",
+    "glProgramUniform3ui",
+    "glProgramUniform3uiv",
+    "glProgramUniform4i",
+    "glProgramUniform4iv",
+    "glProgramUniform4f",
+    "glProgramUniform4fv",
+    "glProgramUniform4d",
+    "glProgramUniform4dv",
+    "glProgramUniform4ui",
+    "glProgramUniform4uiv",
+    "glProgramUniformMatrix2fv",
+    "glProgramUniformMatrix3fv",
+    "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix2dv",
+    "glProgramUniformMatrix3dv",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix3x2fv",
+    "glProgramUniformMatrix2x4fv",
+    "glProgramUniformMatrix4x2fv",
+    "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4x3fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramUniformMatrix3x2dv",
+    "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix4x2dv",
+    "glProgramUniformMatrix3x4dv",
+    "glProgramUniformMatrix4x3dv",
+    "glValidateProgramPipeline",
+    "glGetProgramPipelineInfoLog",
+    "glVertexAttribL1d",
+    "glVertexAttribL2d",
+    "glVertexAttribL3d",
+    "glVertexAttribL4d",
+    "glVertexAttribL1dv",
+    "glVertexAttribL2dv",
+    "glVertexAttribL3dv",
+    "glVertexAttribL4dv",
+    "glVertexAttribLPointer",
+    "glGetVertexAttribLdv",
+    "glViewportArrayv",
+    "glViewportIndexedf",
+    "glViewportIndexedfv",
+    "glScissorArrayv",
+    "glScissorIndexed",
+    "glScissorIndexedv",
+    "glDepthRangeArrayv",
+    "glDepthRangeIndexed",
+    "glGetFloati_v",
+    "glGetDoublei_v",
+    "glDrawArraysInstancedBaseInstance",
+    "glDrawElementsInstancedBaseInstance",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glGetInternalformativ",
+    "glGetActiveAtomicCounterBufferiv",
+    "glBindImageTexture",
+    "glMemoryBarrier",
+    "glTexStorage1D",
+    "glTexStorage2D",
+    "glTexStorage3D",
+    "glDrawTransformFeedbackInstanced",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glClearBufferData",
+    "glClearBufferSubData",
+    "glDispatchCompute",
+    "glDispatchComputeIndirect",
+    "glCopyImageSubData",
+    "glFramebufferParameteri",
+    "glGetFramebufferParameteriv",
+    "glGetInternalformati64v",
+    "glInvalidateTexSubImage",
+    "glInvalidateTexImage",
+    "glInvalidateBufferSubData",
+    "glInvalidateBufferData",
+    "glInvalidateFramebuffer",
+    "glInvalidateSubFramebuffer",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsIndirect",
+    "glGetProgramInterfaceiv",
+    "glGetProgramResourceIndex",
+    "glGetProgramResourceName",
+    "glGetProgramResourceiv",
+    "glGetProgramResourceLocation",
+    "glGetProgramResourceLocationIndex",
+    "glShaderStorageBlockBinding",
+    "glTexBufferRange",
+    "glTexStorage2DMultisample",
+    "glTexStorage3DMultisample",
+    "glTextureView",
+    "glBindVertexBuffer",
+    "glVertexAttribFormat",
+    "glVertexAttribIFormat",
+    "glVertexAttribLFormat",
+    "glVertexAttribBinding",
+    "glVertexBindingDivisor",
+    "glDebugMessageControl",
+    "glDebugMessageInsert",
+    "glDebugMessageCallback",
+    "glGetDebugMessageLog",
+    "glPushDebugGroup",
+    "glPopDebugGroup",
+    "glObjectLabel",
+    "glGetObjectLabel",
+    "glObjectPtrLabel",
+    "glGetObjectPtrLabel",
+    "glBufferStorage",
+    "glClearTexImage",
+    "glClearTexSubImage",
+    "glBindBuffersBase",
+    "glBindBuffersRange",
+    "glBindTextures",
+    "glBindSamplers",
+    "glBindImageTextures",
+    "glBindVertexBuffers",
+    "glClipControl",
+    "glCreateTransformFeedbacks",
+    "glTransformFeedbackBufferBase",
+    "glTransformFeedbackBufferRange",
+    "glGetTransformFeedbackiv",
+    "glGetTransformFeedbacki_v",
+    "glGetTransformFeedbacki64_v",
+    "glCreateBuffers",
+    "glNamedBufferStorage",
+    "glNamedBufferData",
+    "glNamedBufferSubData",
+    "glCopyNamedBufferSubData",
+    "glClearNamedBufferData",
+    "glClearNamedBufferSubData",
+    "glMapNamedBuffer",
+    "glMapNamedBufferRange",
+    "glUnmapNamedBuffer",
+    "glFlushMappedNamedBufferRange",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedBufferParameteri64v",
+    "glGetNamedBufferPointerv",
+    "glGetNamedBufferSubData",
+    "glCreateFramebuffers",
+    "glNamedFramebufferRenderbuffer",
+    "glNamedFramebufferParameteri",
+    "glNamedFramebufferTexture",
+    "glNamedFramebufferTextureLayer",
+    "glNamedFramebufferDrawBuffer",
+    "glNamedFramebufferDrawBuffers",
+    "glNamedFramebufferReadBuffer",
+    "glInvalidateNamedFramebufferData",
+    "glInvalidateNamedFramebufferSubData",
+    "glClearNamedFramebufferiv",
+    "glClearNamedFramebufferuiv",
+    "glClearNamedFramebufferfv",
+    "glClearNamedFramebufferfi",
+    "glBlitNamedFramebuffer",
+    "glCheckNamedFramebufferStatus",
+    "glGetNamedFramebufferParameteriv",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glCreateRenderbuffers",
+    "glNamedRenderbufferStorage",
+    "glNamedRenderbufferStorageMultisample",
+    "glGetNamedRenderbufferParameteriv",
+    "glCreateTextures",
+    "glTextureBuffer",
+    "glTextureBufferRange",
+    "glTextureStorage1D",
+    "glTextureStorage2D",
+    "glTextureStorage3D",
+    "glTextureStorage2DMultisample",
+    "glTextureStorage3DMultisample",
+    "glTextureSubImage1D",
+    "glTextureSubImage2D",
+    "glTextureSubImage3D",
+    "glCompressedTextureSubImage1D",
+    "glCompressedTextureSubImage2D",
+    "glCompressedTextureSubImage3D",
+    "glCopyTextureSubImage1D",
+    "glCopyTextureSubImage2D",
+    "glCopyTextureSubImage3D",
+    "glTextureParameterf",
+    "glTextureParameterfv",
+    "glTextureParameteri",
+    "glTextureParameterIiv",
+    "glTextureParameterIuiv",
+    "glTextureParameteriv",
+    "glGenerateTextureMipmap",
+    "glBindTextureUnit",
+    "glGetTextureImage",
+    "glGetCompressedTextureImage",
+    "glGetTextureLevelParameterfv",
+    "glGetTextureLevelParameteriv",
+    "glGetTextureParameterfv",
+    "glGetTextureParameterIiv",
+    "glGetTextureParameterIuiv",
+    "glGetTextureParameteriv",
+    "glCreateVertexArrays",
+    "glDisableVertexArrayAttrib",
+    "glEnableVertexArrayAttrib",
+    "glVertexArrayElementBuffer",
+    "glVertexArrayVertexBuffer",
+    "glVertexArrayVertexBuffers",
+    "glVertexArrayAttribBinding",
+    "glVertexArrayAttribFormat",
+    "glVertexArrayAttribIFormat",
+    "glVertexArrayAttribLFormat",
+    "glVertexArrayBindingDivisor",
+    "glGetVertexArrayiv",
+    "glGetVertexArrayIndexediv",
+    "glGetVertexArrayIndexed64iv",
+    "glCreateSamplers",
+    "glCreateProgramPipelines",
+    "glCreateQueries",
+    "glGetQueryBufferObjecti64v",
+    "glGetQueryBufferObjectiv",
+    "glGetQueryBufferObjectui64v",
+    "glGetQueryBufferObjectuiv",
+    "glMemoryBarrierByRegion",
+    "glGetTextureSubImage",
+    "glGetCompressedTextureSubImage",
+    "glGetGraphicsResetStatus",
+    "glGetnCompressedTexImage",
+    "glGetnTexImage",
+    "glGetnUniformdv",
+    "glGetnUniformfv",
+    "glGetnUniformiv",
+    "glGetnUniformuiv",
+    "glReadnPixels",
+    "glTextureBarrier",
+    "glSpecializeShader",
+    "glMultiDrawArraysIndirectCount",
+    "glMultiDrawElementsIndirectCount",
+    "glPolygonOffsetClamp",
+    0,
+};
+
+const char * const trace_metadata[] = {
+    "{\"functions\":[[\"glCullFace\",\"v\",[[\"mode\",\"e\"]]],[\"glFrontFace\",\"v\",[[\"mode\",\"e\"]]],[\"glHint\",\"v\",[[\"target\",\"e\"],[\"mode\",\"e\"]]],[\"glLineWidth\",\"v\",[[\"width\",\"f\"]]],[\"glPointSize\",\"v\",[[\"size\",\"f\"]]],[\"glPolygonMode\",\"v\",[[\"face\",\"e\"],[\"mode\",\"e\"]]],[\"glScissor\",\"v\",[[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glTexParameterf\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"param\",\"f\"]]],[\"glTexParameterfv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glTexParameteri\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"param\",\"i\"]]],[\"glTexParameteriv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glTexImage1D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"internalformat\",\"i\"],[\"width\",\"i\"],[\"border\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glTexImage2D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"internalformat\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"border\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glDrawBuffer\",\"v\",[[\"buf\",\"e\"]]],[\"glClear\",\"v\",[[\"mask\",\"x\"]]],[\"glClearColor\",\"v\",[[\"red\",\"f\"],[\"green\",\"f\"],[\"bl",
+    "ue\",\"f\"],[\"alpha\",\"f\"]]],[\"glClearStencil\",\"v\",[[\"s\",\"i\"]]],[\"glClearDepth\",\"v\",[[\"depth\",\"d\"]]],[\"glStencilMask\",\"v\",[[\"mask\",\"u\"]]],[\"glColorMask\",\"v\",[[\"red\",\"b\"],[\"green\",\"b\"],[\"blue\",\"b\"],[\"alpha\",\"b\"]]],[\"glDepthMask\",\"v\",[[\"flag\",\"b\"]]],[\"glDisable\",\"v\",[[\"cap\",\"e\"]]],[\"glEnable\",\"v\",[[\"cap\",\"e\"]]],[\"glFinish\",\"v\",[]],[\"glFlush\",\"v\",[]],[\"glBlendFunc\",\"v\",[[\"sfactor\",\"e\"],[\"dfactor\",\"e\"]]],[\"glLogicOp\",\"v\",[[\"opcode\",\"e\"]]],[\"glStencilFunc\",\"v\",[[\"func\",\"e\"],[\"ref\",\"i\"],[\"mask\",\"u\"]]],[\"glStencilOp\",\"v\",[[\"fail\",\"e\"],[\"zfail\",\"e\"],[\"zpass\",\"e\"]]],[\"glDepthFunc\",\"v\",[[\"func\",\"e\"]]],[\"glPixelStoref\",\"v\",[[\"pname\",\"e\"],[\"param\",\"f\"]]],[\"glPixelStorei\",\"v\",[[\"pname\",\"e\"],[\"param\",\"i\"]]],[\"glReadBuffer\",\"v\",[[\"src\",\"e\"]]],[\"glReadPixels\",\"v\",[[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glGetBooleanv\",\"v\",[[\"pname\",\"e\"],[\"data\",\"p\"]]],[\"glGetDoublev\",\"v\",[[\"pname\",\"e\"],[\"data\",\"p\"]]],[\"glGetError\",\"e\",[]],[\"glGetFloatv\",\"v\",[[\"pname\",\"e\"],[\"data\",\"p\"]]],[\"g",
+    "lGetIntegerv\",\"v\",[[\"pname\",\"e\"],[\"data\",\"p\"]]],[\"glGetString\",\"p\",[[\"name\",\"e\"]]],[\"glGetTexImage\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glGetTexParameterfv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetTexParameteriv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetTexLevelParameterfv\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetTexLevelParameteriv\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glIsEnabled\",\"b\",[[\"cap\",\"e\"]]],[\"glDepthRange\",\"v\",[[\"n\",\"d\"],[\"f\",\"d\"]]],[\"glViewport\",\"v\",[[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glDrawArrays\",\"v\",[[\"mode\",\"e\"],[\"first\",\"i\"],[\"count\",\"i\"]]],[\"glDrawElements\",\"v\",[[\"mode\",\"e\"],[\"count\",\"i\"],[\"type\",\"e\"],[\"indices\",\"p\"]]],[\"glGetPointerv\",\"v\",[[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glPolygonOffset\",\"v\",[[\"factor\",\"f\"],[\"units\",\"f\"]]],[\"glCopyTexImage1D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"internalformat\",\"e\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],",
+    "[\"border\",\"i\"]]],[\"glCopyTexImage2D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"internalformat\",\"e\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"border\",\"i\"]]],[\"glCopyTexSubImage1D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"]]],[\"glCopyTexSubImage2D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glTexSubImage1D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"width\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glTexSubImage2D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glBindTexture\",\"v\",[[\"target\",\"e\"],[\"texture\",\"u\"]]],[\"glDeleteTextures\",\"v\",[[\"n\",\"i\"],[\"textures\",\"p\"]]],[\"glGenTextures\",\"v\",[[\"n\",\"i\"],[\"textures\",\"p\"]]],[\"glIsTexture\",\"b\",[[\"texture\",\"u\"]]],[\"glDrawRangeElements\",\"v\",[[\"mode\",\"e\"],[\"start\",\"u\"],[\"end\",\"u\"],[\"count\",\"i\"],[\"type\",\"e\"],[\"indices\",\"p\"]]],[\"glTexImage3D\",\"v",
+    "\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"internalformat\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"border\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glTexSubImage3D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glCopyTexSubImage3D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glActiveTexture\",\"v\",[[\"texture\",\"e\"]]],[\"glSampleCoverage\",\"v\",[[\"value\",\"f\"],[\"invert\",\"b\"]]],[\"glCompressedTexImage3D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"border\",\"i\"],[\"imageSize\",\"i\"],[\"data\",\"p\"]]],[\"glCompressedTexImage2D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"border\",\"i\"],[\"imageSize\",\"i\"],[\"data\",\"p\"]]],[\"glCompressedTexImage1D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"internalformat\",\"e\"],[\"widt",
+    "h\",\"i\"],[\"border\",\"i\"],[\"imageSize\",\"i\"],[\"data\",\"p\"]]],[\"glCompressedTexSubImage3D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"format\",\"e\"],[\"imageSize\",\"i\"],[\"data\",\"p\"]]],[\"glCompressedTexSubImage2D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"format\",\"e\"],[\"imageSize\",\"i\"],[\"data\",\"p\"]]],[\"glCompressedTexSubImage1D\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"width\",\"i\"],[\"format\",\"e\"],[\"imageSize\",\"i\"],[\"data\",\"p\"]]],[\"glGetCompressedTexImage\",\"v\",[[\"target\",\"e\"],[\"level\",\"i\"],[\"img\",\"p\"]]],[\"glBlendFuncSeparate\",\"v\",[[\"sfactorRGB\",\"e\"],[\"dfactorRGB\",\"e\"],[\"sfactorAlpha\",\"e\"],[\"dfactorAlpha\",\"e\"]]],[\"glMultiDrawArrays\",\"v\",[[\"mode\",\"e\"],[\"first\",\"p\"],[\"count\",\"p\"],[\"drawcount\",\"i\"]]],[\"glMultiDrawElements\",\"v\",[[\"mode\",\"e\"],[\"count\",\"p\"],[\"type\",\"e\"],[\"indices\",\"p\"],[\"drawcount\",\"i\"]]],[\"glPointParameterf\",\"v\",[[\"pname\",\"e\"],[\"param\",\"f\"]]],[\"glPointParameterfv\"",
+    ",\"v\",[[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glPointParameteri\",\"v\",[[\"pname\",\"e\"],[\"param\",\"i\"]]],[\"glPointParameteriv\",\"v\",[[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glBlendColor\",\"v\",[[\"red\",\"f\"],[\"green\",\"f\"],[\"blue\",\"f\"],[\"alpha\",\"f\"]]],[\"glBlendEquation\",\"v\",[[\"mode\",\"e\"]]],[\"glGenQueries\",\"v\",[[\"n\",\"i\"],[\"ids\",\"p\"]]],[\"glDeleteQueries\",\"v\",[[\"n\",\"i\"],[\"ids\",\"p\"]]],[\"glIsQuery\",\"b\",[[\"id\",\"u\"]]],[\"glBeginQuery\",\"v\",[[\"target\",\"e\"],[\"id\",\"u\"]]],[\"glEndQuery\",\"v\",[[\"target\",\"e\"]]],[\"glGetQueryiv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetQueryObjectiv\",\"v\",[[\"id\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetQueryObjectuiv\",\"v\",[[\"id\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glBindBuffer\",\"v\",[[\"target\",\"e\"],[\"buffer\",\"u\"]]],[\"glDeleteBuffers\",\"v\",[[\"n\",\"i\"],[\"buffers\",\"p\"]]],[\"glGenBuffers\",\"v\",[[\"n\",\"i\"],[\"buffers\",\"p\"]]],[\"glIsBuffer\",\"b\",[[\"buffer\",\"u\"]]],[\"glBufferData\",\"v\",[[\"target\",\"e\"],[\"size\",\"i\"],[\"data\",\"p\"],[\"usage\",\"e\"]]],[\"glBufferSubData\",\"v\",[[\"target\",\"e\"],[\"offset\",\"i\"],[\"size\",\"i\"],[\"data\",",
+    "\"p\"]]],[\"glGetBufferSubData\",\"v\",[[\"target\",\"e\"],[\"offset\",\"i\"],[\"size\",\"i\"],[\"data\",\"p\"]]],[\"glMapBuffer\",\"p\",[[\"target\",\"e\"],[\"access\",\"e\"]]],[\"glUnmapBuffer\",\"b\",[[\"target\",\"e\"]]],[\"glGetBufferParameteriv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetBufferPointerv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glBlendEquationSeparate\",\"v\",[[\"modeRGB\",\"e\"],[\"modeAlpha\",\"e\"]]],[\"glDrawBuffers\",\"v\",[[\"n\",\"i\"],[\"bufs\",\"p\"]]],[\"glStencilOpSeparate\",\"v\",[[\"face\",\"e\"],[\"sfail\",\"e\"],[\"dpfail\",\"e\"],[\"dppass\",\"e\"]]],[\"glStencilFuncSeparate\",\"v\",[[\"face\",\"e\"],[\"func\",\"e\"],[\"ref\",\"i\"],[\"mask\",\"u\"]]],[\"glStencilMaskSeparate\",\"v\",[[\"face\",\"e\"],[\"mask\",\"u\"]]],[\"glAttachShader\",\"v\",[[\"program\",\"u\"],[\"shader\",\"u\"]]],[\"glBindAttribLocation\",\"v\",[[\"program\",\"u\"],[\"index\",\"u\"],[\"name\",\"p\"]]],[\"glCompileShader\",\"v\",[[\"shader\",\"u\"]]],[\"glCreateProgram\",\"u\",[]],[\"glCreateShader\",\"u\",[[\"type\",\"e\"]]],[\"glDeleteProgram\",\"v\",[[\"program\",\"u\"]]],[\"glDeleteShader\",\"v\",[[\"shader\",\"u\"]]],[\"glDetachShader\",\"v\",[[\"prog",
+    "ram\",\"u\"],[\"shader\",\"u\"]]],[\"glDisableVertexAttribArray\",\"v\",[[\"index\",\"u\"]]],[\"glEnableVertexAttribArray\",\"v\",[[\"index\",\"u\"]]],[\"glGetActiveAttrib\",\"v\",[[\"program\",\"u\"],[\"index\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"size\",\"p\"],[\"type\",\"p\"],[\"name\",\"p\"]]],[\"glGetActiveUniform\",\"v\",[[\"program\",\"u\"],[\"index\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"size\",\"p\"],[\"type\",\"p\"],[\"name\",\"p\"]]],[\"glGetAttachedShaders\",\"v\",[[\"program\",\"u\"],[\"maxCount\",\"i\"],[\"count\",\"p\"],[\"shaders\",\"p\"]]],[\"glGetAttribLocation\",\"i\",[[\"program\",\"u\"],[\"name\",\"p\"]]],[\"glGetProgramiv\",\"v\",[[\"program\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetProgramInfoLog\",\"v\",[[\"program\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"infoLog\",\"p\"]]],[\"glGetShaderiv\",\"v\",[[\"shader\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetShaderInfoLog\",\"v\",[[\"shader\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"infoLog\",\"p\"]]],[\"glGetShaderSource\",\"v\",[[\"shader\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"source\",\"p\"]]],[\"glGetUniformLocation\",\"i\",[[\"program\",\"u\"],[\"name\",\"p\"]]],[\"glGetUniformf",
+    "v\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"params\",\"p\"]]],[\"glGetUniformiv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"params\",\"p\"]]],[\"glGetVertexAttribdv\",\"v\",[[\"index\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetVertexAttribfv\",\"v\",[[\"index\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetVertexAttribiv\",\"v\",[[\"index\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetVertexAttribPointerv\",\"v\",[[\"index\",\"u\"],[\"pname\",\"e\"],[\"pointer\",\"p\"]]],[\"glIsProgram\",\"b\",[[\"program\",\"u\"]]],[\"glIsShader\",\"b\",[[\"shader\",\"u\"]]],[\"glLinkProgram\",\"v\",[[\"program\",\"u\"]]],[\"glShaderSource\",\"v\",[[\"shader\",\"u\"],[\"count\",\"i\"],[\"string\",\"p\"],[\"length\",\"p\"]]],[\"glUseProgram\",\"v\",[[\"program\",\"u\"]]],[\"glUniform1f\",\"v\",[[\"location\",\"i\"],[\"v0\",\"f\"]]],[\"glUniform2f\",\"v\",[[\"location\",\"i\"],[\"v0\",\"f\"],[\"v1\",\"f\"]]],[\"glUniform3f\",\"v\",[[\"location\",\"i\"],[\"v0\",\"f\"],[\"v1\",\"f\"],[\"v2\",\"f\"]]],[\"glUniform4f\",\"v\",[[\"location\",\"i\"],[\"v0\",\"f\"],[\"v1\",\"f\"],[\"v2\",\"f\"],[\"v3\",\"f\"]]],[\"glUniform1i\",\"v\",[[\"location\",\"i\"],[\"v0\",\"i\"]]],[\"glUniform2i\",\"v\",[[\"location\",\"i\"],[\"v0",
+    "\",\"i\"],[\"v1\",\"i\"]]],[\"glUniform3i\",\"v\",[[\"location\",\"i\"],[\"v0\",\"i\"],[\"v1\",\"i\"],[\"v2\",\"i\"]]],[\"glUniform4i\",\"v\",[[\"location\",\"i\"],[\"v0\",\"i\"],[\"v1\",\"i\"],[\"v2\",\"i\"],[\"v3\",\"i\"]]],[\"glUniform1fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform2fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform3fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform4fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform1iv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform2iv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform3iv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform4iv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniformMatrix2fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix3fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix4fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glValidateProgram\",\"v\",[[\"p",
+    "rogram\",\"u\"]]],[\"glVertexAttrib1d\",\"v\",[[\"index\",\"u\"],[\"x\",\"d\"]]],[\"glVertexAttrib1dv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib1f\",\"v\",[[\"index\",\"u\"],[\"x\",\"f\"]]],[\"glVertexAttrib1fv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib1s\",\"v\",[[\"index\",\"u\"],[\"x\",\"i\"]]],[\"glVertexAttrib1sv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib2d\",\"v\",[[\"index\",\"u\"],[\"x\",\"d\"],[\"y\",\"d\"]]],[\"glVertexAttrib2dv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib2f\",\"v\",[[\"index\",\"u\"],[\"x\",\"f\"],[\"y\",\"f\"]]],[\"glVertexAttrib2fv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib2s\",\"v\",[[\"index\",\"u\"],[\"x\",\"i\"],[\"y\",\"i\"]]],[\"glVertexAttrib2sv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib3d\",\"v\",[[\"index\",\"u\"],[\"x\",\"d\"],[\"y\",\"d\"],[\"z\",\"d\"]]],[\"glVertexAttrib3dv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib3f\",\"v\",[[\"index\",\"u\"],[\"x\",\"f\"],[\"y\",\"f\"],[\"z\",\"f\"]]],[\"glVertexAttrib3fv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib3s\",\"v\",[[\"index\",\"u\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"z\",\"i\"]]],[\"glVertexAttrib3sv\",\"v\",[[\"index\",\"u\"],[\"v\"",
+    ",\"p\"]]],[\"glVertexAttrib4Nbv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4Niv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4Nsv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4Nub\",\"v\",[[\"index\",\"u\"],[\"x\",\"u\"],[\"y\",\"u\"],[\"z\",\"u\"],[\"w\",\"u\"]]],[\"glVertexAttrib4Nubv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4Nuiv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4Nusv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4bv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4d\",\"v\",[[\"index\",\"u\"],[\"x\",\"d\"],[\"y\",\"d\"],[\"z\",\"d\"],[\"w\",\"d\"]]],[\"glVertexAttrib4dv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4f\",\"v\",[[\"index\",\"u\"],[\"x\",\"f\"],[\"y\",\"f\"],[\"z\",\"f\"],[\"w\",\"f\"]]],[\"glVertexAttrib4fv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4iv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4s\",\"v\",[[\"index\",\"u\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"z\",\"i\"],[\"w\",\"i\"]]],[\"glVertexAttrib4sv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4ubv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttrib4uiv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"g",
+    "lVertexAttrib4usv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribPointer\",\"v\",[[\"index\",\"u\"],[\"size\",\"i\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"stride\",\"i\"],[\"pointer\",\"p\"]]],[\"glUniformMatrix2x3fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix3x2fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix2x4fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix4x2fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix3x4fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix4x3fv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glColorMaski\",\"v\",[[\"index\",\"u\"],[\"r\",\"b\"],[\"g\",\"b\"],[\"b\",\"b\"],[\"a\",\"b\"]]],[\"glGetBooleani_v\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"],[\"data\",\"p\"]]],[\"glGetIntegeri_v\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"],[\"data\",\"p\"]]],[\"glEnablei\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"]]],[\"glDisablei\",\"v\",[[\"targe",
+    "t\",\"e\"],[\"index\",\"u\"]]],[\"glIsEnabledi\",\"b\",[[\"target\",\"e\"],[\"index\",\"u\"]]],[\"glBeginTransformFeedback\",\"v\",[[\"primitiveMode\",\"e\"]]],[\"glEndTransformFeedback\",\"v\",[]],[\"glBindBufferRange\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"],[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"size\",\"i\"]]],[\"glBindBufferBase\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"],[\"buffer\",\"u\"]]],[\"glTransformFeedbackVaryings\",\"v\",[[\"program\",\"u\"],[\"count\",\"i\"],[\"varyings\",\"p\"],[\"bufferMode\",\"e\"]]],[\"glGetTransformFeedbackVarying\",\"v\",[[\"program\",\"u\"],[\"index\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"size\",\"p\"],[\"type\",\"p\"],[\"name\",\"p\"]]],[\"glClampColor\",\"v\",[[\"target\",\"e\"],[\"clamp\",\"e\"]]],[\"glBeginConditionalRender\",\"v\",[[\"id\",\"u\"],[\"mode\",\"e\"]]],[\"glEndConditionalRender\",\"v\",[]],[\"glVertexAttribIPointer\",\"v\",[[\"index\",\"u\"],[\"size\",\"i\"],[\"type\",\"e\"],[\"stride\",\"i\"],[\"pointer\",\"p\"]]],[\"glGetVertexAttribIiv\",\"v\",[[\"index\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetVertexAttribIuiv\",\"v\",[[\"index\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glVertexAttribI1i\",\"v\",[[\"index\",\"u\"],[\"x\"",
+    ",\"i\"]]],[\"glVertexAttribI2i\",\"v\",[[\"index\",\"u\"],[\"x\",\"i\"],[\"y\",\"i\"]]],[\"glVertexAttribI3i\",\"v\",[[\"index\",\"u\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"z\",\"i\"]]],[\"glVertexAttribI4i\",\"v\",[[\"index\",\"u\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"z\",\"i\"],[\"w\",\"i\"]]],[\"glVertexAttribI1ui\",\"v\",[[\"index\",\"u\"],[\"x\",\"u\"]]],[\"glVertexAttribI2ui\",\"v\",[[\"index\",\"u\"],[\"x\",\"u\"],[\"y\",\"u\"]]],[\"glVertexAttribI3ui\",\"v\",[[\"index\",\"u\"],[\"x\",\"u\"],[\"y\",\"u\"],[\"z\",\"u\"]]],[\"glVertexAttribI4ui\",\"v\",[[\"index\",\"u\"],[\"x\",\"u\"],[\"y\",\"u\"],[\"z\",\"u\"],[\"w\",\"u\"]]],[\"glVertexAttribI1iv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI2iv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI3iv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI4iv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI1uiv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI2uiv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI3uiv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI4uiv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI4bv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI4sv\",\"v\",[[\"index\",\"u\"],[\"v\",\"",
+    "p\"]]],[\"glVertexAttribI4ubv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribI4usv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glGetUniformuiv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"params\",\"p\"]]],[\"glBindFragDataLocation\",\"v\",[[\"program\",\"u\"],[\"color\",\"u\"],[\"name\",\"p\"]]],[\"glGetFragDataLocation\",\"i\",[[\"program\",\"u\"],[\"name\",\"p\"]]],[\"glUniform1ui\",\"v\",[[\"location\",\"i\"],[\"v0\",\"u\"]]],[\"glUniform2ui\",\"v\",[[\"location\",\"i\"],[\"v0\",\"u\"],[\"v1\",\"u\"]]],[\"glUniform3ui\",\"v\",[[\"location\",\"i\"],[\"v0\",\"u\"],[\"v1\",\"u\"],[\"v2\",\"u\"]]],[\"glUniform4ui\",\"v\",[[\"location\",\"i\"],[\"v0\",\"u\"],[\"v1\",\"u\"],[\"v2\",\"u\"],[\"v3\",\"u\"]]],[\"glUniform1uiv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform2uiv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform3uiv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform4uiv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glTexParameterIiv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glTexParameterIuiv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetT",
+    "exParameterIiv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetTexParameterIuiv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glClearBufferiv\",\"v\",[[\"buffer\",\"e\"],[\"drawbuffer\",\"i\"],[\"value\",\"p\"]]],[\"glClearBufferuiv\",\"v\",[[\"buffer\",\"e\"],[\"drawbuffer\",\"i\"],[\"value\",\"p\"]]],[\"glClearBufferfv\",\"v\",[[\"buffer\",\"e\"],[\"drawbuffer\",\"i\"],[\"value\",\"p\"]]],[\"glClearBufferfi\",\"v\",[[\"buffer\",\"e\"],[\"drawbuffer\",\"i\"],[\"depth\",\"f\"],[\"stencil\",\"i\"]]],[\"glGetStringi\",\"p\",[[\"name\",\"e\"],[\"index\",\"u\"]]],[\"glIsRenderbuffer\",\"b\",[[\"renderbuffer\",\"u\"]]],[\"glBindRenderbuffer\",\"v\",[[\"target\",\"e\"],[\"renderbuffer\",\"u\"]]],[\"glDeleteRenderbuffers\",\"v\",[[\"n\",\"i\"],[\"renderbuffers\",\"p\"]]],[\"glGenRenderbuffers\",\"v\",[[\"n\",\"i\"],[\"renderbuffers\",\"p\"]]],[\"glRenderbufferStorage\",\"v\",[[\"target\",\"e\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glGetRenderbufferParameteriv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glIsFramebuffer\",\"b\",[[\"framebuffer\",\"u\"]]],[\"glBindFramebuffer\",\"v\",[[\"target\",\"e\"],[\"framebuff",
+    "er\",\"u\"]]],[\"glDeleteFramebuffers\",\"v\",[[\"n\",\"i\"],[\"framebuffers\",\"p\"]]],[\"glGenFramebuffers\",\"v\",[[\"n\",\"i\"],[\"framebuffers\",\"p\"]]],[\"glCheckFramebufferStatus\",\"e\",[[\"target\",\"e\"]]],[\"glFramebufferTexture1D\",\"v\",[[\"target\",\"e\"],[\"attachment\",\"e\"],[\"textarget\",\"e\"],[\"texture\",\"u\"],[\"level\",\"i\"]]],[\"glFramebufferTexture2D\",\"v\",[[\"target\",\"e\"],[\"attachment\",\"e\"],[\"textarget\",\"e\"],[\"texture\",\"u\"],[\"level\",\"i\"]]],[\"glFramebufferTexture3D\",\"v\",[[\"target\",\"e\"],[\"attachment\",\"e\"],[\"textarget\",\"e\"],[\"texture\",\"u\"],[\"level\",\"i\"],[\"zoffset\",\"i\"]]],[\"glFramebufferRenderbuffer\",\"v\",[[\"target\",\"e\"],[\"attachment\",\"e\"],[\"renderbuffertarget\",\"e\"],[\"renderbuffer\",\"u\"]]],[\"glGetFramebufferAttachmentParameteriv\",\"v\",[[\"target\",\"e\"],[\"attachment\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGenerateMipmap\",\"v\",[[\"target\",\"e\"]]],[\"glBlitFramebuffer\",\"v\",[[\"srcX0\",\"i\"],[\"srcY0\",\"i\"],[\"srcX1\",\"i\"],[\"srcY1\",\"i\"],[\"dstX0\",\"i\"],[\"dstY0\",\"i\"],[\"dstX1\",\"i\"],[\"dstY1\",\"i\"],[\"mask\",\"x\"],[\"filter\",\"e\"]]],[\"glRenderbufferStorageMultisample\",\"v\",[[",
+    "\"target\",\"e\"],[\"samples\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glFramebufferTextureLayer\",\"v\",[[\"target\",\"e\"],[\"attachment\",\"e\"],[\"texture\",\"u\"],[\"level\",\"i\"],[\"layer\",\"i\"]]],[\"glMapBufferRange\",\"p\",[[\"target\",\"e\"],[\"offset\",\"i\"],[\"length\",\"i\"],[\"access\",\"x\"]]],[\"glFlushMappedBufferRange\",\"v\",[[\"target\",\"e\"],[\"offset\",\"i\"],[\"length\",\"i\"]]],[\"glBindVertexArray\",\"v\",[[\"array\",\"u\"]]],[\"glDeleteVertexArrays\",\"v\",[[\"n\",\"i\"],[\"arrays\",\"p\"]]],[\"glGenVertexArrays\",\"v\",[[\"n\",\"i\"],[\"arrays\",\"p\"]]],[\"glIsVertexArray\",\"b\",[[\"array\",\"u\"]]],[\"glDrawArraysInstanced\",\"v\",[[\"mode\",\"e\"],[\"first\",\"i\"],[\"count\",\"i\"],[\"instancecount\",\"i\"]]],[\"glDrawElementsInstanced\",\"v\",[[\"mode\",\"e\"],[\"count\",\"i\"],[\"type\",\"e\"],[\"indices\",\"p\"],[\"instancecount\",\"i\"]]],[\"glTexBuffer\",\"v\",[[\"target\",\"e\"],[\"internalformat\",\"e\"],[\"buffer\",\"u\"]]],[\"glPrimitiveRestartIndex\",\"v\",[[\"index\",\"u\"]]],[\"glCopyBufferSubData\",\"v\",[[\"readTarget\",\"e\"],[\"writeTarget\",\"e\"],[\"readOffset\",\"i\"],[\"writeOffset\",\"i\"],[\"size\",\"i\"]]],[\"glGetUniformInd",
+    "ices\",\"v\",[[\"program\",\"u\"],[\"uniformCount\",\"i\"],[\"uniformNames\",\"p\"],[\"uniformIndices\",\"p\"]]],[\"glGetActiveUniformsiv\",\"v\",[[\"program\",\"u\"],[\"uniformCount\",\"i\"],[\"uniformIndices\",\"p\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetActiveUniformName\",\"v\",[[\"program\",\"u\"],[\"uniformIndex\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"uniformName\",\"p\"]]],[\"glGetUniformBlockIndex\",\"u\",[[\"program\",\"u\"],[\"uniformBlockName\",\"p\"]]],[\"glGetActiveUniformBlockiv\",\"v\",[[\"program\",\"u\"],[\"uniformBlockIndex\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetActiveUniformBlockName\",\"v\",[[\"program\",\"u\"],[\"uniformBlockIndex\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"uniformBlockName\",\"p\"]]],[\"glUniformBlockBinding\",\"v\",[[\"program\",\"u\"],[\"uniformBlockIndex\",\"u\"],[\"uniformBlockBinding\",\"u\"]]],[\"glDrawElementsBaseVertex\",\"v\",[[\"mode\",\"e\"],[\"count\",\"i\"],[\"type\",\"e\"],[\"indices\",\"p\"],[\"basevertex\",\"i\"]]],[\"glDrawRangeElementsBaseVertex\",\"v\",[[\"mode\",\"e\"],[\"start\",\"u\"],[\"end\",\"u\"],[\"count\",\"i\"],[\"type\",\"e\"],[\"indices\",\"p\"],[\"basevertex\",\"i\"]]],[\"glDrawElementsIn",
+    "stancedBaseVertex\",\"v\",[[\"mode\",\"e\"],[\"count\",\"i\"],[\"type\",\"e\"],[\"indices\",\"p\"],[\"instancecount\",\"i\"],[\"basevertex\",\"i\"]]],[\"glMultiDrawElementsBaseVertex\",\"v\",[[\"mode\",\"e\"],[\"count\",\"p\"],[\"type\",\"e\"],[\"indices\",\"p\"],[\"drawcount\",\"i\"],[\"basevertex\",\"p\"]]],[\"glProvokingVertex\",\"v\",[[\"mode\",\"e\"]]],[\"glFenceSync\",\"p\",[[\"condition\",\"e\"],[\"flags\",\"x\"]]],[\"glIsSync\",\"b\",[[\"sync\",\"p\"]]],[\"glDeleteSync\",\"v\",[[\"sync\",\"p\"]]],[\"glClientWaitSync\",\"e\",[[\"sync\",\"p\"],[\"flags\",\"x\"],[\"timeout\",\"u\"]]],[\"glWaitSync\",\"v\",[[\"sync\",\"p\"],[\"flags\",\"x\"],[\"timeout\",\"u\"]]],[\"glGetInteger64v\",\"v\",[[\"pname\",\"e\"],[\"data\",\"p\"]]],[\"glGetSynciv\",\"v\",[[\"sync\",\"p\"],[\"pname\",\"e\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"values\",\"p\"]]],[\"glGetInteger64i_v\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"],[\"data\",\"p\"]]],[\"glGetBufferParameteri64v\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glFramebufferTexture\",\"v\",[[\"target\",\"e\"],[\"attachment\",\"e\"],[\"texture\",\"u\"],[\"level\",\"i\"]]],[\"glTexImage2DMultisample\",\"v\",[[\"target\",\"e\"],[\"samples\",\"i\"],[\"internalformat",
+    "\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"fixedsamplelocations\",\"b\"]]],[\"glTexImage3DMultisample\",\"v\",[[\"target\",\"e\"],[\"samples\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"fixedsamplelocations\",\"b\"]]],[\"glGetMultisamplefv\",\"v\",[[\"pname\",\"e\"],[\"index\",\"u\"],[\"val\",\"p\"]]],[\"glSampleMaski\",\"v\",[[\"maskNumber\",\"u\"],[\"mask\",\"x\"]]],[\"glBindFragDataLocationIndexed\",\"v\",[[\"program\",\"u\"],[\"colorNumber\",\"u\"],[\"index\",\"u\"],[\"name\",\"p\"]]],[\"glGetFragDataIndex\",\"i\",[[\"program\",\"u\"],[\"name\",\"p\"]]],[\"glGenSamplers\",\"v\",[[\"count\",\"i\"],[\"samplers\",\"p\"]]],[\"glDeleteSamplers\",\"v\",[[\"count\",\"i\"],[\"samplers\",\"p\"]]],[\"glIsSampler\",\"b\",[[\"sampler\",\"u\"]]],[\"glBindSampler\",\"v\",[[\"unit\",\"u\"],[\"sampler\",\"u\"]]],[\"glSamplerParameteri\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"param\",\"i\"]]],[\"glSamplerParameteriv\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glSamplerParameterf\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"param\",\"f\"]]],[\"glSamplerParameterfv\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glSampl",
+    "erParameterIiv\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glSamplerParameterIuiv\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glGetSamplerParameteriv\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetSamplerParameterIiv\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetSamplerParameterfv\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetSamplerParameterIuiv\",\"v\",[[\"sampler\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glQueryCounter\",\"v\",[[\"id\",\"u\"],[\"target\",\"e\"]]],[\"glGetQueryObjecti64v\",\"v\",[[\"id\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetQueryObjectui64v\",\"v\",[[\"id\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glVertexAttribDivisor\",\"v\",[[\"index\",\"u\"],[\"divisor\",\"u\"]]],[\"glVertexAttribP1ui\",\"v\",[[\"index\",\"u\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"value\",\"u\"]]],[\"glVertexAttribP1uiv\",\"v\",[[\"index\",\"u\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"value\",\"p\"]]],[\"glVertexAttribP2ui\",\"v\",[[\"index\",\"u\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"value\",\"u\"]]],[\"glVertexAttribP2uiv\",\"v\",[[\"index\",",
+    "\"u\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"value\",\"p\"]]],[\"glVertexAttribP3ui\",\"v\",[[\"index\",\"u\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"value\",\"u\"]]],[\"glVertexAttribP3uiv\",\"v\",[[\"index\",\"u\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"value\",\"p\"]]],[\"glVertexAttribP4ui\",\"v\",[[\"index\",\"u\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"value\",\"u\"]]],[\"glVertexAttribP4uiv\",\"v\",[[\"index\",\"u\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"value\",\"p\"]]],[\"glMinSampleShading\",\"v\",[[\"value\",\"f\"]]],[\"glBlendEquationi\",\"v\",[[\"buf\",\"u\"],[\"mode\",\"e\"]]],[\"glBlendEquationSeparatei\",\"v\",[[\"buf\",\"u\"],[\"modeRGB\",\"e\"],[\"modeAlpha\",\"e\"]]],[\"glBlendFunci\",\"v\",[[\"buf\",\"u\"],[\"src\",\"e\"],[\"dst\",\"e\"]]],[\"glBlendFuncSeparatei\",\"v\",[[\"buf\",\"u\"],[\"srcRGB\",\"e\"],[\"dstRGB\",\"e\"],[\"srcAlpha\",\"e\"],[\"dstAlpha\",\"e\"]]],[\"glDrawArraysIndirect\",\"v\",[[\"mode\",\"e\"],[\"indirect\",\"p\"]]],[\"glDrawElementsIndirect\",\"v\",[[\"mode\",\"e\"],[\"type\",\"e\"],[\"indirect\",\"p\"]]],[\"glUniform1d\",\"v\",[[\"location\",\"i\"],[\"x\",\"d\"]]],[\"glUniform2d\",\"v\",[[\"location\",\"i\"],[\"x\",\"d\"],[\"y\",\"d\"]]],[\"glUniform3d\",\"v\",[[\"loca",
+    "tion\",\"i\"],[\"x\",\"d\"],[\"y\",\"d\"],[\"z\",\"d\"]]],[\"glUniform4d\",\"v\",[[\"location\",\"i\"],[\"x\",\"d\"],[\"y\",\"d\"],[\"z\",\"d\"],[\"w\",\"d\"]]],[\"glUniform1dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform2dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform3dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniform4dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glUniformMatrix2dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix3dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix4dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix2x3dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix2x4dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix3x2dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix3x4dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\"",
+    ",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix4x2dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glUniformMatrix4x3dv\",\"v\",[[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glGetUniformdv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"params\",\"p\"]]],[\"glGetSubroutineUniformLocation\",\"i\",[[\"program\",\"u\"],[\"shadertype\",\"e\"],[\"name\",\"p\"]]],[\"glGetSubroutineIndex\",\"u\",[[\"program\",\"u\"],[\"shadertype\",\"e\"],[\"name\",\"p\"]]],[\"glGetActiveSubroutineUniformiv\",\"v\",[[\"program\",\"u\"],[\"shadertype\",\"e\"],[\"index\",\"u\"],[\"pname\",\"e\"],[\"values\",\"p\"]]],[\"glGetActiveSubroutineUniformName\",\"v\",[[\"program\",\"u\"],[\"shadertype\",\"e\"],[\"index\",\"u\"],[\"bufsize\",\"i\"],[\"length\",\"p\"],[\"name\",\"p\"]]],[\"glGetActiveSubroutineName\",\"v\",[[\"program\",\"u\"],[\"shadertype\",\"e\"],[\"index\",\"u\"],[\"bufsize\",\"i\"],[\"length\",\"p\"],[\"name\",\"p\"]]],[\"glUniformSubroutinesuiv\",\"v\",[[\"shadertype\",\"e\"],[\"count\",\"i\"],[\"indices\",\"p\"]]],[\"glGetUniformSubroutineuiv\",\"v\",[[\"shadertype\",\"e\"],[\"location\",\"i\"],[\"params\",\"p\"]]],[\"glGetProgramStage",
+    "iv\",\"v\",[[\"program\",\"u\"],[\"shadertype\",\"e\"],[\"pname\",\"e\"],[\"values\",\"p\"]]],[\"glPatchParameteri\",\"v\",[[\"pname\",\"e\"],[\"value\",\"i\"]]],[\"glPatchParameterfv\",\"v\",[[\"pname\",\"e\"],[\"values\",\"p\"]]],[\"glBindTransformFeedback\",\"v\",[[\"target\",\"e\"],[\"id\",\"u\"]]],[\"glDeleteTransformFeedbacks\",\"v\",[[\"n\",\"i\"],[\"ids\",\"p\"]]],[\"glGenTransformFeedbacks\",\"v\",[[\"n\",\"i\"],[\"ids\",\"p\"]]],[\"glIsTransformFeedback\",\"b\",[[\"id\",\"u\"]]],[\"glPauseTransformFeedback\",\"v\",[]],[\"glResumeTransformFeedback\",\"v\",[]],[\"glDrawTransformFeedback\",\"v\",[[\"mode\",\"e\"],[\"id\",\"u\"]]],[\"glDrawTransformFeedbackStream\",\"v\",[[\"mode\",\"e\"],[\"id\",\"u\"],[\"stream\",\"u\"]]],[\"glBeginQueryIndexed\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"],[\"id\",\"u\"]]],[\"glEndQueryIndexed\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"]]],[\"glGetQueryIndexediv\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glReleaseShaderCompiler\",\"v\",[]],[\"glShaderBinary\",\"v\",[[\"count\",\"i\"],[\"shaders\",\"p\"],[\"binaryformat\",\"e\"],[\"binary\",\"p\"],[\"length\",\"i\"]]],[\"glGetShaderPrecisionFormat\",\"v\",[[\"shadertype\",\"e",
+    "\"],[\"precisiontype\",\"e\"],[\"range\",\"p\"],[\"precision\",\"p\"]]],[\"glDepthRangef\",\"v\",[[\"n\",\"f\"],[\"f\",\"f\"]]],[\"glClearDepthf\",\"v\",[[\"d\",\"f\"]]],[\"glGetProgramBinary\",\"v\",[[\"program\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"binaryFormat\",\"p\"],[\"binary\",\"p\"]]],[\"glProgramBinary\",\"v\",[[\"program\",\"u\"],[\"binaryFormat\",\"e\"],[\"binary\",\"p\"],[\"length\",\"i\"]]],[\"glProgramParameteri\",\"v\",[[\"program\",\"u\"],[\"pname\",\"e\"],[\"value\",\"i\"]]],[\"glUseProgramStages\",\"v\",[[\"pipeline\",\"u\"],[\"stages\",\"x\"],[\"program\",\"u\"]]],[\"glActiveShaderProgram\",\"v\",[[\"pipeline\",\"u\"],[\"program\",\"u\"]]],[\"glCreateShaderProgramv\",\"u\",[[\"type\",\"e\"],[\"count\",\"i\"],[\"strings\",\"p\"]]],[\"glBindProgramPipeline\",\"v\",[[\"pipeline\",\"u\"]]],[\"glDeleteProgramPipelines\",\"v\",[[\"n\",\"i\"],[\"pipelines\",\"p\"]]],[\"glGenProgramPipelines\",\"v\",[[\"n\",\"i\"],[\"pipelines\",\"p\"]]],[\"glIsProgramPipeline\",\"b\",[[\"pipeline\",\"u\"]]],[\"glGetProgramPipelineiv\",\"v\",[[\"pipeline\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glProgramUniform1i\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"i\"]]],[\"glProgramUniform1",
+    "iv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform1f\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"f\"]]],[\"glProgramUniform1fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform1d\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"d\"]]],[\"glProgramUniform1dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform1ui\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"u\"]]],[\"glProgramUniform1uiv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform2i\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"i\"],[\"v1\",\"i\"]]],[\"glProgramUniform2iv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform2f\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"f\"],[\"v1\",\"f\"]]],[\"glProgramUniform2fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform2d\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"d\"],[\"v1\",\"d\"]]],[\"glProgramUniform2dv\",\"",
+    "v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform2ui\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"u\"],[\"v1\",\"u\"]]],[\"glProgramUniform2uiv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform3i\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"i\"],[\"v1\",\"i\"],[\"v2\",\"i\"]]],[\"glProgramUniform3iv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform3f\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"f\"],[\"v1\",\"f\"],[\"v2\",\"f\"]]],[\"glProgramUniform3fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform3d\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"d\"],[\"v1\",\"d\"],[\"v2\",\"d\"]]],[\"glProgramUniform3dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform3ui\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"u\"],[\"v1\",\"u\"],[\"v2\",\"u\"]]],[\"glProgramUniform3uiv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform4i\",\"v\",[[\"progr",
+    "am\",\"u\"],[\"location\",\"i\"],[\"v0\",\"i\"],[\"v1\",\"i\"],[\"v2\",\"i\"],[\"v3\",\"i\"]]],[\"glProgramUniform4iv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform4f\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"f\"],[\"v1\",\"f\"],[\"v2\",\"f\"],[\"v3\",\"f\"]]],[\"glProgramUniform4fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform4d\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"d\"],[\"v1\",\"d\"],[\"v2\",\"d\"],[\"v3\",\"d\"]]],[\"glProgramUniform4dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniform4ui\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"v0\",\"u\"],[\"v1\",\"u\"],[\"v2\",\"u\"],[\"v3\",\"u\"]]],[\"glProgramUniform4uiv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix2fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix3fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix4fv\",\"v\",[[\"pr",
+    "ogram\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix2dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix3dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix4dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix2x3fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix3x2fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix2x4fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix4x2fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix3x4fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUnifor",
+    "mMatrix4x3fv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix2x3dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix3x2dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix2x4dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix4x2dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix3x4dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glProgramUniformMatrix4x3dv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"count\",\"i\"],[\"transpose\",\"b\"],[\"value\",\"p\"]]],[\"glValidateProgramPipeline\",\"v\",[[\"pipeline\",\"u\"]]],[\"glGetProgramPipelineInfoLog\",\"v\",[[\"pipeline\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"infoLog\",\"p\"]]],[\"glVertexAttribL1d\",\"v\",[[\"index\",\"u\"],[\"x\",\"d\"]]],[\"glVertexAttri",
+    "bL2d\",\"v\",[[\"index\",\"u\"],[\"x\",\"d\"],[\"y\",\"d\"]]],[\"glVertexAttribL3d\",\"v\",[[\"index\",\"u\"],[\"x\",\"d\"],[\"y\",\"d\"],[\"z\",\"d\"]]],[\"glVertexAttribL4d\",\"v\",[[\"index\",\"u\"],[\"x\",\"d\"],[\"y\",\"d\"],[\"z\",\"d\"],[\"w\",\"d\"]]],[\"glVertexAttribL1dv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribL2dv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribL3dv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribL4dv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glVertexAttribLPointer\",\"v\",[[\"index\",\"u\"],[\"size\",\"i\"],[\"type\",\"e\"],[\"stride\",\"i\"],[\"pointer\",\"p\"]]],[\"glGetVertexAttribLdv\",\"v\",[[\"index\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glViewportArrayv\",\"v\",[[\"first\",\"u\"],[\"count\",\"i\"],[\"v\",\"p\"]]],[\"glViewportIndexedf\",\"v\",[[\"index\",\"u\"],[\"x\",\"f\"],[\"y\",\"f\"],[\"w\",\"f\"],[\"h\",\"f\"]]],[\"glViewportIndexedfv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glScissorArrayv\",\"v\",[[\"first\",\"u\"],[\"count\",\"i\"],[\"v\",\"p\"]]],[\"glScissorIndexed\",\"v\",[[\"index\",\"u\"],[\"left\",\"i\"],[\"bottom\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glScissorIndexedv\",\"v\",[[\"index\",\"u\"],[\"v\",\"p\"]]],[\"glDepthRangeArr",
+    "ayv\",\"v\",[[\"first\",\"u\"],[\"count\",\"i\"],[\"v\",\"p\"]]],[\"glDepthRangeIndexed\",\"v\",[[\"index\",\"u\"],[\"n\",\"d\"],[\"f\",\"d\"]]],[\"glGetFloati_v\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"],[\"data\",\"p\"]]],[\"glGetDoublei_v\",\"v\",[[\"target\",\"e\"],[\"index\",\"u\"],[\"data\",\"p\"]]],[\"glDrawArraysInstancedBaseInstance\",\"v\",[[\"mode\",\"e\"],[\"first\",\"i\"],[\"count\",\"i\"],[\"instancecount\",\"i\"],[\"baseinstance\",\"u\"]]],[\"glDrawElementsInstancedBaseInstance\",\"v\",[[\"mode\",\"e\"],[\"count\",\"i\"],[\"type\",\"e\"],[\"indices\",\"p\"],[\"instancecount\",\"i\"],[\"baseinstance\",\"u\"]]],[\"glDrawElementsInstancedBaseVertexBaseInstance\",\"v\",[[\"mode\",\"e\"],[\"count\",\"i\"],[\"type\",\"e\"],[\"indices\",\"p\"],[\"instancecount\",\"i\"],[\"basevertex\",\"i\"],[\"baseinstance\",\"u\"]]],[\"glGetInternalformativ\",\"v\",[[\"target\",\"e\"],[\"internalformat\",\"e\"],[\"pname\",\"e\"],[\"bufSize\",\"i\"],[\"params\",\"p\"]]],[\"glGetActiveAtomicCounterBufferiv\",\"v\",[[\"program\",\"u\"],[\"bufferIndex\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glBindImageTexture\",\"v\",[[\"unit\",\"u\"],[\"texture\",\"u\"],[\"level\",\"i\"],[\"layered\",\"b\"],[\"layer\",\"i\"],[\"acces",
+    "s\",\"e\"],[\"format\",\"e\"]]],[\"glMemoryBarrier\",\"v\",[[\"barriers\",\"x\"]]],[\"glTexStorage1D\",\"v\",[[\"target\",\"e\"],[\"levels\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"]]],[\"glTexStorage2D\",\"v\",[[\"target\",\"e\"],[\"levels\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glTexStorage3D\",\"v\",[[\"target\",\"e\"],[\"levels\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"]]],[\"glDrawTransformFeedbackInstanced\",\"v\",[[\"mode\",\"e\"],[\"id\",\"u\"],[\"instancecount\",\"i\"]]],[\"glDrawTransformFeedbackStreamInstanced\",\"v\",[[\"mode\",\"e\"],[\"id\",\"u\"],[\"stream\",\"u\"],[\"instancecount\",\"i\"]]],[\"glClearBufferData\",\"v\",[[\"target\",\"e\"],[\"internalformat\",\"e\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"data\",\"p\"]]],[\"glClearBufferSubData\",\"v\",[[\"target\",\"e\"],[\"internalformat\",\"e\"],[\"offset\",\"i\"],[\"size\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"data\",\"p\"]]],[\"glDispatchCompute\",\"v\",[[\"num_groups_x\",\"u\"],[\"num_groups_y\",\"u\"],[\"num_groups_z\",\"u\"]]],[\"glDispatchComputeIndirect\",\"v\",[[\"indirect\",\"i\"]]],[\"glCopyImageSubData\",\"v\",[[\"srcName\",\"u\"],[\"src",
+    "Target\",\"e\"],[\"srcLevel\",\"i\"],[\"srcX\",\"i\"],[\"srcY\",\"i\"],[\"srcZ\",\"i\"],[\"dstName\",\"u\"],[\"dstTarget\",\"e\"],[\"dstLevel\",\"i\"],[\"dstX\",\"i\"],[\"dstY\",\"i\"],[\"dstZ\",\"i\"],[\"srcWidth\",\"i\"],[\"srcHeight\",\"i\"],[\"srcDepth\",\"i\"]]],[\"glFramebufferParameteri\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"param\",\"i\"]]],[\"glGetFramebufferParameteriv\",\"v\",[[\"target\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetInternalformati64v\",\"v\",[[\"target\",\"e\"],[\"internalformat\",\"e\"],[\"pname\",\"e\"],[\"bufSize\",\"i\"],[\"params\",\"p\"]]],[\"glInvalidateTexSubImage\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"]]],[\"glInvalidateTexImage\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"]]],[\"glInvalidateBufferSubData\",\"v\",[[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"length\",\"i\"]]],[\"glInvalidateBufferData\",\"v\",[[\"buffer\",\"u\"]]],[\"glInvalidateFramebuffer\",\"v\",[[\"target\",\"e\"],[\"numAttachments\",\"i\"],[\"attachments\",\"p\"]]],[\"glInvalidateSubFramebuffer\",\"v\",[[\"target\",\"e\"],[\"numAttachments\",\"i\"],[\"attachments\",\"p\"],[\"x\",",
+    "\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glMultiDrawArraysIndirect\",\"v\",[[\"mode\",\"e\"],[\"indirect\",\"p\"],[\"drawcount\",\"i\"],[\"stride\",\"i\"]]],[\"glMultiDrawElementsIndirect\",\"v\",[[\"mode\",\"e\"],[\"type\",\"e\"],[\"indirect\",\"p\"],[\"drawcount\",\"i\"],[\"stride\",\"i\"]]],[\"glGetProgramInterfaceiv\",\"v\",[[\"program\",\"u\"],[\"programInterface\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetProgramResourceIndex\",\"u\",[[\"program\",\"u\"],[\"programInterface\",\"e\"],[\"name\",\"p\"]]],[\"glGetProgramResourceName\",\"v\",[[\"program\",\"u\"],[\"programInterface\",\"e\"],[\"index\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"name\",\"p\"]]],[\"glGetProgramResourceiv\",\"v\",[[\"program\",\"u\"],[\"programInterface\",\"e\"],[\"index\",\"u\"],[\"propCount\",\"i\"],[\"props\",\"p\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"params\",\"p\"]]],[\"glGetProgramResourceLocation\",\"i\",[[\"program\",\"u\"],[\"programInterface\",\"e\"],[\"name\",\"p\"]]],[\"glGetProgramResourceLocationIndex\",\"i\",[[\"program\",\"u\"],[\"programInterface\",\"e\"],[\"name\",\"p\"]]],[\"glShaderStorageBlockBinding\",\"v\",[[\"program\",\"u\"],[\"storageBlockIndex\",\"u\"],[\"",
+    "storageBlockBinding\",\"u\"]]],[\"glTexBufferRange\",\"v\",[[\"target\",\"e\"],[\"internalformat\",\"e\"],[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"size\",\"i\"]]],[\"glTexStorage2DMultisample\",\"v\",[[\"target\",\"e\"],[\"samples\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"fixedsamplelocations\",\"b\"]]],[\"glTexStorage3DMultisample\",\"v\",[[\"target\",\"e\"],[\"samples\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"fixedsamplelocations\",\"b\"]]],[\"glTextureView\",\"v\",[[\"texture\",\"u\"],[\"target\",\"e\"],[\"origtexture\",\"u\"],[\"internalformat\",\"e\"],[\"minlevel\",\"u\"],[\"numlevels\",\"u\"],[\"minlayer\",\"u\"],[\"numlayers\",\"u\"]]],[\"glBindVertexBuffer\",\"v\",[[\"bindingindex\",\"u\"],[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"stride\",\"i\"]]],[\"glVertexAttribFormat\",\"v\",[[\"attribindex\",\"u\"],[\"size\",\"i\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"relativeoffset\",\"u\"]]],[\"glVertexAttribIFormat\",\"v\",[[\"attribindex\",\"u\"],[\"size\",\"i\"],[\"type\",\"e\"],[\"relativeoffset\",\"u\"]]],[\"glVertexAttribLFormat\",\"v\",[[\"attribindex\",\"u\"],[\"size\",\"i\"],[\"type\",\"e\"],[\"relativeoffset\",\"",
+    "u\"]]],[\"glVertexAttribBinding\",\"v\",[[\"attribindex\",\"u\"],[\"bindingindex\",\"u\"]]],[\"glVertexBindingDivisor\",\"v\",[[\"bindingindex\",\"u\"],[\"divisor\",\"u\"]]],[\"glDebugMessageControl\",\"v\",[[\"source\",\"e\"],[\"type\",\"e\"],[\"severity\",\"e\"],[\"count\",\"i\"],[\"ids\",\"p\"],[\"enabled\",\"b\"]]],[\"glDebugMessageInsert\",\"v\",[[\"source\",\"e\"],[\"type\",\"e\"],[\"id\",\"u\"],[\"severity\",\"e\"],[\"length\",\"i\"],[\"buf\",\"p\"]]],[\"glDebugMessageCallback\",\"v\",[[\"callback\",\"p\"],[\"userParam\",\"p\"]]],[\"glGetDebugMessageLog\",\"u\",[[\"count\",\"u\"],[\"bufSize\",\"i\"],[\"sources\",\"p\"],[\"types\",\"p\"],[\"ids\",\"p\"],[\"severities\",\"p\"],[\"lengths\",\"p\"],[\"messageLog\",\"p\"]]],[\"glPushDebugGroup\",\"v\",[[\"source\",\"e\"],[\"id\",\"u\"],[\"length\",\"i\"],[\"message\",\"p\"]]],[\"glPopDebugGroup\",\"v\",[]],[\"glObjectLabel\",\"v\",[[\"identifier\",\"e\"],[\"name\",\"u\"],[\"length\",\"i\"],[\"label\",\"p\"]]],[\"glGetObjectLabel\",\"v\",[[\"identifier\",\"e\"],[\"name\",\"u\"],[\"bufSize\",\"i\"],[\"length\",\"p\"],[\"label\",\"p\"]]],[\"glObjectPtrLabel\",\"v\",[[\"ptr\",\"p\"],[\"length\",\"i\"],[\"label\",\"p\"]]],[\"glGetObjectPtrLabel\",\"v\",[[\"ptr\",\"p\"],[\"bufSize",
+    "\",\"i\"],[\"length\",\"p\"],[\"label\",\"p\"]]],[\"glBufferStorage\",\"v\",[[\"target\",\"e\"],[\"size\",\"i\"],[\"data\",\"p\"],[\"flags\",\"x\"]]],[\"glClearTexImage\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"data\",\"p\"]]],[\"glClearTexSubImage\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"data\",\"p\"]]],[\"glBindBuffersBase\",\"v\",[[\"target\",\"e\"],[\"first\",\"u\"],[\"count\",\"i\"],[\"buffers\",\"p\"]]],[\"glBindBuffersRange\",\"v\",[[\"target\",\"e\"],[\"first\",\"u\"],[\"count\",\"i\"],[\"buffers\",\"p\"],[\"offsets\",\"p\"],[\"sizes\",\"p\"]]],[\"glBindTextures\",\"v\",[[\"first\",\"u\"],[\"count\",\"i\"],[\"textures\",\"p\"]]],[\"glBindSamplers\",\"v\",[[\"first\",\"u\"],[\"count\",\"i\"],[\"samplers\",\"p\"]]],[\"glBindImageTextures\",\"v\",[[\"first\",\"u\"],[\"count\",\"i\"],[\"textures\",\"p\"]]],[\"glBindVertexBuffers\",\"v\",[[\"first\",\"u\"],[\"count\",\"i\"],[\"buffers\",\"p\"],[\"offsets\",\"p\"],[\"strides\",\"p\"]]],[\"glClipControl\",\"v\",[[\"origin\",\"e\"],[\"depth\",\"e\"]]],[\"glCreateTransformFeedbacks\",\"v\",[[\"n",
+    "\",\"i\"],[\"ids\",\"p\"]]],[\"glTransformFeedbackBufferBase\",\"v\",[[\"xfb\",\"u\"],[\"index\",\"u\"],[\"buffer\",\"u\"]]],[\"glTransformFeedbackBufferRange\",\"v\",[[\"xfb\",\"u\"],[\"index\",\"u\"],[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"size\",\"i\"]]],[\"glGetTransformFeedbackiv\",\"v\",[[\"xfb\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glGetTransformFeedbacki_v\",\"v\",[[\"xfb\",\"u\"],[\"pname\",\"e\"],[\"index\",\"u\"],[\"param\",\"p\"]]],[\"glGetTransformFeedbacki64_v\",\"v\",[[\"xfb\",\"u\"],[\"pname\",\"e\"],[\"index\",\"u\"],[\"param\",\"p\"]]],[\"glCreateBuffers\",\"v\",[[\"n\",\"i\"],[\"buffers\",\"p\"]]],[\"glNamedBufferStorage\",\"v\",[[\"buffer\",\"u\"],[\"size\",\"i\"],[\"data\",\"p\"],[\"flags\",\"x\"]]],[\"glNamedBufferData\",\"v\",[[\"buffer\",\"u\"],[\"size\",\"i\"],[\"data\",\"p\"],[\"usage\",\"e\"]]],[\"glNamedBufferSubData\",\"v\",[[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"size\",\"i\"],[\"data\",\"p\"]]],[\"glCopyNamedBufferSubData\",\"v\",[[\"readBuffer\",\"u\"],[\"writeBuffer\",\"u\"],[\"readOffset\",\"i\"],[\"writeOffset\",\"i\"],[\"size\",\"i\"]]],[\"glClearNamedBufferData\",\"v\",[[\"buffer\",\"u\"],[\"internalformat\",\"e\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"data\",\"p\"]]],[\"glClear",
+    "NamedBufferSubData\",\"v\",[[\"buffer\",\"u\"],[\"internalformat\",\"e\"],[\"offset\",\"i\"],[\"size\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"data\",\"p\"]]],[\"glMapNamedBuffer\",\"p\",[[\"buffer\",\"u\"],[\"access\",\"e\"]]],[\"glMapNamedBufferRange\",\"p\",[[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"length\",\"i\"],[\"access\",\"x\"]]],[\"glUnmapNamedBuffer\",\"b\",[[\"buffer\",\"u\"]]],[\"glFlushMappedNamedBufferRange\",\"v\",[[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"length\",\"i\"]]],[\"glGetNamedBufferParameteriv\",\"v\",[[\"buffer\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetNamedBufferParameteri64v\",\"v\",[[\"buffer\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetNamedBufferPointerv\",\"v\",[[\"buffer\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetNamedBufferSubData\",\"v\",[[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"size\",\"i\"],[\"data\",\"p\"]]],[\"glCreateFramebuffers\",\"v\",[[\"n\",\"i\"],[\"framebuffers\",\"p\"]]],[\"glNamedFramebufferRenderbuffer\",\"v\",[[\"framebuffer\",\"u\"],[\"attachment\",\"e\"],[\"renderbuffertarget\",\"e\"],[\"renderbuffer\",\"u\"]]],[\"glNamedFramebufferParameteri\",\"v\",[[\"framebuffer\",\"u\"],[\"pname\",\"e\"],[\"param\",\"i\"]]],",
+    "[\"glNamedFramebufferTexture\",\"v\",[[\"framebuffer\",\"u\"],[\"attachment\",\"e\"],[\"texture\",\"u\"],[\"level\",\"i\"]]],[\"glNamedFramebufferTextureLayer\",\"v\",[[\"framebuffer\",\"u\"],[\"attachment\",\"e\"],[\"texture\",\"u\"],[\"level\",\"i\"],[\"layer\",\"i\"]]],[\"glNamedFramebufferDrawBuffer\",\"v\",[[\"framebuffer\",\"u\"],[\"buf\",\"e\"]]],[\"glNamedFramebufferDrawBuffers\",\"v\",[[\"framebuffer\",\"u\"],[\"n\",\"i\"],[\"bufs\",\"p\"]]],[\"glNamedFramebufferReadBuffer\",\"v\",[[\"framebuffer\",\"u\"],[\"src\",\"e\"]]],[\"glInvalidateNamedFramebufferData\",\"v\",[[\"framebuffer\",\"u\"],[\"numAttachments\",\"i\"],[\"attachments\",\"p\"]]],[\"glInvalidateNamedFramebufferSubData\",\"v\",[[\"framebuffer\",\"u\"],[\"numAttachments\",\"i\"],[\"attachments\",\"p\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glClearNamedFramebufferiv\",\"v\",[[\"framebuffer\",\"u\"],[\"buffer\",\"e\"],[\"drawbuffer\",\"i\"],[\"value\",\"p\"]]],[\"glClearNamedFramebufferuiv\",\"v\",[[\"framebuffer\",\"u\"],[\"buffer\",\"e\"],[\"drawbuffer\",\"i\"],[\"value\",\"p\"]]],[\"glClearNamedFramebufferfv\",\"v\",[[\"framebuffer\",\"u\"],[\"buffer\",\"e\"],[\"drawbuffer\",\"i\"],[\"value\",",
+    "\"p\"]]],[\"glClearNamedFramebufferfi\",\"v\",[[\"framebuffer\",\"u\"],[\"buffer\",\"e\"],[\"drawbuffer\",\"i\"],[\"depth\",\"f\"],[\"stencil\",\"i\"]]],[\"glBlitNamedFramebuffer\",\"v\",[[\"readFramebuffer\",\"u\"],[\"drawFramebuffer\",\"u\"],[\"srcX0\",\"i\"],[\"srcY0\",\"i\"],[\"srcX1\",\"i\"],[\"srcY1\",\"i\"],[\"dstX0\",\"i\"],[\"dstY0\",\"i\"],[\"dstX1\",\"i\"],[\"dstY1\",\"i\"],[\"mask\",\"x\"],[\"filter\",\"e\"]]],[\"glCheckNamedFramebufferStatus\",\"e\",[[\"framebuffer\",\"u\"],[\"target\",\"e\"]]],[\"glGetNamedFramebufferParameteriv\",\"v\",[[\"framebuffer\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glGetNamedFramebufferAttachmentParameteriv\",\"v\",[[\"framebuffer\",\"u\"],[\"attachment\",\"e\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glCreateRenderbuffers\",\"v\",[[\"n\",\"i\"],[\"renderbuffers\",\"p\"]]],[\"glNamedRenderbufferStorage\",\"v\",[[\"renderbuffer\",\"u\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glNamedRenderbufferStorageMultisample\",\"v\",[[\"renderbuffer\",\"u\"],[\"samples\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glGetNamedRenderbufferParameteriv\",\"v\",[[\"renderbuffer\",\"u\"],[\"pname\",\"e\"],[",
+    "\"params\",\"p\"]]],[\"glCreateTextures\",\"v\",[[\"target\",\"e\"],[\"n\",\"i\"],[\"textures\",\"p\"]]],[\"glTextureBuffer\",\"v\",[[\"texture\",\"u\"],[\"internalformat\",\"e\"],[\"buffer\",\"u\"]]],[\"glTextureBufferRange\",\"v\",[[\"texture\",\"u\"],[\"internalformat\",\"e\"],[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"size\",\"i\"]]],[\"glTextureStorage1D\",\"v\",[[\"texture\",\"u\"],[\"levels\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"]]],[\"glTextureStorage2D\",\"v\",[[\"texture\",\"u\"],[\"levels\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glTextureStorage3D\",\"v\",[[\"texture\",\"u\"],[\"levels\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"]]],[\"glTextureStorage2DMultisample\",\"v\",[[\"texture\",\"u\"],[\"samples\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"fixedsamplelocations\",\"b\"]]],[\"glTextureStorage3DMultisample\",\"v\",[[\"texture\",\"u\"],[\"samples\",\"i\"],[\"internalformat\",\"e\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"fixedsamplelocations\",\"b\"]]],[\"glTextureSubImage1D\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"width\",\"i\"],[\"f",
+    "ormat\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glTextureSubImage2D\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glTextureSubImage3D\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"pixels\",\"p\"]]],[\"glCompressedTextureSubImage1D\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"width\",\"i\"],[\"format\",\"e\"],[\"imageSize\",\"i\"],[\"data\",\"p\"]]],[\"glCompressedTextureSubImage2D\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"format\",\"e\"],[\"imageSize\",\"i\"],[\"data\",\"p\"]]],[\"glCompressedTextureSubImage3D\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"format\",\"e\"],[\"imageSize\",\"i\"],[\"data\",\"p\"]]],[\"glCopyTextureSubImage1D\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"x\",\"i\"],[\"y\",\"",
+    "i\"],[\"width\",\"i\"]]],[\"glCopyTextureSubImage2D\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glCopyTextureSubImage3D\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"]]],[\"glTextureParameterf\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"param\",\"f\"]]],[\"glTextureParameterfv\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glTextureParameteri\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"param\",\"i\"]]],[\"glTextureParameterIiv\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glTextureParameterIuiv\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glTextureParameteriv\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glGenerateTextureMipmap\",\"v\",[[\"texture\",\"u\"]]],[\"glBindTextureUnit\",\"v\",[[\"unit\",\"u\"],[\"texture\",\"u\"]]],[\"glGetTextureImage\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"bufSize\",\"i\"],[\"pixels\",\"p\"]]],[\"glGetCompressedText",
+    "ureImage\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"bufSize\",\"i\"],[\"pixels\",\"p\"]]],[\"glGetTextureLevelParameterfv\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetTextureLevelParameteriv\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetTextureParameterfv\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetTextureParameterIiv\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetTextureParameterIuiv\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glGetTextureParameteriv\",\"v\",[[\"texture\",\"u\"],[\"pname\",\"e\"],[\"params\",\"p\"]]],[\"glCreateVertexArrays\",\"v\",[[\"n\",\"i\"],[\"arrays\",\"p\"]]],[\"glDisableVertexArrayAttrib\",\"v\",[[\"vaobj\",\"u\"],[\"index\",\"u\"]]],[\"glEnableVertexArrayAttrib\",\"v\",[[\"vaobj\",\"u\"],[\"index\",\"u\"]]],[\"glVertexArrayElementBuffer\",\"v\",[[\"vaobj\",\"u\"],[\"buffer\",\"u\"]]],[\"glVertexArrayVertexBuffer\",\"v\",[[\"vaobj\",\"u\"],[\"bindingindex\",\"u\"],[\"buffer\",\"u\"],[\"offset\",\"i\"],[\"stride\",\"i\"]]],[\"glVertexArrayVertexBuffers\",\"v\",[[\"vaobj\",\"u\"],[\"first\",\"u\"],[",
+    "\"count\",\"i\"],[\"buffers\",\"p\"],[\"offsets\",\"p\"],[\"strides\",\"p\"]]],[\"glVertexArrayAttribBinding\",\"v\",[[\"vaobj\",\"u\"],[\"attribindex\",\"u\"],[\"bindingindex\",\"u\"]]],[\"glVertexArrayAttribFormat\",\"v\",[[\"vaobj\",\"u\"],[\"attribindex\",\"u\"],[\"size\",\"i\"],[\"type\",\"e\"],[\"normalized\",\"b\"],[\"relativeoffset\",\"u\"]]],[\"glVertexArrayAttribIFormat\",\"v\",[[\"vaobj\",\"u\"],[\"attribindex\",\"u\"],[\"size\",\"i\"],[\"type\",\"e\"],[\"relativeoffset\",\"u\"]]],[\"glVertexArrayAttribLFormat\",\"v\",[[\"vaobj\",\"u\"],[\"attribindex\",\"u\"],[\"size\",\"i\"],[\"type\",\"e\"],[\"relativeoffset\",\"u\"]]],[\"glVertexArrayBindingDivisor\",\"v\",[[\"vaobj\",\"u\"],[\"bindingindex\",\"u\"],[\"divisor\",\"u\"]]],[\"glGetVertexArrayiv\",\"v\",[[\"vaobj\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glGetVertexArrayIndexediv\",\"v\",[[\"vaobj\",\"u\"],[\"index\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glGetVertexArrayIndexed64iv\",\"v\",[[\"vaobj\",\"u\"],[\"index\",\"u\"],[\"pname\",\"e\"],[\"param\",\"p\"]]],[\"glCreateSamplers\",\"v\",[[\"n\",\"i\"],[\"samplers\",\"p\"]]],[\"glCreateProgramPipelines\",\"v\",[[\"n\",\"i\"],[\"pipelines\",\"p\"]]],[\"glCreateQueries\",\"v\",[[\"ta",
+    "rget\",\"e\"],[\"n\",\"i\"],[\"ids\",\"p\"]]],[\"glGetQueryBufferObjecti64v\",\"v\",[[\"id\",\"u\"],[\"buffer\",\"u\"],[\"pname\",\"e\"],[\"offset\",\"i\"]]],[\"glGetQueryBufferObjectiv\",\"v\",[[\"id\",\"u\"],[\"buffer\",\"u\"],[\"pname\",\"e\"],[\"offset\",\"i\"]]],[\"glGetQueryBufferObjectui64v\",\"v\",[[\"id\",\"u\"],[\"buffer\",\"u\"],[\"pname\",\"e\"],[\"offset\",\"i\"]]],[\"glGetQueryBufferObjectuiv\",\"v\",[[\"id\",\"u\"],[\"buffer\",\"u\"],[\"pname\",\"e\"],[\"offset\",\"i\"]]],[\"glMemoryBarrierByRegion\",\"v\",[[\"barriers\",\"x\"]]],[\"glGetTextureSubImage\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"bufSize\",\"i\"],[\"pixels\",\"p\"]]],[\"glGetCompressedTextureSubImage\",\"v\",[[\"texture\",\"u\"],[\"level\",\"i\"],[\"xoffset\",\"i\"],[\"yoffset\",\"i\"],[\"zoffset\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"depth\",\"i\"],[\"bufSize\",\"i\"],[\"pixels\",\"p\"]]],[\"glGetGraphicsResetStatus\",\"e\",[]],[\"glGetnCompressedTexImage\",\"v\",[[\"target\",\"e\"],[\"lod\",\"i\"],[\"bufSize\",\"i\"],[\"pixels\",\"p\"]]],[\"glGetnTexImage\",\"v\",[[\"target\",\"e\"],[",
+    "\"level\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"bufSize\",\"i\"],[\"pixels\",\"p\"]]],[\"glGetnUniformdv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"bufSize\",\"i\"],[\"params\",\"p\"]]],[\"glGetnUniformfv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"bufSize\",\"i\"],[\"params\",\"p\"]]],[\"glGetnUniformiv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"bufSize\",\"i\"],[\"params\",\"p\"]]],[\"glGetnUniformuiv\",\"v\",[[\"program\",\"u\"],[\"location\",\"i\"],[\"bufSize\",\"i\"],[\"params\",\"p\"]]],[\"glReadnPixels\",\"v\",[[\"x\",\"i\"],[\"y\",\"i\"],[\"width\",\"i\"],[\"height\",\"i\"],[\"format\",\"e\"],[\"type\",\"e\"],[\"bufSize\",\"i\"],[\"data\",\"p\"]]],[\"glTextureBarrier\",\"v\",[]],[\"glSpecializeShader\",\"v\",[[\"shader\",\"u\"],[\"pEntryPoint\",\"p\"],[\"numSpecializationConstants\",\"u\"],[\"pConstantIndex\",\"p\"],[\"pConstantValue\",\"p\"]]],[\"glMultiDrawArraysIndirectCount\",\"v\",[[\"mode\",\"e\"],[\"indirect\",\"p\"],[\"drawcount\",\"i\"],[\"maxdrawcount\",\"i\"],[\"stride\",\"i\"]]],[\"glMultiDrawElementsIndirectCount\",\"v\",[[\"mode\",\"e\"],[\"type\",\"e\"],[\"indirect\",\"p\"],[\"drawcount\",\"i\"],[\"maxdrawcount\",\"i\"],[\"stride\",\"i\"]]],[\"glPolygonOffsetClam",
+    "p\",\"v\",[[\"factor\",\"f\"],[\"units\",\"f\"],[\"clamp\",\"f\"]]]],\"enums\":{\"512\":\"GL_NEVER\",\"513\":\"GL_LESS\",\"514\":\"GL_EQUAL\",\"515\":\"GL_LEQUAL\",\"516\":\"GL_GREATER\",\"517\":\"GL_NOTEQUAL\",\"518\":\"GL_GEQUAL\",\"519\":\"GL_ALWAYS\",\"768\":\"GL_SRC_COLOR\",\"769\":\"GL_ONE_MINUS_SRC_COLOR\",\"770\":\"GL_SRC_ALPHA\",\"771\":\"GL_ONE_MINUS_SRC_ALPHA\",\"772\":\"GL_DST_ALPHA\",\"773\":\"GL_ONE_MINUS_DST_ALPHA\",\"774\":\"GL_DST_COLOR\",\"775\":\"GL_ONE_MINUS_DST_COLOR\",\"776\":\"GL_SRC_ALPHA_SATURATE\",\"1024\":\"GL_FRONT_LEFT\",\"1025\":\"GL_FRONT_RIGHT\",\"1026\":\"GL_BACK_LEFT\",\"1027\":\"GL_BACK_RIGHT\",\"1028\":\"GL_FRONT\",\"1029\":\"GL_BACK\",\"1030\":\"GL_LEFT\",\"1031\":\"GL_RIGHT\",\"1032\":\"GL_FRONT_AND_BACK\",\"1280\":\"GL_INVALID_ENUM\",\"1281\":\"GL_INVALID_VALUE\",\"1282\":\"GL_INVALID_OPERATION\",\"1283\":\"GL_STACK_OVERFLOW\",\"1284\":\"GL_STACK_UNDERFLOW\",\"1285\":\"GL_OUT_OF_MEMORY\",\"1286\":\"GL_INVALID_FRAMEBUFFER_OPERATION\",\"1287\":\"GL_CONTEXT_LOST\",\"2304\":\"GL_CW\",\"2305\":\"GL_CCW\",\"2833\":\"GL_POINT_SIZE\",\"2834\":\"GL_POINT_SIZE_RANGE\",\"2835\":\"GL_POINT_SIZE_GRANULARITY\",\"2848\":\"GL_LINE_SMOOTH\",\"2849\":\"GL_LINE_WIDT",
+    "H\",\"2850\":\"GL_LINE_WIDTH_RANGE\",\"2851\":\"GL_LINE_WIDTH_GRANULARITY\",\"2880\":\"GL_POLYGON_MODE\",\"2881\":\"GL_POLYGON_SMOOTH\",\"2884\":\"GL_CULL_FACE\",\"2885\":\"GL_CULL_FACE_MODE\",\"2886\":\"GL_FRONT_FACE\",\"2928\":\"GL_DEPTH_RANGE\",\"2929\":\"GL_DEPTH_TEST\",\"2930\":\"GL_DEPTH_WRITEMASK\",\"2931\":\"GL_DEPTH_CLEAR_VALUE\",\"2932\":\"GL_DEPTH_FUNC\",\"2960\":\"GL_STENCIL_TEST\",\"2961\":\"GL_STENCIL_CLEAR_VALUE\",\"2962\":\"GL_STENCIL_FUNC\",\"2963\":\"GL_STENCIL_VALUE_MASK\",\"2964\":\"GL_STENCIL_FAIL\",\"2965\":\"GL_STENCIL_PASS_DEPTH_FAIL\",\"2966\":\"GL_STENCIL_PASS_DEPTH_PASS\",\"2967\":\"GL_STENCIL_REF\",\"2968\":\"GL_STENCIL_WRITEMASK\",\"2978\":\"GL_VIEWPORT\",\"3024\":\"GL_DITHER\",\"3040\":\"GL_BLEND_DST\",\"3041\":\"GL_BLEND_SRC\",\"3042\":\"GL_BLEND\",\"3056\":\"GL_LOGIC_OP_MODE\",\"3058\":\"GL_COLOR_LOGIC_OP\",\"3073\":\"GL_DRAW_BUFFER\",\"3074\":\"GL_READ_BUFFER\",\"3088\":\"GL_SCISSOR_BOX\",\"3089\":\"GL_SCISSOR_TEST\",\"3106\":\"GL_COLOR_CLEAR_VALUE\",\"3107\":\"GL_COLOR_WRITEMASK\",\"3122\":\"GL_DOUBLEBUFFER\",\"3123\":\"GL_STEREO\",\"3154\":\"GL_LINE_SMOOTH_HINT\",\"3155\":\"GL_POLYGON_SMOOTH_HINT\",\"3312\":\"GL_UNPACK_SWAP_BYT",
+    "ES\",\"3313\":\"GL_UNPACK_LSB_FIRST\",\"3314\":\"GL_UNPACK_ROW_LENGTH\",\"3315\":\"GL_UNPACK_SKIP_ROWS\",\"3316\":\"GL_UNPACK_SKIP_PIXELS\",\"3317\":\"GL_UNPACK_ALIGNMENT\",\"3328\":\"GL_PACK_SWAP_BYTES\",\"3329\":\"GL_PACK_LSB_FIRST\",\"3330\":\"GL_PACK_ROW_LENGTH\",\"3331\":\"GL_PACK_SKIP_ROWS\",\"3332\":\"GL_PACK_SKIP_PIXELS\",\"3333\":\"GL_PACK_ALIGNMENT\",\"3378\":\"GL_MAX_CLIP_DISTANCES\",\"3379\":\"GL_MAX_TEXTURE_SIZE\",\"3386\":\"GL_MAX_VIEWPORT_DIMS\",\"3408\":\"GL_SUBPIXEL_BITS\",\"3552\":\"GL_TEXTURE_1D\",\"3553\":\"GL_TEXTURE_2D\",\"4096\":\"GL_TEXTURE_WIDTH\",\"4097\":\"GL_TEXTURE_HEIGHT\",\"4099\":\"GL_TEXTURE_INTERNAL_FORMAT\",\"4100\":\"GL_TEXTURE_BORDER_COLOR\",\"4102\":\"GL_TEXTURE_TARGET\",\"4352\":\"GL_DONT_CARE\",\"4353\":\"GL_FASTEST\",\"4354\":\"GL_NICEST\",\"5120\":\"GL_BYTE\",\"5121\":\"GL_UNSIGNED_BYTE\",\"5122\":\"GL_SHORT\",\"5123\":\"GL_UNSIGNED_SHORT\",\"5124\":\"GL_INT\",\"5125\":\"GL_UNSIGNED_INT\",\"5126\":\"GL_FLOAT\",\"5130\":\"GL_DOUBLE\",\"5131\":\"GL_HALF_FLOAT\",\"5132\":\"GL_FIXED\",\"5376\":\"GL_CLEAR\",\"5377\":\"GL_AND\",\"5378\":\"GL_AND_REVERSE\",\"5379\":\"GL_COPY\",\"5380\":\"GL_AND_INVERTED\",\"5381\":\"GL_NOOP\",\"5382\":\"GL",
+    "_XOR\",\"5383\":\"GL_OR\",\"5384\":\"GL_NOR\",\"5385\":\"GL_EQUIV\",\"5386\":\"GL_INVERT\",\"5387\":\"GL_OR_REVERSE\",\"5388\":\"GL_COPY_INVERTED\",\"5389\":\"GL_OR_INVERTED\",\"5390\":\"GL_NAND\",\"5391\":\"GL_SET\",\"5890\":\"GL_TEXTURE\",\"6144\":\"GL_COLOR\",\"6145\":\"GL_DEPTH\",\"6146\":\"GL_STENCIL\",\"6401\":\"GL_STENCIL_INDEX\",\"6402\":\"GL_DEPTH_COMPONENT\",\"6403\":\"GL_RED\",\"6404\":\"GL_GREEN\",\"6405\":\"GL_BLUE\",\"6406\":\"GL_ALPHA\",\"6407\":\"GL_RGB\",\"6408\":\"GL_RGBA\",\"6912\":\"GL_POINT\",\"6913\":\"GL_LINE\",\"6914\":\"GL_FILL\",\"7680\":\"GL_KEEP\",\"7681\":\"GL_REPLACE\",\"7682\":\"GL_INCR\",\"7683\":\"GL_DECR\",\"7936\":\"GL_VENDOR\",\"7937\":\"GL_RENDERER\",\"7938\":\"GL_VERSION\",\"7939\":\"GL_EXTENSIONS\",\"9728\":\"GL_NEAREST\",\"9729\":\"GL_LINEAR\",\"9984\":\"GL_NEAREST_MIPMAP_NEAREST\",\"9985\":\"GL_LINEAR_MIPMAP_NEAREST\",\"9986\":\"GL_NEAREST_MIPMAP_LINEAR\",\"9987\":\"GL_LINEAR_MIPMAP_LINEAR\",\"10240\":\"GL_TEXTURE_MAG_FILTER\",\"10241\":\"GL_TEXTURE_MIN_FILTER\",\"10242\":\"GL_TEXTURE_WRAP_S\",\"10243\":\"GL_TEXTURE_WRAP_T\",\"10497\":\"GL_REPEAT\",\"10752\":\"GL_POLYGON_OFFSET_UNITS\",\"10753\":\"GL_POLYGON_OFFSET_POINT\",\"10754\":\"GL_POLYGON_OFF",
+    "SET_LINE\",\"10768\":\"GL_R3_G3_B2\",\"12288\":\"GL_CLIP_DISTANCE0\",\"12289\":\"GL_CLIP_DISTANCE1\",\"12290\":\"GL_CLIP_DISTANCE2\",\"12291\":\"GL_CLIP_DISTANCE3\",\"12292\":\"GL_CLIP_DISTANCE4\",\"12293\":\"GL_CLIP_DISTANCE5\",\"12294\":\"GL_CLIP_DISTANCE6\",\"12295\":\"GL_CLIP_DISTANCE7\",\"32769\":\"GL_CONSTANT_COLOR\",\"32770\":\"GL_ONE_MINUS_CONSTANT_COLOR\",\"32771\":\"GL_CONSTANT_ALPHA\",\"32772\":\"GL_ONE_MINUS_CONSTANT_ALPHA\",\"32773\":\"GL_BLEND_COLOR\",\"32774\":\"GL_FUNC_ADD\",\"32775\":\"GL_MIN\",\"32776\":\"GL_MAX\",\"32777\":\"GL_BLEND_EQUATION\",\"32778\":\"GL_FUNC_SUBTRACT\",\"32779\":\"GL_FUNC_REVERSE_SUBTRACT\",\"32818\":\"GL_UNSIGNED_BYTE_3_3_2\",\"32819\":\"GL_UNSIGNED_SHORT_4_4_4_4\",\"32820\":\"GL_UNSIGNED_SHORT_5_5_5_1\",\"32821\":\"GL_UNSIGNED_INT_8_8_8_8\",\"32822\":\"GL_UNSIGNED_INT_10_10_10_2\",\"32823\":\"GL_POLYGON_OFFSET_FILL\",\"32824\":\"GL_POLYGON_OFFSET_FACTOR\",\"32847\":\"GL_RGB4\",\"32848\":\"GL_RGB5\",\"32849\":\"GL_RGB8\",\"32850\":\"GL_RGB10\",\"32851\":\"GL_RGB12\",\"32852\":\"GL_RGB16\",\"32853\":\"GL_RGBA2\",\"32854\":\"GL_RGBA4\",\"32855\":\"GL_RGB5_A1\",\"32856\":\"GL_RGBA8\",\"32857\":\"GL_RGB10_A2\",\"32858\":\"G",
+    "L_RGBA12\",\"32859\":\"GL_RGBA16\",\"32860\":\"GL_TEXTURE_RED_SIZE\",\"32861\":\"GL_TEXTURE_GREEN_SIZE\",\"32862\":\"GL_TEXTURE_BLUE_SIZE\",\"32863\":\"GL_TEXTURE_ALPHA_SIZE\",\"32867\":\"GL_PROXY_TEXTURE_1D\",\"32868\":\"GL_PROXY_TEXTURE_2D\",\"32872\":\"GL_TEXTURE_BINDING_1D\",\"32873\":\"GL_TEXTURE_BINDING_2D\",\"32874\":\"GL_TEXTURE_BINDING_3D\",\"32875\":\"GL_PACK_SKIP_IMAGES\",\"32876\":\"GL_PACK_IMAGE_HEIGHT\",\"32877\":\"GL_UNPACK_SKIP_IMAGES\",\"32878\":\"GL_UNPACK_IMAGE_HEIGHT\",\"32879\":\"GL_TEXTURE_3D\",\"32880\":\"GL_PROXY_TEXTURE_3D\",\"32881\":\"GL_TEXTURE_DEPTH\",\"32882\":\"GL_TEXTURE_WRAP_R\",\"32883\":\"GL_MAX_3D_TEXTURE_SIZE\",\"32884\":\"GL_VERTEX_ARRAY\",\"32925\":\"GL_MULTISAMPLE\",\"32926\":\"GL_SAMPLE_ALPHA_TO_COVERAGE\",\"32927\":\"GL_SAMPLE_ALPHA_TO_ONE\",\"32928\":\"GL_SAMPLE_COVERAGE\",\"32936\":\"GL_SAMPLE_BUFFERS\",\"32937\":\"GL_SAMPLES\",\"32938\":\"GL_SAMPLE_COVERAGE_VALUE\",\"32939\":\"GL_SAMPLE_COVERAGE_INVERT\",\"32968\":\"GL_BLEND_DST_RGB\",\"32969\":\"GL_BLEND_SRC_RGB\",\"32970\":\"GL_BLEND_DST_ALPHA\",\"32971\":\"GL_BLEND_SRC_ALPHA\",\"32992\":\"GL_BGR\",\"32993\":\"GL_BGRA\",\"33000\":\"GL_MAX_ELEMENTS_VE",
+    "RTICES\",\"33001\":\"GL_MAX_ELEMENTS_INDICES\",\"33006\":\"GL_PARAMETER_BUFFER\",\"33007\":\"GL_PARAMETER_BUFFER_BINDING\",\"33064\":\"GL_POINT_FADE_THRESHOLD_SIZE\",\"33069\":\"GL_CLAMP_TO_BORDER\",\"33071\":\"GL_CLAMP_TO_EDGE\",\"33082\":\"GL_TEXTURE_MIN_LOD\",\"33083\":\"GL_TEXTURE_MAX_LOD\",\"33084\":\"GL_TEXTURE_BASE_LEVEL\",\"33085\":\"GL_TEXTURE_MAX_LEVEL\",\"33189\":\"GL_DEPTH_COMPONENT16\",\"33190\":\"GL_DEPTH_COMPONENT24\",\"33191\":\"GL_DEPTH_COMPONENT32\",\"33296\":\"GL_FRAMEBUFFER_ATTACHMENT_COLOR_ENCODING\",\"33297\":\"GL_FRAMEBUFFER_ATTACHMENT_COMPONENT_TYPE\",\"33298\":\"GL_FRAMEBUFFER_ATTACHMENT_RED_SIZE\",\"33299\":\"GL_FRAMEBUFFER_ATTACHMENT_GREEN_SIZE\",\"33300\":\"GL_FRAMEBUFFER_ATTACHMENT_BLUE_SIZE\",\"33301\":\"GL_FRAMEBUFFER_ATTACHMENT_ALPHA_SIZE\",\"33302\":\"GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE\",\"33303\":\"GL_FRAMEBUFFER_ATTACHMENT_STENCIL_SIZE\",\"33304\":\"GL_FRAMEBUFFER_DEFAULT\",\"33305\":\"GL_FRAMEBUFFER_UNDEFINED\",\"33306\":\"GL_DEPTH_STENCIL_ATTACHMENT\",\"33307\":\"GL_MAJOR_VERSION\",\"33308\":\"GL_MINOR_VERSION\",\"33309\":\"GL_NUM_EXTENSIONS\",\"33310\":\"GL_CONTEXT_FLAGS\",\"33311\"",
+    ":\"GL_BUFFER_IMMUTABLE_STORAGE\",\"33312\":\"GL_BUFFER_STORAGE_FLAGS\",\"33313\":\"GL_PRIMITIVE_RESTART_FOR_PATCHES_SUPPORTED\",\"33317\":\"GL_COMPRESSED_RED\",\"33318\":\"GL_COMPRESSED_RG\",\"33319\":\"GL_RG\",\"33320\":\"GL_RG_INTEGER\",\"33321\":\"GL_R8\",\"33322\":\"GL_R16\",\"33323\":\"GL_RG8\",\"33324\":\"GL_RG16\",\"33325\":\"GL_R16F\",\"33326\":\"GL_R32F\",\"33327\":\"GL_RG16F\",\"33328\":\"GL_RG32F\",\"33329\":\"GL_R8I\",\"33330\":\"GL_R8UI\",\"33331\":\"GL_R16I\",\"33332\":\"GL_R16UI\",\"33333\":\"GL_R32I\",\"33334\":\"GL_R32UI\",\"33335\":\"GL_RG8I\",\"33336\":\"GL_RG8UI\",\"33337\":\"GL_RG16I\",\"33338\":\"GL_RG16UI\",\"33339\":\"GL_RG32I\",\"33340\":\"GL_RG32UI\",\"33346\":\"GL_DEBUG_OUTPUT_SYNCHRONOUS\",\"33347\":\"GL_DEBUG_NEXT_LOGGED_MESSAGE_LENGTH\",\"33348\":\"GL_DEBUG_CALLBACK_FUNCTION\",\"33349\":\"GL_DEBUG_CALLBACK_USER_PARAM\",\"33350\":\"GL_DEBUG_SOURCE_API\",\"33351\":\"GL_DEBUG_SOURCE_WINDOW_SYSTEM\",\"33352\":\"GL_DEBUG_SOURCE_SHADER_COMPILER\",\"33353\":\"GL_DEBUG_SOURCE_THIRD_PARTY\",\"33354\":\"GL_DEBUG_SOURCE_APPLICATION\",\"33355\":\"GL_DEBUG_SOURCE_OTHER\",\"33356\":\"GL_DEBUG_TYPE_ERROR\",\"33357\":\"GL_DEBUG_TYPE_DEPRECATED_B",
+    "EHAVIOR\",\"33358\":\"GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR\",\"33359\":\"GL_DEBUG_TYPE_PORTABILITY\",\"33360\":\"GL_DEBUG_TYPE_PERFORMANCE\",\"33361\":\"GL_DEBUG_TYPE_OTHER\",\"33362\":\"GL_LOSE_CONTEXT_ON_RESET\",\"33363\":\"GL_GUILTY_CONTEXT_RESET\",\"33364\":\"GL_INNOCENT_CONTEXT_RESET\",\"33365\":\"GL_UNKNOWN_CONTEXT_RESET\",\"33366\":\"GL_RESET_NOTIFICATION_STRATEGY\",\"33367\":\"GL_PROGRAM_BINARY_RETRIEVABLE_HINT\",\"33368\":\"GL_PROGRAM_SEPARABLE\",\"33369\":\"GL_ACTIVE_PROGRAM\",\"33370\":\"GL_PROGRAM_PIPELINE_BINDING\",\"33371\":\"GL_MAX_VIEWPORTS\",\"33372\":\"GL_VIEWPORT_SUBPIXEL_BITS\",\"33373\":\"GL_VIEWPORT_BOUNDS_RANGE\",\"33374\":\"GL_LAYER_PROVOKING_VERTEX\",\"33375\":\"GL_VIEWPORT_INDEX_PROVOKING_VERTEX\",\"33376\":\"GL_UNDEFINED_VERTEX\",\"33377\":\"GL_NO_RESET_NOTIFICATION\",\"33378\":\"GL_MAX_COMPUTE_SHARED_MEMORY_SIZE\",\"33379\":\"GL_MAX_COMPUTE_UNIFORM_COMPONENTS\",\"33380\":\"GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS\",\"33381\":\"GL_MAX_COMPUTE_ATOMIC_COUNTERS\",\"33382\":\"GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS\",\"33383\":\"GL_COMPUTE_WORK_GROUP_SIZE\",\"33384\":\"GL_DEBUG_TYPE_MARKER\",\"3338",
+    "5\":\"GL_DEBUG_TYPE_PUSH_GROUP\",\"33386\":\"GL_DEBUG_TYPE_POP_GROUP\",\"33387\":\"GL_DEBUG_SEVERITY_NOTIFICATION\",\"33388\":\"GL_MAX_DEBUG_GROUP_STACK_DEPTH\",\"33389\":\"GL_DEBUG_GROUP_STACK_DEPTH\",\"33390\":\"GL_MAX_UNIFORM_LOCATIONS\",\"33391\":\"GL_INTERNALFORMAT_SUPPORTED\",\"33392\":\"GL_INTERNALFORMAT_PREFERRED\",\"33393\":\"GL_INTERNALFORMAT_RED_SIZE\",\"33394\":\"GL_INTERNALFORMAT_GREEN_SIZE\",\"33395\":\"GL_INTERNALFORMAT_BLUE_SIZE\",\"33396\":\"GL_INTERNALFORMAT_ALPHA_SIZE\",\"33397\":\"GL_INTERNALFORMAT_DEPTH_SIZE\",\"33398\":\"GL_INTERNALFORMAT_STENCIL_SIZE\",\"33399\":\"GL_INTERNALFORMAT_SHARED_SIZE\",\"33400\":\"GL_INTERNALFORMAT_RED_TYPE\",\"33401\":\"GL_INTERNALFORMAT_GREEN_TYPE\",\"33402\":\"GL_INTERNALFORMAT_BLUE_TYPE\",\"33403\":\"GL_INTERNALFORMAT_ALPHA_TYPE\",\"33404\":\"GL_INTERNALFORMAT_DEPTH_TYPE\",\"33405\":\"GL_INTERNALFORMAT_STENCIL_TYPE\",\"33406\":\"GL_MAX_WIDTH\",\"33407\":\"GL_MAX_HEIGHT\",\"33408\":\"GL_MAX_DEPTH\",\"33409\":\"GL_MAX_LAYERS\",\"33410\":\"GL_MAX_COMBINED_DIMENSIONS\",\"33411\":\"GL_COLOR_COMPONENTS\",\"33412\":\"GL_DEPTH_COMPONENTS\",\"33413\":\"GL_STENCIL_COMPONENTS\",\"",
+    "33414\":\"GL_COLOR_RENDERABLE\",\"33415\":\"GL_DEPTH_RENDERABLE\",\"33416\":\"GL_STENCIL_RENDERABLE\",\"33417\":\"GL_FRAMEBUFFER_RENDERABLE\",\"33418\":\"GL_FRAMEBUFFER_RENDERABLE_LAYERED\",\"33419\":\"GL_FRAMEBUFFER_BLEND\",\"33420\":\"GL_READ_PIXELS\",\"33421\":\"GL_READ_PIXELS_FORMAT\",\"33422\":\"GL_READ_PIXELS_TYPE\",\"33423\":\"GL_TEXTURE_IMAGE_FORMAT\",\"33424\":\"GL_TEXTURE_IMAGE_TYPE\",\"33425\":\"GL_GET_TEXTURE_IMAGE_FORMAT\",\"33426\":\"GL_GET_TEXTURE_IMAGE_TYPE\",\"33427\":\"GL_MIPMAP\",\"33428\":\"GL_MANUAL_GENERATE_MIPMAP\",\"33429\":\"GL_AUTO_GENERATE_MIPMAP\",\"33430\":\"GL_COLOR_ENCODING\",\"33431\":\"GL_SRGB_READ\",\"33432\":\"GL_SRGB_WRITE\",\"33434\":\"GL_FILTER\",\"33435\":\"GL_VERTEX_TEXTURE\",\"33436\":\"GL_TESS_CONTROL_TEXTURE\",\"33437\":\"GL_TESS_EVALUATION_TEXTURE\",\"33438\":\"GL_GEOMETRY_TEXTURE\",\"33439\":\"GL_FRAGMENT_TEXTURE\",\"33440\":\"GL_COMPUTE_TEXTURE\",\"33441\":\"GL_TEXTURE_SHADOW\",\"33442\":\"GL_TEXTURE_GATHER\",\"33443\":\"GL_TEXTURE_GATHER_SHADOW\",\"33444\":\"GL_SHADER_IMAGE_LOAD\",\"33445\":\"GL_SHADER_IMAGE_STORE\",\"33446\":\"GL_SHADER_IMAGE_ATOMIC\",\"33447\":\"GL_IMAGE_TEXEL_SIZE\",\"3344",
+    "8\":\"GL_IMAGE_COMPATIBILITY_CLASS\",\"33449\":\"GL_IMAGE_PIXEL_FORMAT\",\"33450\":\"GL_IMAGE_PIXEL_TYPE\",\"33452\":\"GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_TEST\",\"33453\":\"GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_TEST\",\"33454\":\"GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_WRITE\",\"33455\":\"GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_WRITE\",\"33457\":\"GL_TEXTURE_COMPRESSED_BLOCK_WIDTH\",\"33458\":\"GL_TEXTURE_COMPRESSED_BLOCK_HEIGHT\",\"33459\":\"GL_TEXTURE_COMPRESSED_BLOCK_SIZE\",\"33460\":\"GL_CLEAR_BUFFER\",\"33461\":\"GL_TEXTURE_VIEW\",\"33462\":\"GL_VIEW_COMPATIBILITY_CLASS\",\"33463\":\"GL_FULL_SUPPORT\",\"33464\":\"GL_CAVEAT_SUPPORT\",\"33465\":\"GL_IMAGE_CLASS_4_X_32\",\"33466\":\"GL_IMAGE_CLASS_2_X_32\",\"33467\":\"GL_IMAGE_CLASS_1_X_32\",\"33468\":\"GL_IMAGE_CLASS_4_X_16\",\"33469\":\"GL_IMAGE_CLASS_2_X_16\",\"33470\":\"GL_IMAGE_CLASS_1_X_16\",\"33471\":\"GL_IMAGE_CLASS_4_X_8\",\"33472\":\"GL_IMAGE_CLASS_2_X_8\",\"33473\":\"GL_IMAGE_CLASS_1_X_8\",\"33474\":\"GL_IMAGE_CLASS_11_11_10\",\"33475\":\"GL_IMAGE_CLASS_10_10_10_2\",\"33476\":\"GL_VIEW_CLASS_128_BITS\",\"33477\":\"GL_VIEW_CLASS_96_BITS\",\"33478\":\"GL_VIEW_CLASS_64_BITS",
+    "\",\"33479\":\"GL_VIEW_CLASS_48_BITS\",\"33480\":\"GL_VIEW_CLASS_32_BITS\",\"33481\":\"GL_VIEW_CLASS_24_BITS\",\"33482\":\"GL_VIEW_CLASS_16_BITS\",\"33483\":\"GL_VIEW_CLASS_8_BITS\",\"33484\":\"GL_VIEW_CLASS_S3TC_DXT1_RGB\",\"33485\":\"GL_VIEW_CLASS_S3TC_DXT1_RGBA\",\"33486\":\"GL_VIEW_CLASS_S3TC_DXT3_RGBA\",\"33487\":\"GL_VIEW_CLASS_S3TC_DXT5_RGBA\",\"33488\":\"GL_VIEW_CLASS_RGTC1_RED\",\"33489\":\"GL_VIEW_CLASS_RGTC2_RG\",\"33490\":\"GL_VIEW_CLASS_BPTC_UNORM\",\"33491\":\"GL_VIEW_CLASS_BPTC_FLOAT\",\"33492\":\"GL_VERTEX_ATTRIB_BINDING\",\"33493\":\"GL_VERTEX_ATTRIB_RELATIVE_OFFSET\",\"33494\":\"GL_VERTEX_BINDING_DIVISOR\",\"33495\":\"GL_VERTEX_BINDING_OFFSET\",\"33496\":\"GL_VERTEX_BINDING_STRIDE\",\"33497\":\"GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET\",\"33498\":\"GL_MAX_VERTEX_ATTRIB_BINDINGS\",\"33499\":\"GL_TEXTURE_VIEW_MIN_LEVEL\",\"33500\":\"GL_TEXTURE_VIEW_NUM_LEVELS\",\"33501\":\"GL_TEXTURE_VIEW_MIN_LAYER\",\"33502\":\"GL_TEXTURE_VIEW_NUM_LAYERS\",\"33503\":\"GL_TEXTURE_IMMUTABLE_LEVELS\",\"33504\":\"GL_BUFFER\",\"33505\":\"GL_SHADER\",\"33506\":\"GL_PROGRAM\",\"33507\":\"GL_QUERY\",\"33508\":\"GL_PROGRAM_PIPELINE\",\"33509",
+    "\":\"GL_MAX_VERTEX_ATTRIB_STRIDE\",\"33510\":\"GL_SAMPLER\",\"33512\":\"GL_MAX_LABEL_LENGTH\",\"33513\":\"GL_NUM_SHADING_LANGUAGE_VERSIONS\",\"33514\":\"GL_QUERY_TARGET\",\"33516\":\"GL_TRANSFORM_FEEDBACK_OVERFLOW\",\"33517\":\"GL_TRANSFORM_FEEDBACK_STREAM_OVERFLOW\",\"33518\":\"GL_VERTICES_SUBMITTED\",\"33519\":\"GL_PRIMITIVES_SUBMITTED\",\"33520\":\"GL_VERTEX_SHADER_INVOCATIONS\",\"33521\":\"GL_TESS_CONTROL_SHADER_PATCHES\",\"33522\":\"GL_TESS_EVALUATION_SHADER_INVOCATIONS\",\"33523\":\"GL_GEOMETRY_SHADER_PRIMITIVES_EMITTED\",\"33524\":\"GL_FRAGMENT_SHADER_INVOCATIONS\",\"33525\":\"GL_COMPUTE_SHADER_INVOCATIONS\",\"33526\":\"GL_CLIPPING_INPUT_PRIMITIVES\",\"33527\":\"GL_CLIPPING_OUTPUT_PRIMITIVES\",\"33529\":\"GL_MAX_CULL_DISTANCES\",\"33530\":\"GL_MAX_COMBINED_CLIP_AND_CULL_DISTANCES\",\"33531\":\"GL_CONTEXT_RELEASE_BEHAVIOR\",\"33532\":\"GL_CONTEXT_RELEASE_BEHAVIOR_FLUSH\",\"33634\":\"GL_UNSIGNED_BYTE_2_3_3_REV\",\"33635\":\"GL_UNSIGNED_SHORT_5_6_5\",\"33636\":\"GL_UNSIGNED_SHORT_5_6_5_REV\",\"33637\":\"GL_UNSIGNED_SHORT_4_4_4_4_REV\",\"33638\":\"GL_UNSIGNED_SHORT_1_5_5_5_REV\",\"33639\":\"GL_UNSIGNED_INT_8_8",
+    "_8_8_REV\",\"33640\":\"GL_UNSIGNED_INT_2_10_10_10_REV\",\"33648\":\"GL_MIRRORED_REPEAT\",\"33902\":\"GL_ALIASED_LINE_WIDTH_RANGE\",\"33984\":\"GL_TEXTURE0\",\"33985\":\"GL_TEXTURE1\",\"33986\":\"GL_TEXTURE2\",\"33987\":\"GL_TEXTURE3\",\"33988\":\"GL_TEXTURE4\",\"33989\":\"GL_TEXTURE5\",\"33990\":\"GL_TEXTURE6\",\"33991\":\"GL_TEXTURE7\",\"33992\":\"GL_TEXTURE8\",\"33993\":\"GL_TEXTURE9\",\"33994\":\"GL_TEXTURE10\",\"33995\":\"GL_TEXTURE11\",\"33996\":\"GL_TEXTURE12\",\"33997\":\"GL_TEXTURE13\",\"33998\":\"GL_TEXTURE14\",\"33999\":\"GL_TEXTURE15\",\"34000\":\"GL_TEXTURE16\",\"34001\":\"GL_TEXTURE17\",\"34002\":\"GL_TEXTURE18\",\"34003\":\"GL_TEXTURE19\",\"34004\":\"GL_TEXTURE20\",\"34005\":\"GL_TEXTURE21\",\"34006\":\"GL_TEXTURE22\",\"34007\":\"GL_TEXTURE23\",\"34008\":\"GL_TEXTURE24\",\"34009\":\"GL_TEXTURE25\",\"34010\":\"GL_TEXTURE26\",\"34011\":\"GL_TEXTURE27\",\"34012\":\"GL_TEXTURE28\",\"34013\":\"GL_TEXTURE29\",\"34014\":\"GL_TEXTURE30\",\"34015\":\"GL_TEXTURE31\",\"34016\":\"GL_ACTIVE_TEXTURE\",\"34024\":\"GL_MAX_RENDERBUFFER_SIZE\",\"34029\":\"GL_COMPRESSED_RGB\",\"34030\":\"GL_COMPRESSED_RGBA\",\"34031\":\"GL_TEXTURE_COMPRESSION_HINT\",\"34032\":\"GL_UNIFORM_BL",
+    "OCK_REFERENCED_BY_TESS_CONTROL_SHADER\",\"34033\":\"GL_UNIFORM_BLOCK_REFERENCED_BY_TESS_EVALUATION_SHADER\",\"34037\":\"GL_TEXTURE_RECTANGLE\",\"34038\":\"GL_TEXTURE_BINDING_RECTANGLE\",\"34039\":\"GL_PROXY_TEXTURE_RECTANGLE\",\"34040\":\"GL_MAX_RECTANGLE_TEXTURE_SIZE\",\"34041\":\"GL_DEPTH_STENCIL\",\"34042\":\"GL_UNSIGNED_INT_24_8\",\"34045\":\"GL_MAX_TEXTURE_LOD_BIAS\",\"34046\":\"GL_TEXTURE_MAX_ANISOTROPY\",\"34047\":\"GL_MAX_TEXTURE_MAX_ANISOTROPY\",\"34049\":\"GL_TEXTURE_LOD_BIAS\",\"34055\":\"GL_INCR_WRAP\",\"34056\":\"GL_DECR_WRAP\",\"34067\":\"GL_TEXTURE_CUBE_MAP\",\"34068\":\"GL_TEXTURE_BINDING_CUBE_MAP\",\"34069\":\"GL_TEXTURE_CUBE_MAP_POSITIVE_X\",\"34070\":\"GL_TEXTURE_CUBE_MAP_NEGATIVE_X\",\"34071\":\"GL_TEXTURE_CUBE_MAP_POSITIVE_Y\",\"34072\":\"GL_TEXTURE_CUBE_MAP_NEGATIVE_Y\",\"34073\":\"GL_TEXTURE_CUBE_MAP_POSITIVE_Z\",\"34074\":\"GL_TEXTURE_CUBE_MAP_NEGATIVE_Z\",\"34075\":\"GL_PROXY_TEXTURE_CUBE_MAP\",\"34076\":\"GL_MAX_CUBE_MAP_TEXTURE_SIZE\",\"34185\":\"GL_SRC1_ALPHA\",\"34229\":\"GL_VERTEX_ARRAY_BINDING\",\"34338\":\"GL_VERTEX_ATTRIB_ARRAY_ENABLED\",\"34339\":\"GL_VERTEX_ATTRIB_ARRAY_SIZE\",\"343",
+    "40\":\"GL_VERTEX_ATTRIB_ARRAY_STRIDE\",\"34341\":\"GL_VERTEX_ATTRIB_ARRAY_TYPE\",\"34342\":\"GL_CURRENT_VERTEX_ATTRIB\",\"34370\":\"GL_VERTEX_PROGRAM_POINT_SIZE\",\"34373\":\"GL_VERTEX_ATTRIB_ARRAY_POINTER\",\"34383\":\"GL_DEPTH_CLAMP\",\"34464\":\"GL_TEXTURE_COMPRESSED_IMAGE_SIZE\",\"34465\":\"GL_TEXTURE_COMPRESSED\",\"34466\":\"GL_NUM_COMPRESSED_TEXTURE_FORMATS\",\"34467\":\"GL_COMPRESSED_TEXTURE_FORMATS\",\"34625\":\"GL_PROGRAM_BINARY_LENGTH\",\"34627\":\"GL_MIRROR_CLAMP_TO_EDGE\",\"34638\":\"GL_VERTEX_ATTRIB_ARRAY_LONG\",\"34660\":\"GL_BUFFER_SIZE\",\"34661\":\"GL_BUFFER_USAGE\",\"34814\":\"GL_NUM_PROGRAM_BINARY_FORMATS\",\"34815\":\"GL_PROGRAM_BINARY_FORMATS\",\"34816\":\"GL_STENCIL_BACK_FUNC\",\"34817\":\"GL_STENCIL_BACK_FAIL\",\"34818\":\"GL_STENCIL_BACK_PASS_DEPTH_FAIL\",\"34819\":\"GL_STENCIL_BACK_PASS_DEPTH_PASS\",\"34836\":\"GL_RGBA32F\",\"34837\":\"GL_RGB32F\",\"34842\":\"GL_RGBA16F\",\"34843\":\"GL_RGB16F\",\"34852\":\"GL_MAX_DRAW_BUFFERS\",\"34853\":\"GL_DRAW_BUFFER0\",\"34854\":\"GL_DRAW_BUFFER1\",\"34855\":\"GL_DRAW_BUFFER2\",\"34856\":\"GL_DRAW_BUFFER3\",\"34857\":\"GL_DRAW_BUFFER4\",\"34858\":\"GL_DRAW_BUFFER5\",\"34",
+    "859\":\"GL_DRAW_BUFFER6\",\"34860\":\"GL_DRAW_BUFFER7\",\"34861\":\"GL_DRAW_BUFFER8\",\"34862\":\"GL_DRAW_BUFFER9\",\"34863\":\"GL_DRAW_BUFFER10\",\"34864\":\"GL_DRAW_BUFFER11\",\"34865\":\"GL_DRAW_BUFFER12\",\"34866\":\"GL_DRAW_BUFFER13\",\"34867\":\"GL_DRAW_BUFFER14\",\"34868\":\"GL_DRAW_BUFFER15\",\"34877\":\"GL_BLEND_EQUATION_ALPHA\",\"34890\":\"GL_TEXTURE_DEPTH_SIZE\",\"34892\":\"GL_TEXTURE_COMPARE_MODE\",\"34893\":\"GL_TEXTURE_COMPARE_FUNC\",\"34894\":\"GL_COMPARE_REF_TO_TEXTURE\",\"34895\":\"GL_TEXTURE_CUBE_MAP_SEAMLESS\",\"34916\":\"GL_QUERY_COUNTER_BITS\",\"34917\":\"GL_CURRENT_QUERY\",\"34918\":\"GL_QUERY_RESULT\",\"34919\":\"GL_QUERY_RESULT_AVAILABLE\",\"34921\":\"GL_MAX_VERTEX_ATTRIBS\",\"34922\":\"GL_VERTEX_ATTRIB_ARRAY_NORMALIZED\",\"34924\":\"GL_MAX_TESS_CONTROL_INPUT_COMPONENTS\",\"34925\":\"GL_MAX_TESS_EVALUATION_INPUT_COMPONENTS\",\"34930\":\"GL_MAX_TEXTURE_IMAGE_UNITS\",\"34943\":\"GL_GEOMETRY_SHADER_INVOCATIONS\",\"34962\":\"GL_ARRAY_BUFFER\",\"34963\":\"GL_ELEMENT_ARRAY_BUFFER\",\"34964\":\"GL_ARRAY_BUFFER_BINDING\",\"34965\":\"GL_ELEMENT_ARRAY_BUFFER_BINDING\",\"34975\":\"GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDI",
+    "NG\",\"35000\":\"GL_READ_ONLY\",\"35001\":\"GL_WRITE_ONLY\",\"35002\":\"GL_READ_WRITE\",\"35003\":\"GL_BUFFER_ACCESS\",\"35004\":\"GL_BUFFER_MAPPED\",\"35005\":\"GL_BUFFER_MAP_POINTER\",\"35007\":\"GL_TIME_ELAPSED\",\"35040\":\"GL_STREAM_DRAW\",\"35041\":\"GL_STREAM_READ\",\"35042\":\"GL_STREAM_COPY\",\"35044\":\"GL_STATIC_DRAW\",\"35045\":\"GL_STATIC_READ\",\"35046\":\"GL_STATIC_COPY\",\"35048\":\"GL_DYNAMIC_DRAW\",\"35049\":\"GL_DYNAMIC_READ\",\"35050\":\"GL_DYNAMIC_COPY\",\"35051\":\"GL_PIXEL_PACK_BUFFER\",\"35052\":\"GL_PIXEL_UNPACK_BUFFER\",\"35053\":\"GL_PIXEL_PACK_BUFFER_BINDING\",\"35055\":\"GL_PIXEL_UNPACK_BUFFER_BINDING\",\"35056\":\"GL_DEPTH24_STENCIL8\",\"35057\":\"GL_TEXTURE_STENCIL_SIZE\",\"35065\":\"GL_SRC1_COLOR\",\"35066\":\"GL_ONE_MINUS_SRC1_COLOR\",\"35067\":\"GL_ONE_MINUS_SRC1_ALPHA\",\"35068\":\"GL_MAX_DUAL_SOURCE_DRAW_BUFFERS\",\"35069\":\"GL_VERTEX_ATTRIB_ARRAY_INTEGER\",\"35070\":\"GL_VERTEX_ATTRIB_ARRAY_DIVISOR\",\"35071\":\"GL_MAX_ARRAY_TEXTURE_LAYERS\",\"35076\":\"GL_MIN_PROGRAM_TEXEL_OFFSET\",\"35077\":\"GL_MAX_PROGRAM_TEXEL_OFFSET\",\"35092\":\"GL_SAMPLES_PASSED\",\"35094\":\"GL_GEOMETRY_VERTICES_OUT\",\"35095\":",
+    "\"GL_GEOMETRY_INPUT_TYPE\",\"35096\":\"GL_GEOMETRY_OUTPUT_TYPE\",\"35097\":\"GL_SAMPLER_BINDING\",\"35100\":\"GL_CLAMP_READ_COLOR\",\"35101\":\"GL_FIXED_ONLY\",\"35345\":\"GL_UNIFORM_BUFFER\",\"35368\":\"GL_UNIFORM_BUFFER_BINDING\",\"35369\":\"GL_UNIFORM_BUFFER_START\",\"35370\":\"GL_UNIFORM_BUFFER_SIZE\",\"35371\":\"GL_MAX_VERTEX_UNIFORM_BLOCKS\",\"35372\":\"GL_MAX_GEOMETRY_UNIFORM_BLOCKS\",\"35373\":\"GL_MAX_FRAGMENT_UNIFORM_BLOCKS\",\"35374\":\"GL_MAX_COMBINED_UNIFORM_BLOCKS\",\"35375\":\"GL_MAX_UNIFORM_BUFFER_BINDINGS\",\"35376\":\"GL_MAX_UNIFORM_BLOCK_SIZE\",\"35377\":\"GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS\",\"35378\":\"GL_MAX_COMBINED_GEOMETRY_UNIFORM_COMPONENTS\",\"35379\":\"GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS\",\"35380\":\"GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT\",\"35381\":\"GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH\",\"35382\":\"GL_ACTIVE_UNIFORM_BLOCKS\",\"35383\":\"GL_UNIFORM_TYPE\",\"35384\":\"GL_UNIFORM_SIZE\",\"35385\":\"GL_UNIFORM_NAME_LENGTH\",\"35386\":\"GL_UNIFORM_BLOCK_INDEX\",\"35387\":\"GL_UNIFORM_OFFSET\",\"35388\":\"GL_UNIFORM_ARRAY_STRIDE\",\"35389\":\"GL_UNIFORM_MATRIX_STRIDE\",\"35390\"",
+    ":\"GL_UNIFORM_IS_ROW_MAJOR\",\"35391\":\"GL_UNIFORM_BLOCK_BINDING\",\"35392\":\"GL_UNIFORM_BLOCK_DATA_SIZE\",\"35393\":\"GL_UNIFORM_BLOCK_NAME_LENGTH\",\"35394\":\"GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS\",\"35395\":\"GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES\",\"35396\":\"GL_UNIFORM_BLOCK_REFERENCED_BY_VERTEX_SHADER\",\"35397\":\"GL_UNIFORM_BLOCK_REFERENCED_BY_GEOMETRY_SHADER\",\"35398\":\"GL_UNIFORM_BLOCK_REFERENCED_BY_FRAGMENT_SHADER\",\"35632\":\"GL_FRAGMENT_SHADER\",\"35633\":\"GL_VERTEX_SHADER\",\"35657\":\"GL_MAX_FRAGMENT_UNIFORM_COMPONENTS\",\"35658\":\"GL_MAX_VERTEX_UNIFORM_COMPONENTS\",\"35659\":\"GL_MAX_VARYING_FLOATS\",\"35660\":\"GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS\",\"35661\":\"GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS\",\"35663\":\"GL_SHADER_TYPE\",\"35664\":\"GL_FLOAT_VEC2\",\"35665\":\"GL_FLOAT_VEC3\",\"35666\":\"GL_FLOAT_VEC4\",\"35667\":\"GL_INT_VEC2\",\"35668\":\"GL_INT_VEC3\",\"35669\":\"GL_INT_VEC4\",\"35670\":\"GL_BOOL\",\"35671\":\"GL_BOOL_VEC2\",\"35672\":\"GL_BOOL_VEC3\",\"35673\":\"GL_BOOL_VEC4\",\"35674\":\"GL_FLOAT_MAT2\",\"35675\":\"GL_FLOAT_MAT3\",\"35676\":\"GL_FLOAT_MAT4\",\"35677\":\"GL_SAMPLER_1D\",\"35678\":\"GL_",
+    "SAMPLER_2D\",\"35679\":\"GL_SAMPLER_3D\",\"35680\":\"GL_SAMPLER_CUBE\",\"35681\":\"GL_SAMPLER_1D_SHADOW\",\"35682\":\"GL_SAMPLER_2D_SHADOW\",\"35683\":\"GL_SAMPLER_2D_RECT\",\"35684\":\"GL_SAMPLER_2D_RECT_SHADOW\",\"35685\":\"GL_FLOAT_MAT2x3\",\"35686\":\"GL_FLOAT_MAT2x4\",\"35687\":\"GL_FLOAT_MAT3x2\",\"35688\":\"GL_FLOAT_MAT3x4\",\"35689\":\"GL_FLOAT_MAT4x2\",\"35690\":\"GL_FLOAT_MAT4x3\",\"35712\":\"GL_DELETE_STATUS\",\"35713\":\"GL_COMPILE_STATUS\",\"35714\":\"GL_LINK_STATUS\",\"35715\":\"GL_VALIDATE_STATUS\",\"35716\":\"GL_INFO_LOG_LENGTH\",\"35717\":\"GL_ATTACHED_SHADERS\",\"35718\":\"GL_ACTIVE_UNIFORMS\",\"35719\":\"GL_ACTIVE_UNIFORM_MAX_LENGTH\",\"35720\":\"GL_SHADER_SOURCE_LENGTH\",\"35721\":\"GL_ACTIVE_ATTRIBUTES\",\"35722\":\"GL_ACTIVE_ATTRIBUTE_MAX_LENGTH\",\"35723\":\"GL_FRAGMENT_SHADER_DERIVATIVE_HINT\",\"35724\":\"GL_SHADING_LANGUAGE_VERSION\",\"35725\":\"GL_CURRENT_PROGRAM\",\"35738\":\"GL_IMPLEMENTATION_COLOR_READ_TYPE\",\"35739\":\"GL_IMPLEMENTATION_COLOR_READ_FORMAT\",\"35856\":\"GL_TEXTURE_RED_TYPE\",\"35857\":\"GL_TEXTURE_GREEN_TYPE\",\"35858\":\"GL_TEXTURE_BLUE_TYPE\",\"35859\":\"GL_TEXTURE_ALPHA_TYPE\",\"35862\":\"G",
+    "L_TEXTURE_DEPTH_TYPE\",\"35863\":\"GL_UNSIGNED_NORMALIZED\",\"35864\":\"GL_TEXTURE_1D_ARRAY\",\"35865\":\"GL_PROXY_TEXTURE_1D_ARRAY\",\"35866\":\"GL_TEXTURE_2D_ARRAY\",\"35867\":\"GL_PROXY_TEXTURE_2D_ARRAY\",\"35868\":\"GL_TEXTURE_BINDING_1D_ARRAY\",\"35869\":\"GL_TEXTURE_BINDING_2D_ARRAY\",\"35881\":\"GL_MAX_GEOMETRY_TEXTURE_IMAGE_UNITS\",\"35882\":\"GL_TEXTURE_BUFFER\",\"35883\":\"GL_MAX_TEXTURE_BUFFER_SIZE\",\"35884\":\"GL_TEXTURE_BINDING_BUFFER\",\"35885\":\"GL_TEXTURE_BUFFER_DATA_STORE_BINDING\",\"35887\":\"GL_ANY_SAMPLES_PASSED\",\"35894\":\"GL_SAMPLE_SHADING\",\"35895\":\"GL_MIN_SAMPLE_SHADING_VALUE\",\"35898\":\"GL_R11F_G11F_B10F\",\"35899\":\"GL_UNSIGNED_INT_10F_11F_11F_REV\",\"35901\":\"GL_RGB9_E5\",\"35902\":\"GL_UNSIGNED_INT_5_9_9_9_REV\",\"35903\":\"GL_TEXTURE_SHARED_SIZE\",\"35904\":\"GL_SRGB\",\"35905\":\"GL_SRGB8\",\"35906\":\"GL_SRGB_ALPHA\",\"35907\":\"GL_SRGB8_ALPHA8\",\"35912\":\"GL_COMPRESSED_SRGB\",\"35913\":\"GL_COMPRESSED_SRGB_ALPHA\",\"35958\":\"GL_TRANSFORM_FEEDBACK_VARYING_MAX_LENGTH\",\"35967\":\"GL_TRANSFORM_FEEDBACK_BUFFER_MODE\",\"35968\":\"GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_COMPONENTS\",\"3597",
+    "1\":\"GL_TRANSFORM_FEEDBACK_VARYINGS\",\"35972\":\"GL_TRANSFORM_FEEDBACK_BUFFER_START\",\"35973\":\"GL_TRANSFORM_FEEDBACK_BUFFER_SIZE\",\"35975\":\"GL_PRIMITIVES_GENERATED\",\"35976\":\"GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN\",\"35977\":\"GL_RASTERIZER_DISCARD\",\"35978\":\"GL_MAX_TRANSFORM_FEEDBACK_INTERLEAVED_COMPONENTS\",\"35979\":\"GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS\",\"35980\":\"GL_INTERLEAVED_ATTRIBS\",\"35981\":\"GL_SEPARATE_ATTRIBS\",\"35982\":\"GL_TRANSFORM_FEEDBACK_BUFFER\",\"35983\":\"GL_TRANSFORM_FEEDBACK_BUFFER_BINDING\",\"36000\":\"GL_POINT_SPRITE_COORD_ORIGIN\",\"36001\":\"GL_LOWER_LEFT\",\"36002\":\"GL_UPPER_LEFT\",\"36003\":\"GL_STENCIL_BACK_REF\",\"36004\":\"GL_STENCIL_BACK_VALUE_MASK\",\"36005\":\"GL_STENCIL_BACK_WRITEMASK\",\"36006\":\"GL_FRAMEBUFFER_BINDING\",\"36007\":\"GL_RENDERBUFFER_BINDING\",\"36008\":\"GL_READ_FRAMEBUFFER\",\"36009\":\"GL_DRAW_FRAMEBUFFER\",\"36010\":\"GL_READ_FRAMEBUFFER_BINDING\",\"36011\":\"GL_RENDERBUFFER_SAMPLES\",\"36012\":\"GL_DEPTH_COMPONENT32F\",\"36013\":\"GL_DEPTH32F_STENCIL8\",\"36048\":\"GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE\",\"36049\":\"GL_FRAMEBUFF",
+    "ER_ATTACHMENT_OBJECT_NAME\",\"36050\":\"GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LEVEL\",\"36051\":\"GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_CUBE_MAP_FACE\",\"36052\":\"GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LAYER\",\"36053\":\"GL_FRAMEBUFFER_COMPLETE\",\"36054\":\"GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT\",\"36055\":\"GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT\",\"36059\":\"GL_FRAMEBUFFER_INCOMPLETE_DRAW_BUFFER\",\"36060\":\"GL_FRAMEBUFFER_INCOMPLETE_READ_BUFFER\",\"36061\":\"GL_FRAMEBUFFER_UNSUPPORTED\",\"36063\":\"GL_MAX_COLOR_ATTACHMENTS\",\"36064\":\"GL_COLOR_ATTACHMENT0\",\"36065\":\"GL_COLOR_ATTACHMENT1\",\"36066\":\"GL_COLOR_ATTACHMENT2\",\"36067\":\"GL_COLOR_ATTACHMENT3\",\"36068\":\"GL_COLOR_ATTACHMENT4\",\"36069\":\"GL_COLOR_ATTACHMENT5\",\"36070\":\"GL_COLOR_ATTACHMENT6\",\"36071\":\"GL_COLOR_ATTACHMENT7\",\"36072\":\"GL_COLOR_ATTACHMENT8\",\"36073\":\"GL_COLOR_ATTACHMENT9\",\"36074\":\"GL_COLOR_ATTACHMENT10\",\"36075\":\"GL_COLOR_ATTACHMENT11\",\"36076\":\"GL_COLOR_ATTACHMENT12\",\"36077\":\"GL_COLOR_ATTACHMENT13\",\"36078\":\"GL_COLOR_ATTACHMENT14\",\"36079\":\"GL_COLOR_ATTACHMENT15\",\"36080\":\"GL_COLOR_ATTACHMENT16\",\"",
+    "36081\":\"GL_COLOR_ATTACHMENT17\",\"36082\":\"GL_COLOR_ATTACHMENT18\",\"36083\":\"GL_COLOR_ATTACHMENT19\",\"36084\":\"GL_COLOR_ATTACHMENT20\",\"36085\":\"GL_COLOR_ATTACHMENT21\",\"36086\":\"GL_COLOR_ATTACHMENT22\",\"36087\":\"GL_COLOR_ATTACHMENT23\",\"36088\":\"GL_COLOR_ATTACHMENT24\",\"36089\":\"GL_COLOR_ATTACHMENT25\",\"36090\":\"GL_COLOR_ATTACHMENT26\",\"36091\":\"GL_COLOR_ATTACHMENT27\",\"36092\":\"GL_COLOR_ATTACHMENT28\",\"36093\":\"GL_COLOR_ATTACHMENT29\",\"36094\":\"GL_COLOR_ATTACHMENT30\",\"36095\":\"GL_COLOR_ATTACHMENT31\",\"36096\":\"GL_DEPTH_ATTACHMENT\",\"36128\":\"GL_STENCIL_ATTACHMENT\",\"36160\":\"GL_FRAMEBUFFER\",\"36161\":\"GL_RENDERBUFFER\",\"36162\":\"GL_RENDERBUFFER_WIDTH\",\"36163\":\"GL_RENDERBUFFER_HEIGHT\",\"36164\":\"GL_RENDERBUFFER_INTERNAL_FORMAT\",\"36166\":\"GL_STENCIL_INDEX1\",\"36167\":\"GL_STENCIL_INDEX4\",\"36168\":\"GL_STENCIL_INDEX8\",\"36169\":\"GL_STENCIL_INDEX16\",\"36176\":\"GL_RENDERBUFFER_RED_SIZE\",\"36177\":\"GL_RENDERBUFFER_GREEN_SIZE\",\"36178\":\"GL_RENDERBUFFER_BLUE_SIZE\",\"36179\":\"GL_RENDERBUFFER_ALPHA_SIZE\",\"36180\":\"GL_RENDERBUFFER_DEPTH_SIZE\",\"36181\":\"GL_RENDERBUFFER_STENC",
+    "IL_SIZE\",\"36182\":\"GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE\",\"36183\":\"GL_MAX_SAMPLES\",\"36194\":\"GL_RGB565\",\"36201\":\"GL_PRIMITIVE_RESTART_FIXED_INDEX\",\"36202\":\"GL_ANY_SAMPLES_PASSED_CONSERVATIVE\",\"36203\":\"GL_MAX_ELEMENT_INDEX\",\"36208\":\"GL_RGBA32UI\",\"36209\":\"GL_RGB32UI\",\"36214\":\"GL_RGBA16UI\",\"36215\":\"GL_RGB16UI\",\"36220\":\"GL_RGBA8UI\",\"36221\":\"GL_RGB8UI\",\"36226\":\"GL_RGBA32I\",\"36227\":\"GL_RGB32I\",\"36232\":\"GL_RGBA16I\",\"36233\":\"GL_RGB16I\",\"36238\":\"GL_RGBA8I\",\"36239\":\"GL_RGB8I\",\"36244\":\"GL_RED_INTEGER\",\"36245\":\"GL_GREEN_INTEGER\",\"36246\":\"GL_BLUE_INTEGER\",\"36248\":\"GL_RGB_INTEGER\",\"36249\":\"GL_RGBA_INTEGER\",\"36250\":\"GL_BGR_INTEGER\",\"36251\":\"GL_BGRA_INTEGER\",\"36255\":\"GL_INT_2_10_10_10_REV\",\"36263\":\"GL_FRAMEBUFFER_ATTACHMENT_LAYERED\",\"36264\":\"GL_FRAMEBUFFER_INCOMPLETE_LAYER_TARGETS\",\"36269\":\"GL_FLOAT_32_UNSIGNED_INT_24_8_REV\",\"36281\":\"GL_FRAMEBUFFER_SRGB\",\"36283\":\"GL_COMPRESSED_RED_RGTC1\",\"36284\":\"GL_COMPRESSED_SIGNED_RED_RGTC1\",\"36285\":\"GL_COMPRESSED_RG_RGTC2\",\"36286\":\"GL_COMPRESSED_SIGNED_RG_RGTC2\",\"36288\":\"GL_SAMPLER_1D_ARRA",
+    "Y\",\"36289\":\"GL_SAMPLER_2D_ARRAY\",\"36290\":\"GL_SAMPLER_BUFFER\",\"36291\":\"GL_SAMPLER_1D_ARRAY_SHADOW\",\"36292\":\"GL_SAMPLER_2D_ARRAY_SHADOW\",\"36293\":\"GL_SAMPLER_CUBE_SHADOW\",\"36294\":\"GL_UNSIGNED_INT_VEC2\",\"36295\":\"GL_UNSIGNED_INT_VEC3\",\"36296\":\"GL_UNSIGNED_INT_VEC4\",\"36297\":\"GL_INT_SAMPLER_1D\",\"36298\":\"GL_INT_SAMPLER_2D\",\"36299\":\"GL_INT_SAMPLER_3D\",\"36300\":\"GL_INT_SAMPLER_CUBE\",\"36301\":\"GL_INT_SAMPLER_2D_RECT\",\"36302\":\"GL_INT_SAMPLER_1D_ARRAY\",\"36303\":\"GL_INT_SAMPLER_2D_ARRAY\",\"36304\":\"GL_INT_SAMPLER_BUFFER\",\"36305\":\"GL_UNSIGNED_INT_SAMPLER_1D\",\"36306\":\"GL_UNSIGNED_INT_SAMPLER_2D\",\"36307\":\"GL_UNSIGNED_INT_SAMPLER_3D\",\"36308\":\"GL_UNSIGNED_INT_SAMPLER_CUBE\",\"36309\":\"GL_UNSIGNED_INT_SAMPLER_2D_RECT\",\"36310\":\"GL_UNSIGNED_INT_SAMPLER_1D_ARRAY\",\"36311\":\"GL_UNSIGNED_INT_SAMPLER_2D_ARRAY\",\"36312\":\"GL_UNSIGNED_INT_SAMPLER_BUFFER\",\"36313\":\"GL_GEOMETRY_SHADER\",\"36319\":\"GL_MAX_GEOMETRY_UNIFORM_COMPONENTS\",\"36320\":\"GL_MAX_GEOMETRY_OUTPUT_VERTICES\",\"36321\":\"GL_MAX_GEOMETRY_TOTAL_OUTPUT_COMPONENTS\",\"36325\":\"GL_ACTIVE_SUBROUTINES\"",
+    ",\"36326\":\"GL_ACTIVE_SUBROUTINE_UNIFORMS\",\"36327\":\"GL_MAX_SUBROUTINES\",\"36328\":\"GL_MAX_SUBROUTINE_UNIFORM_LOCATIONS\",\"36336\":\"GL_LOW_FLOAT\",\"36337\":\"GL_MEDIUM_FLOAT\",\"36338\":\"GL_HIGH_FLOAT\",\"36339\":\"GL_LOW_INT\",\"36340\":\"GL_MEDIUM_INT\",\"36341\":\"GL_HIGH_INT\",\"36344\":\"GL_SHADER_BINARY_FORMATS\",\"36345\":\"GL_NUM_SHADER_BINARY_FORMATS\",\"36346\":\"GL_SHADER_COMPILER\",\"36347\":\"GL_MAX_VERTEX_UNIFORM_VECTORS\",\"36348\":\"GL_MAX_VARYING_VECTORS\",\"36349\":\"GL_MAX_FRAGMENT_UNIFORM_VECTORS\",\"36371\":\"GL_QUERY_WAIT\",\"36372\":\"GL_QUERY_NO_WAIT\",\"36373\":\"GL_QUERY_BY_REGION_WAIT\",\"36374\":\"GL_QUERY_BY_REGION_NO_WAIT\",\"36375\":\"GL_QUERY_WAIT_INVERTED\",\"36376\":\"GL_QUERY_NO_WAIT_INVERTED\",\"36377\":\"GL_QUERY_BY_REGION_WAIT_INVERTED\",\"36378\":\"GL_QUERY_BY_REGION_NO_WAIT_INVERTED\",\"36379\":\"GL_POLYGON_OFFSET_CLAMP\",\"36382\":\"GL_MAX_COMBINED_TESS_CONTROL_UNIFORM_COMPONENTS\",\"36383\":\"GL_MAX_COMBINED_TESS_EVALUATION_UNIFORM_COMPONENTS\",\"36386\":\"GL_TRANSFORM_FEEDBACK\",\"36387\":\"GL_TRANSFORM_FEEDBACK_BUFFER_PAUSED\",\"36388\":\"GL_TRANSFORM_FEEDBACK_BUFFER_A",
+    "CTIVE\",\"36389\":\"GL_TRANSFORM_FEEDBACK_BINDING\",\"36392\":\"GL_TIMESTAMP\",\"36418\":\"GL_TEXTURE_SWIZZLE_R\",\"36419\":\"GL_TEXTURE_SWIZZLE_G\",\"36420\":\"GL_TEXTURE_SWIZZLE_B\",\"36421\":\"GL_TEXTURE_SWIZZLE_A\",\"36422\":\"GL_TEXTURE_SWIZZLE_RGBA\",\"36423\":\"GL_ACTIVE_SUBROUTINE_UNIFORM_LOCATIONS\",\"36424\":\"GL_ACTIVE_SUBROUTINE_MAX_LENGTH\",\"36425\":\"GL_ACTIVE_SUBROUTINE_UNIFORM_MAX_LENGTH\",\"36426\":\"GL_NUM_COMPATIBLE_SUBROUTINES\",\"36427\":\"GL_COMPATIBLE_SUBROUTINES\",\"36428\":\"GL_QUADS_FOLLOW_PROVOKING_VERTEX_CONVENTION\",\"36429\":\"GL_FIRST_VERTEX_CONVENTION\",\"36430\":\"GL_LAST_VERTEX_CONVENTION\",\"36431\":\"GL_PROVOKING_VERTEX\",\"36432\":\"GL_SAMPLE_POSITION\",\"36433\":\"GL_SAMPLE_MASK\",\"36434\":\"GL_SAMPLE_MASK_VALUE\",\"36441\":\"GL_MAX_SAMPLE_MASK_WORDS\",\"36442\":\"GL_MAX_GEOMETRY_SHADER_INVOCATIONS\",\"36443\":\"GL_MIN_FRAGMENT_INTERPOLATION_OFFSET\",\"36444\":\"GL_MAX_FRAGMENT_INTERPOLATION_OFFSET\",\"36445\":\"GL_FRAGMENT_INTERPOLATION_OFFSET_BITS\",\"36446\":\"GL_MIN_PROGRAM_TEXTURE_GATHER_OFFSET\",\"36447\":\"GL_MAX_PROGRAM_TEXTURE_GATHER_OFFSET\",\"36464\":\"GL_MAX_TRANS",
+    "FORM_FEEDBACK_BUFFERS\",\"36465\":\"GL_MAX_VERTEX_STREAMS\",\"36466\":\"GL_PATCH_VERTICES\",\"36467\":\"GL_PATCH_DEFAULT_INNER_LEVEL\",\"36468\":\"GL_PATCH_DEFAULT_OUTER_LEVEL\",\"36469\":\"GL_TESS_CONTROL_OUTPUT_VERTICES\",\"36470\":\"GL_TESS_GEN_MODE\",\"36471\":\"GL_TESS_GEN_SPACING\",\"36472\":\"GL_TESS_GEN_VERTEX_ORDER\",\"36473\":\"GL_TESS_GEN_POINT_MODE\",\"36474\":\"GL_ISOLINES\",\"36475\":\"GL_FRACTIONAL_ODD\",\"36476\":\"GL_FRACTIONAL_EVEN\",\"36477\":\"GL_MAX_PATCH_VERTICES\",\"36478\":\"GL_MAX_TESS_GEN_LEVEL\",\"36479\":\"GL_MAX_TESS_CONTROL_UNIFORM_COMPONENTS\",\"36480\":\"GL_MAX_TESS_EVALUATION_UNIFORM_COMPONENTS\",\"36481\":\"GL_MAX_TESS_CONTROL_TEXTURE_IMAGE_UNITS\",\"36482\":\"GL_MAX_TESS_EVALUATION_TEXTURE_IMAGE_UNITS\",\"36483\":\"GL_MAX_TESS_CONTROL_OUTPUT_COMPONENTS\",\"36484\":\"GL_MAX_TESS_PATCH_COMPONENTS\",\"36485\":\"GL_MAX_TESS_CONTROL_TOTAL_OUTPUT_COMPONENTS\",\"36486\":\"GL_MAX_TESS_EVALUATION_OUTPUT_COMPONENTS\",\"36487\":\"GL_TESS_EVALUATION_SHADER\",\"36488\":\"GL_TESS_CONTROL_SHADER\",\"36489\":\"GL_MAX_TESS_CONTROL_UNIFORM_BLOCKS\",\"36490\":\"GL_MAX_TESS_EVALUATION_UNIFORM_BLO",
+    "CKS\",\"36492\":\"GL_COMPRESSED_RGBA_BPTC_UNORM\",\"36493\":\"GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM\",\"36494\":\"GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT\",\"36495\":\"GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT\",\"36662\":\"GL_COPY_READ_BUFFER\",\"36663\":\"GL_COPY_WRITE_BUFFER\",\"36664\":\"GL_MAX_IMAGE_UNITS\",\"36665\":\"GL_MAX_COMBINED_IMAGE_UNITS_AND_FRAGMENT_OUTPUTS\",\"36666\":\"GL_IMAGE_BINDING_NAME\",\"36667\":\"GL_IMAGE_BINDING_LEVEL\",\"36668\":\"GL_IMAGE_BINDING_LAYERED\",\"36669\":\"GL_IMAGE_BINDING_LAYER\",\"36670\":\"GL_IMAGE_BINDING_ACCESS\",\"36671\":\"GL_DRAW_INDIRECT_BUFFER\",\"36675\":\"GL_DRAW_INDIRECT_BUFFER_BINDING\",\"36678\":\"GL_DOUBLE_MAT2\",\"36679\":\"GL_DOUBLE_MAT3\",\"36680\":\"GL_DOUBLE_MAT4\",\"36681\":\"GL_DOUBLE_MAT2x3\",\"36682\":\"GL_DOUBLE_MAT2x4\",\"36683\":\"GL_DOUBLE_MAT3x2\",\"36684\":\"GL_DOUBLE_MAT3x4\",\"36685\":\"GL_DOUBLE_MAT4x2\",\"36686\":\"GL_DOUBLE_MAT4x3\",\"36687\":\"GL_VERTEX_BINDING_BUFFER\",\"36756\":\"GL_R8_SNORM\",\"36757\":\"GL_RG8_SNORM\",\"36758\":\"GL_RGB8_SNORM\",\"36759\":\"GL_RGBA8_SNORM\",\"36760\":\"GL_R16_SNORM\",\"36761\":\"GL_RG16_SNORM\",\"36762\":\"GL_RGB16_SNORM\",\"36763\":\"",
+    "GL_RGBA16_SNORM\",\"36764\":\"GL_SIGNED_NORMALIZED\",\"36765\":\"GL_PRIMITIVE_RESTART\",\"36766\":\"GL_PRIMITIVE_RESTART_INDEX\",\"36860\":\"GL_DOUBLE_VEC2\",\"36861\":\"GL_DOUBLE_VEC3\",\"36862\":\"GL_DOUBLE_VEC4\",\"36873\":\"GL_TEXTURE_CUBE_MAP_ARRAY\",\"36874\":\"GL_TEXTURE_BINDING_CUBE_MAP_ARRAY\",\"36875\":\"GL_PROXY_TEXTURE_CUBE_MAP_ARRAY\",\"36876\":\"GL_SAMPLER_CUBE_MAP_ARRAY\",\"36877\":\"GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW\",\"36878\":\"GL_INT_SAMPLER_CUBE_MAP_ARRAY\",\"36879\":\"GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY\",\"36940\":\"GL_IMAGE_1D\",\"36941\":\"GL_IMAGE_2D\",\"36942\":\"GL_IMAGE_3D\",\"36943\":\"GL_IMAGE_2D_RECT\",\"36944\":\"GL_IMAGE_CUBE\",\"36945\":\"GL_IMAGE_BUFFER\",\"36946\":\"GL_IMAGE_1D_ARRAY\",\"36947\":\"GL_IMAGE_2D_ARRAY\",\"36948\":\"GL_IMAGE_CUBE_MAP_ARRAY\",\"36949\":\"GL_IMAGE_2D_MULTISAMPLE\",\"36950\":\"GL_IMAGE_2D_MULTISAMPLE_ARRAY\",\"36951\":\"GL_INT_IMAGE_1D\",\"36952\":\"GL_INT_IMAGE_2D\",\"36953\":\"GL_INT_IMAGE_3D\",\"36954\":\"GL_INT_IMAGE_2D_RECT\",\"36955\":\"GL_INT_IMAGE_CUBE\",\"36956\":\"GL_INT_IMAGE_BUFFER\",\"36957\":\"GL_INT_IMAGE_1D_ARRAY\",\"36958\":\"GL_INT_IMAGE_2D_ARRAY\",\"3695",
+    "9\":\"GL_INT_IMAGE_CUBE_MAP_ARRAY\",\"36960\":\"GL_INT_IMAGE_2D_MULTISAMPLE\",\"36961\":\"GL_INT_IMAGE_2D_MULTISAMPLE_ARRAY\",\"36962\":\"GL_UNSIGNED_INT_IMAGE_1D\",\"36963\":\"GL_UNSIGNED_INT_IMAGE_2D\",\"36964\":\"GL_UNSIGNED_INT_IMAGE_3D\",\"36965\":\"GL_UNSIGNED_INT_IMAGE_2D_RECT\",\"36966\":\"GL_UNSIGNED_INT_IMAGE_CUBE\",\"36967\":\"GL_UNSIGNED_INT_IMAGE_BUFFER\",\"36968\":\"GL_UNSIGNED_INT_IMAGE_1D_ARRAY\",\"36969\":\"GL_UNSIGNED_INT_IMAGE_2D_ARRAY\",\"36970\":\"GL_UNSIGNED_INT_IMAGE_CUBE_MAP_ARRAY\",\"36971\":\"GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE\",\"36972\":\"GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY\",\"36973\":\"GL_MAX_IMAGE_SAMPLES\",\"36974\":\"GL_IMAGE_BINDING_FORMAT\",\"36975\":\"GL_RGB10_A2UI\",\"37052\":\"GL_MIN_MAP_BUFFER_ALIGNMENT\",\"37063\":\"GL_IMAGE_FORMAT_COMPATIBILITY_TYPE\",\"37064\":\"GL_IMAGE_FORMAT_COMPATIBILITY_BY_SIZE\",\"37065\":\"GL_IMAGE_FORMAT_COMPATIBILITY_BY_CLASS\",\"37066\":\"GL_MAX_VERTEX_IMAGE_UNIFORMS\",\"37067\":\"GL_MAX_TESS_CONTROL_IMAGE_UNIFORMS\",\"37068\":\"GL_MAX_TESS_EVALUATION_IMAGE_UNIFORMS\",\"37069\":\"GL_MAX_GEOMETRY_IMAGE_UNIFORMS\",\"37070\":\"GL_MAX_F",
+    "RAGMENT_IMAGE_UNIFORMS\",\"37071\":\"GL_MAX_COMBINED_IMAGE_UNIFORMS\",\"37074\":\"GL_SHADER_STORAGE_BUFFER\",\"37075\":\"GL_SHADER_STORAGE_BUFFER_BINDING\",\"37076\":\"GL_SHADER_STORAGE_BUFFER_START\",\"37077\":\"GL_SHADER_STORAGE_BUFFER_SIZE\",\"37078\":\"GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS\",\"37079\":\"GL_MAX_GEOMETRY_SHADER_STORAGE_BLOCKS\",\"37080\":\"GL_MAX_TESS_CONTROL_SHADER_STORAGE_BLOCKS\",\"37081\":\"GL_MAX_TESS_EVALUATION_SHADER_STORAGE_BLOCKS\",\"37082\":\"GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS\",\"37083\":\"GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS\",\"37084\":\"GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS\",\"37085\":\"GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS\",\"37086\":\"GL_MAX_SHADER_STORAGE_BLOCK_SIZE\",\"37087\":\"GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT\",\"37098\":\"GL_DEPTH_STENCIL_TEXTURE_MODE\",\"37099\":\"GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS\",\"37100\":\"GL_UNIFORM_BLOCK_REFERENCED_BY_COMPUTE_SHADER\",\"37101\":\"GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_COMPUTE_SHADER\",\"37102\":\"GL_DISPATCH_INDIRECT_BUFFER\",\"37103\":\"GL_DISPATCH_INDIRECT_BUFFER_BINDING\",\"37120\":\"GL_TEXTURE_2",
+    "D_MULTISAMPLE\",\"37121\":\"GL_PROXY_TEXTURE_2D_MULTISAMPLE\",\"37122\":\"GL_TEXTURE_2D_MULTISAMPLE_ARRAY\",\"37123\":\"GL_PROXY_TEXTURE_2D_MULTISAMPLE_ARRAY\",\"37124\":\"GL_TEXTURE_BINDING_2D_MULTISAMPLE\",\"37125\":\"GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY\",\"37126\":\"GL_TEXTURE_SAMPLES\",\"37127\":\"GL_TEXTURE_FIXED_SAMPLE_LOCATIONS\",\"37128\":\"GL_SAMPLER_2D_MULTISAMPLE\",\"37129\":\"GL_INT_SAMPLER_2D_MULTISAMPLE\",\"37130\":\"GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE\",\"37131\":\"GL_SAMPLER_2D_MULTISAMPLE_ARRAY\",\"37132\":\"GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY\",\"37133\":\"GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY\",\"37134\":\"GL_MAX_COLOR_TEXTURE_SAMPLES\",\"37135\":\"GL_MAX_DEPTH_TEXTURE_SAMPLES\",\"37136\":\"GL_MAX_INTEGER_SAMPLES\",\"37137\":\"GL_MAX_SERVER_WAIT_TIMEOUT\",\"37138\":\"GL_OBJECT_TYPE\",\"37139\":\"GL_SYNC_CONDITION\",\"37140\":\"GL_SYNC_STATUS\",\"37141\":\"GL_SYNC_FLAGS\",\"37142\":\"GL_SYNC_FENCE\",\"37143\":\"GL_SYNC_GPU_COMMANDS_COMPLETE\",\"37144\":\"GL_UNSIGNALED\",\"37145\":\"GL_SIGNALED\",\"37146\":\"GL_ALREADY_SIGNALED\",\"37147\":\"GL_TIMEOUT_EXPIRED\",\"37148\":\"GL_CONDITION_S",
+    "ATISFIED\",\"37149\":\"GL_WAIT_FAILED\",\"37151\":\"GL_BUFFER_ACCESS_FLAGS\",\"37152\":\"GL_BUFFER_MAP_LENGTH\",\"37153\":\"GL_BUFFER_MAP_OFFSET\",\"37154\":\"GL_MAX_VERTEX_OUTPUT_COMPONENTS\",\"37155\":\"GL_MAX_GEOMETRY_INPUT_COMPONENTS\",\"37156\":\"GL_MAX_GEOMETRY_OUTPUT_COMPONENTS\",\"37157\":\"GL_MAX_FRAGMENT_INPUT_COMPONENTS\",\"37158\":\"GL_CONTEXT_PROFILE_MASK\",\"37159\":\"GL_UNPACK_COMPRESSED_BLOCK_WIDTH\",\"37160\":\"GL_UNPACK_COMPRESSED_BLOCK_HEIGHT\",\"37161\":\"GL_UNPACK_COMPRESSED_BLOCK_DEPTH\",\"37162\":\"GL_UNPACK_COMPRESSED_BLOCK_SIZE\",\"37163\":\"GL_PACK_COMPRESSED_BLOCK_WIDTH\",\"37164\":\"GL_PACK_COMPRESSED_BLOCK_HEIGHT\",\"37165\":\"GL_PACK_COMPRESSED_BLOCK_DEPTH\",\"37166\":\"GL_PACK_COMPRESSED_BLOCK_SIZE\",\"37167\":\"GL_TEXTURE_IMMUTABLE_FORMAT\",\"37187\":\"GL_MAX_DEBUG_MESSAGE_LENGTH\",\"37188\":\"GL_MAX_DEBUG_LOGGED_MESSAGES\",\"37189\":\"GL_DEBUG_LOGGED_MESSAGES\",\"37190\":\"GL_DEBUG_SEVERITY_HIGH\",\"37191\":\"GL_DEBUG_SEVERITY_MEDIUM\",\"37192\":\"GL_DEBUG_SEVERITY_LOW\",\"37266\":\"GL_QUERY_BUFFER\",\"37267\":\"GL_QUERY_BUFFER_BINDING\",\"37268\":\"GL_QUERY_RESULT_NO_WAIT\",\"37277\":",
+    "\"GL_TEXTURE_BUFFER_OFFSET\",\"37278\":\"GL_TEXTURE_BUFFER_SIZE\",\"37279\":\"GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT\",\"37305\":\"GL_COMPUTE_SHADER\",\"37307\":\"GL_MAX_COMPUTE_UNIFORM_BLOCKS\",\"37308\":\"GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS\",\"37309\":\"GL_MAX_COMPUTE_IMAGE_UNIFORMS\",\"37310\":\"GL_MAX_COMPUTE_WORK_GROUP_COUNT\",\"37311\":\"GL_MAX_COMPUTE_WORK_GROUP_SIZE\",\"37488\":\"GL_COMPRESSED_R11_EAC\",\"37489\":\"GL_COMPRESSED_SIGNED_R11_EAC\",\"37490\":\"GL_COMPRESSED_RG11_EAC\",\"37491\":\"GL_COMPRESSED_SIGNED_RG11_EAC\",\"37492\":\"GL_COMPRESSED_RGB8_ETC2\",\"37493\":\"GL_COMPRESSED_SRGB8_ETC2\",\"37494\":\"GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2\",\"37495\":\"GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2\",\"37496\":\"GL_COMPRESSED_RGBA8_ETC2_EAC\",\"37497\":\"GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC\",\"37568\":\"GL_ATOMIC_COUNTER_BUFFER\",\"37569\":\"GL_ATOMIC_COUNTER_BUFFER_BINDING\",\"37570\":\"GL_ATOMIC_COUNTER_BUFFER_START\",\"37571\":\"GL_ATOMIC_COUNTER_BUFFER_SIZE\",\"37572\":\"GL_ATOMIC_COUNTER_BUFFER_DATA_SIZE\",\"37573\":\"GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTERS\",\"37574\":\"GL_AT",
+    "OMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTER_INDICES\",\"37575\":\"GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_VERTEX_SHADER\",\"37576\":\"GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_TESS_CONTROL_SHADER\",\"37577\":\"GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_TESS_EVALUATION_SHADER\",\"37578\":\"GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_GEOMETRY_SHADER\",\"37579\":\"GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_FRAGMENT_SHADER\",\"37580\":\"GL_MAX_VERTEX_ATOMIC_COUNTER_BUFFERS\",\"37581\":\"GL_MAX_TESS_CONTROL_ATOMIC_COUNTER_BUFFERS\",\"37582\":\"GL_MAX_TESS_EVALUATION_ATOMIC_COUNTER_BUFFERS\",\"37583\":\"GL_MAX_GEOMETRY_ATOMIC_COUNTER_BUFFERS\",\"37584\":\"GL_MAX_FRAGMENT_ATOMIC_COUNTER_BUFFERS\",\"37585\":\"GL_MAX_COMBINED_ATOMIC_COUNTER_BUFFERS\",\"37586\":\"GL_MAX_VERTEX_ATOMIC_COUNTERS\",\"37587\":\"GL_MAX_TESS_CONTROL_ATOMIC_COUNTERS\",\"37588\":\"GL_MAX_TESS_EVALUATION_ATOMIC_COUNTERS\",\"37589\":\"GL_MAX_GEOMETRY_ATOMIC_COUNTERS\",\"37590\":\"GL_MAX_FRAGMENT_ATOMIC_COUNTERS\",\"37591\":\"GL_MAX_COMBINED_ATOMIC_COUNTERS\",\"37592\":\"GL_MAX_ATOMIC_COUNTER_BUFFER_SIZE\",\"37593\":\"GL_ACTIVE_ATOMIC_COUNT",
+    "ER_BUFFERS\",\"37594\":\"GL_UNIFORM_ATOMIC_COUNTER_BUFFER_INDEX\",\"37595\":\"GL_UNSIGNED_INT_ATOMIC_COUNTER\",\"37596\":\"GL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS\",\"37600\":\"GL_DEBUG_OUTPUT\",\"37601\":\"GL_UNIFORM\",\"37602\":\"GL_UNIFORM_BLOCK\",\"37603\":\"GL_PROGRAM_INPUT\",\"37604\":\"GL_PROGRAM_OUTPUT\",\"37605\":\"GL_BUFFER_VARIABLE\",\"37606\":\"GL_SHADER_STORAGE_BLOCK\",\"37607\":\"GL_IS_PER_PATCH\",\"37608\":\"GL_VERTEX_SUBROUTINE\",\"37609\":\"GL_TESS_CONTROL_SUBROUTINE\",\"37610\":\"GL_TESS_EVALUATION_SUBROUTINE\",\"37611\":\"GL_GEOMETRY_SUBROUTINE\",\"37612\":\"GL_FRAGMENT_SUBROUTINE\",\"37613\":\"GL_COMPUTE_SUBROUTINE\",\"37614\":\"GL_VERTEX_SUBROUTINE_UNIFORM\",\"37615\":\"GL_TESS_CONTROL_SUBROUTINE_UNIFORM\",\"37616\":\"GL_TESS_EVALUATION_SUBROUTINE_UNIFORM\",\"37617\":\"GL_GEOMETRY_SUBROUTINE_UNIFORM\",\"37618\":\"GL_FRAGMENT_SUBROUTINE_UNIFORM\",\"37619\":\"GL_COMPUTE_SUBROUTINE_UNIFORM\",\"37620\":\"GL_TRANSFORM_FEEDBACK_VARYING\",\"37621\":\"GL_ACTIVE_RESOURCES\",\"37622\":\"GL_MAX_NAME_LENGTH\",\"37623\":\"GL_MAX_NUM_ACTIVE_VARIABLES\",\"37624\":\"GL_MAX_NUM_COMPATIBLE_SUBROUTINES\",\"37625\":\"GL_NAM",
+    "E_LENGTH\",\"37626\":\"GL_TYPE\",\"37627\":\"GL_ARRAY_SIZE\",\"37628\":\"GL_OFFSET\",\"37629\":\"GL_BLOCK_INDEX\",\"37630\":\"GL_ARRAY_STRIDE\",\"37631\":\"GL_MATRIX_STRIDE\",\"37632\":\"GL_IS_ROW_MAJOR\",\"37633\":\"GL_ATOMIC_COUNTER_BUFFER_INDEX\",\"37634\":\"GL_BUFFER_BINDING\",\"37635\":\"GL_BUFFER_DATA_SIZE\",\"37636\":\"GL_NUM_ACTIVE_VARIABLES\",\"37637\":\"GL_ACTIVE_VARIABLES\",\"37638\":\"GL_REFERENCED_BY_VERTEX_SHADER\",\"37639\":\"GL_REFERENCED_BY_TESS_CONTROL_SHADER\",\"37640\":\"GL_REFERENCED_BY_TESS_EVALUATION_SHADER\",\"37641\":\"GL_REFERENCED_BY_GEOMETRY_SHADER\",\"37642\":\"GL_REFERENCED_BY_FRAGMENT_SHADER\",\"37643\":\"GL_REFERENCED_BY_COMPUTE_SHADER\",\"37644\":\"GL_TOP_LEVEL_ARRAY_SIZE\",\"37645\":\"GL_TOP_LEVEL_ARRAY_STRIDE\",\"37646\":\"GL_LOCATION\",\"37647\":\"GL_LOCATION_INDEX\",\"37648\":\"GL_FRAMEBUFFER_DEFAULT_WIDTH\",\"37649\":\"GL_FRAMEBUFFER_DEFAULT_HEIGHT\",\"37650\":\"GL_FRAMEBUFFER_DEFAULT_LAYERS\",\"37651\":\"GL_FRAMEBUFFER_DEFAULT_SAMPLES\",\"37652\":\"GL_FRAMEBUFFER_DEFAULT_FIXED_SAMPLE_LOCATIONS\",\"37653\":\"GL_MAX_FRAMEBUFFER_WIDTH\",\"37654\":\"GL_MAX_FRAMEBUFFER_HEIGHT\",\"37655\":\"GL_",
+    "MAX_FRAMEBUFFER_LAYERS\",\"37656\":\"GL_MAX_FRAMEBUFFER_SAMPLES\",\"37706\":\"GL_LOCATION_COMPONENT\",\"37707\":\"GL_TRANSFORM_FEEDBACK_BUFFER_INDEX\",\"37708\":\"GL_TRANSFORM_FEEDBACK_BUFFER_STRIDE\",\"37724\":\"GL_CLIP_ORIGIN\",\"37725\":\"GL_CLIP_DEPTH_MODE\",\"37726\":\"GL_NEGATIVE_ONE_TO_ONE\",\"37727\":\"GL_ZERO_TO_ONE\",\"37733\":\"GL_CLEAR_TEXTURE\",\"37760\":\"GL_NUM_SAMPLE_COUNTS\",\"38225\":\"GL_SHADER_BINARY_FORMAT_SPIR_V\",\"38226\":\"GL_SPIR_V_BINARY\",\"38227\":\"GL_SPIR_V_EXTENSIONS\",\"38228\":\"GL_NUM_SPIR_V_EXTENSIONS\"}}",
+    0,
+};
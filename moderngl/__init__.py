@@ -8,15 +8,25 @@ from .compute_shader import *
 from .conditional_render import *
 from .context import *
 from .framebuffer import *
+from .picking import *
+from .frame_ring import *
+from .frame_sink import *
 from .program import *
 from .program_members import *
 from .query import *
+from .profiler import *
 from .renderbuffer import *
 from .scope import *
+from .stats import *
 from .texture import *
+from .bricks import *
 from .texture_3d import *
 from .texture_array import *
 from .texture_cube import *
+from .texture_pool import *
+from .tiles import *
+from .tracer import *
+from .residency import *
 from .vertex_array import *
 from .sampler import *
 
@@ -0,0 +1,171 @@
+from array import array
+
+from .texture import DTYPE_SIZE
+
+__all__ = ['BrickMap']
+
+
+class BrickMap:
+    '''
+        A BrickMap splits a :py:class:`Texture3D` into a grid of equally sized bricks
+        and keeps one dirty bit for each of them.
+
+        Mark the modified regions of the volume with :py:meth:`mark`, then
+        upload only the dirty bricks with :py:meth:`flush` or collect their
+        origins with :py:meth:`origins` and pass them to :py:meth:`Texture3D.write_bricks`.
+
+        A BrickMap object cannot be instantiated directly.
+        Use :py:meth:`Texture3D.brick_map` to create one.
+    '''
+
+    __slots__ = ['_size', '_brick_size', '_grid', '_bits', '_dirty', 'texture', 'ctx', 'extra']
+
+    def __init__(self):
+        self._size = None
+        self._brick_size = None
+        self._grid = None
+        self._bits = None
+        self._dirty = None
+        self.texture = None  #: Texture3D - The texture the bricks are uploaded to
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<BrickMap: %d dirty>' % self._dirty
+
+    @property
+    def brick_size(self) -> tuple:
+        '''
+            tuple: The width, height and depth of a brick.
+        '''
+
+        return self._brick_size
+
+    @property
+    def grid(self) -> tuple:
+        '''
+            tuple: The number of bricks along each axis.
+        '''
+
+        return self._grid
+
+    @property
+    def dirty(self) -> int:
+        '''
+            int: The number of dirty bricks.
+        '''
+
+        return self._dirty
+
+    def mark(self, viewport=None) -> None:
+        '''
+            Mark every brick overlapping a region of the volume as dirty.
+
+            Args:
+                viewport (tuple): The region as ``(x, y, z, width, height, depth)``
+                    or ``(width, height, depth)``. Marks every brick by default.
+        '''
+
+        if viewport is None:
+            viewport = (0, 0, 0) + self._size
+        elif len(viewport) == 3:
+            viewport = (0, 0, 0) + tuple(viewport)
+
+        x, y, z, width, height, depth = viewport
+        bw, bh, bd = self._brick_size
+        gx, gy, gz = self._grid
+
+        x0, x1 = max(x // bw, 0), min((x + width + bw - 1) // bw, gx)
+        y0, y1 = max(y // bh, 0), min((y + height + bh - 1) // bh, gy)
+        z0, z1 = max(z // bd, 0), min((z + depth + bd - 1) // bd, gz)
+
+        bits = self._bits
+        for k in range(z0, z1):
+            for j in range(y0, y1):
+                row = (k * gy + j) * gx
+                for i in range(row + x0, row + x1):
+                    mask = 1 << (i & 7)
+                    if not bits[i >> 3] & mask:
+                        bits[i >> 3] |= mask
+                        self._dirty += 1
+
+    def origins(self, *, clear=True) -> array:
+        '''
+            Get the origins of the dirty bricks.
+
+            Keyword Args:
+                clear (bool): Clear the dirty bits.
+
+            Returns:
+                array: Three ``'i'`` integers for each dirty brick.
+        '''
+
+        gx, gy, _ = self._grid
+        bw, bh, bd = self._brick_size
+        result = array('i')
+
+        for byte_index, byte in enumerate(self._bits):
+            if not byte:
+                continue
+            for bit in range(8):
+                if byte & (1 << bit):
+                    index = byte_index * 8 + bit
+                    i, j, k = index % gx, index // gx % gy, index // (gx * gy)
+                    result.extend((i * bw, j * bh, k * bd))
+
+        if clear:
+            self.clear()
+
+        return result
+
+    def clear(self) -> None:
+        '''
+            Clear every dirty bit.
+        '''
+
+        self._bits[:] = bytes(len(self._bits))
+        self._dirty = 0
+
+    def flush(self, source) -> int:
+        '''
+            Upload the dirty bricks from a host copy of the whole volume
+            and clear the dirty bits.
+
+            Args:
+                source (bytes): The content of the volume laid out like :py:meth:`Texture3D.read` returns it.
+
+            Returns:
+                int: The number of bricks uploaded.
+        '''
+
+        width, height, depth = self._size
+        pixel_size = self.texture.components * DTYPE_SIZE[self.texture.dtype]
+
+        # Checked before the dirty bits are cleared
+        if memoryview(source).nbytes != width * height * depth * pixel_size:
+            raise ValueError('the source must contain the whole volume')
+
+        origins = self.origins()
+        if not origins:
+            return 0
+
+        self.texture.write_bricks(source, origins, self._brick_size, volume=True)
+        return len(origins) // 3
+
+
+def _create_brick_map(texture, brick_size):
+    width, height, depth = texture.size
+    bw, bh, bd = brick_size
+    grid = ((width + bw - 1) // bw, (height + bh - 1) // bh, (depth + bd - 1) // bd)
+
+    res = BrickMap.__new__(BrickMap)
+    res._size = (width, height, depth)
+    res._brick_size = (bw, bh, bd)
+    res._grid = grid
+    res._bits = bytearray((grid[0] * grid[1] * grid[2] + 7) // 8)
+    res._dirty = 0
+    res.texture = texture
+    res.ctx = texture.ctx
+    res.extra = None
+    return res
@@ -1,21 +1,31 @@
 import os
 import warnings
+from contextlib import contextmanager
 from typing import Dict, Tuple
 
 from .buffer import Buffer
 from .compute_shader import ComputeShader
 from .conditional_render import ConditionalRender
+from .debug import _debug_messages, _label_object
+from .frame_ring import FrameRing, _create_frame_ring
+from .frame_sink import FrameSink, _create_frame_sink
 from .framebuffer import Framebuffer
+from .profiler import GPUProfiler, _create_gpu_profiler
 from .program import Program, detect_format
 from .program_members import (Attribute, Subroutine, Uniform, UniformBlock,
                               Varying)
-from .query import Query
+from .query import Query, QueryRing, _create_query_ring
 from .renderbuffer import Renderbuffer
+from .residency import ResidencyManager, _create_residency_manager
 from .scope import Scope
+from .stats import ContextStats, _create_context_stats
 from .texture import Texture
 from .texture_3d import Texture3D
 from .texture_array import TextureArray
 from .texture_cube import TextureCube
+from .texture_pool import TexturePool, _create_texture_pool
+from .tiles import TiledRenderer, _create_tiled_renderer
+from .tracer import Tracer, _create_tracer
 from .vertex_array import VertexArray
 from .sampler import Sampler
 
@@ -148,12 +158,17 @@ class Context:
     #: Used with :py:attr:`Context.provoking_vertex`.
     LAST_VERTEX_CONVENTION = 0x8E4E
 
-    __slots__ = ['mglo', '_screen', '_info', 'version_code', 'fbo', 'extra']
+    __slots__ = ['mglo', '_screen', '_info', '_texture_pool', '_pick_pool', '_stats', '_debug',
+                 'version_code', 'fbo', 'extra']
 
     def __init__(self):
         self.mglo = None  #: Internal representation for debug purposes only.
         self._screen = None
         self._info = None
+        self._texture_pool = None
+        self._pick_pool = None
+        self._stats = None
+        self._debug = None
         self.version_code = None  #: int: The OpenGL version code. Reports ``410`` for OpenGL 4.1
         #: Framebuffer: The active framebuffer.
         #: Set every time :py:meth:`Framebuffer.use()` is called.
@@ -526,6 +541,67 @@ class Context:
 
         return self.mglo.error
 
+    @property
+    def texture_pool(self) -> 'TexturePool':
+        '''
+            TexturePool: Recycles transient textures and renderbuffers.
+            The pool is created on first access with a budget of 256MB.
+        '''
+
+        if self._texture_pool is None:
+            self._texture_pool = _create_texture_pool(self, 256 * 1024 * 1024)
+
+        return self._texture_pool
+
+    @property
+    def stats(self) -> 'ContextStats':
+        '''
+            ContextStats: The draw call, state change and traffic counters of the context.
+        '''
+
+        if self._stats is None:
+            self._stats = _create_context_stats(self)
+
+        return self._stats
+
+    @property
+    def debug_log_limit(self) -> int:
+        '''
+            int: The maximum number of distinct messages kept for :py:meth:`debug_messages`.
+            The oldest messages are dropped first. Lowering the limit drops them immediately,
+            zero stops collecting. The default is 1024.
+        '''
+
+        return self.mglo.debug_log_limit
+
+    @debug_log_limit.setter
+    def debug_log_limit(self, value):
+        self.mglo.debug_log_limit = value
+
+    @property
+    def memory_usage(self) -> Dict[str, int]:
+        '''
+            dict: The number of bytes allocated by the objects of this context.
+            Textures evicted by a :py:class:`ResidencyManager` are not counted.
+
+            Example::
+
+                {
+                    'textures': 4194304,
+                    'renderbuffers': 1048576,
+                    'buffers': 65536,
+                    'total': 5308416,
+                }
+        '''
+
+        textures, renderbuffers, buffers = self.mglo.memory
+        return {
+            'textures': textures,
+            'renderbuffers': renderbuffers,
+            'buffers': buffers,
+            'total': textures + renderbuffers + buffers,
+        }
+
     @property
     def info(self) -> Dict[str, object]:
         '''
@@ -808,6 +884,10 @@ class Context:
         res._dynamic = dynamic
         res.ctx = self
         res.extra = None
+
+        if self._debug:
+            _label_object(res)
+
         return res
 
     def texture(self, size, components, data=None, *, samples=0, alignment=1,
@@ -838,6 +918,10 @@ class Context:
         res._depth = False
         res.ctx = self
         res.extra = None
+
+        if self._debug:
+            _label_object(res)
+
         return res
 
     def texture_array(self, size, components, data=None, *, alignment=1,
@@ -866,6 +950,10 @@ class Context:
         res._dtype = dtype
         res.ctx = self
         res.extra = None
+
+        if self._debug:
+            _label_object(res)
+
         return res
 
     def texture3d(self, size, components, data=None, *, alignment=1, dtype='f1') -> 'Texture3D':
@@ -887,8 +975,15 @@ class Context:
 
         res = Texture3D.__new__(Texture3D)
         res.mglo, res._glo = self.mglo.texture3d(size, components, data, alignment, dtype)
+        res._size = size
+        res._components = components
+        res._dtype = dtype
         res.ctx = self
         res.extra = None
+
+        if self._debug:
+            _label_object(res)
+
         return res
 
     def texture_cube(self, size, components, data=None, *, alignment=1,
@@ -918,6 +1013,52 @@ class Context:
         res._dtype = dtype
         res.ctx = self
         res.extra = None
+
+        if self._debug:
+            _label_object(res)
+
+        return res
+
+    def load_texture(self, path):
+        '''
+            Load a DDS or KTX2 file into a new texture.
+
+            The file is memory mapped and every mipmap level, layer and face
+            is uploaded straight from the mapping.
+            Compressed formats (BC1-BC7, ETC2 and EAC) are uploaded as they are
+            when supported by the driver. Compressed textures can be read
+            but cannot be written.
+
+            Supercompressed KTX2 files, cube map arrays and 1D textures are not supported.
+
+            Args:
+                path (str): Path of the ``.dds`` or ``.ktx2`` file.
+
+            Returns:
+                :py:class:`Texture`, :py:class:`TextureArray`,
+                :py:class:`TextureCube` or :py:class:`Texture3D` object
+        '''
+
+        kind, mglo, glo, size, components, dtype, levels = self.mglo.load_texture(path)
+
+        if kind == 'texture':
+            res = Texture.__new__(Texture)
+            res._samples = 0
+            res._depth = False
+        elif kind == 'texture_array':
+            res = TextureArray.__new__(TextureArray)
+        elif kind == 'texture_cube':
+            res = TextureCube.__new__(TextureCube)
+        else:
+            res = Texture3D.__new__(Texture3D)
+
+        res.mglo = mglo
+        res._glo = glo
+        res._size = size
+        res._components = components
+        res._dtype = dtype
+        res.ctx = self
+        res.extra = None
         return res
 
     def depth_texture(self, size, data=None, *, samples=0, alignment=4) -> 'Texture':
@@ -945,6 +1086,10 @@ class Context:
         res._depth = True
         res.ctx = self
         res.extra = None
+
+        if self._debug:
+            _label_object(res)
+
         return res
 
     def vertex_array(self, *args, **kwargs) -> 'VertexArray':
@@ -1094,9 +1239,14 @@ class Context:
         res._members = members
         res.ctx = self
         res.extra = None
+
+        if self._debug:
+            _label_object(res)
+
         return res
 
-    def query(self, *, samples=False, any_samples=False, time=False, primitives=False) -> 'Query':
+    def query(self, *, samples=False, any_samples=False, time=False, primitives=False,
+              statistics=False) -> 'Query':
         '''
             Create a :py:class:`Query` object.
 
@@ -1105,10 +1255,12 @@ class Context:
                 any_samples (bool): Query ``GL_ANY_SAMPLES_PASSED`` or not.
                 time (bool): Query ``GL_TIME_ELAPSED`` or not.
                 primitives (bool): Query ``GL_PRIMITIVES_GENERATED`` or not.
+                statistics (bool): Query the pipeline statistics or not.
+                    Requires OpenGL 4.6 or ``GL_ARB_pipeline_statistics_query``.
         '''
 
         res = Query.__new__(Query)
-        res.mglo = self.mglo.query(samples, any_samples, time, primitives)
+        res.mglo = self.mglo.query(samples, any_samples, time, primitives, statistics)
         res.crender = None
 
         if samples or any_samples:
@@ -1119,6 +1271,102 @@ class Context:
         res.extra = None
         return res
 
+    def query_ring(self, size=3, *, samples=False, any_samples=False, time=False, primitives=False,
+                   statistics=False) -> 'QueryRing':
+        '''
+            Create a :py:class:`QueryRing` object.
+
+            Args:
+                size (int): The number of queries to rotate.
+                    It should cover the frames the GPU runs behind.
+
+            Keyword Args:
+                samples (bool): Query ``GL_SAMPLES_PASSED`` or not.
+                any_samples (bool): Query ``GL_ANY_SAMPLES_PASSED`` or not.
+                time (bool): Query ``GL_TIME_ELAPSED`` or not.
+                primitives (bool): Query ``GL_PRIMITIVES_GENERATED`` or not.
+                statistics (bool): Query the pipeline statistics or not.
+        '''
+
+        return _create_query_ring(self, size, samples, any_samples, time, primitives, statistics)
+
+    def gpu_profiler(self, *, history=256) -> 'GPUProfiler':
+        '''
+            Create a :py:class:`GPUProfiler` object.
+
+            Keyword Args:
+                history (int): The number of measurements kept per section.
+        '''
+
+        return _create_gpu_profiler(self, history)
+
+    def tracer(self, capacity=65536, *, gpu=True) -> 'Tracer':
+        '''
+            Create a :py:class:`Tracer` object.
+
+            Args:
+                capacity (int): The number of spans kept per track.
+
+            Keyword Args:
+                gpu (bool): Bracket the GPU work with timestamp queries.
+        '''
+
+        return _create_tracer(self, capacity, gpu)
+
+    def debug_messages(self, clear=False) -> list:
+        '''
+            Get the messages reported by the driver through ``KHR_debug``.
+            The messages are only collected by contexts created with ``debug=True``.
+
+            Repeated messages are counted instead of stored again,
+            a message is identified by its source, type, id and text.
+            At most :py:attr:`debug_log_limit` messages are kept, the oldest are dropped first.
+            Each message is a dict with the ``source``, ``type``, ``id``,
+            ``severity``, ``count`` and ``message`` keys.
+
+            Example::
+
+                ctx = moderngl.create_context(debug=True)
+                ...
+                for msg in ctx.debug_messages(clear=True):
+                    print(msg['count'], msg['severity'], msg['message'])
+
+            Args:
+                clear (bool): Forget the returned messages.
+
+            Returns:
+                list: The messages in the order they were first reported.
+        '''
+
+        return _debug_messages(self, clear)
+
+    @contextmanager
+    def debug_group(self, name):
+        '''
+            Group the commands issued inside a ``with`` block with
+            ``glPushDebugGroup`` and ``glPopDebugGroup``.
+            Graphics debuggers such as RenderDoc show the groups as a tree of named passes.
+
+            The groups are also pushed without ``debug=True``, drivers not supporting
+            ``KHR_debug`` ignore them.
+
+            Example::
+
+                with ctx.debug_group('shadow pass'):
+                    shadow_vao.render()
+
+            Args:
+                name (str): The name of the group.
+        '''
+
+        self.mglo.push_debug_group(name)
+
+        try:
+            yield
+
+        finally:
+            self.mglo.pop_debug_group()
+
     def scope(self, framebuffer=None, enable_only=None, *, textures=(),
               uniform_buffers=(), storage_buffers=(), samplers=(), enable=None) -> 'Scope':
         '''
@@ -1153,6 +1401,87 @@ class Context:
         res.extra = None
         return res
 
+    def residency_manager(self, budget, *, on_evict=None) -> 'ResidencyManager':
+        '''
+            Create a :py:class:`ResidencyManager` object.
+
+            Args:
+                budget (int): The number of bytes the context may allocate before evicting.
+
+            Keyword Args:
+                on_evict (callable): Called with the texture to evict instead of
+                                     moving it to host memory.
+
+            Returns:
+                :py:class:`ResidencyManager` object
+        '''
+
+        return _create_residency_manager(self, budget, on_evict)
+
+    def frame_ring(self, size, components=3, *, dtype='f1', slots=3, name=None, path=None) -> 'FrameRing':
+        '''
+            Create a :py:class:`FrameRing` object to hand frames over to other processes.
+            Exactly one of `name` and `path` must be given.
+
+            Args:
+                size (tuple): The width and height of the frames.
+                components (int): The number of components 1, 2, 3 or 4.
+
+            Keyword Args:
+                dtype (str): Data type.
+                slots (int): The number of frame slots.
+                name (str): The name of the shared memory segment to create.
+                path (str): The path of the file to create and map.
+
+            Returns:
+                :py:class:`FrameRing` object
+        '''
+
+        return _create_frame_ring(self, size, components, dtype, slots, name, path)
+
+    def frame_sink(self, output, size, format='y4m', *, fps=60, buffers=3, workers=2, max_queue=8) -> 'FrameSink':
+        '''
+            Create a :py:class:`FrameSink` object to capture frames into a video stream.
+
+            Args:
+                output: The path of the file to create or a writable binary file object, for example a pipe.
+                size (tuple): The width and height of the frames.
+                format (str): ``'y4m'``, ``'rgb'`` or ``'rgba'``.
+
+            Keyword Args:
+                fps (int, float, Fraction or tuple): The frame rate written to the Y4M header,
+                    a tuple is a fraction. Floats are rounded to a fraction like ``2997:100``.
+                buffers (int): The number of pixel pack buffers in the readback ring.
+                workers (int): The number of conversion threads.
+                max_queue (int): The number of converted frames that may wait for the writer.
+
+            Returns:
+                :py:class:`FrameSink` object
+        '''
+
+        return _create_frame_sink(self, output, size, format, fps, buffers, workers, max_queue)
+
+    def tiled_renderer(self, size, tile_size=(1024, 1024), components=4, *,
+                       dtype='f1', samples=0, depth=True) -> 'TiledRenderer':
+        '''
+            Create a :py:class:`TiledRenderer` object.
+
+            Args:
+                size (tuple): The width and height of the output.
+                tile_size (tuple): The largest width and height of a tile.
+                components (int): The number of components 1, 2, 3 or 4.
+
+            Keyword Args:
+                dtype (str): Data type.
+                samples (int): The number of samples. Value 0 means no multisample format.
+                depth (bool): Render the tiles with a depth buffer.
+
+            Returns:
+                :py:class:`TiledRenderer` object
+        '''
+
+        return _create_tiled_renderer(self, size, tile_size, components, dtype, samples, depth)
+
     def simple_framebuffer(self, size, components=4, *, samples=0, dtype='f1') -> 'Framebuffer':
         '''
             Creates a :py:class:`Framebuffer` with a single color attachment
@@ -1181,20 +1510,31 @@ class Context:
             used as the destination for rendering. The buffers for Framebuffer
             objects reference images from either Textures or Renderbuffers.
 
+            A single layer of a :py:class:`TextureArray` or :py:class:`Texture3D`,
+            or a single face of a :py:class:`TextureCube` is attached with an
+            ``(texture, layer)`` tuple. Attaching the whole object makes the
+            framebuffer layered: a geometry shader selects the layer to render
+            into with ``gl_Layer``. Every attachment of a layered framebuffer
+            must be layered.
+
             Args:
-                color_attachments (list): A list of :py:class:`Texture` or
-                                          :py:class:`Renderbuffer` objects.
+                color_attachments (list): A list of :py:class:`Texture`,
+                                          :py:class:`Renderbuffer`,
+                                          :py:class:`TextureArray`,
+                                          :py:class:`TextureCube` or
+                                          :py:class:`Texture3D` objects
+                                          or ``(texture, layer)`` tuples.
                 depth_attachment (Renderbuffer or Texture): The depth attachment.
 
             Returns:
                 :py:class:`Framebuffer` object
         '''
 
-        if type(color_attachments) is Texture or type(color_attachments) is Renderbuffer:
+        if type(color_attachments) in ATTACHMENT_TYPES or _is_layer_attachment(color_attachments):
             color_attachments = (color_attachments,)
 
-        ca_mglo = tuple(x.mglo for x in color_attachments)
-        da_mglo = None if depth_attachment is None else depth_attachment.mglo
+        ca_mglo = tuple(_attachment_mglo(x) for x in color_attachments)
+        da_mglo = None if depth_attachment is None else _attachment_mglo(depth_attachment)
 
         res = Framebuffer.__new__(Framebuffer)
         res.mglo, res._size, res._samples, res._glo = self.mglo.framebuffer(ca_mglo, da_mglo)
@@ -1202,6 +1542,10 @@ class Context:
         res._depth_attachment = depth_attachment
         res.ctx = self
         res.extra = None
+
+        if self._debug:
+            _label_object(res)
+
         return res
 
     def renderbuffer(self, size, components=4, *, samples=0, dtype='f1') -> 'Renderbuffer':
@@ -1289,6 +1633,10 @@ class Context:
         res._members = members
         res.ctx = self
         res.extra = None
+
+        if self._debug:
+            _label_object(res)
+
         return res
 
     def sampler(self, repeat_x=True, repeat_y=True, repeat_z=True, filter=None,
@@ -1359,6 +1707,20 @@ class Context:
         '''
         self.mglo.clear_samplers(start, end)
 
+    def reset_state_cache(self) -> None:
+        '''
+            Forget the framebuffer state moderngl believes to be applied.
+
+            :py:meth:`Framebuffer.use` only changes the framebuffer binding,
+            viewport, scissor, color mask and depth mask when they differ from
+            the last applied values. Call this method after OpenGL code outside
+            of moderngl changed any of them, for example a GUI toolkit binding
+            its own framebuffer, so the next :py:meth:`Framebuffer.use` applies
+            the whole state again.
+        '''
+
+        self.mglo.reset_state_cache()
+
     def core_profile_check(self) -> None:
         '''
             Core profile check.
@@ -1416,7 +1778,21 @@ class Context:
         self.mglo.release()
 
 
-def create_context(require=None, standalone=False, share=False, **settings) -> Context:
+ATTACHMENT_TYPES = (Texture, Renderbuffer, TextureArray, TextureCube, Texture3D)
+
+
+def _is_layer_attachment(attachment):
+    return type(attachment) is tuple and len(attachment) == 2 and type(attachment[1]) is int
+
+
+def _attachment_mglo(attachment):
+    if _is_layer_attachment(attachment):
+        return (attachment[0].mglo, attachment[1])
+
+    return attachment.mglo
+
+
+def create_context(require=None, standalone=False, share=False, debug=False, **settings) -> Context:
     '''
         Create a ModernGL context by loading OpenGL functions from an existing OpenGL context.
         An OpenGL context must exists.
@@ -1435,6 +1811,8 @@ def create_context(require=None, standalone=False, share=False, **settings) -> C
         Keyword Arguments:
             require (int): OpenGL version code (default: 330)
             standalone (bool): Headless flag
+            debug (bool): Collect the ``KHR_debug`` messages and label the objects,
+                          see :py:meth:`Context.debug_messages`
             **settings: Other backend specific settings
 
         Returns:
@@ -1453,12 +1831,19 @@ def create_context(require=None, standalone=False, share=False, **settings) -> C
     ctx = Context.__new__(Context)
     ctx.mglo, ctx.version_code = mgl.create_context(glversion=require, mode=mode, **settings)
     ctx._info = None
+    ctx._texture_pool = None
+    ctx._pick_pool = None
+    ctx._stats = None
+    ctx._debug = debug
     ctx.extra = None
 
     if ctx.version_code < require:
         raise ValueError('Requested OpenGL version {}, got version {}'.format(
             require, ctx.version_code))
 
+    if debug:
+        ctx.mglo.debug_output(True)
+
     if standalone:
         ctx._screen = None
         ctx.fbo = None
@@ -1470,7 +1855,7 @@ def create_context(require=None, standalone=False, share=False, **settings) -> C
     return ctx
 
 
-def create_standalone_context(require=None, share=False, **settings) -> 'Context':
+def create_standalone_context(require=None, share=False, debug=False, **settings) -> 'Context':
     '''
         Create a standalone ModernGL context.
         The preferred way to make a context ``
@@ -1485,6 +1870,8 @@ def create_standalone_context(require=None, share=False, **settings) -> 'Context
 
         Keyword Arguments:
             require (int): OpenGL version code.
+            debug (bool): Collect the ``KHR_debug`` messages and label the objects,
+                          see :py:meth:`Context.debug_messages`
 
         Returns:
             :py:class:`Context` object
@@ -1499,10 +1886,17 @@ def create_standalone_context(require=None, share=False, **settings) -> 'Context
     ctx._screen = None
     ctx.fbo = None
     ctx._info = None
+    ctx._texture_pool = None
+    ctx._pick_pool = None
+    ctx._stats = None
+    ctx._debug = debug
     ctx.extra = None
 
     if require is not None and ctx.version_code < require:
         raise ValueError('Requested OpenGL version {}, got version {}'.format(
             require, ctx.version_code))
 
+    if debug:
+        ctx.mglo.debug_output(True)
+
     return ctx
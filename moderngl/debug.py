@@ -0,0 +1,77 @@
+import sys
+
+from .buffer import Buffer
+from .compute_shader import ComputeShader
+from .framebuffer import Framebuffer
+from .program import Program
+from .texture import Texture
+from .texture_3d import Texture3D
+from .texture_array import TextureArray
+from .texture_cube import TextureCube
+
+__all__ = []
+
+SOURCES = {
+    0x8246: 'api',
+    0x8247: 'window_system',
+    0x8248: 'shader_compiler',
+    0x8249: 'third_party',
+    0x824A: 'application',
+    0x824B: 'other',
+}
+
+TYPES = {
+    0x824C: 'error',
+    0x824D: 'deprecated_behavior',
+    0x824E: 'undefined_behavior',
+    0x824F: 'portability',
+    0x8250: 'performance',
+    0x8251: 'other',
+    0x8268: 'marker',
+}
+
+SEVERITIES = {
+    0x9146: 'high',
+    0x9147: 'medium',
+    0x9148: 'low',
+    0x826B: 'notification',
+}
+
+# The glObjectLabel identifiers of the labeled objects
+IDENTIFIERS = {
+    Buffer: 0x82E0,  # GL_BUFFER
+    Program: 0x82E2,  # GL_PROGRAM
+    ComputeShader: 0x82E2,  # GL_PROGRAM
+    Texture: 0x1702,  # GL_TEXTURE
+    Texture3D: 0x1702,
+    TextureArray: 0x1702,
+    TextureCube: 0x1702,
+    Framebuffer: 0x8D40,  # GL_FRAMEBUFFER
+}
+
+
+def _debug_messages(ctx, clear):
+    return [
+        {
+            'source': SOURCES.get(source, 'other'),
+            'type': TYPES.get(type, 'other'),
+            'id': id,
+            'severity': SEVERITIES.get(severity, 'notification'),
+            'count': count,
+            'message': message,
+        }
+        for source, type, id, severity, count, message in ctx.mglo.debug_messages(clear)
+    ]
+
+
+def _label_object(obj):
+    # Name the object after the line that created it, outside of moderngl
+    frame = sys._getframe(1)
+    while frame is not None and frame.f_globals.get('__name__', '').startswith('moderngl'):
+        frame = frame.f_back
+
+    label = type(obj).__name__
+    if frame is not None:
+        label += ' %s:%d' % (frame.f_code.co_filename, frame.f_lineno)
+
+    obj.ctx.mglo.object_label(IDENTIFIERS[type(obj)], obj._glo, label)
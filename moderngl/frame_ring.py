@@ -0,0 +1,325 @@
+import mmap
+import struct
+import time
+
+from .texture import DTYPE_SIZE
+
+__all__ = ['FrameRing', 'open_frame_ring']
+
+
+# magic, version, slot stride, slots, width, height, components, dtype, latest sequence
+HEADER = struct.Struct('<4sIQIIII2s6xQ')
+SLOT_HEADER = struct.Struct('<QQ')
+MAGIC = b'MGLR'
+VERSION = 1
+PAGE_SIZE = 4096
+
+
+class FrameRing:
+    '''
+        A FrameRing hands frames over to other processes without copying them.
+
+        The frames live in a named shared memory segment or a memory mapped file.
+        The memory is split into slots, the producer reads each frame straight
+        into the next slot with :py:meth:`write` and then publishes its sequence number.
+        Consumers open the same memory with :py:func:`open_frame_ring`, wait for
+        new sequence numbers and access the pixels of the slots in place.
+
+        A slot is reused after as many frames as there are slots. Consumers that
+        keep a frame longer can detect it with :py:meth:`check`.
+
+        A FrameRing object cannot be instantiated directly.
+        Use :py:meth:`Context.frame_ring` to create a producer
+        or :py:func:`open_frame_ring` to create a consumer.
+    '''
+
+    __slots__ = ['_memory', '_owner', '_shared', '_view', '_slots', '_stride', '_size', '_components', '_dtype',
+                 'ctx', 'extra']
+
+    def __init__(self):
+        self._memory = None
+        self._owner = None
+        self._shared = None
+        self._view = None
+        self._slots = None
+        self._stride = None
+        self._size = None
+        self._components = None
+        self._dtype = None
+        self.ctx = None  #: The context this object belongs to, None for consumers
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<FrameRing: %d slots, sequence %d>' % (self._slots, self.sequence)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.release()
+
+    @property
+    def size(self) -> tuple:
+        '''
+            tuple: The width and height of the frames.
+        '''
+
+        return self._size
+
+    @property
+    def components(self) -> int:
+        '''
+            int: The number of components of the pixels.
+        '''
+
+        return self._components
+
+    @property
+    def dtype(self) -> str:
+        '''
+            str: The data type of the pixels.
+        '''
+
+        return self._dtype
+
+    @property
+    def slots(self) -> int:
+        '''
+            int: The number of frame slots.
+        '''
+
+        return self._slots
+
+    @property
+    def frame_size(self) -> int:
+        '''
+            int: The size of a frame in bytes.
+        '''
+
+        width, height = self._size
+        return width * height * self._components * DTYPE_SIZE[self._dtype]
+
+    @property
+    def sequence(self) -> int:
+        '''
+            int: The sequence number of the last published frame. Zero before the first one.
+        '''
+
+        return struct.unpack_from('<Q', self._view, HEADER.size - 8)[0]
+
+    def write(self, framebuffer, *, viewport=None, attachment=0) -> int:
+        '''
+            Read a frame from a framebuffer straight into the next slot and publish it.
+
+            Args:
+                framebuffer (Framebuffer): The framebuffer to read.
+
+            Keyword Args:
+                viewport (tuple): The region to read, it must match :py:attr:`size`.
+                    The origin of the framebuffer by default.
+                attachment (int): The color attachment.
+
+            Returns:
+                int: The sequence number of the frame.
+        '''
+
+        if self.ctx is None:
+            raise ValueError('only the producer can write frames')
+
+        if viewport is None:
+            viewport = (0, 0) + self._size
+        elif tuple(viewport[-2:]) != self._size:
+            raise ValueError('the viewport must match the size of the frames')
+
+        sequence = self.sequence + 1
+        offset = self._slot_offset(sequence)
+
+        # The slot is marked incomplete while the pixels are overwritten
+        SLOT_HEADER.pack_into(self._view, offset, 0, self.frame_size)
+        framebuffer.read_into(
+            self._view, tuple(viewport), self._components, attachment=attachment,
+            dtype=self._dtype, write_offset=offset + PAGE_SIZE,
+        )
+        SLOT_HEADER.pack_into(self._view, offset, sequence, self.frame_size)
+        struct.pack_into('<Q', self._view, HEADER.size - 8, sequence)
+        return sequence
+
+    def wait(self, after=0, timeout=None) -> int:
+        '''
+            Wait for a frame newer than `after`.
+
+            Args:
+                after (int): The last sequence number seen by the caller.
+                timeout (float): The number of seconds to wait. Waits forever by default.
+
+            Returns:
+                int: The latest sequence number or zero on timeout.
+        '''
+
+        deadline = None if timeout is None else time.monotonic() + timeout
+        delay = 0.0001
+
+        while True:
+            sequence = self.sequence
+            if sequence > after:
+                return sequence
+            if deadline is not None and time.monotonic() >= deadline:
+                return 0
+            time.sleep(delay)
+            delay = min(delay * 2, 0.005)
+
+    def frame(self, sequence) -> memoryview:
+        '''
+            Access the pixels of a frame in place.
+
+            Args:
+                sequence (int): The sequence number of the frame.
+
+            Returns:
+                memoryview: The pixels laid out like :py:meth:`Framebuffer.read` returns them.
+        '''
+
+        if not self.check(sequence):
+            raise ValueError('the frame %d is not available' % sequence)
+
+        start = self._slot_offset(sequence) + PAGE_SIZE
+        return self._view[start:start + self.frame_size]
+
+    def check(self, sequence) -> bool:
+        '''
+            Check whether a slot still holds a frame.
+            Call it after processing a frame to detect that it was overwritten meanwhile.
+
+            Args:
+                sequence (int): The sequence number of the frame.
+
+            Returns:
+                bool
+        '''
+
+        if sequence < 1:
+            return False
+
+        return SLOT_HEADER.unpack_from(self._view, self._slot_offset(sequence))[0] == sequence
+
+    def release(self) -> None:
+        '''
+            Unmap the memory. The producer also removes the shared memory segment.
+            Views returned by :py:meth:`frame` must be released before.
+        '''
+
+        if self._view is None:
+            return
+
+        self._view.release()
+        self._view = None
+
+        self._memory.close()
+
+        if self._shared and self._owner:
+            self._memory.unlink()
+
+    def _slot_offset(self, sequence):
+        return PAGE_SIZE + (sequence - 1) % self._slots * self._stride
+
+
+def _open_memory(name, path, size):
+    '''
+        Open or create the shared memory, a size creates it.
+        Returns the memory object, whether it is a shared memory segment and a memoryview.
+    '''
+
+    if path is not None:
+        with open(path, 'r+b' if size is None else 'w+b') as f:
+            if size is not None:
+                f.truncate(size)
+            memory = mmap.mmap(f.fileno(), 0)
+        return memory, False, memoryview(memory)
+
+    from multiprocessing import shared_memory
+
+    memory = shared_memory.SharedMemory(name, create=size is not None, size=size or 0)
+
+    if size is None:
+        # Consumers must not remove the segment when they exit
+        try:
+            from multiprocessing import resource_tracker
+            resource_tracker.unregister(memory._name, 'shared_memory')
+        except Exception:
+            pass
+
+    return memory, True, memory.buf
+
+
+def _create_frame_ring(ctx, size, components, dtype, slots, name, path):
+    if (name is None) == (path is None):
+        raise ValueError('either a name or a path is required')
+
+    if dtype not in DTYPE_SIZE:
+        raise ValueError('invalid dtype: %r' % (dtype,))
+
+    if slots < 1:
+        raise ValueError('the ring must hold at least one frame')
+
+    width, height = size
+    frame_size = width * height * components * DTYPE_SIZE[dtype]
+
+    # Every slot starts with a page holding its header, the pixels are page aligned
+    stride = PAGE_SIZE + (frame_size + PAGE_SIZE - 1) // PAGE_SIZE * PAGE_SIZE
+    memory, shared, view = _open_memory(name, path, PAGE_SIZE + stride * slots)
+    HEADER.pack_into(view, 0, MAGIC, VERSION, stride, slots, width, height, components, dtype.encode(), 0)
+
+    res = FrameRing.__new__(FrameRing)
+    res._memory = memory
+    res._owner = True
+    res._shared = shared
+    res._view = view
+    res._slots = slots
+    res._stride = stride
+    res._size = (width, height)
+    res._components = components
+    res._dtype = dtype
+    res.ctx = ctx
+    res.extra = None
+    return res
+
+
+def open_frame_ring(name=None, *, path=None) -> FrameRing:
+    '''
+        Open the FrameRing of a producer as a consumer. No context is needed.
+
+        Args:
+            name (str): The name of the shared memory segment.
+
+        Keyword Args:
+            path (str): The path of the memory mapped file.
+
+        Returns:
+            :py:class:`FrameRing` object
+    '''
+
+    if (name is None) == (path is None):
+        raise ValueError('either a name or a path is required')
+
+    memory, shared, view = _open_memory(name, path, None)
+    magic, version, stride, slots, width, height, components, dtype, _ = HEADER.unpack_from(view, 0)
+
+    if magic != MAGIC or version != VERSION:
+        view.release()
+        memory.close()
+        raise ValueError('not a frame ring')
+
+    res = FrameRing.__new__(FrameRing)
+    res._memory = memory
+    res._owner = False
+    res._shared = shared
+    res._view = view
+    res._slots = slots
+    res._stride = stride
+    res._size = (width, height)
+    res._components = components
+    res._dtype = dtype.decode()
+    res.ctx = None
+    res.extra = None
+    return res
@@ -0,0 +1,260 @@
+import collections
+import time
+from concurrent.futures import ThreadPoolExecutor
+from fractions import Fraction
+
+try:
+    import moderngl.mgl as mgl
+except ImportError:
+    pass
+
+__all__ = ['FrameSink']
+
+
+class FrameSink:
+    '''
+        A FrameSink captures rendered frames into a Y4M or raw video stream.
+
+        Every captured frame is read into the next buffer of a pixel pack buffer ring.
+        A buffer is mapped only when the ring wraps around, several frames later,
+        so the readback does not stall rendering. The pixels are then converted
+        on a pool of worker threads and written in order by a writer thread.
+        Rendering, readback, conversion and disk I/O overlap.
+
+        The ``'y4m'`` format writes BT.601 limited range YUV 4:2:0 frames, the ``'rgb'``
+        and ``'rgba'`` formats write raw top down pixels for tools like ``ffmpeg -f rawvideo``.
+
+        A FrameSink object cannot be instantiated directly.
+        Use :py:meth:`Context.frame_sink` to create one.
+    '''
+
+    __slots__ = ['_file', '_owns_file', '_size', '_format', '_components', '_buffers', '_pending', '_frame',
+                 '_convert_pool', '_write_pool', '_queue', '_max_queue', '_frames', '_totals', '_max_queue_depth',
+                 'ctx', 'extra']
+
+    def __init__(self):
+        self._file = None
+        self._owns_file = None
+        self._size = None
+        self._format = None
+        self._components = None
+        self._buffers = None
+        self._pending = None
+        self._frame = None
+        self._convert_pool = None
+        self._write_pool = None
+        self._queue = None
+        self._max_queue = None
+        self._frames = None
+        self._totals = None
+        self._max_queue_depth = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<FrameSink: %d frames>' % self._frames
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    @property
+    def size(self) -> tuple:
+        '''
+            tuple: The width and height of the frames.
+        '''
+
+        return self._size
+
+    @property
+    def format(self) -> str:
+        '''
+            str: The output format ``'y4m'``, ``'rgb'`` or ``'rgba'``.
+        '''
+
+        return self._format
+
+    @property
+    def frames(self) -> int:
+        '''
+            int: The number of frames written to the output.
+        '''
+
+        return self._frames
+
+    @property
+    def queue_depth(self) -> int:
+        '''
+            int: The number of frames read back but not yet written.
+        '''
+
+        return sum(not future.done() for future in self._queue)
+
+    @property
+    def stats(self) -> dict:
+        '''
+            dict: The average latency of the ``readback``, ``convert`` and ``write``
+            stages in seconds, the number of ``frames`` and the current and
+            largest ``queue_depth``.
+        '''
+
+        count = max(self._frames, 1)
+        result = {stage: total / count for stage, total in self._totals.items()}
+        result['frames'] = self._frames
+        result['queue_depth'] = self.queue_depth
+        result['max_queue_depth'] = self._max_queue_depth
+        return result
+
+    def write(self, framebuffer, *, attachment=0) -> None:
+        '''
+            Capture the content of a framebuffer.
+
+            Args:
+                framebuffer (Framebuffer): The framebuffer to capture, its origin is read.
+
+            Keyword Args:
+                attachment (int): The color attachment.
+        '''
+
+        buffer = self._buffers[self._frame % len(self._buffers)]
+
+        # Reusing a buffer of the ring completes the oldest readback first
+        if len(self._pending) == len(self._buffers):
+            self._submit(self._pending.popleft())
+
+        framebuffer.read_into(buffer, (0, 0) + self._size, self._components, attachment=attachment)
+        self._pending.append(buffer)
+        self._frame += 1
+
+    def flush(self) -> None:
+        '''
+            Wait until every captured frame is written.
+        '''
+
+        while self._pending:
+            self._submit(self._pending.popleft())
+
+        while self._queue:
+            self._queue.popleft().result()
+
+        self._file.flush()
+
+    def close(self) -> None:
+        '''
+            Write the remaining frames, stop the worker threads and release the buffers.
+            The output is closed if the sink opened it.
+        '''
+
+        if self._buffers is None:
+            return
+
+        self.flush()
+        self._convert_pool.shutdown()
+        self._write_pool.shutdown()
+
+        for buffer in self._buffers:
+            buffer.release()
+
+        self._buffers = None
+
+        if self._owns_file:
+            self._file.close()
+
+    def _submit(self, buffer):
+        start = time.perf_counter()
+        data = buffer.read()
+        self._totals['readback'] += time.perf_counter() - start
+
+        converted = self._convert_pool.submit(self._convert, data)
+        self._queue.append(self._write_pool.submit(self._write, converted))
+        self._max_queue_depth = max(self._max_queue_depth, len(self._queue))
+
+        # Bound the memory held by the queue, the oldest frames are usually done by now
+        while len(self._queue) > self._max_queue or (self._queue and self._queue[0].done()):
+            self._queue.popleft().result()
+
+    def _convert(self, data):
+        start = time.perf_counter()
+        width, height = self._size
+
+        if self._format == 'y4m':
+            out = bytearray(6 + width * height + (width + 1) // 2 * ((height + 1) // 2) * 2)
+            out[:6] = b'FRAME\n'
+            mgl.convert_frame(data, memoryview(out)[6:], width, height, self._components, 'yuv420')
+        else:
+            out = bytearray(width * height * len(self._format))
+            mgl.convert_frame(data, out, width, height, self._components, self._format)
+
+        return out, time.perf_counter() - start
+
+    def _write(self, converted):
+        out, convert_time = converted.result()
+        start = time.perf_counter()
+        self._file.write(out)
+        self._totals['convert'] += convert_time
+        self._totals['write'] += time.perf_counter() - start
+        self._frames += 1
+
+
+def _frame_rate(fps):
+    # Floats are rounded to the nearest fraction with a small denominator, 29.97 gives 2997:100
+    if isinstance(fps, tuple):
+        numerator, denominator = fps
+    elif isinstance(fps, (int, float, Fraction)):
+        rate = Fraction(fps).limit_denominator(1001)
+        numerator, denominator = rate.numerator, rate.denominator
+    else:
+        raise ValueError('invalid fps: %r' % (fps,))
+
+    if not isinstance(numerator, int) or not isinstance(denominator, int) or numerator <= 0 or denominator <= 0:
+        raise ValueError('invalid fps: %r' % (fps,))
+
+    return numerator, denominator
+
+
+def _create_frame_sink(ctx, output, size, format, fps, buffers, workers, max_queue):
+    if format not in ('y4m', 'rgb', 'rgba'):
+        raise ValueError('invalid format: %r' % (format,))
+
+    if buffers < 1:
+        raise ValueError('the sink must have at least one buffer')
+
+    if workers < 1:
+        raise ValueError('the sink must have at least one worker')
+
+    if max_queue < 1:
+        raise ValueError('the queue must hold at least one frame')
+
+    width, height = size
+    components = 4 if format == 'rgba' else 3
+    numerator, denominator = _frame_rate(fps)
+
+    # Everything is validated before the output is opened, a failed call leaves no file behind
+    owns_file = isinstance(output, str)
+    file = open(output, 'wb') if owns_file else output
+
+    if format == 'y4m':
+        file.write(('YUV4MPEG2 W%d H%d F%d:%d Ip A1:1 C420jpeg\n' % (width, height, numerator, denominator)).encode())
+
+    res = FrameSink.__new__(FrameSink)
+    res._file = file
+    res._owns_file = owns_file
+    res._size = (width, height)
+    res._format = format
+    res._components = components
+    res._buffers = tuple(ctx.buffer(reserve=width * height * components) for _ in range(buffers))
+    res._pending = collections.deque()
+    res._frame = 0
+    res._convert_pool = ThreadPoolExecutor(workers)
+    res._write_pool = ThreadPoolExecutor(1)
+    res._queue = collections.deque()
+    res._max_queue = max_queue
+    res._frames = 0
+    res._totals = {'readback': 0.0, 'convert': 0.0, 'write': 0.0}
+    res._max_queue_depth = 0
+    res.ctx = ctx
+    res.extra = None
+    return res
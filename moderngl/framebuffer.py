@@ -1,11 +1,17 @@
 from typing import Dict, Tuple, Union
 
 from .buffer import Buffer
+from .picking import PickResult, _create_pick_result
 from .renderbuffer import Renderbuffer
-from .texture import Texture
+from .texture import ARRAY_FORMATS, LINEAR, NEAREST, Texture
 
 __all__ = ['Framebuffer']
 
+RESOLVE_FILTERS = {
+    'nearest': NEAREST,
+    'linear': LINEAR,
+}
+
 
 class Framebuffer:
     '''
@@ -176,6 +182,7 @@ class Framebuffer:
     def color_attachments(self) -> Tuple[Union[Texture, Renderbuffer], ...]:
         '''
             tuple: The color attachments of the framebuffer.
+            Single layer attachments are ``(texture, layer)`` tuples.
         '''
 
         return self._color_attachments
@@ -284,6 +291,236 @@ class Framebuffer:
 
         return self.mglo.read_into(buffer, viewport, components, attachment, alignment, dtype, write_offset)
 
+    def read_array(self, viewport=None, components=3, *, attachment=0, dtype='f1',
+                   out_dtype=None, flip=True, out=None):
+        '''
+            Read the content of the framebuffer as a ``(height, width, components)`` array.
+
+            The rows are flipped to top down order and converted to `out_dtype`
+            in a single pass over the pixels, without intermediate copies.
+            Supported conversions are ``'f1'`` to ``'f4'`` (normalized),
+            ``'f2'`` to ``'f4'`` and ``'f4'`` to ``'f1'`` (clamped).
+
+            The result supports the buffer protocol, ``numpy.asarray`` wraps it without a copy.
+            Half floats are exposed as ``'H'`` bit patterns, view them as ``'f2'`` in numpy.
+
+            Args:
+                viewport (tuple): The viewport.
+                components (int): The number of components to read.
+
+            Keyword Args:
+                attachment (int): The color attachment, use ``-1`` for the depth attachment.
+                dtype (str): The data type of the pixels read.
+                out_dtype (str): The data type of the result. Same as `dtype` by default.
+                flip (bool): Return the rows in top down order.
+                out: A writable contiguous buffer, for example a numpy array, to fill instead of allocating.
+
+            Returns:
+                memoryview or `out`
+        '''
+
+        if out_dtype is None:
+            out_dtype = dtype
+
+        if viewport is None:
+            width, height = self._size
+        else:
+            viewport = tuple(viewport)
+            width, height = viewport[-2:]
+
+        if attachment == -1:
+            components = 1
+
+        if out is not None:
+            self.mglo.read_array(out, viewport, components, attachment, dtype, out_dtype, flip)
+            return out
+
+        if out_dtype not in ARRAY_FORMATS:
+            raise ValueError('invalid dtype: %r' % (out_dtype,))
+
+        data = bytearray(width * height * components * int(out_dtype[1]))
+        self.mglo.read_array(data, viewport, components, attachment, dtype, out_dtype, flip)
+        return memoryview(data).cast(ARRAY_FORMATS[out_dtype], (height, width, components))
+
+    def read_scaled(self, size, components=3, *, viewport=None, attachment=0, dtype='f1', filter='linear') -> bytes:
+        '''
+            Downscale a color attachment on the GPU and read only the reduced image.
+
+            Multisample framebuffers are resolved first. With the ``'linear'`` filter
+            the image is halved repeatedly until it is within twice the target size,
+            which averages every source pixel like a box filter. The last step converts
+            to `dtype`, so only ``size`` pixels of the target format are transferred.
+
+            Args:
+                size (tuple): The width and height of the result.
+                components (int): The number of components to read.
+
+            Keyword Args:
+                viewport (tuple): The source region. The whole framebuffer by default.
+                attachment (int): The color attachment.
+                dtype (str): ``'f1'``, ``'f2'`` or ``'f4'``.
+                filter (str): ``'linear'`` or ``'nearest'``.
+
+            Returns:
+                bytes
+        '''
+
+        if filter not in RESOLVE_FILTERS:
+            raise ValueError('invalid filter: %r' % (filter,))
+
+        if viewport is not None:
+            viewport = tuple(viewport)
+
+        return self.mglo.read_scaled(tuple(size), components, attachment, viewport, dtype, filter == 'linear')
+
+    def read_all(self, attachments=None, *, depth=True, viewport=None, out=None) -> tuple:
+        '''
+            Read several attachments with a single call.
+
+            Every attachment is read with its own components and dtype,
+            the depth attachment is read as ``'f4'``. The framebuffer is bound
+            and the pixel store is set up only once, and the pixels land in one arena.
+            The rows are in bottom up order like :py:meth:`read` returns them.
+
+            When `out` is a :py:class:`Buffer` the pixels are read asynchronously
+            into it and the byte offsets of the attachments are returned instead of views.
+
+            Args:
+                attachments (tuple): The color attachment indices. Reads every color attachment by default.
+
+            Keyword Args:
+                depth (bool): Read the depth attachment too, if the framebuffer has one.
+                viewport (tuple): The viewport.
+                out: A :py:class:`Buffer` or a writable buffer to use as the arena instead of allocating.
+
+            Returns:
+                tuple: A ``(height, width, components)`` memoryview or an offset for every attachment,
+                the depth attachment comes last.
+        '''
+
+        if viewport is None:
+            width, height = self._size
+        else:
+            viewport = tuple(viewport)
+            width, height = viewport[-2:]
+
+        colors = self._color_attachments
+        if attachments is None:
+            attachments = range(len(colors)) if colors is not None else (0,)
+
+        layout = []
+        for index in attachments:
+            attachment = colors[index] if colors is not None else None
+            if type(attachment) is tuple:
+                attachment = attachment[0]
+            if attachment is None:
+                layout.append((index, 4, 'f1'))
+            else:
+                layout.append((index, attachment.components, attachment.dtype))
+
+        if depth and (self._depth_attachment is not None or colors is None):
+            layout.append((-1, 1, 'f4'))
+
+        # Every attachment starts at a 16 byte aligned offset of the arena
+        # An invalid viewport sizes an empty arena and is reported by the read
+        reads, offset, pixels = [], 0, max(width, 0) * max(height, 0)
+        for index, components, dtype in layout:
+            reads.append((index, components, dtype, offset))
+            offset += (pixels * components * int(dtype[1]) + 15) & ~15
+
+        if type(out) is Buffer:
+            self.mglo.read_all(out.mglo, tuple(reads), viewport)
+            return tuple(read[3] for read in reads)
+
+        if out is None:
+            out = bytearray(offset)
+
+        self.mglo.read_all(out, tuple(reads), viewport)
+
+        arena = memoryview(out).cast('B')
+        return tuple(
+            arena[start:start + width * height * components * int(dtype[1])].cast(ARRAY_FORMATS[dtype], (height, width, components))
+            for index, components, dtype, start in reads
+        )
+
+    def pick(self, x, y, width=1, height=1, *, attachment=0, components=1, dtype='u4') -> 'PickResult':
+        '''
+            Read a small region without waiting for the GPU.
+
+            The pixels are copied into a pooled pixel pack buffer and a fence
+            is inserted after the copy. Poll the returned :py:class:`PickResult`
+            on the following frames instead of stalling the pipeline like :py:meth:`read` does.
+
+            Args:
+                x (int): The left edge of the region.
+                y (int): The bottom edge of the region.
+                width (int): The width of the region.
+                height (int): The height of the region.
+
+            Keyword Args:
+                attachment (int): The color attachment, use ``-1`` for the depth attachment.
+                components (int): The number of components to read.
+                dtype (str): Data type, ``'u4'`` matches object id attachments.
+
+            Returns:
+                :py:class:`PickResult` object
+        '''
+
+        return _create_pick_result(self, x, y, width, height, components, attachment, dtype)
+
+    def invalidate(self, attachments=None, viewport=None) -> None:
+        '''
+            Tell the driver that the content of some attachments is no longer needed.
+
+            Transient attachments such as depth buffers or multisample colors
+            are usually not needed after a pass. Invalidating them saves the
+            driver from preserving their content.
+            This is only a hint, it does nothing before OpenGL 4.3.
+
+            Args:
+                attachments (tuple): The color attachment indices, use ``-1`` for the depth attachment.
+                    Invalidates every attachment by default.
+                viewport (tuple): The region to invalidate. Invalidates the whole framebuffer by default.
+        '''
+
+        if attachments is None:
+            if self._color_attachments is None:
+                attachments = (0, -1)
+            else:
+                attachments = tuple(range(len(self._color_attachments)))
+                if self._depth_attachment is not None:
+                    attachments += (-1,)
+
+        if viewport is not None:
+            viewport = tuple(viewport)
+
+        self.mglo.invalidate(tuple(attachments), viewport)
+
+    def resolve(self, dst, attachment=0, viewport=None, *, dst_attachment=0, filter='nearest') -> None:
+        '''
+            Resolve a single attachment of a multisample framebuffer into another framebuffer.
+
+            Unlike :py:meth:`Context.copy_framebuffer` only the requested attachment
+            and region are copied.
+
+            Args:
+                dst (Framebuffer): The destination framebuffer.
+                attachment (int): The color attachment, use ``-1`` for the depth attachment.
+                viewport (tuple): The region to resolve. Resolves the common size of the framebuffers by default.
+
+            Keyword Args:
+                dst_attachment (int): The color attachment of the destination.
+                filter (str): ``'nearest'`` or ``'linear'``. The depth attachment requires ``'nearest'``.
+        '''
+
+        if viewport is not None:
+            viewport = tuple(viewport)
+
+        if filter not in RESOLVE_FILTERS:
+            raise ValueError('invalid filter: %r' % (filter,))
+
+        self.mglo.resolve(dst.mglo, attachment, viewport, dst_attachment, RESOLVE_FILTERS[filter])
+
     def release(self) -> None:
         '''
             Release the ModernGL object.
@@ -0,0 +1,163 @@
+import weakref
+
+from .texture import ARRAY_FORMATS
+
+__all__ = ['PickResult']
+
+
+PICK_BUFFER_SIZE = 4096
+
+
+class PickResult:
+    '''
+        A PickResult is the deferred result of :py:meth:`Framebuffer.pick`.
+
+        The pixels are copied into a pixel pack buffer on the GPU timeline
+        and a fence is inserted after the copy. Checking :py:attr:`ready`
+        never blocks, poll it on the following frames and call :py:meth:`result`
+        once it is set to get the pixels without a pipeline stall.
+
+        A result dropped before it arrived gives its fence and buffer back
+        when it is garbage collected.
+
+        A PickResult object cannot be instantiated directly.
+        Use :py:meth:`Framebuffer.pick` to create one.
+    '''
+
+    __slots__ = [
+        '_pool', '_buffer', '_nbytes', '_shape', '_format', '_fence', '_value', '_finalizer',
+        'ctx', 'extra', '__weakref__',
+    ]
+
+    def __init__(self):
+        self._pool = None
+        self._buffer = None
+        self._nbytes = None
+        self._shape = None
+        self._format = None
+        self._fence = None
+        self._value = None
+        self._finalizer = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<PickResult: %s>' % ('ready' if self.ready else 'pending')
+
+    @property
+    def ready(self) -> bool:
+        '''
+            bool: True if the pixels arrived. Checking it does not block.
+        '''
+
+        if self._value is None and self._fence is not None and self.ctx.mglo.fence_wait(self._fence, 0.0):
+            self._fetch()
+
+        return self._value is not None
+
+    def result(self, wait=True):
+        '''
+            Get the pixels.
+
+            Args:
+                wait (bool): Block until the pixels arrive.
+                    Returns None instead if they are not ready yet.
+
+            Returns:
+                memoryview: A ``(height, width, components)`` view of the pixels.
+        '''
+
+        if self._value is None and self._fence is not None:
+            if wait:
+                self.ctx.mglo.fence_wait(self._fence, 3600.0)
+                self._fetch()
+            elif not self.ready:
+                return None
+
+        return self._value
+
+    def release(self) -> None:
+        '''
+            Drop the result and give the buffer back to the pool before it arrived.
+        '''
+
+        if self._fence is not None:
+            self._finalizer()
+            self._fence = None
+            self._buffer = None
+
+    def _fetch(self):
+        data = bytearray(self._nbytes)
+        self._buffer.read_into(data, self._nbytes)
+        self._value = memoryview(data).cast(self._format, self._shape)
+        self.release()
+
+
+class _PickPool:
+    '''
+        The pixel pack buffers used by the pick results of a context.
+    '''
+
+    __slots__ = ['_free', 'ctx']
+
+    def __init__(self, ctx):
+        self._free = []
+        self.ctx = ctx
+
+    def _acquire(self, nbytes):
+        if nbytes > PICK_BUFFER_SIZE:
+            return self.ctx.buffer(reserve=nbytes)
+
+        if self._free:
+            return self._free.pop()
+
+        return self.ctx.buffer(reserve=PICK_BUFFER_SIZE)
+
+    def _release(self, buffer):
+        if buffer.size == PICK_BUFFER_SIZE:
+            self._free.append(buffer)
+        else:
+            buffer.release()
+
+
+def _reclaim(pool, fence, buffer):
+    pool.ctx.mglo.fence_release(fence)
+    pool._release(buffer)
+
+
+def _create_pick_result(framebuffer, x, y, width, height, components, attachment, dtype):
+    if dtype not in ARRAY_FORMATS:
+        raise ValueError('invalid dtype: %r' % (dtype,))
+
+    if attachment == -1:
+        components = 1
+
+    ctx = framebuffer.ctx
+    if ctx._pick_pool is None:
+        ctx._pick_pool = _PickPool(ctx)
+
+    nbytes = width * height * components * int(dtype[1])
+    buffer = ctx._pick_pool._acquire(nbytes)
+
+    try:
+        fence = framebuffer.mglo.pick(buffer.mglo, 0, x, y, width, height, components, attachment, dtype)
+    except Exception:
+        ctx._pick_pool._release(buffer)
+        raise
+
+    res = PickResult.__new__(PickResult)
+    res._pool = ctx._pick_pool
+    res._buffer = buffer
+    res._nbytes = nbytes
+    res._shape = (height, width, components)
+    res._format = ARRAY_FORMATS[dtype]
+    res._fence = fence
+    res._value = None
+    res.ctx = ctx
+    res.extra = None
+
+    # The finalizer runs once, either from release or when the result is collected
+    res._finalizer = weakref.finalize(res, _reclaim, ctx._pick_pool, fence, buffer)
+    res._finalizer.atexit = False
+    return res
@@ -0,0 +1,181 @@
+import collections
+from contextlib import contextmanager
+
+__all__ = ['GPUProfiler']
+
+QUERY_BATCH = 32
+
+
+class GPUProfiler:
+    '''
+        A GPUProfiler measures the GPU time of named and nested sections.
+
+        Every section records a ``GL_TIMESTAMP`` before and after its commands.
+        Unlike elapsed time queries timestamps can nest, so the sections form a tree.
+        The queries are taken from a pool and their results are collected
+        with :py:meth:`resolve` once they arrived, usually a few frames later,
+        so measuring does not stall the pipeline.
+
+        The durations of the last :py:attr:`history` measurements of every section
+        are kept and aggregated by :py:meth:`results`.
+
+        A GPUProfiler object cannot be instantiated directly.
+        Use :py:meth:`Context.gpu_profiler` to create one.
+    '''
+
+    __slots__ = ['_free', '_queries', '_pending', '_stack', '_samples', '_history', 'ctx', 'extra']
+
+    def __init__(self):
+        self._free = None
+        self._queries = None
+        self._pending = None
+        self._stack = None
+        self._samples = None
+        self._history = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<GPUProfiler: %d sections, %d pending>' % (len(self._samples), len(self._pending))
+
+    @property
+    def history(self) -> int:
+        '''
+            int: The number of measurements kept per section.
+        '''
+
+        return self._history
+
+    @property
+    def pending(self) -> int:
+        '''
+            int: The number of sections waiting for their timestamps.
+        '''
+
+        return len(self._pending)
+
+    @contextmanager
+    def section(self, name):
+        '''
+            Measure the commands issued inside a ``with`` block.
+            Sections entered inside the block become its children.
+
+            Args:
+                name (str): The name of the section.
+        '''
+
+        begin, end = self._acquire(), self._acquire()
+        self._stack.append(name)
+        path = tuple(self._stack)
+        self.ctx.mglo.timestamp(begin)
+
+        try:
+            yield self
+        finally:
+            self.ctx.mglo.timestamp(end)
+            self._stack.pop()
+            self._pending.append((path, begin, end))
+
+    def resolve(self, wait=False) -> int:
+        '''
+            Collect the timestamps that arrived, in submission order.
+
+            Args:
+                wait (bool): Wait for every pending section.
+
+            Returns:
+                int: The number of sections collected.
+        '''
+
+        count = 0
+
+        while self._pending:
+            path, begin, end = self._pending[0]
+            values = self.ctx.mglo.timestamp_results((begin, end), wait)
+
+            if values is None:
+                break
+
+            self._pending.popleft()
+            self._free.extend((begin, end))
+
+            if path not in self._samples:
+                self._samples[path] = collections.deque(maxlen=self._history)
+
+            self._samples[path].append(max(values[1] - values[0], 0))
+            count += 1
+
+        return count
+
+    def results(self) -> dict:
+        '''
+            Aggregate the collected measurements. Pending sections are not included,
+            call :py:meth:`resolve` before.
+
+            Returns:
+                dict: A tree of sections keyed by name. Every section holds the ``count``,
+                ``last``, ``min``, ``mean`` and ``p99`` durations in nanoseconds
+                and its ``children`` in the same layout.
+        '''
+
+        tree = {}
+
+        for path in sorted(self._samples):
+            samples = sorted(self._samples[path])
+            children = tree
+
+            for name in path[:-1]:
+                children = children.setdefault(name, {'children': {}})['children']
+
+            node = children.setdefault(path[-1], {'children': {}})
+            node['count'] = len(samples)
+            node['last'] = self._samples[path][-1]
+            node['min'] = samples[0]
+            node['mean'] = sum(samples) / len(samples)
+            node['p99'] = samples[min(len(samples) - 1, len(samples) * 99 // 100)]
+
+        return tree
+
+    def reset(self) -> None:
+        '''
+            Drop the collected measurements.
+        '''
+
+        self._samples.clear()
+
+    def release(self) -> None:
+        '''
+            Release the queries of the profiler. Pending sections are dropped.
+        '''
+
+        self._pending.clear()
+        self._free = []
+
+        if self._queries:
+            self.ctx.mglo.release_queries(tuple(self._queries))
+            self._queries = []
+
+    def _acquire(self):
+        if not self._free:
+            queries = self.ctx.mglo.timestamp_queries(QUERY_BATCH)
+            self._queries.extend(queries)
+            self._free.extend(queries)
+
+        return self._free.pop()
+
+
+def _create_gpu_profiler(ctx, history):
+    if history < 1:
+        raise ValueError('the history must hold at least one measurement')
+
+    res = GPUProfiler.__new__(GPUProfiler)
+    res._free = []
+    res._queries = []
+    res._pending = collections.deque()
+    res._stack = []
+    res._samples = {}
+    res._history = history
+    res.ctx = ctx
+    res.extra = None
+    return res
@@ -1,4 +1,16 @@
-__all__ = ['Query']
+import collections
+
+__all__ = ['Query', 'QueryRing']
+
+STATISTICS_NAMES = (
+    'vertices_submitted', 'primitives_submitted', 'vertex_shader_invocations',
+    'tess_control_shader_patches', 'tess_evaluation_shader_invocations',
+    'geometry_shader_invocations', 'geometry_shader_primitives_emitted',
+    'fragment_shader_invocations', 'compute_shader_invocations',
+    'clipping_input_primitives', 'clipping_output_primitives',
+)
+
+RESULT_NAMES = ('samples', 'any_samples', 'elapsed', 'primitives') + STATISTICS_NAMES
 
 
 class Query:
@@ -25,6 +37,15 @@ class Query:
     def __exit__(self, *args):
         self.mglo.end()
 
+    @property
+    def available(self) -> bool:
+        '''
+            bool: True if the results of the last :py:meth:`Query.__enter__` block arrived.
+            Checking it never blocks. The query must have been used before.
+        '''
+
+        return self.mglo.available
+
     @property
     def samples(self) -> int:
         '''
@@ -48,3 +69,203 @@ class Query:
         '''
 
         return self.mglo.elapsed
+
+    @property
+    def statistics(self) -> dict:
+        '''
+            dict: The pipeline statistics by name, waits for the results.
+            The query must be created with ``statistics=True``.
+
+            The counters are ``vertices_submitted``, ``primitives_submitted``,
+            ``vertex_shader_invocations``, ``tess_control_shader_patches``,
+            ``tess_evaluation_shader_invocations``, ``geometry_shader_invocations``,
+            ``geometry_shader_primitives_emitted``, ``fragment_shader_invocations``,
+            ``compute_shader_invocations``, ``clipping_input_primitives`` and
+            ``clipping_output_primitives``.
+        '''
+
+        values = self.mglo.try_result(True)[len(RESULT_NAMES) - len(STATISTICS_NAMES):]
+
+        if values[0] is None:
+            raise ValueError('the query was created without statistics')
+
+        return dict(zip(STATISTICS_NAMES, values))
+
+    def try_result(self) -> dict:
+        '''
+            Get the results without waiting for the GPU.
+
+            Returns:
+                dict: The ``samples``, ``any_samples``, ``elapsed``, ``primitives``
+                and :py:attr:`statistics` results the query was created with
+                or None if they did not arrive yet.
+        '''
+
+        values = self.mglo.try_result(False)
+
+        if values is None:
+            return None
+
+        return {name: value for name, value in zip(RESULT_NAMES, values) if value is not None}
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object.
+        '''
+
+        self.mglo.release()
+
+
+class QueryRing:
+    '''
+        A QueryRing measures a site of the frame without stalling the pipeline.
+
+        Reading the results of a query right after it ended waits for the GPU to finish.
+        The ring rotates several queries instead. Every frame uses the next query
+        and the results of the previous frames are collected with :py:meth:`poll`
+        once they arrived, usually a few frames later.
+
+        A query is only reused after its results were collected. If the ring is
+        too short and the oldest results are still pending, entering waits for them
+        and the :py:attr:`stalls` counter is incremented.
+
+        A QueryRing object cannot be instantiated directly.
+        Use :py:meth:`Context.query_ring` to create one.
+    '''
+
+    __slots__ = ['_queries', '_index', '_pending', '_ready', '_active', '_latest', '_frames', '_stalls', 'ctx', 'extra']
+
+    def __init__(self):
+        self._queries = None
+        self._index = None
+        self._pending = None
+        self._ready = None
+        self._active = None
+        self._latest = None
+        self._frames = None
+        self._stalls = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<QueryRing: %d queries, %d pending>' % (len(self._queries), len(self._pending))
+
+    def __enter__(self):
+        query = self._queries[self._index]
+
+        # The oldest results must be collected before their query is reused
+        if len(self._pending) == len(self._queries):
+            entry = self._pending.popleft()
+            result = self._collect(entry, False)
+            if result is None:
+                self._stalls += 1
+                result = self._collect(entry, True)
+            self._ready.append(result)
+
+        self._index = (self._index + 1) % len(self._queries)
+        self._active = query
+        query.mglo.begin()
+        return self
+
+    def __exit__(self, *args):
+        self._active.mglo.end()
+        self._pending.append((self._active, self._frames))
+        self._frames += 1
+        self._active = None
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The number of queries in the ring.
+        '''
+
+        return len(self._queries)
+
+    @property
+    def latest(self) -> dict:
+        '''
+            dict: The most recent results collected by :py:meth:`poll`, None before the first one.
+            The ``frame`` key holds the index of the measured frame.
+        '''
+
+        return self._latest
+
+    @property
+    def pending(self) -> int:
+        '''
+            int: The number of measurements waiting for their results.
+        '''
+
+        return len(self._pending)
+
+    @property
+    def stalls(self) -> int:
+        '''
+            int: The number of times entering waited for the GPU because the ring was too short.
+        '''
+
+        return self._stalls
+
+    def poll(self) -> list:
+        '''
+            Collect the results that arrived, oldest first. Never blocks.
+
+            Returns:
+                list: The results as dictionaries like :py:meth:`Query.try_result` returns them
+                with an additional ``frame`` key.
+        '''
+
+        result, self._ready = self._ready, []
+
+        while self._pending:
+            res = self._collect(self._pending[0], False)
+            if res is None:
+                break
+            self._pending.popleft()
+            result.append(res)
+
+        return result
+
+    def release(self) -> None:
+        '''
+            Release the queries of the ring.
+        '''
+
+        for query in self._queries:
+            query.release()
+
+        self._pending.clear()
+
+    def _collect(self, entry, wait):
+        query, frame = entry
+        values = query.mglo.try_result(wait)
+
+        if values is None:
+            return None
+
+        result = {name: value for name, value in zip(RESULT_NAMES, values) if value is not None}
+        result['frame'] = frame
+        self._latest = result
+        return result
+
+
+def _create_query_ring(ctx, size, samples, any_samples, time, primitives, statistics):
+    if size < 1:
+        raise ValueError('the ring must hold at least one query')
+
+    res = QueryRing.__new__(QueryRing)
+    res._queries = [
+        ctx.query(samples=samples, any_samples=any_samples, time=time, primitives=primitives, statistics=statistics)
+        for _ in range(size)
+    ]
+    res._index = 0
+    res._pending = collections.deque()
+    res._ready = []
+    res._active = None
+    res._latest = None
+    res._frames = 0
+    res._stalls = 0
+    res.ctx = ctx
+    res.extra = None
+    return res
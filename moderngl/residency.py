@@ -0,0 +1,168 @@
+__all__ = ['ResidencyManager']
+
+
+class ResidencyManager:
+    '''
+        A ResidencyManager keeps the memory allocated by a context under a budget.
+
+        Tracked textures are stamped with the current frame every time they are
+        bound with :py:meth:`Texture.use` or through a :py:class:`Scope`.
+        When the context allocates more than :py:attr:`budget` bytes the least
+        recently used tracked textures are evicted. By default an evicted texture
+        moves its images to host memory and frees the GPU storage.
+        It is restored transparently the next time it is used, read, written or
+        attached to a new framebuffer.
+
+        When an eviction callback is given it is called with the texture instead
+        and the texture is no longer tracked.
+
+        Only single sample :py:class:`Texture` objects can be tracked.
+        Textures attached to a framebuffer are not evicted until the framebuffer is released.
+
+        A ResidencyManager object cannot be instantiated directly.
+        Use :py:meth:`Context.residency_manager` to create one.
+    '''
+
+    __slots__ = ['_textures', '_budget', '_on_evict', '_evictions', 'ctx', 'extra']
+
+    def __init__(self):
+        self._textures = None
+        self._budget = None
+        self._on_evict = None
+        self._evictions = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<ResidencyManager: %d textures>' % len(self._textures)
+
+    @property
+    def budget(self) -> int:
+        '''
+            int: The number of bytes the context may allocate before evicting.
+        '''
+
+        return self._budget
+
+    @budget.setter
+    def budget(self, value):
+        self._budget = int(value)
+
+    @property
+    def frame(self) -> int:
+        '''
+            int: The current frame, advanced by :py:meth:`next_frame`.
+        '''
+
+        return self.ctx.mglo.frame
+
+    @property
+    def evictions(self) -> int:
+        '''
+            int: The number of textures evicted so far.
+        '''
+
+        return self._evictions
+
+    @property
+    def resident_bytes(self) -> int:
+        '''
+            int: The number of bytes used by the tracked textures on the GPU.
+        '''
+
+        return sum(tex.mglo.memory for tex in self._textures.values() if tex.mglo.resident)
+
+    def track(self, texture) -> None:
+        '''
+            Allow the texture to be evicted.
+
+            Args:
+                texture (Texture): A single sample, uncompressed texture
+                    not attached to a framebuffer.
+        '''
+
+        if texture.samples:
+            raise ValueError('multisample textures cannot be evicted')
+
+        if texture.mglo.compressed:
+            raise ValueError('compressed textures cannot be evicted')
+
+        if texture.mglo.attached:
+            raise ValueError('textures attached to a framebuffer cannot be evicted')
+
+        self._textures[id(texture)] = texture
+
+    def untrack(self, texture) -> None:
+        '''
+            Stop tracking the texture. An evicted texture stays evicted until its next use.
+
+            Args:
+                texture (Texture): A tracked texture.
+        '''
+
+        self._textures.pop(id(texture), None)
+
+    def next_frame(self) -> int:
+        '''
+            Advance the frame counter and enforce the budget.
+            Call this once per frame.
+
+            Returns:
+                int: The number of textures evicted.
+        '''
+
+        self.ctx.mglo.frame += 1
+        return self.enforce()
+
+    def enforce(self) -> int:
+        '''
+            Evict the least recently used tracked textures until the context
+            is under budget. Textures used in the current frame are never evicted.
+
+            Returns:
+                int: The number of textures evicted.
+        '''
+
+        total = sum(self.ctx.mglo.memory)
+
+        if total <= self._budget:
+            return 0
+
+        frame = self.ctx.mglo.frame
+        # Framebuffers created after tracking keep their textures resident too
+        candidates = [
+            tex for tex in self._textures.values()
+            if tex.mglo.resident and not tex.mglo.attached and tex.mglo.last_use < frame
+        ]
+        candidates.sort(key=lambda tex: tex.mglo.last_use)
+
+        evicted = 0
+
+        for tex in candidates:
+            if total <= self._budget:
+                break
+
+            total -= tex.mglo.memory
+
+            if self._on_evict is not None:
+                del self._textures[id(tex)]
+                self._on_evict(tex)
+            else:
+                tex.mglo.evict()
+
+            evicted += 1
+
+        self._evictions += evicted
+        return evicted
+
+
+def _create_residency_manager(ctx, budget, on_evict):
+    res = ResidencyManager.__new__(ResidencyManager)
+    res._textures = {}
+    res._budget = int(budget)
+    res._on_evict = on_evict
+    res._evictions = 0
+    res.ctx = ctx
+    res.extra = None
+    return res
@@ -50,6 +50,7 @@ PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 	}
 
 	MGLBuffer * buffer = (MGLBuffer *)MGLBuffer_Type.tp_alloc(&MGLBuffer_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	buffer->size = (int)buffer_view.len;
 	buffer->dynamic = dynamic ? true : false;
@@ -68,6 +69,8 @@ PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 	gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
 	gl.BufferData(GL_ARRAY_BUFFER, buffer->size, buffer_view.buf, dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
 
+	self->buffer_memory += buffer->size;
+
 	Py_INCREF(self);
 	buffer->context = self;
 
@@ -129,6 +132,7 @@ PyObject * MGLBuffer_write(MGLBuffer * self, PyObject * args) {
 	const GLMethods & gl = self->context->gl;
 	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
 	gl.BufferSubData(GL_ARRAY_BUFFER, (GLintptr)offset, buffer_view.len, buffer_view.buf);
+	MGL_STAT(self->context, MGL_STAT_BUFFER_BYTES_WRITTEN, buffer_view.len);
 	PyBuffer_Release(&buffer_view);
 	Py_RETURN_NONE;
 }
@@ -168,6 +172,7 @@ PyObject * MGLBuffer_read(MGLBuffer * self, PyObject * args) {
 	}
 
 	PyObject * data = PyBytes_FromStringAndSize((const char *)map, size);
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, size);
 
 	gl.UnmapBuffer(GL_ARRAY_BUFFER);
 
@@ -223,6 +228,7 @@ PyObject * MGLBuffer_read_into(MGLBuffer * self, PyObject * args) {
 
 	char * ptr = (char *)buffer_view.buf + write_offset;
 	memcpy(ptr, map, size);
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, size);
 
 	gl.UnmapBuffer(GL_ARRAY_BUFFER);
 
@@ -296,6 +302,8 @@ PyObject * MGLBuffer_write_chunks(MGLBuffer * self, PyObject * args) {
 		write_ptr += step;
 	}
 
+	MGL_STAT(self->context, MGL_STAT_BUFFER_BYTES_WRITTEN, chunk_size * count);
+
 	gl.UnmapBuffer(GL_ARRAY_BUFFER);
 	PyBuffer_Release(&buffer_view);
 	Py_RETURN_NONE;
@@ -352,6 +360,8 @@ PyObject * MGLBuffer_read_chunks(MGLBuffer * self, PyObject * args) {
 		read_ptr += step;
 	}
 
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, chunk_size * count);
+
 	gl.UnmapBuffer(GL_ARRAY_BUFFER);
 	return data;
 }
@@ -406,6 +416,8 @@ PyObject * MGLBuffer_read_chunks_into(MGLBuffer * self, PyObject * args) {
 		read_ptr += step;
 	}
 
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, chunk_size * count);
+
 	gl.UnmapBuffer(GL_ARRAY_BUFFER);
 	PyBuffer_Release(&buffer_view);
 	Py_RETURN_NONE;
@@ -473,6 +485,7 @@ PyObject * MGLBuffer_clear(MGLBuffer * self, PyObject * args) {
 	}
 
 	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	MGL_STAT(self->context, MGL_STAT_BUFFER_BYTES_WRITTEN, size);
 
 	if (chunk != Py_None) {
 		PyBuffer_Release(&buffer_view);
@@ -495,6 +508,7 @@ PyObject * MGLBuffer_orphan(MGLBuffer * self, PyObject * args) {
 	}
 
 	if (size > 0) {
+		self->context->buffer_memory += size - self->size;
 		self->size = size;
 	}
 
@@ -665,11 +679,15 @@ void MGLBuffer_Invalidate(MGLBuffer * buffer) {
 		return;
 	}
 
+	MGL_STAT(buffer->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = buffer->context->gl;
 	gl.DeleteBuffers(1, (GLuint *)&buffer->buffer_obj);
 
+	buffer->context->buffer_memory -= buffer->size;
+
 	Py_TYPE(buffer) = &MGLInvalidObject_Type;
 	Py_DECREF(buffer);
 }
@@ -0,0 +1,146 @@
+#include "Types.hpp"
+
+// Host side frame conversion used by FrameSink.
+// The input is the bottom up RGB or RGBA output of ReadPixels, the output is top down.
+// The inner loops work on a single row with integer arithmetic, so the compiler can vectorize them.
+
+// BT.601 limited range coefficients in 8.8 fixed point
+inline unsigned char rgb_to_y(int r, int g, int b) {
+	return (unsigned char)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+}
+
+inline unsigned char rgb_to_u(int r, int g, int b) {
+	return (unsigned char)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+}
+
+inline unsigned char rgb_to_v(int r, int g, int b) {
+	return (unsigned char)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+}
+
+static void convert_yuv420(const unsigned char * src, unsigned char * dst, int width, int height, int components) {
+	int chroma_width = (width + 1) / 2;
+	int chroma_height = (height + 1) / 2;
+	Py_ssize_t stride = (Py_ssize_t)width * components;
+
+	unsigned char * plane_y = dst;
+	unsigned char * plane_u = plane_y + (Py_ssize_t)width * height;
+	unsigned char * plane_v = plane_u + (Py_ssize_t)chroma_width * chroma_height;
+
+	for (int row = 0; row < height; ++row) {
+		const unsigned char * pixel = src + stride * (height - row - 1);
+		unsigned char * out = plane_y + (Py_ssize_t)width * row;
+		for (int x = 0; x < width; ++x) {
+			out[x] = rgb_to_y(pixel[x * components + 0], pixel[x * components + 1], pixel[x * components + 2]);
+		}
+	}
+
+	// The chroma planes average 2x2 blocks, the last row and column are repeated for odd sizes
+	for (int row = 0; row < chroma_height; ++row) {
+		int top = row * 2;
+		int bottom = top + 1 < height ? top + 1 : top;
+		const unsigned char * line0 = src + stride * (height - top - 1);
+		const unsigned char * line1 = src + stride * (height - bottom - 1);
+		unsigned char * out_u = plane_u + (Py_ssize_t)chroma_width * row;
+		unsigned char * out_v = plane_v + (Py_ssize_t)chroma_width * row;
+
+		for (int x = 0; x < chroma_width; ++x) {
+			int left = x * 2 * components;
+			int right = (x * 2 + 1 < width ? x * 2 + 1 : x * 2) * components;
+			int r = (line0[left + 0] + line0[right + 0] + line1[left + 0] + line1[right + 0] + 2) >> 2;
+			int g = (line0[left + 1] + line0[right + 1] + line1[left + 1] + line1[right + 1] + 2) >> 2;
+			int b = (line0[left + 2] + line0[right + 2] + line1[left + 2] + line1[right + 2] + 2) >> 2;
+			out_u[x] = rgb_to_u(r, g, b);
+			out_v[x] = rgb_to_v(r, g, b);
+		}
+	}
+}
+
+static void convert_rgb(const unsigned char * src, unsigned char * dst, int width, int height, int components, int out_components) {
+	Py_ssize_t stride = (Py_ssize_t)width * components;
+	Py_ssize_t out_stride = (Py_ssize_t)width * out_components;
+
+	for (int row = 0; row < height; ++row) {
+		const unsigned char * pixel = src + stride * (height - row - 1);
+		unsigned char * out = dst + out_stride * row;
+
+		if (components == out_components) {
+			memcpy(out, pixel, stride);
+			continue;
+		}
+
+		for (int x = 0; x < width; ++x) {
+			out[x * 3 + 0] = pixel[x * components + 0];
+			out[x * 3 + 1] = pixel[x * components + 1];
+			out[x * 3 + 2] = pixel[x * components + 2];
+		}
+	}
+}
+
+PyObject * MGL_convert_frame(PyObject * self, PyObject * args) {
+	Py_buffer src;
+	Py_buffer dst;
+	int width;
+	int height;
+	int components;
+	const char * format;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"y*w*IIIs",
+		&src,
+		&dst,
+		&width,
+		&height,
+		&components,
+		&format
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	bool yuv = !strcmp(format, "yuv420");
+	int out_components = !strcmp(format, "rgba") ? 4 : 3;
+
+	if (!yuv && strcmp(format, "rgb") && strcmp(format, "rgba")) {
+		MGLError_Set("invalid format");
+		PyBuffer_Release(&src);
+		PyBuffer_Release(&dst);
+		return 0;
+	}
+
+	if (components < out_components || components < 3 || components > 4) {
+		MGLError_Set("cannot convert %d components to %s", components, format);
+		PyBuffer_Release(&src);
+		PyBuffer_Release(&dst);
+		return 0;
+	}
+
+	Py_ssize_t src_size = (Py_ssize_t)width * height * components;
+	Py_ssize_t dst_size = (Py_ssize_t)width * height * out_components;
+
+	if (yuv) {
+		dst_size = (Py_ssize_t)width * height + (Py_ssize_t)((width + 1) / 2) * ((height + 1) / 2) * 2;
+	}
+
+	if (src.len < src_size || dst.len < dst_size) {
+		MGLError_Set("the buffers are too small");
+		PyBuffer_Release(&src);
+		PyBuffer_Release(&dst);
+		return 0;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+
+	if (yuv) {
+		convert_yuv420((const unsigned char *)src.buf, (unsigned char *)dst.buf, width, height, components);
+	} else {
+		convert_rgb((const unsigned char *)src.buf, (unsigned char *)dst.buf, width, height, components, out_components);
+	}
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(&src);
+	PyBuffer_Release(&dst);
+	return PyLong_FromSsize_t(dst_size);
+}
@@ -23,6 +23,7 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 	const char * source_str = PyUnicode_AsUTF8(source);
 
 	MGLComputeShader * compute_shader = (MGLComputeShader *)MGLComputeShader_Type.tp_alloc(&MGLComputeShader_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	Py_INCREF(self);
 	compute_shader->context = self;
@@ -269,6 +270,9 @@ PyObject * MGLComputeShader_run(MGLComputeShader * self, PyObject * args) {
 	gl.UseProgram(self->program_obj);
 	gl.DispatchCompute(x, y, z);
 
+	MGL_STAT(self->context, MGL_STAT_PROGRAM_BINDS, 1);
+	MGL_STAT(self->context, MGL_STAT_DISPATCHES, 1);
+
 	Py_RETURN_NONE;
 }
 
@@ -333,6 +337,8 @@ void MGLComputeShader_Invalidate(MGLComputeShader * compute_shader) {
 		return;
 	}
 
+	MGL_STAT(compute_shader->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = compute_shader->context->gl;
@@ -451,11 +451,110 @@ PyObject * MGLContext_clear_samplers(MGLContext * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLContext_reset_state_cache(MGLContext * self) {
+	MGLContext_ResetFramebufferState(self);
+	Py_RETURN_NONE;
+}
+
+#ifdef MGL_STATS
+// Indexed by MGLStatCounter
+static const char * stat_names[] = {
+	"draw_arrays",
+	"draw_elements",
+	"draw_indirect",
+	"dispatches",
+	"vertices",
+	"instances",
+	"program_binds",
+	"vertex_array_binds",
+	"texture_binds",
+	"framebuffer_binds",
+	"buffer_bytes_written",
+	"texture_bytes_written",
+	"clears",
+	"bytes_read",
+	"objects_created",
+	"objects_released",
+};
+#endif
+
+PyObject * MGLContext_stats(MGLContext * self) {
+#ifdef MGL_STATS
+	PyObject * result = PyDict_New();
+
+	for (int i = 0; i < MGL_STAT_COUNT; ++i) {
+		PyObject * value = PyLong_FromUnsignedLongLong(self->stats[i]);
+		PyDict_SetItemString(result, stat_names[i], value);
+		Py_DECREF(value);
+	}
+
+	return result;
+#else
+	Py_RETURN_NONE;
+#endif
+}
+
+PyObject * MGLContext_reset_stats(MGLContext * self) {
+#ifdef MGL_STATS
+	memset(self->stats, 0, sizeof(self->stats));
+#endif
+	Py_RETURN_NONE;
+}
+
+// Fences are passed to Python as integers holding the GLsync handle
+PyObject * MGLContext_fence(MGLContext * self) {
+	GLsync sync = self->gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	return PyLong_FromVoidPtr(sync);
+}
+
+PyObject * MGLContext_fence_wait(MGLContext * self, PyObject * args) {
+	PyObject * handle;
+	double timeout;
+
+	if (!PyArg_ParseTuple(args, "Od", &handle, &timeout)) {
+		return 0;
+	}
+
+	GLsync sync = (GLsync)PyLong_AsVoidPtr(handle);
+
+	if (PyErr_Occurred()) {
+		return 0;
+	}
+
+	GLuint64 timeout_ns = timeout > 0.0 ? (GLuint64)(timeout * 1e9) : 0;
+	int status = self->gl.ClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout_ns);
+
+	if (status == GL_WAIT_FAILED) {
+		MGLError_Set("invalid fence");
+		return 0;
+	}
+
+	return PyBool_FromLong(status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED);
+}
+
+PyObject * MGLContext_fence_release(MGLContext * self, PyObject * args) {
+	PyObject * handle;
+
+	if (!PyArg_ParseTuple(args, "O", &handle)) {
+		return 0;
+	}
+
+	GLsync sync = (GLsync)PyLong_AsVoidPtr(handle);
+
+	if (PyErr_Occurred()) {
+		return 0;
+	}
+
+	self->gl.DeleteSync(sync);
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLContext_buffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args);
+PyObject * MGLContext_load_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args);
 PyObject * MGLContext_program(MGLContext * self, PyObject * args);
@@ -464,11 +563,31 @@ PyObject * MGLContext_renderbuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_depth_renderbuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args);
 PyObject * MGLContext_query(MGLContext * self, PyObject * args);
+PyObject * MGLContext_timestamp_queries(MGLContext * self, PyObject * args);
+PyObject * MGLContext_timestamp(MGLContext * self, PyObject * args);
+PyObject * MGLContext_timestamp_results(MGLContext * self, PyObject * args);
+PyObject * MGLContext_release_queries(MGLContext * self, PyObject * args);
+PyObject * MGLContext_gpu_time(MGLContext * self);
+PyObject * MGLContext_debug_output(MGLContext * self, PyObject * args);
+PyObject * MGLContext_debug_messages(MGLContext * self, PyObject * args);
+PyObject * MGLContext_push_debug_group(MGLContext * self, PyObject * args);
+PyObject * MGLContext_pop_debug_group(MGLContext * self);
+PyObject * MGLContext_get_debug_log_limit(MGLContext * self);
+int MGLContext_set_debug_log_limit(MGLContext * self, PyObject * value);
+PyObject * MGLContext_object_label(MGLContext * self, PyObject * args);
 PyObject * MGLContext_scope(MGLContext * self, PyObject * args);
 PyObject * MGLContext_sampler(MGLContext * self, PyObject * args);
 
+// The function table of the context, extras/gltraces swaps it to intercept the calls
+PyObject * MGLContext_glprocs(MGLContext * self) {
+	return PyMemoryView_FromMemory((char *)&self->gl, sizeof(GLMethods), PyBUF_WRITE);
+}
+
 PyObject * MGLContext_enter(MGLContext * self) {
 	PyObject_CallMethod(self->ctx, "__enter__", NULL);
+
+	// Calls made while another context was current may have been recorded in the cache
+	MGLContext_ResetFramebufferState(self);
 	Py_RETURN_NONE;
 }
 
@@ -478,6 +597,7 @@ PyObject * MGLContext_exit(MGLContext * self) {
 }
 
 PyObject * MGLContext_release(MGLContext * self) {
+	MGLContext_ReleaseDebugLog(self);
 	PyObject_CallMethod(self->ctx, "release", NULL);
 	Py_RETURN_NONE;
 }
@@ -491,12 +611,19 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"copy_framebuffer", (PyCFunction)MGLContext_copy_framebuffer, METH_VARARGS, 0},
 	{"detect_framebuffer", (PyCFunction)MGLContext_detect_framebuffer, METH_VARARGS, 0},
 	{"clear_samplers", (PyCFunction)MGLContext_clear_samplers, METH_VARARGS, 0},
+	{"reset_state_cache", (PyCFunction)MGLContext_reset_state_cache, METH_NOARGS, 0},
+	{"stats", (PyCFunction)MGLContext_stats, METH_NOARGS, 0},
+	{"reset_stats", (PyCFunction)MGLContext_reset_stats, METH_NOARGS, 0},
+	{"fence", (PyCFunction)MGLContext_fence, METH_NOARGS, 0},
+	{"fence_wait", (PyCFunction)MGLContext_fence_wait, METH_VARARGS, 0},
+	{"fence_release", (PyCFunction)MGLContext_fence_release, METH_VARARGS, 0},
 
 	{"buffer", (PyCFunction)MGLContext_buffer, METH_VARARGS, 0},
 	{"texture", (PyCFunction)MGLContext_texture, METH_VARARGS, 0},
 	{"texture3d", (PyCFunction)MGLContext_texture3d, METH_VARARGS, 0},
 	{"texture_array", (PyCFunction)MGLContext_texture_array, METH_VARARGS, 0},
 	{"texture_cube", (PyCFunction)MGLContext_texture_cube, METH_VARARGS, 0},
+	{"load_texture", (PyCFunction)MGLContext_load_texture, METH_VARARGS, 0},
 	{"depth_texture", (PyCFunction)MGLContext_depth_texture, METH_VARARGS, 0},
 	{"vertex_array", (PyCFunction)MGLContext_vertex_array, METH_VARARGS, 0},
 	{"program", (PyCFunction)MGLContext_program, METH_VARARGS, 0},
@@ -506,6 +633,17 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"depth_renderbuffer", (PyCFunction)MGLContext_depth_renderbuffer, METH_VARARGS, 0},
 	{"compute_shader", (PyCFunction)MGLContext_compute_shader, METH_VARARGS, 0},
 	{"query", (PyCFunction)MGLContext_query, METH_VARARGS, 0},
+	{"timestamp_queries", (PyCFunction)MGLContext_timestamp_queries, METH_VARARGS, 0},
+	{"timestamp", (PyCFunction)MGLContext_timestamp, METH_VARARGS, 0},
+	{"timestamp_results", (PyCFunction)MGLContext_timestamp_results, METH_VARARGS, 0},
+	{"release_queries", (PyCFunction)MGLContext_release_queries, METH_VARARGS, 0},
+	{"gpu_time", (PyCFunction)MGLContext_gpu_time, METH_NOARGS, 0},
+	{"debug_output", (PyCFunction)MGLContext_debug_output, METH_VARARGS, 0},
+	{"debug_messages", (PyCFunction)MGLContext_debug_messages, METH_VARARGS, 0},
+	{"push_debug_group", (PyCFunction)MGLContext_push_debug_group, METH_VARARGS, 0},
+	{"pop_debug_group", (PyCFunction)MGLContext_pop_debug_group, METH_NOARGS, 0},
+	{"object_label", (PyCFunction)MGLContext_object_label, METH_VARARGS, 0},
+	{"glprocs", (PyCFunction)MGLContext_glprocs, METH_NOARGS, 0},
 	{"scope", (PyCFunction)MGLContext_scope, METH_VARARGS, 0},
 	{"sampler", (PyCFunction)MGLContext_sampler, METH_VARARGS, 0},
 
@@ -709,6 +847,30 @@ PyObject * MGLContext_get_max_anisotropy(MGLContext * self) {
 	return PyFloat_FromDouble(self->max_anisotropy);
 }
 
+PyObject * MGLContext_get_memory(MGLContext * self) {
+	PyObject * result = PyTuple_New(3);
+	PyTuple_SET_ITEM(result, 0, PyLong_FromSsize_t(self->texture_memory));
+	PyTuple_SET_ITEM(result, 1, PyLong_FromSsize_t(self->renderbuffer_memory));
+	PyTuple_SET_ITEM(result, 2, PyLong_FromSsize_t(self->buffer_memory));
+	return result;
+}
+
+PyObject * MGLContext_get_frame(MGLContext * self) {
+	return PyLong_FromLong(self->frame);
+}
+
+int MGLContext_set_frame(MGLContext * self, PyObject * value) {
+	int frame = PyLong_AsLong(value);
+
+	if (PyErr_Occurred()) {
+		return -1;
+	}
+
+	self->frame = frame;
+
+	return 0;
+}
+
 MGLFramebuffer * MGLContext_get_fbo(MGLContext * self) {
 	Py_INCREF(self->bound_framebuffer);
 	return self->bound_framebuffer;
@@ -721,6 +883,12 @@ int MGLContext_set_fbo(MGLContext * self, PyObject * value) {
 	Py_INCREF(value);
 	Py_DECREF(self->bound_framebuffer);
 	self->bound_framebuffer = (MGLFramebuffer *)value;
+
+	// The GL binding is left untouched, the next Framebuffer.use() must not rely on it
+	if (self->applied_framebuffer != self->bound_framebuffer->framebuffer_obj) {
+		self->applied_framebuffer = -1;
+	}
+
 	return 0;
 }
 
@@ -1382,6 +1550,10 @@ PyGetSetDef MGLContext_tp_getseters[] = {
 
 	{(char *)"fbo", (getter)MGLContext_get_fbo, (setter)MGLContext_set_fbo, 0, 0},
 
+	{(char *)"memory", (getter)MGLContext_get_memory, 0, 0, 0},
+	{(char *)"frame", (getter)MGLContext_get_frame, (setter)MGLContext_set_frame, 0, 0},
+	{(char *)"debug_log_limit", (getter)MGLContext_get_debug_log_limit, (setter)MGLContext_set_debug_log_limit, 0, 0},
+
 	{(char *)"wireframe", (getter)MGLContext_get_wireframe, (setter)MGLContext_set_wireframe, 0, 0},
 	{(char *)"front_face", (getter)MGLContext_get_front_face, (setter)MGLContext_set_front_face, 0, 0},
 	{(char *)"cull_face", (getter)MGLContext_get_cull_face, (setter)MGLContext_set_cull_face, 0, 0},
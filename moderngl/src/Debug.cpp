@@ -0,0 +1,247 @@
+#include <deque>
+#include <map>
+#include <string>
+#include <tuple>
+
+#include "Types.hpp"
+
+struct MGLDebugMessage {
+	GLenum source;
+	GLenum type;
+	GLuint id;
+	GLenum severity;
+	unsigned long long count;
+	std::string text;
+};
+
+struct MGLDebugLog {
+	// Messages in the order they were first seen, the index is keyed by (source, type, id, text).
+	// Some drivers share an id between every message of a type, Mesa does for the API errors.
+	// The index holds the sequence number of a message, first is the sequence number of the oldest one.
+	std::deque<MGLDebugMessage> messages;
+	std::map<std::tuple<GLenum, GLenum, GLuint, std::string>, unsigned long long> index;
+	unsigned long long first;
+};
+
+// Drop the oldest messages until at most limit messages are left
+static void trim_debug_log(MGLDebugLog * log, int limit) {
+	while (!log->messages.empty() && log->messages.size() > (size_t)(limit > 0 ? limit : 0)) {
+		const MGLDebugMessage & oldest = log->messages.front();
+		log->index.erase(std::make_tuple(oldest.source, oldest.type, oldest.id, oldest.text));
+		log->messages.pop_front();
+		log->first += 1;
+	}
+}
+
+// Runs inside the GL call reporting the message (GL_DEBUG_OUTPUT_SYNCHRONOUS), no Python API is used.
+static void GLAPI debug_callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * message, const void * user_param) {
+	// The group markers only echo the debug_group calls
+	if (type == GL_DEBUG_TYPE_PUSH_GROUP || type == GL_DEBUG_TYPE_POP_GROUP) {
+		return;
+	}
+
+	MGLContext * context = (MGLContext *)user_param;
+	MGLDebugLog * log = context->debug_log;
+
+	if (!log || context->debug_log_limit <= 0) {
+		return;
+	}
+
+	std::string text = length < 0 ? std::string(message) : std::string(message, length);
+	auto key = std::make_tuple(source, type, id, text);
+	auto it = log->index.find(key);
+
+	if (it != log->index.end()) {
+		log->messages[it->second - log->first].count += 1;
+		return;
+	}
+
+	// A noisy driver must not grow the log without bounds
+	trim_debug_log(log, context->debug_log_limit - 1);
+
+	log->index[key] = log->first + log->messages.size();
+	log->messages.push_back({source, type, id, severity, 1, text});
+}
+
+PyObject * MGLContext_debug_output(MGLContext * self, PyObject * args) {
+	int enable;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&enable
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	if (!gl.DebugMessageCallback || !gl.DebugMessageControl) {
+		MGLError_Set("the debug output requires OpenGL 4.3 or GL_KHR_debug");
+		return 0;
+	}
+
+	if (enable) {
+		if (!self->debug_log) {
+			self->debug_log = new MGLDebugLog();
+		}
+
+		gl.DebugMessageCallback(debug_callback, self);
+		gl.DebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, 0, true);
+		gl.Enable(GL_DEBUG_OUTPUT);
+		gl.Enable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	} else {
+		gl.Disable(GL_DEBUG_OUTPUT);
+		gl.Disable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+		gl.DebugMessageCallback(0, 0);
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLContext_debug_messages(MGLContext * self, PyObject * args) {
+	int clear;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&clear
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLDebugLog * log = self->debug_log;
+
+	if (!log) {
+		return PyTuple_New(0);
+	}
+
+	PyObject * result = PyTuple_New(log->messages.size());
+
+	for (size_t i = 0; i < log->messages.size(); ++i) {
+		const MGLDebugMessage & entry = log->messages[i];
+		PyObject * message = Py_BuildValue(
+			"(IIIIKs#)",
+			entry.source,
+			entry.type,
+			entry.id,
+			entry.severity,
+			entry.count,
+			entry.text.c_str(),
+			(Py_ssize_t)entry.text.size()
+		);
+
+		if (!message) {
+			Py_DECREF(result);
+			return 0;
+		}
+
+		PyTuple_SET_ITEM(result, i, message);
+	}
+
+	if (clear) {
+		log->messages.clear();
+		log->index.clear();
+		log->first = 0;
+	}
+
+	return result;
+}
+
+PyObject * MGLContext_get_debug_log_limit(MGLContext * self) {
+	return PyLong_FromLong(self->debug_log_limit);
+}
+
+int MGLContext_set_debug_log_limit(MGLContext * self, PyObject * value) {
+	int limit = PyLong_AsLong(value);
+
+	if (PyErr_Occurred()) {
+		return -1;
+	}
+
+	if (limit < 0) {
+		MGLError_Set("the debug log limit must not be negative");
+		return -1;
+	}
+
+	self->debug_log_limit = limit;
+
+	if (self->debug_log) {
+		trim_debug_log(self->debug_log, limit);
+	}
+
+	return 0;
+}
+
+PyObject * MGLContext_push_debug_group(MGLContext * self, PyObject * args) {
+	const char * name;
+	Py_ssize_t name_size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"s#",
+		&name,
+		&name_size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->gl.PushDebugGroup) {
+		self->gl.PushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, (GLsizei)name_size, name);
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLContext_pop_debug_group(MGLContext * self) {
+	if (self->gl.PopDebugGroup) {
+		self->gl.PopDebugGroup();
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLContext_object_label(MGLContext * self, PyObject * args) {
+	GLenum identifier;
+	GLuint name;
+	const char * label;
+	Py_ssize_t label_size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IIs#",
+		&identifier,
+		&name,
+		&label,
+		&label_size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->gl.ObjectLabel) {
+		self->gl.ObjectLabel(identifier, name, (GLsizei)label_size, label);
+	}
+
+	Py_RETURN_NONE;
+}
+
+void MGLContext_ReleaseDebugLog(MGLContext * self) {
+	if (!self->debug_log) {
+		return;
+	}
+
+	// The callback must not outlive the log it writes to
+	self->gl.DebugMessageCallback(0, 0);
+	self->gl.Disable(GL_DEBUG_OUTPUT);
+
+	delete self->debug_log;
+	self->debug_log = 0;
+}
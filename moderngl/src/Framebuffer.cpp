@@ -1,5 +1,262 @@
+#include <new>
+
 #include "Types.hpp"
 
+#include "InlineMethods.hpp"
+
+// A color or depth attachment, either a whole object or a single layer (or cube face) of it
+struct MGLFramebufferAttachment {
+	PyObject * object;
+	MGLContext * context;
+	int layer;
+	int width;
+	int height;
+	int samples;
+	int components;
+	bool depth;
+};
+
+static bool parse_attachment(PyObject * item, MGLFramebufferAttachment & attachment, const char * name) {
+	attachment.layer = -1;
+
+	if (Py_TYPE(item) == &PyTuple_Type) {
+		if (PyTuple_GET_SIZE(item) != 2) {
+			MGLError_Set("%s must be an object or an (object, layer) tuple", name);
+			return false;
+		}
+
+		attachment.layer = PyLong_AsLong(PyTuple_GET_ITEM(item, 1));
+
+		if (PyErr_Occurred() || attachment.layer < 0) {
+			PyErr_Clear();
+			MGLError_Set("%s has an invalid layer", name);
+			return false;
+		}
+
+		item = PyTuple_GET_ITEM(item, 0);
+	}
+
+	attachment.object = item;
+	attachment.samples = 0;
+	attachment.depth = false;
+
+	int layers = 0;
+
+	if (Py_TYPE(item) == &MGLTexture_Type) {
+		MGLTexture * texture = (MGLTexture *)item;
+		attachment.context = texture->context;
+		attachment.width = texture->width;
+		attachment.height = texture->height;
+		attachment.samples = texture->samples;
+		attachment.components = texture->components;
+		attachment.depth = texture->depth;
+	} else if (Py_TYPE(item) == &MGLRenderbuffer_Type) {
+		MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)item;
+		attachment.context = renderbuffer->context;
+		attachment.width = renderbuffer->width;
+		attachment.height = renderbuffer->height;
+		attachment.samples = renderbuffer->samples;
+		attachment.components = renderbuffer->components;
+		attachment.depth = renderbuffer->depth;
+	} else if (Py_TYPE(item) == &MGLTextureArray_Type) {
+		MGLTextureArray * texture = (MGLTextureArray *)item;
+		attachment.context = texture->context;
+		attachment.width = texture->width;
+		attachment.height = texture->height;
+		attachment.components = texture->components;
+		layers = texture->layers;
+	} else if (Py_TYPE(item) == &MGLTextureCube_Type) {
+		MGLTextureCube * texture = (MGLTextureCube *)item;
+		attachment.context = texture->context;
+		attachment.width = texture->width;
+		attachment.height = texture->height;
+		attachment.components = texture->components;
+		layers = 6;
+	} else if (Py_TYPE(item) == &MGLTexture3D_Type) {
+		MGLTexture3D * texture = (MGLTexture3D *)item;
+		attachment.context = texture->context;
+		attachment.width = texture->width;
+		attachment.height = texture->height;
+		attachment.components = texture->components;
+		layers = texture->depth;
+	} else {
+		MGLError_Set("%s must be a Renderbuffer or Texture not %s", name, Py_TYPE(item)->tp_name);
+		return false;
+	}
+
+	if (attachment.layer >= 0 && attachment.layer >= layers) {
+		if (layers) {
+			MGLError_Set("%s has an invalid layer %d, the object has %d layers", name, attachment.layer, layers);
+		} else {
+			MGLError_Set("%s is not layered", name);
+		}
+		return false;
+	}
+
+	return true;
+}
+
+static void attach(const GLMethods & gl, int attachment_point, const MGLFramebufferAttachment & attachment) {
+	PyObject * item = attachment.object;
+
+	if (Py_TYPE(item) == &MGLTexture_Type) {
+		MGLTexture * texture = (MGLTexture *)item;
+		MGLTexture_Restore(texture);
+		int target = texture->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+		gl.FramebufferTexture2D(GL_FRAMEBUFFER, attachment_point, target, texture->texture_obj, 0);
+
+	} else if (Py_TYPE(item) == &MGLRenderbuffer_Type) {
+		MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)item;
+		gl.FramebufferRenderbuffer(GL_FRAMEBUFFER, attachment_point, GL_RENDERBUFFER, renderbuffer->renderbuffer_obj);
+
+	} else {
+		int texture_obj;
+
+		if (Py_TYPE(item) == &MGLTextureArray_Type) {
+			texture_obj = ((MGLTextureArray *)item)->texture_obj;
+		} else if (Py_TYPE(item) == &MGLTextureCube_Type) {
+			texture_obj = ((MGLTextureCube *)item)->texture_obj;
+		} else {
+			texture_obj = ((MGLTexture3D *)item)->texture_obj;
+		}
+
+		if (attachment.layer < 0) {
+			// Layered rendering, the geometry shader selects the layer with gl_Layer
+			gl.FramebufferTexture(GL_FRAMEBUFFER, attachment_point, texture_obj, 0);
+		} else if (Py_TYPE(item) == &MGLTextureCube_Type) {
+			gl.FramebufferTexture2D(GL_FRAMEBUFFER, attachment_point, GL_TEXTURE_CUBE_MAP_POSITIVE_X + attachment.layer, texture_obj, 0);
+		} else {
+			gl.FramebufferTextureLayer(GL_FRAMEBUFFER, attachment_point, texture_obj, 0, attachment.layer);
+		}
+	}
+}
+
+void MGLContext_ResetFramebufferState(MGLContext * self) {
+	self->applied_framebuffer = -1;
+	self->applied_viewport[0] = -1;
+	self->applied_scissor[0] = -1;
+	self->applied_scissor_enabled = -1;
+	self->applied_depth_mask = -1;
+	for (int i = 0; i < MGL_MAX_DRAW_BUFFERS; ++i) {
+		self->applied_color_mask[i] = -1;
+	}
+}
+
+// The functions below change the GL state only when it differs from the cached one
+
+static bool apply_framebuffer(MGLContext * context, int framebuffer_obj) {
+	if (context->applied_framebuffer == framebuffer_obj) {
+		return false;
+	}
+	context->gl.BindFramebuffer(GL_FRAMEBUFFER, framebuffer_obj);
+	context->applied_framebuffer = framebuffer_obj;
+	MGL_STAT(context, MGL_STAT_FRAMEBUFFER_BINDS, 1);
+	return true;
+}
+
+static void apply_viewport(MGLContext * context, int x, int y, int width, int height) {
+	int * applied = context->applied_viewport;
+	if (applied[0] == x && applied[1] == y && applied[2] == width && applied[3] == height) {
+		return;
+	}
+	context->gl.Viewport(x, y, width, height);
+	applied[0] = x;
+	applied[1] = y;
+	applied[2] = width;
+	applied[3] = height;
+}
+
+static void apply_scissor(MGLContext * context, bool enabled, int x, int y, int width, int height) {
+	if (context->applied_scissor_enabled != (int)enabled) {
+		if (enabled) {
+			context->gl.Enable(GL_SCISSOR_TEST);
+		} else {
+			context->gl.Disable(GL_SCISSOR_TEST);
+		}
+		context->applied_scissor_enabled = enabled;
+	}
+
+	if (!enabled) {
+		return;
+	}
+
+	int * applied = context->applied_scissor;
+	if (applied[0] == x && applied[1] == y && applied[2] == width && applied[3] == height) {
+		return;
+	}
+	context->gl.Scissor(x, y, width, height);
+	applied[0] = x;
+	applied[1] = y;
+	applied[2] = width;
+	applied[3] = height;
+}
+
+static void apply_masks(MGLContext * context, MGLFramebuffer * framebuffer) {
+	const GLMethods & gl = context->gl;
+
+	for (int i = 0; i < framebuffer->draw_buffers_len; ++i) {
+		bool * mask = framebuffer->color_mask + i * 4;
+		int bits = mask[0] | mask[1] << 1 | mask[2] << 2 | mask[3] << 3;
+
+		if (i < MGL_MAX_DRAW_BUFFERS && context->applied_color_mask[i] == bits) {
+			continue;
+		}
+
+		gl.ColorMaski(i, mask[0], mask[1], mask[2], mask[3]);
+
+		if (i < MGL_MAX_DRAW_BUFFERS) {
+			context->applied_color_mask[i] = bits;
+		}
+	}
+
+	if (context->applied_depth_mask != (int)framebuffer->depth_mask) {
+		gl.DepthMask(framebuffer->depth_mask);
+		context->applied_depth_mask = framebuffer->depth_mask;
+	}
+}
+
+// Parses a (width, height) or (x, y, width, height) viewport, None keeps the passed in values
+static bool parse_viewport(PyObject * viewport, int & x, int & y, int & width, int & height) {
+	if (viewport == Py_None) {
+		return true;
+	}
+
+	if (Py_TYPE(viewport) != &PyTuple_Type) {
+		MGLError_Set("the viewport must be a tuple not %s", Py_TYPE(viewport)->tp_name);
+		return false;
+	}
+
+	if (PyTuple_GET_SIZE(viewport) == 4) {
+		x = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+		y = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+		width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 2));
+		height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 3));
+	} else if (PyTuple_GET_SIZE(viewport) == 2) {
+		width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+		height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+	} else {
+		MGLError_Set("the viewport size %d is invalid", (int)PyTuple_GET_SIZE(viewport));
+		return false;
+	}
+
+	if (PyErr_Occurred()) {
+		MGLError_Set("wrong values in the viewport");
+		return false;
+	}
+
+	return true;
+}
+
+// The reads allocate and copy width * height pixels, the region must be inside the framebuffer
+static bool check_read_viewport(MGLFramebuffer * self, int x, int y, int width, int height) {
+	if (width < 1 || height < 1 || x < 0 || y < 0 || x > self->width - width || y > self->height - height) {
+		MGLError_Set("the viewport (%d, %d, %d, %d) is outside the framebuffer", x, y, width, height);
+		return false;
+	}
+
+	return true;
+}
+
 PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 	PyObject * color_attachments;
 	PyObject * depth_attachment;
@@ -36,57 +293,42 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 	// 	return 0;
 	// }
 
+	MGLFramebufferAttachment * attachments = new MGLFramebufferAttachment[color_attachments_len + 1];
+	MGLFramebufferAttachment & depth = attachments[color_attachments_len];
+
 	for (int i = 0; i < color_attachments_len; ++i) {
 		PyObject * item = PyTuple_GET_ITEM(color_attachments, i);
+		MGLFramebufferAttachment & attachment = attachments[i];
 
-		if (Py_TYPE(item) == &MGLTexture_Type) {
-			MGLTexture * texture = (MGLTexture *)item;
-
-			if (texture->depth) {
-				MGLError_Set("color_attachments[%d] is a depth attachment", i);
-				return 0;
-			}
+		char name[32];
+		PyOS_snprintf(name, 32, "color_attachments[%d]", i);
 
-			if (i == 0) {
-				width = texture->width;
-				height = texture->height;
-				samples = texture->samples;
-			} else {
-				if (texture->width != width || texture->height != height || texture->samples != samples) {
-					MGLError_Set("the color_attachments have different sizes or samples");
-					return 0;
-				}
-			}
+		if (!parse_attachment(item, attachment, name)) {
+			delete[] attachments;
+			return 0;
+		}
 
-			if (texture->context != self) {
-				MGLError_Set("color_attachments[%d] belongs to a different context", i);
-				return 0;
-			}
-		} else if (Py_TYPE(item) == &MGLRenderbuffer_Type) {
-			MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)item;
+		if (attachment.depth) {
+			MGLError_Set("color_attachments[%d] is a depth attachment", i);
+			delete[] attachments;
+			return 0;
+		}
 
-			if (renderbuffer->depth) {
-				MGLError_Set("color_attachments[%d] is a depth attachment", i);
+		if (i == 0) {
+			width = attachment.width;
+			height = attachment.height;
+			samples = attachment.samples;
+		} else {
+			if (attachment.width != width || attachment.height != height || attachment.samples != samples) {
+				MGLError_Set("the color_attachments have different sizes or samples");
+				delete[] attachments;
 				return 0;
 			}
+		}
 
-			if (i == 0) {
-				width = renderbuffer->width;
-				height = renderbuffer->height;
-				samples = renderbuffer->samples;
-			} else {
-				if (renderbuffer->width != width || renderbuffer->height != height || renderbuffer->samples != samples) {
-					MGLError_Set("the color_attachments have different sizes or samples");
-					return 0;
-				}
-			}
-
-			if (renderbuffer->context != self) {
-				MGLError_Set("color_attachments[%d] belongs to a different context", i);
-				return 0;
-			}
-		} else {
-			MGLError_Set("color_attachments[%d] must be a Renderbuffer or Texture not %s", i, Py_TYPE(item)->tp_name);
+		if (attachment.context != self) {
+			MGLError_Set("color_attachments[%d] belongs to a different context", i);
+			delete[] attachments;
 			return 0;
 		}
 	}
@@ -95,61 +337,38 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 
 	if (depth_attachment != Py_None) {
 
-		if (Py_TYPE(depth_attachment) == &MGLTexture_Type) {
-			MGLTexture * texture = (MGLTexture *)depth_attachment;
-
-			if (!texture->depth) {
-				MGLError_Set("the depth_attachment is a color attachment");
-				return 0;
-			}
-
-			if (texture->context != self) {
-				MGLError_Set("the depth_attachment belongs to a different context");
-				return 0;
-			}
+		if (!parse_attachment(depth_attachment, depth, "the depth_attachment")) {
+			delete[] attachments;
+			return 0;
+		}
 
-			if (color_attachments_len) {
-				if (texture->width != width || texture->height != height || texture->samples != samples) {
-					MGLError_Set("the depth_attachment have different sizes or samples");
-					return 0;
-				}
-			}
-			else {
-				width = texture->width;
-				height = texture->height;
-				samples = texture->samples;
-			}
-		} else if (Py_TYPE(depth_attachment) == &MGLRenderbuffer_Type) {
-			MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)depth_attachment;
+		if (!depth.depth) {
+			MGLError_Set("the depth_attachment is a color attachment");
+			delete[] attachments;
+			return 0;
+		}
 
-			if (!renderbuffer->depth) {
-				MGLError_Set("the depth_attachment is a color attachment");
-				return 0;
-			}
+		if (depth.context != self) {
+			MGLError_Set("the depth_attachment belongs to a different context");
+			delete[] attachments;
+			return 0;
+		}
 
-			if (renderbuffer->context != self) {
-				MGLError_Set("the depth_attachment belongs to a different context");
+		if (color_attachments_len) {
+			if (depth.width != width || depth.height != height || depth.samples != samples) {
+				MGLError_Set("the depth_attachment have different sizes or samples");
+				delete[] attachments;
 				return 0;
 			}
-
-			if (color_attachments_len) {
-				if (renderbuffer->width != width || renderbuffer->height != height || renderbuffer->samples != samples) {
-					MGLError_Set("the depth_attachment have different sizes or samples");
-					return 0;
-				}
-			}
-			else {
-				width = renderbuffer->width;
-				height = renderbuffer->height;
-				samples = renderbuffer->samples;
-			}
 		} else {
-			MGLError_Set("the depth_attachment must be a Renderbuffer or Texture not %s", Py_TYPE(depth_attachment)->tp_name);
-			return 0;
+			width = depth.width;
+			height = depth.height;
+			samples = depth.samples;
 		}
 	}
 
 	MGLFramebuffer * framebuffer = (MGLFramebuffer *)MGLFramebuffer_Type.tp_alloc(&MGLFramebuffer_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	framebuffer->framebuffer_obj = 0;
 	gl.GenFramebuffers(1, (GLuint *)&framebuffer->framebuffer_obj);
@@ -157,6 +376,7 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 	if (!framebuffer->framebuffer_obj) {
 		MGLError_Set("cannot create framebuffer");
 		Py_DECREF(framebuffer);
+		delete[] attachments;
 		return 0;
 	}
 
@@ -167,53 +387,11 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 	}
 
 	for (int i = 0; i < color_attachments_len; ++i) {
-		PyObject * item = PyTuple_GET_ITEM(color_attachments, i);
-
-		if (Py_TYPE(item) == &MGLTexture_Type) {
-
-			MGLTexture * texture = (MGLTexture *)item;
-
-			gl.FramebufferTexture2D(
-				GL_FRAMEBUFFER,
-				GL_COLOR_ATTACHMENT0 + i,
-				texture->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D,
-				texture->texture_obj,
-				0
-			);
-
-		} else if (Py_TYPE(item) == &MGLRenderbuffer_Type) {
-
-			MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)item;
-
-			gl.FramebufferRenderbuffer(
-				GL_FRAMEBUFFER,
-				GL_COLOR_ATTACHMENT0 + i,
-				GL_RENDERBUFFER,
-				renderbuffer->renderbuffer_obj
-			);
-		}
+		attach(gl, GL_COLOR_ATTACHMENT0 + i, attachments[i]);
 	}
 
-	if (Py_TYPE(depth_attachment) == &MGLTexture_Type) {
-		MGLTexture * texture = (MGLTexture *)depth_attachment;
-
-		gl.FramebufferTexture2D(
-			GL_FRAMEBUFFER,
-			GL_DEPTH_ATTACHMENT,
-			texture->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D,
-			texture->texture_obj,
-			0
-		);
-
-	} else if (Py_TYPE(depth_attachment) == &MGLRenderbuffer_Type) {
-		MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)depth_attachment;
-
-		gl.FramebufferRenderbuffer(
-			GL_FRAMEBUFFER,
-			GL_DEPTH_ATTACHMENT,
-			GL_RENDERBUFFER,
-			renderbuffer->renderbuffer_obj
-		);
+	if (depth_attachment != Py_None) {
+		attach(gl, GL_DEPTH_ATTACHMENT, depth);
 	}
 
 	int status = gl.CheckFramebufferStatus(GL_FRAMEBUFFER);
@@ -258,6 +436,7 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 		}
 
 		MGLError_Set(message);
+		delete[] attachments;
 		return 0;
 	}
 
@@ -271,22 +450,26 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 	framebuffer->color_mask = new bool[color_attachments_len * 4 + 1];
 
 	for (int i = 0; i < color_attachments_len; ++i) {
-		PyObject * item = PyTuple_GET_ITEM(color_attachments, i);
-		if (Py_TYPE(item) == &MGLTexture_Type) {
-			MGLTexture * texture = (MGLTexture *)item;
-			framebuffer->color_mask[i * 4 + 0] = texture->components >= 1;
-			framebuffer->color_mask[i * 4 + 1] = texture->components >= 2;
-			framebuffer->color_mask[i * 4 + 2] = texture->components >= 3;
-			framebuffer->color_mask[i * 4 + 3] = texture->components >= 4;
-		} else if (Py_TYPE(item) == &MGLRenderbuffer_Type) {
-			MGLTexture * renderbuffer = (MGLTexture *)item;
-			framebuffer->color_mask[i * 4 + 0] = renderbuffer->components >= 1;
-			framebuffer->color_mask[i * 4 + 1] = renderbuffer->components >= 2;
-			framebuffer->color_mask[i * 4 + 2] = renderbuffer->components >= 3;
-			framebuffer->color_mask[i * 4 + 3] = renderbuffer->components >= 4;
+		framebuffer->color_mask[i * 4 + 0] = attachments[i].components >= 1;
+		framebuffer->color_mask[i * 4 + 1] = attachments[i].components >= 2;
+		framebuffer->color_mask[i * 4 + 2] = attachments[i].components >= 3;
+		framebuffer->color_mask[i * 4 + 3] = attachments[i].components >= 4;
+	}
+
+	framebuffer->textures = PyList_New(0);
+
+	for (int i = 0; i <= color_attachments_len; ++i) {
+		if (i == color_attachments_len && depth_attachment == Py_None) {
+			break;
+		}
+		if (Py_TYPE(attachments[i].object) == &MGLTexture_Type) {
+			((MGLTexture *)attachments[i].object)->framebuffers += 1;
+			PyList_Append(framebuffer->textures, attachments[i].object);
 		}
 	}
 
+	delete[] attachments;
+
 	framebuffer->depth_mask = (depth_attachment != Py_None);
 
 	framebuffer->viewport_x = 0;
@@ -397,104 +580,59 @@ PyObject * MGLFramebuffer_clear(MGLFramebuffer * self, PyObject * args) {
 
 	}
 
-	const GLMethods & gl = self->context->gl;
-
-	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
+	MGLContext * context = self->context;
+	const GLMethods & gl = context->gl;
 
-	if (self->framebuffer_obj) {
+	if (apply_framebuffer(context, self->framebuffer_obj) && self->framebuffer_obj) {
 		gl.DrawBuffers(self->draw_buffers_len, self->draw_buffers);
 	}
 
 	gl.ClearColor(r, g, b, a);
 	gl.ClearDepth(depth);
 
-	for (int i = 0; i < self->draw_buffers_len; ++i) {
-		gl.ColorMaski(
-			i,
-			self->color_mask[i * 4 + 0],
-			self->color_mask[i * 4 + 1],
-			self->color_mask[i * 4 + 2],
-			self->color_mask[i * 4 + 3]
-		);
-	}
-
-	gl.DepthMask(self->depth_mask);
+	apply_masks(context, self);
 
 	// Respect the passed in viewport even with scissor enabled
 	if (viewport != Py_None) {
-		gl.Enable(GL_SCISSOR_TEST);
-		gl.Scissor(x, y, width, height);
-		gl.Clear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
-
-		// restore scissor if enabled
-		if (self->scissor_enabled) {
-			gl.Scissor(
-				self->scissor_x, self->scissor_y,
-				self->scissor_width, self->scissor_height
-			);
-		} else {
-			gl.Disable(GL_SCISSOR_TEST);
-		}
+		apply_scissor(context, true, x, y, width, height);
 	} else {
-		// clear with scissor if enabled
-		if (self->scissor_enabled) {
-			gl.Enable(GL_SCISSOR_TEST);
-			gl.Scissor(
-				self->scissor_x, self->scissor_y,
-				self->scissor_width, self->scissor_height
-			);
-		}
-		gl.Clear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+		apply_scissor(context, self->scissor_enabled, self->scissor_x, self->scissor_y, self->scissor_width, self->scissor_height);
 	}
 
-	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
+	gl.Clear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+	MGL_STAT(context, MGL_STAT_CLEARS, 1);
+
+	// Leave the state of the bound framebuffer behind
+	MGLFramebuffer * bound = context->bound_framebuffer;
+
+	if (apply_framebuffer(context, bound->framebuffer_obj) && bound->framebuffer_obj) {
+		gl.DrawBuffers(bound->draw_buffers_len, bound->draw_buffers);
+	}
+
+	apply_scissor(context, bound->scissor_enabled, bound->scissor_x, bound->scissor_y, bound->scissor_width, bound->scissor_height);
+	apply_masks(context, bound);
 
 	Py_RETURN_NONE;
 }
 
 PyObject * MGLFramebuffer_use(MGLFramebuffer * self) {
-	const GLMethods & gl = self->context->gl;
-
-	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
+	MGLContext * context = self->context;
 
-	if (self->framebuffer_obj) {
-		gl.DrawBuffers(self->draw_buffers_len, self->draw_buffers);
+	// The draw buffers are part of the framebuffer object, they only need to be set when binding it
+	if (apply_framebuffer(context, self->framebuffer_obj) && self->framebuffer_obj) {
+		context->gl.DrawBuffers(self->draw_buffers_len, self->draw_buffers);
 	}
 
 	if (self->viewport_width && self->viewport_height) {
-		gl.Viewport(
-			self->viewport_x,
-			self->viewport_y,
-			self->viewport_width,
-			self->viewport_height
-		);
-	}
-
-	if (self->scissor_enabled) {
-		gl.Enable(GL_SCISSOR_TEST);
-		gl.Scissor(
-			self->scissor_x, self->scissor_y,
-			self->scissor_width, self->scissor_height
-		);
-	} else {
-		gl.Disable(GL_SCISSOR_TEST);
-	}
-
-	for (int i = 0; i < self->draw_buffers_len; ++i) {
-		gl.ColorMaski(
-			i,
-			self->color_mask[i * 4 + 0],
-			self->color_mask[i * 4 + 1],
-			self->color_mask[i * 4 + 2],
-			self->color_mask[i * 4 + 3]
-		);
+		apply_viewport(context, self->viewport_x, self->viewport_y, self->viewport_width, self->viewport_height);
 	}
 
-	gl.DepthMask(self->depth_mask);
+	apply_scissor(context, self->scissor_enabled, self->scissor_x, self->scissor_y, self->scissor_width, self->scissor_height);
+	apply_masks(context, self);
 
 	Py_INCREF(self);
-	Py_DECREF(self->context->bound_framebuffer);
-	self->context->bound_framebuffer = self;
+	Py_DECREF(context->bound_framebuffer);
+	context->bound_framebuffer = self;
 
 	Py_RETURN_NONE;
 }
@@ -608,6 +746,7 @@ PyObject * MGLFramebuffer_read(MGLFramebuffer * self, PyObject * args) {
 	gl.ReadPixels(x, y, width, height, base_format, pixel_type, data);
 	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
 
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 	return result;
 }
 
@@ -748,95 +887,770 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 		gl.ReadPixels(x, y, width, height, base_format, pixel_type, ptr);
 		gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
 
+		MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 		PyBuffer_Release(&buffer_view);
 	}
 
 	return PyLong_FromLong(expected_size);
 }
 
-PyMethodDef MGLFramebuffer_tp_methods[] = {
-	{"clear", (PyCFunction)MGLFramebuffer_clear, METH_VARARGS, 0},
-	{"use", (PyCFunction)MGLFramebuffer_use, METH_NOARGS, 0},
-	{"read", (PyCFunction)MGLFramebuffer_read, METH_VARARGS, 0},
-	{"read_into", (PyCFunction)MGLFramebuffer_read_into, METH_VARARGS, 0},
-	{"release", (PyCFunction)MGLFramebuffer_release, METH_NOARGS, 0},
-	{0},
-};
+PyObject * MGLFramebuffer_invalidate(MGLFramebuffer * self, PyObject * args) {
+	PyObject * attachments;
+	PyObject * viewport;
 
-PyObject * MGLFramebuffer_get_viewport(MGLFramebuffer * self, void * closure) {
-	PyObject * x = PyLong_FromLong(self->viewport_x);
-	PyObject * y = PyLong_FromLong(self->viewport_y);
-	PyObject * width = PyLong_FromLong(self->viewport_width);
-	PyObject * height = PyLong_FromLong(self->viewport_height);
-	return PyTuple_Pack(4, x, y, width, height);
-}
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!O",
+		&PyTuple_Type,
+		&attachments,
+		&viewport
+	);
 
-int MGLFramebuffer_set_viewport(MGLFramebuffer * self, PyObject * value, void * closure) {
-	if (PyTuple_GET_SIZE(value) != 4) {
-		MGLError_Set("the viewport must be a 4-tuple not %d-tuple", PyTuple_GET_SIZE(value));
-		return -1;
+	if (!args_ok) {
+		return 0;
 	}
 
-	int viewport_x = PyLong_AsLong(PyTuple_GET_ITEM(value, 0));
-	int viewport_y = PyLong_AsLong(PyTuple_GET_ITEM(value, 1));
-	int viewport_width = PyLong_AsLong(PyTuple_GET_ITEM(value, 2));
-	int viewport_height = PyLong_AsLong(PyTuple_GET_ITEM(value, 3));
+	int x = 0;
+	int y = 0;
+	int width = self->width;
+	int height = self->height;
 
-	if (PyErr_Occurred()) {
-		MGLError_Set("the viewport is invalid");
-		return -1;
+	if (!parse_viewport(viewport, x, y, width, height)) {
+		return 0;
 	}
 
-	self->viewport_x = viewport_x;
-	self->viewport_y = viewport_y;
-	self->viewport_width = viewport_width;
-	self->viewport_height = viewport_height;
+	int num_attachments = (int)PyTuple_GET_SIZE(attachments);
+	unsigned * points = new unsigned[num_attachments * 2 + 1];
+	int num_points = 0;
 
-	if (self->framebuffer_obj == self->context->bound_framebuffer->framebuffer_obj) {
-		const GLMethods & gl = self->context->gl;
+	for (int i = 0; i < num_attachments; ++i) {
+		int attachment = PyLong_AsLong(PyTuple_GET_ITEM(attachments, i));
 
-		gl.Viewport(
-			self->viewport_x,
-			self->viewport_y,
-			self->viewport_width,
-			self->viewport_height
-		);
-	}
+		if (PyErr_Occurred() || attachment < -1 || attachment >= self->draw_buffers_len) {
+			MGLError_Set("the attachments[%d] is invalid", i);
+			delete[] points;
+			return 0;
+		}
 
-	return 0;
-}
+		// The default framebuffer has its own attachment names
+		if (!self->framebuffer_obj) {
+			if (attachment == -1) {
+				points[num_points++] = GL_DEPTH;
+				points[num_points++] = GL_STENCIL;
+			} else {
+				points[num_points++] = GL_COLOR;
+			}
+		} else {
+			points[num_points++] = attachment == -1 ? GL_DEPTH_ATTACHMENT : GL_COLOR_ATTACHMENT0 + attachment;
+		}
+	}
 
-PyObject * MGLFramebuffer_get_scissor(MGLFramebuffer * self, void * closure) {
-	PyObject * x = PyLong_FromLong(self->scissor_x);
-	PyObject * y = PyLong_FromLong(self->scissor_y);
-	PyObject * width = PyLong_FromLong(self->scissor_width);
-	PyObject * height = PyLong_FromLong(self->scissor_height);
-	return PyTuple_Pack(4, x, y, width, height);
-}
+	const GLMethods & gl = self->context->gl;
 
-int MGLFramebuffer_set_scissor(MGLFramebuffer * self, PyObject * value, void * closure) {
+	// Invalidation is only a hint, it is silently skipped before OpenGL 4.3
+	if (num_points && gl.InvalidateFramebuffer) {
+		gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
 
-	if (value == Py_None) {
-		self->scissor_x = 0;
-		self->scissor_y = 0;
-		self->scissor_width = self->width;
-		self->scissor_height = self->height;
-		self->scissor_enabled = false;
-	} else {
-		if (PyTuple_GET_SIZE(value) != 4) {
-			MGLError_Set("scissor must be None or a 4-tuple not %d-tuple", PyTuple_GET_SIZE(value));
-			return -1;
+		if (viewport == Py_None) {
+			gl.InvalidateFramebuffer(GL_FRAMEBUFFER, num_points, points);
+		} else {
+			gl.InvalidateSubFramebuffer(GL_FRAMEBUFFER, num_points, points, x, y, width, height);
 		}
 
-		int scissor_x = PyLong_AsLong(PyTuple_GET_ITEM(value, 0));
-		int scissor_y = PyLong_AsLong(PyTuple_GET_ITEM(value, 1));
-		int scissor_width = PyLong_AsLong(PyTuple_GET_ITEM(value, 2));
-		int scissor_height = PyLong_AsLong(PyTuple_GET_ITEM(value, 3));
-
-		if (PyErr_Occurred()) {
-			MGLError_Set("the scissor is invalid");
-			return -1;
-		}
+		gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
+	}
+
+	delete[] points;
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLFramebuffer_resolve(MGLFramebuffer * self, PyObject * args) {
+	MGLFramebuffer * dst;
+	int attachment;
+	PyObject * viewport;
+	int dst_attachment;
+	int filter;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!iOiI",
+		&MGLFramebuffer_Type,
+		&dst,
+		&attachment,
+		&viewport,
+		&dst_attachment,
+		&filter
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (attachment < -1 || attachment >= self->draw_buffers_len) {
+		MGLError_Set("the attachment is invalid");
+		return 0;
+	}
+
+	if (attachment != -1 && (dst_attachment < 0 || dst_attachment >= dst->draw_buffers_len)) {
+		MGLError_Set("the dst_attachment is invalid");
+		return 0;
+	}
+
+	if (filter != GL_NEAREST && filter != GL_LINEAR) {
+		MGLError_Set("invalid filter");
+		return 0;
+	}
+
+	if (filter == GL_LINEAR && attachment == -1) {
+		MGLError_Set("the depth attachment can only be resolved with the nearest filter");
+		return 0;
+	}
+
+	int x = 0;
+	int y = 0;
+	int width = self->width < dst->width ? self->width : dst->width;
+	int height = self->height < dst->height ? self->height : dst->height;
+
+	if (!parse_viewport(viewport, x, y, width, height)) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	// The blit is clipped by the scissor test, the whole viewport must be resolved
+	apply_scissor(self->context, false, 0, 0, 0, 0);
+
+	gl.BindFramebuffer(GL_READ_FRAMEBUFFER, self->framebuffer_obj);
+	gl.BindFramebuffer(GL_DRAW_FRAMEBUFFER, dst->framebuffer_obj);
+
+	// Only the selected attachment is copied, the draw buffers of the destination are restored afterwards
+	bool select_draw_buffer = attachment != -1 && dst->framebuffer_obj;
+
+	if (attachment != -1) {
+		gl.ReadBuffer(self->framebuffer_obj ? GL_COLOR_ATTACHMENT0 + attachment : self->draw_buffers[0]);
+	}
+
+	if (select_draw_buffer) {
+		unsigned draw_buffer = GL_COLOR_ATTACHMENT0 + dst_attachment;
+		gl.DrawBuffers(1, &draw_buffer);
+	}
+
+	gl.BlitFramebuffer(
+		x, y, x + width, y + height,
+		x, y, x + width, y + height,
+		attachment == -1 ? GL_DEPTH_BUFFER_BIT : GL_COLOR_BUFFER_BIT,
+		filter
+	);
+
+	if (select_draw_buffer) {
+		gl.DrawBuffers(dst->draw_buffers_len, dst->draw_buffers);
+	}
+
+	MGLFramebuffer * bound = self->context->bound_framebuffer;
+	gl.BindFramebuffer(GL_FRAMEBUFFER, bound->framebuffer_obj);
+	apply_scissor(self->context, bound->scissor_enabled, bound->scissor_x, bound->scissor_y, bound->scissor_width, bound->scissor_height);
+	Py_RETURN_NONE;
+}
+
+enum MGLReadConversion {
+	READ_CONVERSION_NONE,
+	READ_CONVERSION_F1_TO_F4,
+	READ_CONVERSION_F2_TO_F4,
+	READ_CONVERSION_F4_TO_F1,
+};
+
+// Copies rows from the bottom up order of ReadPixels into top down order while converting the components
+// Each inner loop is a plain strided conversion so the compiler can vectorize it
+static void convert_rows(const char * src, char * dst, int width, int height, int components, int src_size, int dst_size, int conversion, bool flip) {
+	Py_ssize_t count = (Py_ssize_t)width * components;
+
+	for (int row = 0; row < height; ++row) {
+		const char * src_row = src + count * src_size * row;
+		char * dst_row = dst + count * dst_size * (flip ? height - row - 1 : row);
+
+		switch (conversion) {
+			case READ_CONVERSION_F1_TO_F4: {
+				const unsigned char * from = (const unsigned char *)src_row;
+				float * to = (float *)dst_row;
+				for (Py_ssize_t i = 0; i < count; ++i) {
+					to[i] = from[i] * (1.0f / 255.0f);
+				}
+				break;
+			}
+
+			case READ_CONVERSION_F2_TO_F4: {
+				const unsigned short * from = (const unsigned short *)src_row;
+				float * to = (float *)dst_row;
+				for (Py_ssize_t i = 0; i < count; ++i) {
+					to[i] = half_to_float(from[i]);
+				}
+				break;
+			}
+
+			case READ_CONVERSION_F4_TO_F1: {
+				const float * from = (const float *)src_row;
+				unsigned char * to = (unsigned char *)dst_row;
+				for (Py_ssize_t i = 0; i < count; ++i) {
+					float value = from[i] * 255.0f + 0.5f;
+					to[i] = (unsigned char)(value < 0.0f ? 0.0f : (value > 255.0f ? 255.0f : value));
+				}
+				break;
+			}
+
+			default:
+				memcpy(dst_row, src_row, count * src_size);
+				break;
+		}
+	}
+}
+
+// Reverses the order of the rows in place
+static void flip_rows(char * data, int height, Py_ssize_t row_size) {
+	char * temp = new char[row_size];
+
+	for (int row = 0; row < height / 2; ++row) {
+		char * top = data + row_size * row;
+		char * bottom = data + row_size * (height - row - 1);
+		memcpy(temp, top, row_size);
+		memcpy(top, bottom, row_size);
+		memcpy(bottom, temp, row_size);
+	}
+
+	delete[] temp;
+}
+
+PyObject * MGLFramebuffer_read_array(MGLFramebuffer * self, PyObject * args) {
+	PyObject * data;
+	PyObject * viewport;
+	int components;
+	int attachment;
+	const char * dtype;
+	const char * out_dtype;
+	int flip;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OOIissp",
+		&data,
+		&viewport,
+		&components,
+		&attachment,
+		&dtype,
+		&out_dtype,
+		&flip
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype);
+	MGLDataType * out_data_type = from_dtype(out_dtype);
+
+	if (!data_type || !out_data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	int conversion = READ_CONVERSION_NONE;
+
+	if (strcmp(dtype, out_dtype)) {
+		if (!strcmp(dtype, "f1") && !strcmp(out_dtype, "f4")) {
+			conversion = READ_CONVERSION_F1_TO_F4;
+		} else if (!strcmp(dtype, "f2") && !strcmp(out_dtype, "f4")) {
+			conversion = READ_CONVERSION_F2_TO_F4;
+		} else if (!strcmp(dtype, "f4") && !strcmp(out_dtype, "f1")) {
+			conversion = READ_CONVERSION_F4_TO_F1;
+		} else {
+			MGLError_Set("cannot convert %s to %s", dtype, out_dtype);
+			return 0;
+		}
+	}
+
+	bool read_depth = attachment == -1;
+
+	if (read_depth) {
+		components = 1;
+	} else if (components < 1 || components > 4) {
+		MGLError_Set("the components must be 1, 2, 3 or 4");
+		return 0;
+	}
+
+	int x = 0;
+	int y = 0;
+	int width = self->width;
+	int height = self->height;
+
+	if (!parse_viewport(viewport, x, y, width, height) || !check_read_viewport(self, x, y, width, height)) {
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	if (PyObject_GetBuffer(data, &buffer_view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0) {
+		PyErr_Clear();
+		MGLError_Set("the out must be a writable contiguous buffer");
+		return 0;
+	}
+
+	Py_ssize_t row_size = (Py_ssize_t)width * components * out_data_type->size;
+
+	if (buffer_view.len < row_size * height) {
+		MGLError_Set("the out is too small %zd < %zd", buffer_view.len, row_size * height);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	int base_format = read_depth ? GL_DEPTH_COMPONENT : data_type->base_format[components];
+	char * out = (char *)buffer_view.buf;
+
+	// Without conversion the pixels are read in place, otherwise through a scratch buffer
+	char * pixels = conversion ? new (std::nothrow) char[(Py_ssize_t)width * height * components * data_type->size] : out;
+
+	if (!pixels) {
+		PyBuffer_Release(&buffer_view);
+		PyErr_NoMemory();
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
+	gl.ReadBuffer(read_depth ? GL_NONE : (GL_COLOR_ATTACHMENT0 + attachment));
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+	gl.ReadPixels(x, y, width, height, base_format, data_type->gl_type, pixels);
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, (Py_ssize_t)width * height * components * data_type->size);
+
+	Py_BEGIN_ALLOW_THREADS
+
+	if (conversion) {
+		convert_rows(pixels, out, width, height, components, data_type->size, out_data_type->size, conversion, flip);
+		delete[] pixels;
+	} else if (flip) {
+		flip_rows(out, height, row_size);
+	}
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(&buffer_view);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLFramebuffer_read_all(MGLFramebuffer * self, PyObject * args) {
+	PyObject * data;
+	PyObject * reads;
+	PyObject * viewport;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OO!O",
+		&data,
+		&PyTuple_Type,
+		&reads,
+		&viewport
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	int x = 0;
+	int y = 0;
+	int width = self->width;
+	int height = self->height;
+
+	if (!parse_viewport(viewport, x, y, width, height) || !check_read_viewport(self, x, y, width, height)) {
+		return 0;
+	}
+
+	// Each read is an (attachment, components, dtype, offset) tuple, validate them before touching the GL state
+	int num_reads = (int)PyTuple_GET_SIZE(reads);
+	Py_ssize_t required_size = 0;
+
+	for (int i = 0; i < num_reads; ++i) {
+		int attachment;
+		int components;
+		const char * dtype;
+		Py_ssize_t offset;
+
+		if (!PyArg_ParseTuple(PyTuple_GET_ITEM(reads, i), "iisn", &attachment, &components, &dtype, &offset)) {
+			return 0;
+		}
+
+		MGLDataType * data_type = from_dtype(dtype);
+
+		if (!data_type) {
+			MGLError_Set("invalid dtype");
+			return 0;
+		}
+
+		if (attachment < -1 || attachment >= self->draw_buffers_len || components < 1 || components > 4) {
+			MGLError_Set("the attachment %d is invalid", attachment);
+			return 0;
+		}
+
+		Py_ssize_t end = offset + (Py_ssize_t)width * height * components * data_type->size;
+		required_size = end > required_size ? end : required_size;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	char * ptr = 0;
+	Py_buffer buffer_view = {};
+	bool pixel_pack = Py_TYPE(data) == &MGLBuffer_Type;
+
+	if (pixel_pack) {
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < required_size) {
+			MGLError_Set("the out is too small %zd < %zd", buffer->size, required_size);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, buffer->buffer_obj);
+	} else {
+		if (PyObject_GetBuffer(data, &buffer_view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0) {
+			PyErr_Clear();
+			MGLError_Set("the out must be a Buffer or a writable contiguous buffer");
+			return 0;
+		}
+
+		if (buffer_view.len < required_size) {
+			MGLError_Set("the out is too small %zd < %zd", buffer_view.len, required_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		ptr = (char *)buffer_view.buf;
+	}
+
+	// A single bind and pixel store setup for all the attachments
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+
+	for (int i = 0; i < num_reads; ++i) {
+		int attachment;
+		int components;
+		const char * dtype;
+		Py_ssize_t offset;
+
+		PyArg_ParseTuple(PyTuple_GET_ITEM(reads, i), "iisn", &attachment, &components, &dtype, &offset);
+		MGLDataType * data_type = from_dtype(dtype);
+
+		int base_format = attachment == -1 ? GL_DEPTH_COMPONENT : data_type->base_format[components];
+
+		gl.ReadBuffer(attachment == -1 ? GL_NONE : (GL_COLOR_ATTACHMENT0 + attachment));
+		gl.ReadPixels(x, y, width, height, base_format, data_type->gl_type, ptr + offset);
+
+		if (!pixel_pack) {
+			MGL_STAT(self->context, MGL_STAT_BYTES_READ, (Py_ssize_t)width * height * (attachment == -1 ? 1 : components) * data_type->size);
+		}
+	}
+
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
+
+	if (pixel_pack) {
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	} else {
+		PyBuffer_Release(&buffer_view);
+	}
+
+	Py_RETURN_NONE;
+}
+
+// A temporary single sample render target used by read_scaled
+struct MGLScratchTarget {
+	int framebuffer_obj;
+	int renderbuffer_obj;
+};
+
+static MGLScratchTarget create_scratch_target(const GLMethods & gl, int internal_format, int width, int height) {
+	MGLScratchTarget target = {};
+
+	gl.GenRenderbuffers(1, (GLuint *)&target.renderbuffer_obj);
+	gl.BindRenderbuffer(GL_RENDERBUFFER, target.renderbuffer_obj);
+	gl.RenderbufferStorage(GL_RENDERBUFFER, internal_format, width, height);
+
+	gl.GenFramebuffers(1, (GLuint *)&target.framebuffer_obj);
+	gl.BindFramebuffer(GL_DRAW_FRAMEBUFFER, target.framebuffer_obj);
+	gl.FramebufferRenderbuffer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, target.renderbuffer_obj);
+
+	return target;
+}
+
+static void delete_scratch_target(const GLMethods & gl, MGLScratchTarget & target) {
+	gl.DeleteFramebuffers(1, (GLuint *)&target.framebuffer_obj);
+	gl.DeleteRenderbuffers(1, (GLuint *)&target.renderbuffer_obj);
+}
+
+PyObject * MGLFramebuffer_read_scaled(MGLFramebuffer * self, PyObject * args) {
+	int target_width;
+	int target_height;
+	int components;
+	int attachment;
+	PyObject * viewport;
+	const char * dtype;
+	int linear;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"(II)IiOsp",
+		&target_width,
+		&target_height,
+		&components,
+		&attachment,
+		&viewport,
+		&dtype,
+		&linear
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype);
+
+	if (!data_type || (strcmp(dtype, "f1") && strcmp(dtype, "f2") && strcmp(dtype, "f4"))) {
+		MGLError_Set("the dtype must be f1, f2 or f4");
+		return 0;
+	}
+
+	if (components < 1 || components > 4) {
+		MGLError_Set("the components must be 1, 2, 3 or 4");
+		return 0;
+	}
+
+	if (attachment < 0 || attachment >= self->draw_buffers_len) {
+		MGLError_Set("the attachment is invalid");
+		return 0;
+	}
+
+	if (target_width < 1 || target_height < 1) {
+		MGLError_Set("the size is invalid");
+		return 0;
+	}
+
+	int x = 0;
+	int y = 0;
+	int width = self->width;
+	int height = self->height;
+
+	if (!parse_viewport(viewport, x, y, width, height) || !check_read_viewport(self, x, y, width, height)) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	// The intermediate steps keep half float precision, only the last one packs to the requested format
+	MGLScratchTarget scratch[32];
+	int num_scratch = 0;
+
+	// The blits are clipped by the scissor test, the scratch targets must be written entirely
+	apply_scissor(self->context, false, 0, 0, 0, 0);
+
+	gl.BindFramebuffer(GL_READ_FRAMEBUFFER, self->framebuffer_obj);
+	gl.ReadBuffer(self->framebuffer_obj ? GL_COLOR_ATTACHMENT0 + attachment : self->draw_buffers[0]);
+
+	// Multisample sources must be resolved at their own size before scaling
+	if (self->samples) {
+		MGLScratchTarget & resolved = scratch[num_scratch++] = create_scratch_target(gl, GL_RGBA16F, width, height);
+		gl.BlitFramebuffer(x, y, x + width, y + height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+		gl.BindFramebuffer(GL_READ_FRAMEBUFFER, resolved.framebuffer_obj);
+		gl.ReadBuffer(GL_COLOR_ATTACHMENT0);
+		x = 0;
+		y = 0;
+	}
+
+	// Halving with a linear filter averages 2x2 texels, repeating it gives a box filter for large ratios
+	while (linear && (width > target_width * 2 || height > target_height * 2) && num_scratch < 31) {
+		int next_width = width > target_width * 2 ? width / 2 : width;
+		int next_height = height > target_height * 2 ? height / 2 : height;
+
+		MGLScratchTarget & step = scratch[num_scratch++] = create_scratch_target(gl, GL_RGBA16F, next_width, next_height);
+		gl.BlitFramebuffer(x, y, x + width, y + height, 0, 0, next_width, next_height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+		gl.BindFramebuffer(GL_READ_FRAMEBUFFER, step.framebuffer_obj);
+		gl.ReadBuffer(GL_COLOR_ATTACHMENT0);
+
+		x = 0;
+		y = 0;
+		width = next_width;
+		height = next_height;
+	}
+
+	MGLScratchTarget & target = scratch[num_scratch++] = create_scratch_target(gl, data_type->internal_format[components], target_width, target_height);
+	gl.BlitFramebuffer(x, y, x + width, y + height, 0, 0, target_width, target_height, GL_COLOR_BUFFER_BIT, linear ? GL_LINEAR : GL_NEAREST);
+
+	int expected_size = target_width * target_height * components * data_type->size;
+	PyObject * result = PyBytes_FromStringAndSize(0, expected_size);
+
+	gl.BindFramebuffer(GL_READ_FRAMEBUFFER, target.framebuffer_obj);
+	gl.ReadBuffer(GL_COLOR_ATTACHMENT0);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+	gl.ReadPixels(0, 0, target_width, target_height, data_type->base_format[components], data_type->gl_type, PyBytes_AS_STRING(result));
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
+
+	MGLFramebuffer * bound = self->context->bound_framebuffer;
+	gl.BindFramebuffer(GL_FRAMEBUFFER, bound->framebuffer_obj);
+	apply_scissor(self->context, bound->scissor_enabled, bound->scissor_x, bound->scissor_y, bound->scissor_width, bound->scissor_height);
+
+	for (int i = 0; i < num_scratch; ++i) {
+		delete_scratch_target(gl, scratch[i]);
+	}
+
+	return result;
+}
+
+PyObject * MGLFramebuffer_pick(MGLFramebuffer * self, PyObject * args) {
+	MGLBuffer * buffer;
+	Py_ssize_t offset;
+	int x;
+	int y;
+	int width;
+	int height;
+	int components;
+	int attachment;
+	const char * dtype;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!niiIIIis",
+		&MGLBuffer_Type,
+		&buffer,
+		&offset,
+		&x,
+		&y,
+		&width,
+		&height,
+		&components,
+		&attachment,
+		&dtype
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	if (attachment < -1 || attachment >= self->draw_buffers_len || components < 1 || components > 4) {
+		MGLError_Set("the attachment is invalid");
+		return 0;
+	}
+
+	if (attachment == -1) {
+		components = 1;
+	}
+
+	if (offset + (Py_ssize_t)width * height * components * data_type->size > buffer->size) {
+		MGLError_Set("the buffer is too small");
+		return 0;
+	}
+
+	int base_format = attachment == -1 ? GL_DEPTH_COMPONENT : data_type->base_format[components];
+
+	const GLMethods & gl = self->context->gl;
+
+	// The pixels are copied into the buffer asynchronously, the fence tells when they arrived
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, buffer->buffer_obj);
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
+	gl.ReadBuffer(attachment == -1 ? GL_NONE : (GL_COLOR_ATTACHMENT0 + attachment));
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+	gl.ReadPixels(x, y, width, height, base_format, data_type->gl_type, (void *)offset);
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	GLsync sync = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	return PyLong_FromVoidPtr(sync);
+}
+
+PyMethodDef MGLFramebuffer_tp_methods[] = {
+	{"clear", (PyCFunction)MGLFramebuffer_clear, METH_VARARGS, 0},
+	{"use", (PyCFunction)MGLFramebuffer_use, METH_NOARGS, 0},
+	{"read", (PyCFunction)MGLFramebuffer_read, METH_VARARGS, 0},
+	{"read_into", (PyCFunction)MGLFramebuffer_read_into, METH_VARARGS, 0},
+	{"read_array", (PyCFunction)MGLFramebuffer_read_array, METH_VARARGS, 0},
+	{"read_all", (PyCFunction)MGLFramebuffer_read_all, METH_VARARGS, 0},
+	{"read_scaled", (PyCFunction)MGLFramebuffer_read_scaled, METH_VARARGS, 0},
+	{"pick", (PyCFunction)MGLFramebuffer_pick, METH_VARARGS, 0},
+	{"invalidate", (PyCFunction)MGLFramebuffer_invalidate, METH_VARARGS, 0},
+	{"resolve", (PyCFunction)MGLFramebuffer_resolve, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLFramebuffer_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLFramebuffer_get_viewport(MGLFramebuffer * self, void * closure) {
+	PyObject * x = PyLong_FromLong(self->viewport_x);
+	PyObject * y = PyLong_FromLong(self->viewport_y);
+	PyObject * width = PyLong_FromLong(self->viewport_width);
+	PyObject * height = PyLong_FromLong(self->viewport_height);
+	return PyTuple_Pack(4, x, y, width, height);
+}
+
+int MGLFramebuffer_set_viewport(MGLFramebuffer * self, PyObject * value, void * closure) {
+	if (PyTuple_GET_SIZE(value) != 4) {
+		MGLError_Set("the viewport must be a 4-tuple not %d-tuple", PyTuple_GET_SIZE(value));
+		return -1;
+	}
+
+	int viewport_x = PyLong_AsLong(PyTuple_GET_ITEM(value, 0));
+	int viewport_y = PyLong_AsLong(PyTuple_GET_ITEM(value, 1));
+	int viewport_width = PyLong_AsLong(PyTuple_GET_ITEM(value, 2));
+	int viewport_height = PyLong_AsLong(PyTuple_GET_ITEM(value, 3));
+
+	if (PyErr_Occurred()) {
+		MGLError_Set("the viewport is invalid");
+		return -1;
+	}
+
+	self->viewport_x = viewport_x;
+	self->viewport_y = viewport_y;
+	self->viewport_width = viewport_width;
+	self->viewport_height = viewport_height;
+
+	if (self->framebuffer_obj == self->context->bound_framebuffer->framebuffer_obj) {
+		apply_viewport(self->context, self->viewport_x, self->viewport_y, self->viewport_width, self->viewport_height);
+	}
+
+	return 0;
+}
+
+PyObject * MGLFramebuffer_get_scissor(MGLFramebuffer * self, void * closure) {
+	PyObject * x = PyLong_FromLong(self->scissor_x);
+	PyObject * y = PyLong_FromLong(self->scissor_y);
+	PyObject * width = PyLong_FromLong(self->scissor_width);
+	PyObject * height = PyLong_FromLong(self->scissor_height);
+	return PyTuple_Pack(4, x, y, width, height);
+}
+
+int MGLFramebuffer_set_scissor(MGLFramebuffer * self, PyObject * value, void * closure) {
+
+	if (value == Py_None) {
+		self->scissor_x = 0;
+		self->scissor_y = 0;
+		self->scissor_width = self->width;
+		self->scissor_height = self->height;
+		self->scissor_enabled = false;
+	} else {
+		if (PyTuple_GET_SIZE(value) != 4) {
+			MGLError_Set("scissor must be None or a 4-tuple not %d-tuple", PyTuple_GET_SIZE(value));
+			return -1;
+		}
+
+		int scissor_x = PyLong_AsLong(PyTuple_GET_ITEM(value, 0));
+		int scissor_y = PyLong_AsLong(PyTuple_GET_ITEM(value, 1));
+		int scissor_width = PyLong_AsLong(PyTuple_GET_ITEM(value, 2));
+		int scissor_height = PyLong_AsLong(PyTuple_GET_ITEM(value, 3));
+
+		if (PyErr_Occurred()) {
+			MGLError_Set("the scissor is invalid");
+			return -1;
+		}
 
 		self->scissor_x = scissor_x;
 		self->scissor_y = scissor_y;
@@ -846,20 +1660,7 @@ int MGLFramebuffer_set_scissor(MGLFramebuffer * self, PyObject * value, void * c
 	}
 
 	if (self->framebuffer_obj == self->context->bound_framebuffer->framebuffer_obj) {
-		const GLMethods & gl = self->context->gl;
-
-		if (self->scissor_enabled) {
-			gl.Enable(GL_SCISSOR_TEST);
-		} else {
-			gl.Disable(GL_SCISSOR_TEST);
-		}
-
-		gl.Scissor(
-			self->scissor_x,
-			self->scissor_y,
-			self->scissor_width,
-			self->scissor_height
-		);
+		apply_scissor(self->context, self->scissor_enabled, self->scissor_x, self->scissor_y, self->scissor_width, self->scissor_height);
 	}
 
 	return 0;
@@ -989,17 +1790,7 @@ int MGLFramebuffer_set_color_mask(MGLFramebuffer * self, PyObject * value, void
 	}
 
 	if (self->framebuffer_obj == self->context->bound_framebuffer->framebuffer_obj) {
-		const GLMethods & gl = self->context->gl;
-
-		for (int i = 0; i < self->draw_buffers_len; ++i) {
-			gl.ColorMaski(
-				i,
-				self->color_mask[i * 4 + 0],
-				self->color_mask[i * 4 + 1],
-				self->color_mask[i * 4 + 2],
-				self->color_mask[i * 4 + 3]
-			);
-		}
+		apply_masks(self->context, self);
 	}
 
 	return 0;
@@ -1020,8 +1811,7 @@ int MGLFramebuffer_set_depth_mask(MGLFramebuffer * self, PyObject * value, void
 	}
 
 	if (self->framebuffer_obj == self->context->bound_framebuffer->framebuffer_obj) {
-		const GLMethods & gl = self->context->gl;
-		gl.DepthMask(self->depth_mask);
+		apply_masks(self->context, self);
 	}
 
 	return 0;
@@ -1133,13 +1923,26 @@ void MGLFramebuffer_Invalidate(MGLFramebuffer * framebuffer) {
 		return;
 	}
 
+	MGL_STAT(framebuffer->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	if (framebuffer->framebuffer_obj) {
+		// Deleting the bound framebuffer binds the default one and the name may be reused later
+		if (framebuffer->context->applied_framebuffer == framebuffer->framebuffer_obj) {
+			framebuffer->context->applied_framebuffer = -1;
+		}
 		framebuffer->context->gl.DeleteFramebuffers(1, (GLuint *)&framebuffer->framebuffer_obj);
 		Py_DECREF(framebuffer->context);
 	}
 
+	if (framebuffer->textures) {
+		for (Py_ssize_t i = 0; i < PyList_GET_SIZE(framebuffer->textures); ++i) {
+			((MGLTexture *)PyList_GET_ITEM(framebuffer->textures, i))->framebuffers -= 1;
+		}
+		Py_CLEAR(framebuffer->textures);
+	}
+
 	Py_TYPE(framebuffer) = &MGLInvalidObject_Type;
 	Py_DECREF(framebuffer);
 }
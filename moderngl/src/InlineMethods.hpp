@@ -7,6 +7,23 @@
 #define min(a,b) (((a) < (b)) ? (a) : (b))
 #endif
 
+// Bytes used by a mipmap chain up to max_level, layers are not halved unless mip_depth is set
+inline Py_ssize_t texture_memory(int width, int height, int depth, int max_level, int pixel_size, bool mip_depth) {
+	Py_ssize_t total = 0;
+	for (int level = 0; level <= max_level; ++level) {
+		total += (Py_ssize_t)width * height * depth * pixel_size;
+		if (width == 1 && height == 1 && (depth == 1 || !mip_depth)) {
+			break;
+		}
+		width = max(width / 2, 1);
+		height = max(height / 2, 1);
+		if (mip_depth) {
+			depth = max(depth / 2, 1);
+		}
+	}
+	return total;
+}
+
 inline void clean_glsl_name(char * name, int & name_len) {
 	if (name_len && name[name_len - 1] == ']') {
 		name_len -= 1;
@@ -176,3 +193,57 @@ inline PyObject * tuple3(PyObject * a, PyObject * b, PyObject * c) {
 	PyTuple_SET_ITEM(res, 2, c);
 	return res;
 }
+
+inline float half_to_float(unsigned short h) {
+	unsigned sign = (h & 0x8000) << 16;
+	unsigned exponent = (h >> 10) & 0x1f;
+	unsigned mantissa = h & 0x3ff;
+	unsigned bits;
+
+	if (exponent == 0) {
+		if (mantissa == 0) {
+			bits = sign;
+		} else {
+			exponent = 113;
+			while (!(mantissa & 0x400)) {
+				mantissa <<= 1;
+				exponent -= 1;
+			}
+			bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+		}
+	} else if (exponent == 31) {
+		bits = sign | 0x7f800000 | (mantissa << 13);
+	} else {
+		bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+
+	float result;
+	memcpy(&result, &bits, 4);
+	return result;
+}
+
+inline unsigned short float_to_half(float f) {
+	unsigned bits;
+	memcpy(&bits, &f, 4);
+
+	unsigned sign = (bits >> 16) & 0x8000;
+	int exponent = ((bits >> 23) & 0xff) - 112;
+	unsigned mantissa = bits & 0x7fffff;
+
+	if (exponent >= 31) {
+		return (unsigned short)(sign | (((bits & 0x7fffffff) > 0x7f800000) ? 0x7e00 : 0x7c00));
+	}
+
+	if (exponent <= 0) {
+		if (exponent < -10) {
+			return (unsigned short)sign;
+		}
+		mantissa |= 0x800000;
+		unsigned shift = 14 - exponent;
+		unsigned half = (mantissa >> shift) + ((mantissa >> (shift - 1)) & 1);
+		return (unsigned short)(sign | half);
+	}
+
+	unsigned half = sign | (exponent << 10) | (mantissa >> 13);
+	return (unsigned short)(half + ((mantissa >> 12) & 1));
+}
@@ -0,0 +1,472 @@
+// The standard headers come first, InlineMethods.hpp defines min and max macros
+#include <thread>
+#include <vector>
+
+#include <math.h>
+#include <string.h>
+
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+
+// Host side mipmap generation.
+// Every level is filtered from the previous level kept in float precision,
+// with a separable filter (a horizontal then a vertical pass).
+// The inner loops are templated on the component count and work on
+// interleaved float rows, so the compiler can vectorize them for the target ISA.
+
+enum MGLMipmapFilter {
+	MIPMAP_FILTER_BOX,
+	MIPMAP_FILTER_KAISER,
+};
+
+struct MGLMipmapTaps {
+	int taps;
+	std::vector<int> index;
+	std::vector<float> weight;
+};
+
+inline float srgb_to_linear(float x) {
+	return x <= 0.04045f ? x / 12.92f : powf((x + 0.055f) / 1.055f, 2.4f);
+}
+
+inline float linear_to_srgb(float x) {
+	return x <= 0.0031308f ? x * 12.92f : 1.055f * powf(x, 1.0f / 2.4f) - 0.055f;
+}
+
+inline double bessel_i0(double x) {
+	double sum = 1.0;
+	double term = 1.0;
+	for (int k = 1; k < 32; ++k) {
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+	}
+	return sum;
+}
+
+inline double kaiser_sinc(double x) {
+	// Kaiser windowed sinc with a support of two destination texels and alpha = 4
+	const double alpha = 4.0;
+	const double pi = 3.14159265358979323846;
+
+	if (x <= -2.0 || x >= 2.0) {
+		return 0.0;
+	}
+
+	double sinc = x == 0.0 ? 1.0 : sin(pi * x) / (pi * x);
+	double t = x / 2.0;
+	return sinc * bessel_i0(alpha * sqrt(1.0 - t * t)) / bessel_i0(alpha);
+}
+
+static void build_taps(MGLMipmapTaps & taps, int src, int dst, int filter) {
+	double scale = (double)src / dst;
+
+	if (filter == MIPMAP_FILTER_BOX) {
+		taps.taps = (int)ceil(scale) + 1;
+	} else {
+		taps.taps = (int)ceil(scale * 4.0) + 1;
+	}
+
+	taps.index.assign(dst * taps.taps, 0);
+	taps.weight.assign(dst * taps.taps, 0.0f);
+
+	for (int x = 0; x < dst; ++x) {
+		int * index = taps.index.data() + x * taps.taps;
+		float * weight = taps.weight.data() + x * taps.taps;
+
+		double left = x * scale;
+		double right = (x + 1) * scale;
+		double center = (x + 0.5) * scale;
+
+		int first = (filter == MIPMAP_FILTER_BOX) ? (int)floor(left) : (int)floor(center - scale * 2.0);
+		double total = 0.0;
+
+		for (int k = 0; k < taps.taps; ++k) {
+			int i = first + k;
+			double w;
+
+			if (filter == MIPMAP_FILTER_BOX) {
+				double lo = i > left ? i : left;
+				double hi = i + 1 < right ? i + 1 : right;
+				w = hi > lo ? hi - lo : 0.0;
+			} else {
+				w = kaiser_sinc((i + 0.5 - center) / scale);
+			}
+
+			index[k] = i < 0 ? 0 : (i >= src ? src - 1 : i);
+			weight[k] = (float)w;
+			total += w;
+		}
+
+		for (int k = 0; k < taps.taps; ++k) {
+			weight[k] = (float)(weight[k] / total);
+		}
+	}
+}
+
+template <int C>
+void filter_horizontal(const float * src, float * dst, int src_width, int dst_width, int row_begin, int row_end, const MGLMipmapTaps & taps) {
+	for (int y = row_begin; y < row_end; ++y) {
+		const float * src_row = src + (Py_ssize_t)y * src_width * C;
+		float * dst_row = dst + (Py_ssize_t)y * dst_width * C;
+
+		for (int x = 0; x < dst_width; ++x) {
+			const int * index = taps.index.data() + x * taps.taps;
+			const float * weight = taps.weight.data() + x * taps.taps;
+			float acc[C] = {};
+
+			for (int k = 0; k < taps.taps; ++k) {
+				const float * texel = src_row + index[k] * C;
+				for (int c = 0; c < C; ++c) {
+					acc[c] += weight[k] * texel[c];
+				}
+			}
+
+			for (int c = 0; c < C; ++c) {
+				dst_row[x * C + c] = acc[c];
+			}
+		}
+	}
+}
+
+template <int C>
+void filter_vertical(const float * src, float * dst, int width, int row_begin, int row_end, const MGLMipmapTaps & taps) {
+	int row = width * C;
+
+	for (int y = row_begin; y < row_end; ++y) {
+		const int * index = taps.index.data() + y * taps.taps;
+		const float * weight = taps.weight.data() + y * taps.taps;
+		float * dst_row = dst + (Py_ssize_t)y * row;
+
+		for (int i = 0; i < row; ++i) {
+			dst_row[i] = 0.0f;
+		}
+
+		for (int k = 0; k < taps.taps; ++k) {
+			const float * src_row = src + (Py_ssize_t)index[k] * row;
+			float w = weight[k];
+			for (int i = 0; i < row; ++i) {
+				dst_row[i] += w * src_row[i];
+			}
+		}
+	}
+}
+
+template <typename F>
+void parallel_rows(int rows, Py_ssize_t work, F func) {
+	// Threads only pay off on large levels, the small ones run inline
+	int threads = (int)std::thread::hardware_concurrency();
+
+	if (threads > 16) {
+		threads = 16;
+	}
+
+	if (threads > rows) {
+		threads = rows;
+	}
+
+	if (threads <= 1 || work < 65536) {
+		func(0, rows);
+		return;
+	}
+
+	std::vector<std::thread> pool;
+	int step = (rows + threads - 1) / threads;
+
+	for (int begin = step; begin < rows; begin += step) {
+		int end = begin + step < rows ? begin + step : rows;
+		pool.push_back(std::thread(func, begin, end));
+	}
+
+	func(0, step < rows ? step : rows);
+
+	for (size_t i = 0; i < pool.size(); ++i) {
+		pool[i].join();
+	}
+}
+
+template <int C>
+void downsample(const float * src, float * tmp, float * dst, int src_width, int src_height, int dst_width, int dst_height, int filter) {
+	MGLMipmapTaps horizontal;
+	MGLMipmapTaps vertical;
+
+	build_taps(horizontal, src_width, dst_width, filter);
+	build_taps(vertical, src_height, dst_height, filter);
+
+	Py_ssize_t work = (Py_ssize_t)dst_width * src_height * C * horizontal.taps;
+
+	parallel_rows(src_height, work, [&](int begin, int end) {
+		filter_horizontal<C>(src, tmp, src_width, dst_width, begin, end, horizontal);
+	});
+
+	parallel_rows(dst_height, work, [&](int begin, int end) {
+		filter_vertical<C>(tmp, dst, dst_width, begin, end, vertical);
+	});
+}
+
+static void downsample(const float * src, float * tmp, float * dst, int src_width, int src_height, int dst_width, int dst_height, int components, int filter) {
+	switch (components) {
+		case 1: downsample<1>(src, tmp, dst, src_width, src_height, dst_width, dst_height, filter); break;
+		case 2: downsample<2>(src, tmp, dst, src_width, src_height, dst_width, dst_height, filter); break;
+		case 3: downsample<3>(src, tmp, dst, src_width, src_height, dst_width, dst_height, filter); break;
+		case 4: downsample<4>(src, tmp, dst, src_width, src_height, dst_width, dst_height, filter); break;
+	}
+}
+
+static void unpack_level(const char * src, float * dst, Py_ssize_t texels, int components, int gl_type, bool srgb) {
+	Py_ssize_t count = texels * components;
+
+	if (gl_type == GL_UNSIGNED_BYTE) {
+		const unsigned char * ptr = (const unsigned char *)src;
+		for (Py_ssize_t i = 0; i < count; ++i) {
+			dst[i] = ptr[i] / 255.0f;
+		}
+		if (srgb) {
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				if (components < 4 || i % 4 != 3) {
+					dst[i] = srgb_to_linear(dst[i]);
+				}
+			}
+		}
+	} else if (gl_type == GL_HALF_FLOAT) {
+		const unsigned short * ptr = (const unsigned short *)src;
+		for (Py_ssize_t i = 0; i < count; ++i) {
+			dst[i] = half_to_float(ptr[i]);
+		}
+	} else {
+		memcpy(dst, src, count * sizeof(float));
+	}
+}
+
+static void pack_level(const float * src, char * dst, Py_ssize_t texels, int components, int gl_type, bool srgb, float alpha_scale) {
+	Py_ssize_t count = texels * components;
+
+	for (Py_ssize_t i = 0; i < count; ++i) {
+		float value = src[i];
+		bool alpha = components == 4 && i % 4 == 3;
+
+		if (alpha) {
+			value *= alpha_scale;
+		}
+
+		if (gl_type == GL_UNSIGNED_BYTE) {
+			if (srgb && !alpha) {
+				value = linear_to_srgb(value < 0.0f ? 0.0f : value);
+			}
+			value = value * 255.0f + 0.5f;
+			((unsigned char *)dst)[i] = (unsigned char)(value < 0.0f ? 0.0f : (value > 255.0f ? 255.0f : value));
+		} else if (gl_type == GL_HALF_FLOAT) {
+			((unsigned short *)dst)[i] = float_to_half(value);
+		} else {
+			((float *)dst)[i] = value;
+		}
+	}
+}
+
+static double alpha_coverage(const float * texels, Py_ssize_t count, float alpha_ref, float scale) {
+	Py_ssize_t covered = 0;
+	for (Py_ssize_t i = 0; i < count; ++i) {
+		if (texels[i * 4 + 3] * scale > alpha_ref) {
+			covered += 1;
+		}
+	}
+	return count ? (double)covered / count : 0.0;
+}
+
+static float alpha_scale_for(const float * texels, Py_ssize_t count, float alpha_ref, double coverage) {
+	// Find the alpha scale that keeps the ratio of texels passing the alpha test
+	float low = 0.0f;
+	float high = 4.0f;
+
+	for (int i = 0; i < 16; ++i) {
+		float mid = (low + high) * 0.5f;
+		if (alpha_coverage(texels, count, alpha_ref, mid) < coverage) {
+			low = mid;
+		} else {
+			high = mid;
+		}
+	}
+
+	return high;
+}
+
+bool MGLMipmaps_Build(MGLContext * context, int target, int texture_obj, int width, int height, int layers, int components, MGLDataType * data_type, int base, int max, const char * method, const char * filter_name, bool srgb, float alpha_ref) {
+	int filter;
+
+	if (!strcmp(filter_name, "box")) {
+		filter = MIPMAP_FILTER_BOX;
+	} else if (!strcmp(filter_name, "kaiser")) {
+		filter = MIPMAP_FILTER_KAISER;
+	} else {
+		MGLError_Set("invalid filter: %s", filter_name);
+		return false;
+	}
+
+	const GLMethods & gl = context->gl;
+
+	gl.ActiveTexture(GL_TEXTURE0 + context->default_texture_unit);
+	gl.BindTexture(target, texture_obj);
+
+	gl.TexParameteri(target, GL_TEXTURE_BASE_LEVEL, base);
+	gl.TexParameteri(target, GL_TEXTURE_MAX_LEVEL, max);
+
+	if (!strcmp(method, "gpu")) {
+		if (filter != MIPMAP_FILTER_BOX || srgb || alpha_ref >= 0.0f) {
+			MGLError_Set("the gpu method only supports the box filter");
+			return false;
+		}
+		gl.GenerateMipmap(target);
+		return true;
+	}
+
+	if (strcmp(method, "cpu")) {
+		MGLError_Set("invalid method: %s", method);
+		return false;
+	}
+
+	// The levels must match the storage of the base level, loaded textures may be sRGB or compressed
+	int level_target = target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_CUBE_MAP_POSITIVE_X : target;
+	int compressed = 0;
+	int internal_format = 0;
+	gl.GetTexLevelParameteriv(level_target, base, GL_TEXTURE_COMPRESSED, &compressed);
+	gl.GetTexLevelParameteriv(level_target, base, GL_TEXTURE_INTERNAL_FORMAT, &internal_format);
+
+	if (compressed) {
+		MGLError_Set("the cpu method does not support compressed textures");
+		return false;
+	}
+
+	int gl_type = data_type->gl_type;
+
+	if (gl_type != GL_UNSIGNED_BYTE && gl_type != GL_HALF_FLOAT && gl_type != GL_FLOAT) {
+		MGLError_Set("the cpu method supports f1, u1, f2 and f4 textures only");
+		return false;
+	}
+
+	if (srgb && gl_type != GL_UNSIGNED_BYTE) {
+		MGLError_Set("srgb filtering requires f1 or u1 textures");
+		return false;
+	}
+
+	if (alpha_ref >= 0.0f && components != 4) {
+		MGLError_Set("alpha coverage requires four components");
+		return false;
+	}
+
+	int base_width = width >> base > 1 ? width >> base : 1;
+	int base_height = height >> base > 1 ? height >> base : 1;
+
+	int top = base;
+	while (top < max && ((base_width >> (top - base)) > 1 || (base_height >> (top - base)) > 1)) {
+		top += 1;
+	}
+
+	if (top == base) {
+		return true;
+	}
+
+	int pixel_size = components * data_type->size;
+	int base_format = data_type->base_format[components];
+	int faces = target == GL_TEXTURE_CUBE_MAP ? 6 : 1;
+	int slices = faces * layers;
+
+	// Every generated level of every layer and face is packed into a single allocation
+	Py_ssize_t base_bytes = (Py_ssize_t)base_width * base_height * pixel_size * slices;
+	Py_ssize_t chain_bytes = 0;
+	for (int level = base + 1; level <= top; ++level) {
+		int w = base_width >> (level - base) > 1 ? base_width >> (level - base) : 1;
+		int h = base_height >> (level - base) > 1 ? base_height >> (level - base) : 1;
+		chain_bytes += (Py_ssize_t)w * h * pixel_size * slices;
+	}
+
+	char * source = (char *)malloc(base_bytes);
+	char * chain = (char *)malloc(chain_bytes);
+
+	if (!source || !chain) {
+		free(source);
+		free(chain);
+		PyErr_NoMemory();
+		return false;
+	}
+
+	// The chain is ordered level by level, with the slices of a level next to each other
+	std::vector<Py_ssize_t> level_offset(top - base + 1, 0);
+	for (int level = base + 2; level <= top; ++level) {
+		int w = base_width >> (level - base - 1) > 1 ? base_width >> (level - base - 1) : 1;
+		int h = base_height >> (level - base - 1) > 1 ? base_height >> (level - base - 1) : 1;
+		level_offset[level - base] = level_offset[level - base - 1] + (Py_ssize_t)w * h * pixel_size * slices;
+	}
+
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	if (faces == 6) {
+		Py_ssize_t face_bytes = base_bytes / 6;
+		for (int face = 0; face < 6; ++face) {
+			gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, base, base_format, gl_type, source + face * face_bytes);
+		}
+	} else {
+		gl.GetTexImage(target, base, base_format, gl_type, source);
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+
+	Py_ssize_t base_texels = (Py_ssize_t)base_width * base_height;
+	std::vector<float> current(base_texels * components);
+	std::vector<float> next(base_texels * components);
+	std::vector<float> tmp(base_texels * components);
+
+	for (int slice = 0; slice < slices; ++slice) {
+		int src_width = base_width;
+		int src_height = base_height;
+
+		unpack_level(source + slice * base_texels * pixel_size, current.data(), base_texels, components, gl_type, srgb);
+
+		double coverage = alpha_ref >= 0.0f ? alpha_coverage(current.data(), base_texels, alpha_ref, 1.0f) : 0.0;
+
+		for (int level = base + 1; level <= top; ++level) {
+			int dst_width = src_width > 1 ? src_width / 2 : 1;
+			int dst_height = src_height > 1 ? src_height / 2 : 1;
+			Py_ssize_t texels = (Py_ssize_t)dst_width * dst_height;
+
+			downsample(current.data(), tmp.data(), next.data(), src_width, src_height, dst_width, dst_height, components, filter);
+
+			float alpha_scale = 1.0f;
+			if (alpha_ref >= 0.0f) {
+				alpha_scale = alpha_scale_for(next.data(), texels, alpha_ref, coverage);
+			}
+
+			char * dst = chain + level_offset[level - base] + slice * texels * pixel_size;
+			pack_level(next.data(), dst, texels, components, gl_type, srgb, alpha_scale);
+
+			current.swap(next);
+			src_width = dst_width;
+			src_height = dst_height;
+		}
+	}
+
+	Py_END_ALLOW_THREADS
+
+	for (int level = base + 1; level <= top; ++level) {
+		int w = base_width >> (level - base) > 1 ? base_width >> (level - base) : 1;
+		int h = base_height >> (level - base) > 1 ? base_height >> (level - base) : 1;
+		char * ptr = chain + level_offset[level - base];
+
+		if (target == GL_TEXTURE_2D_ARRAY) {
+			gl.TexImage3D(target, level, internal_format, w, h, layers, 0, base_format, gl_type, ptr);
+		} else if (faces == 6) {
+			for (int face = 0; face < 6; ++face) {
+				char * face_ptr = ptr + (Py_ssize_t)face * w * h * pixel_size;
+				gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, internal_format, w, h, 0, base_format, gl_type, face_ptr);
+			}
+		} else {
+			gl.TexImage2D(target, level, internal_format, w, h, 0, base_format, gl_type, ptr);
+		}
+	}
+
+	MGL_STAT(context, MGL_STAT_TEXTURE_BYTES_WRITTEN, chain_bytes);
+
+	free(source);
+	free(chain);
+	return true;
+}
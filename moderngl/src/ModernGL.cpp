@@ -273,6 +273,16 @@ PyObject * create_context(PyObject * self, PyObject * args, PyObject * kwargs) {
 	ctx->multisample = true;
 
 	ctx->provoking_vertex = GL_LAST_VERTEX_CONVENTION;
+
+	ctx->texture_memory = 0;
+	ctx->renderbuffer_memory = 0;
+	ctx->buffer_memory = 0;
+	ctx->frame = 0;
+	ctx->debug_log = 0;
+	ctx->debug_log_limit = 1024;
+
+	MGLContext_ResetFramebufferState(ctx);
+
 	gl.GetError(); // clear errors
 
 	if (PyErr_Occurred()) {
@@ -291,6 +301,7 @@ PyMethodDef MGL_module_methods[] = {
 	{"strsize", (PyCFunction)strsize, METH_VARARGS, 0},
 	{"create_context", (PyCFunction)create_context, METH_VARARGS | METH_KEYWORDS, 0},
 	{"fmtdebug", (PyCFunction)fmtdebug, METH_VARARGS, 0},
+	{"convert_frame", (PyCFunction)MGL_convert_frame, METH_VARARGS, 0},
 	{0},
 };
 
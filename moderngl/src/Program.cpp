@@ -32,6 +32,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	}
 
 	MGLProgram * program = (MGLProgram *)MGLProgram_Type.tp_alloc(&MGLProgram_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	Py_INCREF(self);
 	program->context = self;
@@ -680,6 +681,8 @@ void MGLProgram_Invalidate(MGLProgram * program) {
 		return;
 	}
 
+	MGL_STAT(program->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = program->context->gl;
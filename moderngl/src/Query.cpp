@@ -2,27 +2,69 @@
 
 #include "InlineMethods.hpp"
 
+// The query targets by MGLQueryKeys
+static const GLenum query_targets[MGL_QUERY_KEYS] = {
+	GL_SAMPLES_PASSED,
+	GL_ANY_SAMPLES_PASSED,
+	GL_TIME_ELAPSED,
+	GL_PRIMITIVES_GENERATED,
+	GL_VERTICES_SUBMITTED,
+	GL_PRIMITIVES_SUBMITTED,
+	GL_VERTEX_SHADER_INVOCATIONS,
+	GL_TESS_CONTROL_SHADER_PATCHES,
+	GL_TESS_EVALUATION_SHADER_INVOCATIONS,
+	GL_GEOMETRY_SHADER_INVOCATIONS,
+	GL_GEOMETRY_SHADER_PRIMITIVES_EMITTED,
+	GL_FRAGMENT_SHADER_INVOCATIONS,
+	GL_COMPUTE_SHADER_INVOCATIONS,
+	GL_CLIPPING_INPUT_PRIMITIVES,
+	GL_CLIPPING_OUTPUT_PRIMITIVES,
+};
+
+inline bool has_extension(const GLMethods & gl, const char * name) {
+	int num_extensions = 0;
+	gl.GetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
+
+	for (int i = 0; i < num_extensions; ++i) {
+		const char * extension = (const char *)gl.GetStringi(GL_EXTENSIONS, i);
+		if (extension && !strcmp(extension, name)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 PyObject * MGLContext_query(MGLContext * self, PyObject * args) {
 	int samples_passed;
 	int any_samples_passed;
 	int time_elapsed;
 	int primitives_generated;
+	int statistics;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"pppp",
+		"ppppp",
 		&samples_passed,
 		&any_samples_passed,
 		&time_elapsed,
-		&primitives_generated
+		&primitives_generated,
+		&statistics
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
-	// If none of them is set, all will be set.
-	if (!(samples_passed + any_samples_passed + time_elapsed + primitives_generated)) {
+	const GLMethods & gl = self->gl;
+
+	if (statistics && self->version_code < 460 && !has_extension(gl, "GL_ARB_pipeline_statistics_query")) {
+		MGLError_Set("pipeline statistics require OpenGL 4.6 or GL_ARB_pipeline_statistics_query");
+		return 0;
+	}
+
+	// If none of them is set, all will be set. The statistics are only created on request.
+	if (!(samples_passed + any_samples_passed + time_elapsed + primitives_generated + statistics)) {
 		samples_passed = 1;
 		any_samples_passed = 1;
 		time_elapsed = 1;
@@ -30,12 +72,11 @@ PyObject * MGLContext_query(MGLContext * self, PyObject * args) {
 	}
 
 	MGLQuery * query = (MGLQuery *)MGLQuery_Type.tp_alloc(&MGLQuery_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	Py_INCREF(self);
 	query->context = self;
 
-	const GLMethods & gl = self->gl;
-
 	if (samples_passed) {
 		gl.GenQueries(1, (GLuint *)&query->query_obj[SAMPLES_PASSED]);
 	}
@@ -48,60 +89,152 @@ PyObject * MGLContext_query(MGLContext * self, PyObject * args) {
 	if (primitives_generated) {
 		gl.GenQueries(1, (GLuint *)&query->query_obj[PRIMITIVES_GENERATED]);
 	}
+	if (statistics) {
+		gl.GenQueries(MGL_QUERY_KEYS - VERTICES_SUBMITTED, (GLuint *)&query->query_obj[VERTICES_SUBMITTED]);
+	}
 
 	// PyObject * result = PyTuple_New(2);
 	// PyTuple_SET_ITEM(result, 0, (PyObject *)query);
 	// PyTuple_SET_ITEM(result, 1, PyLong_FromLong(query->query_obj));
 	// return result;
 
+	// The extra reference is dropped by release
+	Py_INCREF(query);
 	return (PyObject *)query;
 }
 
-PyObject * MGLQuery_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
-	MGLQuery * self = (MGLQuery *)type->tp_alloc(type, 0);
+// Timestamp queries are passed to Python as tuples of query names, the profiler pools them
+PyObject * MGLContext_timestamp_queries(MGLContext * self, PyObject * args) {
+	int count;
 
-	if (self) {
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"I",
+		&count
+	);
+
+	if (!args_ok) {
+		return 0;
 	}
 
-	return (PyObject *)self;
+	GLuint * names = new GLuint[count];
+	self->gl.GenQueries(count, names);
+
+	PyObject * result = PyTuple_New(count);
+
+	for (int i = 0; i < count; ++i) {
+		PyTuple_SET_ITEM(result, i, PyLong_FromUnsignedLong(names[i]));
+	}
+
+	delete[] names;
+	return result;
 }
 
-void MGLQuery_tp_dealloc(MGLQuery * self) {
-	MGLQuery_Type.tp_free((PyObject *)self);
+PyObject * MGLContext_timestamp(MGLContext * self, PyObject * args) {
+	unsigned query_obj;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"I",
+		&query_obj
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	self->gl.QueryCounter(query_obj, GL_TIMESTAMP);
+	Py_RETURN_NONE;
 }
 
-PyObject * MGLQuery_begin(MGLQuery * self, PyObject * args) {
+PyObject * MGLContext_timestamp_results(MGLContext * self, PyObject * args) {
+	PyObject * queries;
+	int wait;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		""
+		"O!p",
+		&PyTuple_Type,
+		&queries,
+		&wait
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
+	const GLMethods & gl = self->gl;
+	int count = (int)PyTuple_GET_SIZE(queries);
+
+	if (!wait) {
+		for (int i = 0; i < count; ++i) {
+			GLuint available = GL_FALSE;
+			gl.GetQueryObjectuiv(PyLong_AsUnsignedLong(PyTuple_GET_ITEM(queries, i)), GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available) {
+				Py_RETURN_NONE;
+			}
+		}
+	}
+
+	PyObject * result = PyTuple_New(count);
 
-	if (self->query_obj[SAMPLES_PASSED]) {
-		gl.BeginQuery(GL_SAMPLES_PASSED, self->query_obj[SAMPLES_PASSED]);
+	for (int i = 0; i < count; ++i) {
+		GLuint64 value = 0;
+		gl.GetQueryObjectui64v(PyLong_AsUnsignedLong(PyTuple_GET_ITEM(queries, i)), GL_QUERY_RESULT, &value);
+		PyTuple_SET_ITEM(result, i, PyLong_FromUnsignedLongLong(value));
 	}
 
-	if (self->query_obj[ANY_SAMPLES_PASSED]) {
-		gl.BeginQuery(GL_ANY_SAMPLES_PASSED, self->query_obj[ANY_SAMPLES_PASSED]);
+	if (PyErr_Occurred()) {
+		Py_DECREF(result);
+		return 0;
 	}
 
-	if (self->query_obj[TIME_ELAPSED]) {
-		gl.BeginQuery(GL_TIME_ELAPSED, self->query_obj[TIME_ELAPSED]);
+	return result;
+}
+
+// The current GPU time, used to place the timestamps on the CPU timeline
+PyObject * MGLContext_gpu_time(MGLContext * self) {
+	GLint64 timestamp = 0;
+	self->gl.GetInteger64v(GL_TIMESTAMP, &timestamp);
+	return PyLong_FromLongLong(timestamp);
+}
+
+PyObject * MGLContext_release_queries(MGLContext * self, PyObject * args) {
+	PyObject * queries;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!",
+		&PyTuple_Type,
+		&queries
+	);
+
+	if (!args_ok) {
+		return 0;
 	}
 
-	if (self->query_obj[PRIMITIVES_GENERATED]) {
-		gl.BeginQuery(GL_PRIMITIVES_GENERATED, self->query_obj[PRIMITIVES_GENERATED]);
+	for (int i = 0; i < PyTuple_GET_SIZE(queries); ++i) {
+		GLuint query_obj = PyLong_AsUnsignedLong(PyTuple_GET_ITEM(queries, i));
+		self->gl.DeleteQueries(1, &query_obj);
 	}
 
 	Py_RETURN_NONE;
 }
 
-PyObject * MGLQuery_end(MGLQuery * self, PyObject * args) {
+PyObject * MGLQuery_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLQuery * self = (MGLQuery *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLQuery_tp_dealloc(MGLQuery * self) {
+	MGLQuery_Type.tp_free((PyObject *)self);
+}
+
+PyObject * MGLQuery_begin(MGLQuery * self, PyObject * args) {
 	int args_ok = PyArg_ParseTuple(
 		args,
 		""
@@ -113,20 +246,31 @@ PyObject * MGLQuery_end(MGLQuery * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
-	if (self->query_obj[SAMPLES_PASSED]) {
-		gl.EndQuery(GL_SAMPLES_PASSED);
+	for (int i = 0; i < MGL_QUERY_KEYS; ++i) {
+		if (self->query_obj[i]) {
+			gl.BeginQuery(query_targets[i], self->query_obj[i]);
+		}
 	}
 
-	if (self->query_obj[ANY_SAMPLES_PASSED]) {
-		gl.EndQuery(GL_ANY_SAMPLES_PASSED);
-	}
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLQuery_end(MGLQuery * self, PyObject * args) {
+	int args_ok = PyArg_ParseTuple(
+		args,
+		""
+	);
 
-	if (self->query_obj[TIME_ELAPSED]) {
-		gl.EndQuery(GL_TIME_ELAPSED);
+	if (!args_ok) {
+		return 0;
 	}
 
-	if (self->query_obj[PRIMITIVES_GENERATED]) {
-		gl.EndQuery(GL_PRIMITIVES_GENERATED);
+	const GLMethods & gl = self->context->gl;
+
+	for (int i = 0; i < MGL_QUERY_KEYS; ++i) {
+		if (self->query_obj[i]) {
+			gl.EndQuery(query_targets[i]);
+		}
 	}
 
 	Py_RETURN_NONE;
@@ -171,46 +315,97 @@ PyObject * MGLQuery_end_render(MGLQuery * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+// The results are read as 64 bit integers, 32 bit nanoseconds overflow after about 2.1 seconds
+inline unsigned long long query_result(const GLMethods & gl, int query_obj) {
+	GLuint64 result = 0;
+	gl.GetQueryObjectui64v(query_obj, GL_QUERY_RESULT, &result);
+	return result;
+}
+
+inline bool query_available(const GLMethods & gl, const MGLQuery * query) {
+	for (int i = 0; i < MGL_QUERY_KEYS; ++i) {
+		if (query->query_obj[i]) {
+			GLuint available = GL_FALSE;
+			gl.GetQueryObjectuiv(query->query_obj[i], GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+PyObject * MGLQuery_try_result(MGLQuery * self, PyObject * args) {
+	int wait;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&wait
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	if (!wait && !query_available(gl, self)) {
+		Py_RETURN_NONE;
+	}
+
+	PyObject * result = PyTuple_New(MGL_QUERY_KEYS);
+
+	for (int i = 0; i < MGL_QUERY_KEYS; ++i) {
+		if (!self->query_obj[i]) {
+			Py_INCREF(Py_None);
+			PyTuple_SET_ITEM(result, i, Py_None);
+		} else if (i == ANY_SAMPLES_PASSED) {
+			PyTuple_SET_ITEM(result, i, PyBool_FromLong(query_result(gl, self->query_obj[i]) != 0));
+		} else {
+			PyTuple_SET_ITEM(result, i, PyLong_FromUnsignedLongLong(query_result(gl, self->query_obj[i])));
+		}
+	}
+
+	return result;
+}
+
+PyObject * MGLQuery_release(MGLQuery * self) {
+	MGLQuery_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
 PyMethodDef MGLQuery_tp_methods[] = {
 	{"begin", (PyCFunction)MGLQuery_begin, METH_VARARGS, 0},
 	{"end", (PyCFunction)MGLQuery_end, METH_VARARGS, 0},
 	{"begin_render", (PyCFunction)MGLQuery_begin_render, METH_VARARGS, 0},
 	{"end_render", (PyCFunction)MGLQuery_end_render, METH_VARARGS, 0},
-	// {"release", (PyCFunction)MGLQuery_release, METH_NOARGS, 0},
+	{"try_result", (PyCFunction)MGLQuery_try_result, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLQuery_release, METH_NOARGS, 0},
 	{0},
 };
 
 PyObject * MGLQuery_get_samples(MGLQuery * self) {
-	const GLMethods & gl = self->context->gl;
-
-	int samples = 0;
-	gl.GetQueryObjectiv(self->query_obj[SAMPLES_PASSED], GL_QUERY_RESULT, &samples);
-
-	return PyLong_FromLong(samples);
+	return PyLong_FromUnsignedLongLong(query_result(self->context->gl, self->query_obj[SAMPLES_PASSED]));
 }
 
 PyObject * MGLQuery_get_primitives(MGLQuery * self) {
-	const GLMethods & gl = self->context->gl;
-
-	int primitives = 0;
-	gl.GetQueryObjectiv(self->query_obj[PRIMITIVES_GENERATED], GL_QUERY_RESULT, &primitives);
-
-	return PyLong_FromLong(primitives);
+	return PyLong_FromUnsignedLongLong(query_result(self->context->gl, self->query_obj[PRIMITIVES_GENERATED]));
 }
 
 PyObject * MGLQuery_get_elapsed(MGLQuery * self) {
-	const GLMethods & gl = self->context->gl;
-
-	int elapsed = 0;
-	gl.GetQueryObjectiv(self->query_obj[TIME_ELAPSED], GL_QUERY_RESULT, &elapsed);
+	return PyLong_FromUnsignedLongLong(query_result(self->context->gl, self->query_obj[TIME_ELAPSED]));
+}
 
-	return PyLong_FromLong(elapsed);
+PyObject * MGLQuery_get_available(MGLQuery * self) {
+	return PyBool_FromLong(query_available(self->context->gl, self));
 }
 
 PyGetSetDef MGLQuery_tp_getseters[] = {
 	{(char *)"samples", (getter)MGLQuery_get_samples, 0, 0, 0},
 	{(char *)"primitives", (getter)MGLQuery_get_primitives, 0, 0, 0},
 	{(char *)"elapsed", (getter)MGLQuery_get_elapsed, 0, 0, 0},
+	{(char *)"available", (getter)MGLQuery_get_available, 0, 0, 0},
 	{0},
 };
 
@@ -260,11 +455,17 @@ void MGLQuery_Invalidate(MGLQuery * query) {
 		return;
 	}
 
+	MGL_STAT(query->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
-	// const GLMethods & gl = query->context->gl;
+	const GLMethods & gl = query->context->gl;
 
-	// TODO: release
+	for (int i = 0; i < MGL_QUERY_KEYS; ++i) {
+		if (query->query_obj[i]) {
+			gl.DeleteQueries(1, (GLuint *)&query->query_obj[i]);
+		}
+	}
 
 	Py_DECREF(query->context);
 	Py_TYPE(query) = &MGLInvalidObject_Type;
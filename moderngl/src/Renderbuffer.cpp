@@ -53,6 +53,7 @@ PyObject * MGLContext_renderbuffer(MGLContext * self, PyObject * args) {
 	const GLMethods & gl = self->gl;
 
 	MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)MGLRenderbuffer_Type.tp_alloc(&MGLRenderbuffer_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	renderbuffer->renderbuffer_obj = 0;
 	gl.GenRenderbuffers(1, (GLuint *)&renderbuffer->renderbuffer_obj);
@@ -78,6 +79,9 @@ PyObject * MGLContext_renderbuffer(MGLContext * self, PyObject * args) {
 	renderbuffer->data_type = data_type;
 	renderbuffer->depth = false;
 
+	renderbuffer->memory = (Py_ssize_t)width * height * components * data_type->size * (samples ? samples : 1);
+	self->renderbuffer_memory += renderbuffer->memory;
+
 	Py_INCREF(self);
 	renderbuffer->context = self;
 
@@ -115,6 +119,7 @@ PyObject * MGLContext_depth_renderbuffer(MGLContext * self, PyObject * args) {
 	const GLMethods & gl = self->gl;
 
 	MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)MGLRenderbuffer_Type.tp_alloc(&MGLRenderbuffer_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	renderbuffer->renderbuffer_obj = 0;
 	gl.GenRenderbuffers(1, (GLuint *)&renderbuffer->renderbuffer_obj);
@@ -140,6 +145,9 @@ PyObject * MGLContext_depth_renderbuffer(MGLContext * self, PyObject * args) {
 	renderbuffer->data_type = from_dtype("f4");
 	renderbuffer->depth = true;
 
+	renderbuffer->memory = (Py_ssize_t)width * height * 4 * (samples ? samples : 1);
+	self->renderbuffer_memory += renderbuffer->memory;
+
 	Py_INCREF(self);
 	renderbuffer->context = self;
 
@@ -220,11 +228,15 @@ void MGLRenderbuffer_Invalidate(MGLRenderbuffer * renderbuffer) {
 		return;
 	}
 
+	MGL_STAT(renderbuffer->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = renderbuffer->context->gl;
 	gl.DeleteRenderbuffers(1, (GLuint *)&renderbuffer->renderbuffer_obj);
 
+	renderbuffer->context->renderbuffer_memory -= renderbuffer->memory;
+
 	Py_TYPE(renderbuffer) = &MGLInvalidObject_Type;
 	Py_DECREF(renderbuffer);
 }
@@ -14,6 +14,7 @@ PyObject * MGLContext_sampler(MGLContext * self, PyObject * args) {
 	const GLMethods & gl = self->gl;
 
 	MGLSampler * sampler = (MGLSampler *)MGLSampler_Type.tp_alloc(&MGLSampler_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	gl.GenSamplers(1, (GLuint *)&sampler->sampler_obj);
 
@@ -347,6 +348,8 @@ void MGLSampler_Invalidate(MGLSampler * sampler) {
 		return;
 	}
 
+	MGL_STAT(sampler->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = sampler->context->gl;
@@ -59,6 +59,9 @@ PyObject * MGLContext_scope(MGLContext * self, PyObject * args) {
 
 	scope->samplers = PySequence_Fast(samplers, "not iterable");
 
+	Py_INCREF(textures);
+	scope->texture_objects = textures;
+
 	for (int i = 0; i < num_textures; ++i) {
 		PyObject * tup = PyTuple_GET_ITEM(textures, i);
 		PyObject * item = PyTuple_GET_ITEM(tup, 0);
@@ -130,12 +133,16 @@ PyObject * MGLScope_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwar
 	if (self) {
 		self->textures = 0;
 		self->buffers = 0;
+		self->texture_objects = 0;
+		self->samplers = 0;
 	}
 
 	return (PyObject *)self;
 }
 
 void MGLScope_tp_dealloc(MGLScope * self) {
+	Py_XDECREF(self->texture_objects);
+	Py_XDECREF(self->samplers);
 	MGLScope_Type.tp_free((PyObject *)self);
 }
 
@@ -160,8 +167,15 @@ PyObject * MGLScope_begin(MGLScope * self, PyObject * args) {
 	MGLFramebuffer_use(self->framebuffer);
 
 	for (int i = 0; i < self->num_textures; ++i) {
+		PyObject * item = PyTuple_GET_ITEM(PyTuple_GET_ITEM(self->texture_objects, i), 0);
+		if (Py_TYPE(item) == &MGLTexture_Type) {
+			MGLTexture * texture = (MGLTexture *)item;
+			MGLTexture_Restore(texture);
+			texture->last_use = self->context->frame;
+		}
 		gl.ActiveTexture(self->textures[i * 3]);
 		gl.BindTexture(self->textures[i * 3 + 1], self->textures[i * 3 + 2]);
+		MGL_STAT(self->context, MGL_STAT_TEXTURE_BINDS, 1);
 	}
 
 	for (int i = 0; i < self->num_buffers; ++i) {
@@ -321,11 +335,11 @@ void MGLScope_Invalidate(MGLScope * scope) {
 		return;
 	}
 
-	// TODO: decref
-
-	// const GLMethods & gl = scope->context->gl;
-
-	// TODO: release
+	// The textures are kept alive by the scope, their names are only released with it
+	Py_XDECREF(scope->texture_objects);
+	Py_XDECREF(scope->samplers);
+	scope->texture_objects = 0;
+	scope->samplers = 0;
 
 	Py_DECREF(scope->context);
 	Py_TYPE(scope) = &MGLInvalidObject_Type;
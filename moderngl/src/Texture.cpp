@@ -100,6 +100,7 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
 
 	MGLTexture * texture = (MGLTexture *)MGLTexture_Type.tp_alloc(&MGLTexture_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	texture->texture_obj = 0;
 	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
@@ -131,6 +132,8 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	texture->components = components;
 	texture->samples = samples;
 	texture->data_type = data_type;
+	texture->internal_format = internal_format;
+	texture->compressed = false;
 
 	texture->max_level = 0;
 	texture->compare_func = 0;
@@ -143,6 +146,13 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	texture->repeat_x = true;
 	texture->repeat_y = true;
 
+	texture->memory = texture_memory(width, height, 1, 0, components * data_type->size * max(samples, 1), false);
+	self->texture_memory += texture->memory;
+
+	texture->last_use = self->frame;
+	texture->backing = 0;
+	texture->framebuffers = 0;
+
 	Py_INCREF(self);
 	texture->context = self;
 
@@ -220,6 +230,7 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
 
 	MGLTexture * texture = (MGLTexture *)MGLTexture_Type.tp_alloc(&MGLTexture_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	texture->texture_obj = 0;
 	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
@@ -255,6 +266,8 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 	texture->components = 1;
 	texture->samples = samples;
 	texture->data_type = from_dtype("f4");
+	texture->internal_format = GL_DEPTH_COMPONENT24;
+	texture->compressed = false;
 
 	texture->compare_func = GL_LEQUAL;
 	texture->depth = true;
@@ -266,6 +279,13 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 	texture->repeat_x = false;
 	texture->repeat_y = false;
 
+	texture->memory = texture_memory(width, height, 1, 0, 4 * max(samples, 1), false);
+	self->texture_memory += texture->memory;
+
+	texture->last_use = self->frame;
+	texture->backing = 0;
+	texture->framebuffers = 0;
+
 	Py_INCREF(self);
 	texture->context = self;
 
@@ -305,6 +325,8 @@ PyObject * MGLTexture_read(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLTexture_Restore(self);
+
 	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
 		MGLError_Set("the alignment must be 1, 2, 4 or 8");
 		return 0;
@@ -366,6 +388,7 @@ PyObject * MGLTexture_read(MGLTexture * self, PyObject * args) {
 
 	gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, data);
 
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 	return result;
 }
 
@@ -388,6 +411,8 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLTexture_Restore(self);
+
 	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
 		MGLError_Set("the alignment must be 1, 2, 4 or 8");
 		return 0;
@@ -456,6 +481,7 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 		gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, ptr);
 
+		MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 		PyBuffer_Release(&buffer_view);
 
 	}
@@ -482,6 +508,8 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLTexture_Restore(self);
+
 	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
 		MGLError_Set("the alignment must be 1, 2, 4 or 8");
 		return 0;
@@ -589,6 +617,7 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 
 	}
 
+	MGL_STAT(self->context, MGL_STAT_TEXTURE_BYTES_WRITTEN, expected_size);
 	Py_RETURN_NONE;
 }
 
@@ -613,6 +642,8 @@ PyObject * MGLTexture_meth_bind(MGLTexture * self, PyObject * args) {
 		return NULL;
 	}
 
+	MGLTexture_Restore(self);
+
 	int access = GL_READ_WRITE;
 	if (read && !write) access = GL_READ_ONLY;
 	else if (!read && write) access = GL_WRITE_ONLY;
@@ -641,11 +672,15 @@ PyObject * MGLTexture_use(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLTexture_Restore(self);
+	self->last_use = self->context->frame;
+
 	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
 
 	const GLMethods & gl = self->context->gl;
 	gl.ActiveTexture(GL_TEXTURE0 + index);
 	gl.BindTexture(texture_target, self->texture_obj);
+	MGL_STAT(self->context, MGL_STAT_TEXTURE_BINDS, 1);
 
 	Py_RETURN_NONE;
 }
@@ -654,33 +689,45 @@ PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 	int base = 0;
 	int max = 1000;
 
+	const char * method;
+	const char * filter;
+	int srgb;
+	float alpha_ref;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"II",
+		"IIsspf",
 		&base,
-		&max
+		&max,
+		&method,
+		&filter,
+		&srgb,
+		&alpha_ref
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	MGLTexture_Restore(self);
+
 	if (base > self->max_level) {
 		MGLError_Set("invalid base");
 		return 0;
 	}
 
+	if (self->depth && !strcmp(method, "cpu")) {
+		MGLError_Set("the cpu method does not support depth textures");
+		return 0;
+	}
+
 	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
-	gl.BindTexture(texture_target, self->texture_obj);
-
-	gl.TexParameteri(texture_target, GL_TEXTURE_BASE_LEVEL, base);
-	gl.TexParameteri(texture_target, GL_TEXTURE_MAX_LEVEL, max);
-
-	gl.GenerateMipmap(texture_target);
+	if (!MGLMipmaps_Build(self->context, texture_target, self->texture_obj, self->width, self->height, 1, self->components, self->data_type, base, max, method, filter, srgb, alpha_ref)) {
+		return 0;
+	}
 
 	gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
 	gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -689,6 +736,116 @@ PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 	self->mag_filter = GL_LINEAR;
 	self->max_level = max;
 
+	self->context->texture_memory -= self->memory;
+
+	if (self->compressed) {
+		// The block sizes differ between the formats, the driver reports the size of every generated level
+		self->memory = 0;
+		int width = self->width;
+		int height = self->height;
+
+		for (int level = 0; level <= max; ++level) {
+			int level_size = 0;
+			gl.GetTexLevelParameteriv(texture_target, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &level_size);
+			self->memory += level_size;
+			if (width == 1 && height == 1) {
+				break;
+			}
+			width = width / 2 > 1 ? width / 2 : 1;
+			height = height / 2 > 1 ? height / 2 : 1;
+		}
+	} else {
+		int pixel_size = self->depth ? 4 : self->components * self->data_type->size;
+		self->memory = texture_memory(self->width, self->height, 1, max, pixel_size, false);
+	}
+
+	self->context->texture_memory += self->memory;
+
+	Py_RETURN_NONE;
+}
+
+// The size of the levels from 0 to max_level stored one after the other
+static Py_ssize_t backing_levels_size(int width, int height, int max_level, Py_ssize_t pixel_size) {
+	Py_ssize_t size = 0;
+
+	for (int level = 0; level <= max_level; ++level) {
+		size += width * height * pixel_size;
+		if (width == 1 && height == 1) {
+			break;
+		}
+		width = max(width / 2, 1);
+		height = max(height / 2, 1);
+	}
+
+	return size;
+}
+
+PyObject * MGLTexture_evict(MGLTexture * self) {
+	if (self->backing) {
+		Py_RETURN_NONE;
+	}
+
+	if (self->samples) {
+		MGLError_Set("multisample textures cannot be evicted");
+		return 0;
+	}
+
+	// Reading back and uploading again would decompress them, the point of evicting is lost
+	if (self->compressed) {
+		MGLError_Set("compressed textures cannot be evicted");
+		return 0;
+	}
+
+	int pixel_type = self->depth ? GL_FLOAT : self->data_type->gl_type;
+	int base_format = self->depth ? GL_DEPTH_COMPONENT : self->data_type->base_format[self->components];
+	int internal_format = self->internal_format;
+
+	// Every level is kept, the mipmaps may have been written or built on the cpu and cannot be generated again
+	Py_ssize_t pixel_size = (Py_ssize_t)self->components * self->data_type->size;
+	Py_ssize_t backing_size = backing_levels_size(self->width, self->height, self->max_level, pixel_size);
+
+	self->backing = (char *)malloc(backing_size);
+
+	if (!self->backing) {
+		MGLError_Set("cannot allocate the backing store");
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+
+	int width = self->width;
+	int height = self->height;
+	char * ptr = self->backing;
+
+	for (int level = 0; level <= self->max_level; ++level) {
+		gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, ptr);
+		ptr += width * height * pixel_size;
+		if (width == 1 && height == 1) {
+			break;
+		}
+		width = max(width / 2, 1);
+		height = max(height / 2, 1);
+	}
+
+	// Keep the texture name so framebuffers and scopes referencing it stay valid, only drop the storage
+	width = self->width;
+	height = self->height;
+
+	for (int level = 0; level <= self->max_level; ++level) {
+		gl.TexImage2D(GL_TEXTURE_2D, level, internal_format, 0, 0, 0, base_format, pixel_type, 0);
+		if (width == 1 && height == 1) {
+			break;
+		}
+		width = max(width / 2, 1);
+		height = max(height / 2, 1);
+	}
+
+	self->context->texture_memory -= self->memory;
+
 	Py_RETURN_NONE;
 }
 
@@ -702,6 +859,7 @@ PyMethodDef MGLTexture_tp_methods[] = {
 	{"bind", (PyCFunction)MGLTexture_meth_bind, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTexture_use, METH_VARARGS, 0},
 	{"build_mipmaps", (PyCFunction)MGLTexture_build_mipmaps, METH_VARARGS, 0},
+	{"evict", (PyCFunction)MGLTexture_evict, METH_NOARGS, 0},
 	{"read", (PyCFunction)MGLTexture_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTexture_read_into, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTexture_release, METH_NOARGS, 0},
@@ -927,6 +1085,26 @@ int MGLTexture_set_anisotropy(MGLTexture * self, PyObject * value) {
 	return 0;
 }
 
+PyObject * MGLTexture_get_resident(MGLTexture * self) {
+	return PyBool_FromLong(!self->backing);
+}
+
+PyObject * MGLTexture_get_attached(MGLTexture * self) {
+	return PyBool_FromLong(self->framebuffers);
+}
+
+PyObject * MGLTexture_get_last_use(MGLTexture * self) {
+	return PyLong_FromLong(self->last_use);
+}
+
+PyObject * MGLTexture_get_memory(MGLTexture * self) {
+	return PyLong_FromSsize_t(self->memory);
+}
+
+PyObject * MGLTexture_get_compressed(MGLTexture * self) {
+	return PyBool_FromLong(self->compressed);
+}
+
 PyGetSetDef MGLTexture_tp_getseters[] = {
 	{(char *)"repeat_x", (getter)MGLTexture_get_repeat_x, (setter)MGLTexture_set_repeat_x, 0, 0},
 	{(char *)"repeat_y", (getter)MGLTexture_get_repeat_y, (setter)MGLTexture_set_repeat_y, 0, 0},
@@ -934,6 +1112,11 @@ PyGetSetDef MGLTexture_tp_getseters[] = {
 	{(char *)"swizzle", (getter)MGLTexture_get_swizzle, (setter)MGLTexture_set_swizzle, 0, 0},
 	{(char *)"compare_func", (getter)MGLTexture_get_compare_func, (setter)MGLTexture_set_compare_func, 0, 0},
 	{(char *)"anisotropy", (getter)MGLTexture_get_anisotropy, (setter)MGLTexture_set_anisotropy, 0, 0},
+	{(char *)"resident", (getter)MGLTexture_get_resident, 0, 0, 0},
+	{(char *)"last_use", (getter)MGLTexture_get_last_use, 0, 0, 0},
+	{(char *)"attached", (getter)MGLTexture_get_attached, 0, 0, 0},
+	{(char *)"memory", (getter)MGLTexture_get_memory, 0, 0, 0},
+	{(char *)"compressed", (getter)MGLTexture_get_compressed, 0, 0, 0},
 	{0},
 };
 
@@ -983,12 +1166,59 @@ void MGLTexture_Invalidate(MGLTexture * texture) {
 		return;
 	}
 
+	MGL_STAT(texture->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
 
+	if (texture->backing) {
+		free(texture->backing);
+		texture->backing = 0;
+	} else {
+		texture->context->texture_memory -= texture->memory;
+	}
+
 	Py_DECREF(texture->context);
 	Py_TYPE(texture) = &MGLInvalidObject_Type;
 	Py_DECREF(texture);
 }
+
+void MGLTexture_Restore(MGLTexture * texture) {
+	if (!texture->backing) {
+		return;
+	}
+
+	int pixel_type = texture->depth ? GL_FLOAT : texture->data_type->gl_type;
+	int base_format = texture->depth ? GL_DEPTH_COMPONENT : texture->data_type->base_format[texture->components];
+	int internal_format = texture->internal_format;
+
+	const GLMethods & gl = texture->context->gl;
+
+	gl.ActiveTexture(GL_TEXTURE0 + texture->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_2D, texture->texture_obj);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	Py_ssize_t pixel_size = (Py_ssize_t)texture->components * texture->data_type->size;
+	int width = texture->width;
+	int height = texture->height;
+	char * ptr = texture->backing;
+
+	for (int level = 0; level <= texture->max_level; ++level) {
+		gl.TexImage2D(GL_TEXTURE_2D, level, internal_format, width, height, 0, base_format, pixel_type, ptr);
+		ptr += width * height * pixel_size;
+		if (width == 1 && height == 1) {
+			break;
+		}
+		width = max(width / 2, 1);
+		height = max(height / 2, 1);
+	}
+
+	MGL_STAT(texture->context, MGL_STAT_TEXTURE_BYTES_WRITTEN, (Py_ssize_t)(ptr - texture->backing));
+
+	free(texture->backing);
+	texture->backing = 0;
+
+	texture->context->texture_memory += texture->memory;
+}
@@ -87,6 +87,7 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 	const GLMethods & gl = self->gl;
 
 	MGLTexture3D * texture = (MGLTexture3D *)MGLTexture3D_Type.tp_alloc(&MGLTexture3D_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	texture->texture_obj = 0;
 	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
@@ -124,6 +125,12 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 	texture->repeat_y = true;
 	texture->repeat_z = true;
 
+	texture->memory = texture_memory(width, height, depth, 0, components * data_type->size, true);
+	self->texture_memory += texture->memory;
+
+	texture->brick_buffer_obj = 0;
+	texture->brick_buffer_size = 0;
+
 	Py_INCREF(self);
 	texture->context = self;
 
@@ -185,6 +192,7 @@ PyObject * MGLTexture3D_read(MGLTexture3D * self, PyObject * args) {
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 	gl.GetTexImage(GL_TEXTURE_3D, 0, base_format, pixel_type, data);
 
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 	return result;
 }
 
@@ -256,6 +264,7 @@ PyObject * MGLTexture3D_read_into(MGLTexture3D * self, PyObject * args) {
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 		gl.GetTexImage(GL_TEXTURE_3D, 0, format, pixel_type, ptr);
 
+		MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 		PyBuffer_Release(&buffer_view);
 
 	}
@@ -379,6 +388,7 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 
 	}
 
+	MGL_STAT(self->context, MGL_STAT_TEXTURE_BYTES_WRITTEN, expected_size);
 	Py_RETURN_NONE;
 }
 
@@ -398,7 +408,174 @@ PyObject * MGLTexture3D_use(MGLTexture3D * self, PyObject * args) {
 	const GLMethods & gl = self->context->gl;
 	gl.ActiveTexture(GL_TEXTURE0 + index);
 	gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
+	MGL_STAT(self->context, MGL_STAT_TEXTURE_BINDS, 1);
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTexture3D_write_bricks(MGLTexture3D * self, PyObject * args) {
+	PyObject * data;
+	PyObject * origins;
+	int brick_width;
+	int brick_height;
+	int brick_depth;
+	int volume;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OO(iii)p",
+		&data,
+		&origins,
+		&brick_width,
+		&brick_height,
+		&brick_depth,
+		&volume
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (brick_width < 1 || brick_height < 1 || brick_depth < 1) {
+		MGLError_Set("the brick size must be positive");
+		return 0;
+	}
+
+	Py_buffer origins_view;
+
+	if (PyObject_GetBuffer(origins, &origins_view, PyBUF_FORMAT) < 0) {
+		MGLError_Set("origins (%s) does not support buffer interface", Py_TYPE(origins)->tp_name);
+		return 0;
+	}
+
+	if (origins_view.itemsize != 4 || !origins_view.format || !strchr("iIl", origins_view.format[0]) || origins_view.len % 12) {
+		MGLError_Set("origins must be 32-bit integers, three for each brick");
+		PyBuffer_Release(&origins_view);
+		return 0;
+	}
+
+	int * origin = (int *)origins_view.buf;
+	int bricks = (int)(origins_view.len / 12);
+
+	for (int i = 0; i < bricks; ++i) {
+		int x = origin[i * 3 + 0];
+		int y = origin[i * 3 + 1];
+		int z = origin[i * 3 + 2];
+
+		if (x < 0 || y < 0 || z < 0 || x >= self->width || y >= self->height || z >= self->depth) {
+			MGLError_Set("brick %d at (%d, %d, %d) is outside the texture", i, x, y, z);
+			PyBuffer_Release(&origins_view);
+			return 0;
+		}
+	}
+
+	int pixel_size = self->components * self->data_type->size;
+	Py_ssize_t brick_bytes = (Py_ssize_t)brick_width * brick_height * brick_depth * pixel_size;
+	Py_ssize_t volume_bytes = (Py_ssize_t)self->width * self->height * self->depth * pixel_size;
+	Py_ssize_t expected_size = volume ? volume_bytes : brick_bytes * bricks;
+
+	const GLMethods & gl = self->context->gl;
+
+	// With a volume the bricks are read in place from the client memory, nothing is gathered or staged
+	Py_buffer volume_view;
+	char * source = 0;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("the buffer is too small %zd < %zd", buffer->size, expected_size);
+			PyBuffer_Release(&origins_view);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+
+	} else if (volume) {
+
+		if (PyObject_GetBuffer(data, &volume_view, PyBUF_SIMPLE) < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			PyBuffer_Release(&origins_view);
+			return 0;
+		}
+
+		if (volume_view.len != expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", volume_view.len, expected_size);
+			PyBuffer_Release(&volume_view);
+			PyBuffer_Release(&origins_view);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		source = (char *)volume_view.buf;
+
+	} else {
+
+		Py_buffer buffer_view;
+
+		if (PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE) < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			PyBuffer_Release(&origins_view);
+			return 0;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			PyBuffer_Release(&origins_view);
+			return 0;
+		}
+
+		// All the bricks go through one staging buffer that is kept with the texture
+		if (!self->brick_buffer_obj) {
+			gl.GenBuffers(1, (GLuint *)&self->brick_buffer_obj);
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, self->brick_buffer_obj);
+
+		if (self->brick_buffer_size < expected_size) {
+			self->context->buffer_memory += expected_size - self->brick_buffer_size;
+			self->brick_buffer_size = expected_size;
+		}
+
+		gl.BufferData(GL_PIXEL_UNPACK_BUFFER, self->brick_buffer_size, 0, GL_STREAM_DRAW);
+		gl.BufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, expected_size, buffer_view.buf);
+		PyBuffer_Release(&buffer_view);
+	}
+
+	int pixel_type = self->data_type->gl_type;
+	int format = self->data_type->base_format[self->components];
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
+
+	// Bricks crossing the edge of the volume are clipped, the row and image strides keep the full brick or volume layout
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	gl.PixelStorei(GL_UNPACK_ROW_LENGTH, volume ? self->width : brick_width);
+	gl.PixelStorei(GL_UNPACK_IMAGE_HEIGHT, volume ? self->height : brick_height);
+
+	for (int i = 0; i < bricks; ++i) {
+		int x = origin[i * 3 + 0];
+		int y = origin[i * 3 + 1];
+		int z = origin[i * 3 + 2];
+		int width = min(brick_width, self->width - x);
+		int height = min(brick_height, self->height - y);
+		int depth = min(brick_depth, self->depth - z);
+		Py_ssize_t offset = volume ? (((Py_ssize_t)z * self->height + y) * self->width + x) * pixel_size : brick_bytes * i;
+		gl.TexSubImage3D(GL_TEXTURE_3D, 0, x, y, z, width, height, depth, format, pixel_type, source + offset);
+		MGL_STAT(self->context, MGL_STAT_TEXTURE_BYTES_WRITTEN, (Py_ssize_t)width * height * depth * pixel_size);
+	}
+
+	gl.PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	gl.PixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+	gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	if (source) {
+		PyBuffer_Release(&volume_view);
+	}
 
+	PyBuffer_Release(&origins_view);
 	Py_RETURN_NONE;
 }
 
@@ -439,6 +616,10 @@ PyObject * MGLTexture3D_build_mipmaps(MGLTexture3D * self, PyObject * args) {
 	self->mag_filter = GL_LINEAR;
 	self->max_level = max;
 
+	self->context->texture_memory -= self->memory;
+	self->memory = texture_memory(self->width, self->height, self->depth, max, self->components * self->data_type->size, true);
+	self->context->texture_memory += self->memory;
+
 	Py_RETURN_NONE;
 }
 
@@ -449,6 +630,7 @@ PyObject * MGLTexture3D_release(MGLTexture3D * self) {
 
 PyMethodDef MGLTexture3D_tp_methods[] = {
 	{"write", (PyCFunction)MGLTexture3D_write, METH_VARARGS, 0},
+	{"write_bricks", (PyCFunction)MGLTexture3D_write_bricks, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTexture3D_use, METH_VARARGS, 0},
 	{"build_mipmaps", (PyCFunction)MGLTexture3D_build_mipmaps, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTexture3D_read, METH_VARARGS, 0},
@@ -685,11 +867,20 @@ void MGLTexture3D_Invalidate(MGLTexture3D * texture) {
 		return;
 	}
 
+	MGL_STAT(texture->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
 
+	if (texture->brick_buffer_obj) {
+		gl.DeleteBuffers(1, (GLuint *)&texture->brick_buffer_obj);
+		texture->context->buffer_memory -= texture->brick_buffer_size;
+	}
+
+	texture->context->texture_memory -= texture->memory;
+
 	Py_DECREF(texture->context);
 	Py_TYPE(texture) = &MGLInvalidObject_Type;
 	Py_DECREF(texture);
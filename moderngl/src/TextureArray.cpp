@@ -89,6 +89,7 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
 
 	MGLTextureArray * texture = (MGLTextureArray *)MGLTextureArray_Type.tp_alloc(&MGLTextureArray_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	texture->texture_obj = 0;
 	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
@@ -124,6 +125,9 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 	texture->repeat_y = true;
 	texture->anisotropy = 1.0;
 
+	texture->memory = texture_memory(width, height, layers, 0, components * data_type->size, false);
+	self->texture_memory += texture->memory;
+
 	Py_INCREF(self);
 	texture->context = self;
 
@@ -206,6 +210,7 @@ PyObject * MGLTextureArray_read(MGLTextureArray * self, PyObject * args) {
 
 	gl.GetTexImage(GL_TEXTURE_2D_ARRAY, 0, base_format, pixel_type, data);
 
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 	return result;
 }
 
@@ -278,6 +283,7 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 		gl.GetTexImage(GL_TEXTURE_2D_ARRAY, 0, format, pixel_type, ptr);
 
+		MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 		PyBuffer_Release(&buffer_view);
 
 	}
@@ -400,6 +406,7 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 
 	}
 
+	MGL_STAT(self->context, MGL_STAT_TEXTURE_BYTES_WRITTEN, expected_size);
 	Py_RETURN_NONE;
 }
 
@@ -420,6 +427,7 @@ PyObject * MGLTextureArray_use(MGLTextureArray * self, PyObject * args) {
 	const GLMethods & gl = self->context->gl;
 	gl.ActiveTexture(GL_TEXTURE0 + index);
 	gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+	MGL_STAT(self->context, MGL_STAT_TEXTURE_BINDS, 1);
 
 	Py_RETURN_NONE;
 }
@@ -428,11 +436,20 @@ PyObject * MGLTextureArray_build_mipmaps(MGLTextureArray * self, PyObject * args
 	int base = 0;
 	int max = 1000;
 
+	const char * method;
+	const char * filter;
+	int srgb;
+	float alpha_ref;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"II",
+		"IIsspf",
 		&base,
-		&max
+		&max,
+		&method,
+		&filter,
+		&srgb,
+		&alpha_ref
 	);
 
 	if (!args_ok) {
@@ -446,21 +463,21 @@ PyObject * MGLTextureArray_build_mipmaps(MGLTextureArray * self, PyObject * args
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
-	gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
-
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_BASE_LEVEL, base);
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAX_LEVEL, max);
-
-	gl.GenerateMipmap(GL_TEXTURE_3D);
+	if (!MGLMipmaps_Build(self->context, GL_TEXTURE_2D_ARRAY, self->texture_obj, self->width, self->height, self->layers, self->components, self->data_type, base, max, method, filter, srgb, alpha_ref)) {
+		return 0;
+	}
 
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 	self->min_filter = GL_LINEAR_MIPMAP_LINEAR;
 	self->mag_filter = GL_LINEAR;
 	self->max_level = max;
 
+	self->context->texture_memory -= self->memory;
+	self->memory = texture_memory(self->width, self->height, self->layers, max, self->components * self->data_type->size, false);
+	self->context->texture_memory += self->memory;
+
 	Py_RETURN_NONE;
 }
 
@@ -699,11 +716,15 @@ void MGLTextureArray_Invalidate(MGLTextureArray * texture) {
 		return;
 	}
 
+	MGL_STAT(texture->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
 
+	texture->context->texture_memory -= texture->memory;
+
 	Py_DECREF(texture->context);
 	Py_TYPE(texture) = &MGLInvalidObject_Type;
 	Py_DECREF(texture);
@@ -85,6 +85,7 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	const GLMethods & gl = self->gl;
 
 	MGLTextureCube * texture = (MGLTextureCube *)MGLTextureCube_Type.tp_alloc(&MGLTextureCube_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	texture->texture_obj = 0;
 	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
@@ -136,6 +137,9 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	texture->max_level = 0;
 	texture->anisotropy = 1.0;
 
+	texture->memory = texture_memory(width, height, 6, 0, components * data_type->size, false);
+	self->texture_memory += texture->memory;
+
 	Py_INCREF(self);
 	texture->context = self;
 
@@ -204,6 +208,7 @@ PyObject * MGLTextureCube_read(MGLTextureCube * self, PyObject * args) {
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 	gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, format, pixel_type, data);
 
+	MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 	return result;
 }
 
@@ -282,6 +287,7 @@ PyObject * MGLTextureCube_read_into(MGLTextureCube * self, PyObject * args) {
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 		gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, format, pixel_type, ptr);
 
+		MGL_STAT(self->context, MGL_STAT_BYTES_READ, expected_size);
 		PyBuffer_Release(&buffer_view);
 
 	}
@@ -411,6 +417,56 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 		PyBuffer_Release(&buffer_view);
 	}
 
+	MGL_STAT(self->context, MGL_STAT_TEXTURE_BYTES_WRITTEN, expected_size);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureCube_build_mipmaps(MGLTextureCube * self, PyObject * args) {
+	int base = 0;
+	int max = 1000;
+
+	const char * method;
+	const char * filter;
+	int srgb;
+	float alpha_ref;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IIsspf",
+		&base,
+		&max,
+		&method,
+		&filter,
+		&srgb,
+		&alpha_ref
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (base > self->max_level) {
+		MGLError_Set("invalid base");
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	if (!MGLMipmaps_Build(self->context, GL_TEXTURE_CUBE_MAP, self->texture_obj, self->width, self->height, 1, self->components, self->data_type, base, max, method, filter, srgb, alpha_ref)) {
+		return 0;
+	}
+
+	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	self->min_filter = GL_LINEAR_MIPMAP_LINEAR;
+	self->mag_filter = GL_LINEAR;
+	self->max_level = max;
+
+	self->context->texture_memory -= self->memory;
+	self->memory = texture_memory(self->width, self->height, 6, max, self->components * self->data_type->size, false);
+	self->context->texture_memory += self->memory;
+
 	Py_RETURN_NONE;
 }
 
@@ -430,6 +486,7 @@ PyObject * MGLTextureCube_use(MGLTextureCube * self, PyObject * args) {
 	const GLMethods & gl = self->context->gl;
 	gl.ActiveTexture(GL_TEXTURE0 + index);
 	gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+	MGL_STAT(self->context, MGL_STAT_TEXTURE_BINDS, 1);
 
 	Py_RETURN_NONE;
 }
@@ -442,7 +499,7 @@ PyObject * MGLTextureCube_release(MGLTextureCube * self) {
 PyMethodDef MGLTextureCube_tp_methods[] = {
 	{"write", (PyCFunction)MGLTextureCube_write, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTextureCube_use, METH_VARARGS, 0},
-//	{"build_mipmaps", (PyCFunction)MGLTextureCube_build_mipmaps, METH_VARARGS, 0},
+	{"build_mipmaps", (PyCFunction)MGLTextureCube_build_mipmaps, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTextureCube_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTextureCube_read_into, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTextureCube_release, METH_NOARGS, 0},
@@ -616,11 +673,15 @@ void MGLTextureCube_Invalidate(MGLTextureCube * texture) {
 		return;
 	}
 
+	MGL_STAT(texture->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
 
+	texture->context->texture_memory -= texture->memory;
+
 	Py_TYPE(texture) = &MGLInvalidObject_Type;
 	Py_DECREF(texture);
 }
@@ -0,0 +1,731 @@
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+
+#include <string.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// EXT_texture_compression_s3tc and EXT_texture_sRGB are not part of the core profile
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT 0x8C4E
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+
+enum MGLTextureFileKind {
+	TEXTURE_FILE_2D,
+	TEXTURE_FILE_ARRAY,
+	TEXTURE_FILE_CUBE,
+	TEXTURE_FILE_3D,
+};
+
+struct MGLTextureFileFormat {
+	int container_format;   // DXGI_FORMAT, D3DFMT / FourCC or VkFormat
+	const char * dtype;
+	int components;
+	int internal_format;    // 0 means the internal format of the dtype
+	int base_format;        // 0 means the base format of the dtype
+	int block_bytes;        // bytes per 4x4 block for compressed formats, 0 for uncompressed formats
+};
+
+static MGLTextureFileFormat dxgi_formats[] = {
+	{2, "f4", 4, 0, 0, 0},      // R32G32B32A32_FLOAT
+	{6, "f4", 3, 0, 0, 0},      // R32G32B32_FLOAT
+	{10, "f2", 4, 0, 0, 0},     // R16G16B16A16_FLOAT
+	{16, "f4", 2, 0, 0, 0},     // R32G32_FLOAT
+	{28, "f1", 4, 0, 0, 0},     // R8G8B8A8_UNORM
+	{29, "f1", 4, GL_SRGB8_ALPHA8, 0, 0},
+	{30, "u1", 4, 0, 0, 0},     // R8G8B8A8_UINT
+	{34, "f2", 2, 0, 0, 0},     // R16G16_FLOAT
+	{41, "f4", 1, 0, 0, 0},     // R32_FLOAT
+	{42, "u4", 1, 0, 0, 0},     // R32_UINT
+	{49, "f1", 2, 0, 0, 0},     // R8G8_UNORM
+	{54, "f2", 1, 0, 0, 0},     // R16_FLOAT
+	{57, "u2", 1, 0, 0, 0},     // R16_UINT
+	{61, "f1", 1, 0, 0, 0},     // R8_UNORM
+	{62, "u1", 1, 0, 0, 0},     // R8_UINT
+	{87, "f1", 4, 0, GL_BGRA, 0},
+	{71, "f1", 4, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 0, 8},
+	{72, "f1", 4, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 0, 8},
+	{74, "f1", 4, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 0, 16},
+	{75, "f1", 4, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, 0, 16},
+	{77, "f1", 4, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 0, 16},
+	{78, "f1", 4, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 0, 16},
+	{80, "f1", 1, GL_COMPRESSED_RED_RGTC1, 0, 8},
+	{81, "f1", 1, GL_COMPRESSED_SIGNED_RED_RGTC1, 0, 8},
+	{83, "f1", 2, GL_COMPRESSED_RG_RGTC2, 0, 16},
+	{84, "f1", 2, GL_COMPRESSED_SIGNED_RG_RGTC2, 0, 16},
+	{95, "f2", 3, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, 0, 16},
+	{96, "f2", 3, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, 0, 16},
+	{98, "f1", 4, GL_COMPRESSED_RGBA_BPTC_UNORM, 0, 16},
+	{99, "f1", 4, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 0, 16},
+	{0},
+};
+
+// Legacy DDS files store the format as a FourCC or as a D3DFMT number
+static MGLTextureFileFormat fourcc_formats[] = {
+	{'D' | 'X' << 8 | 'T' << 16 | '1' << 24, "f1", 4, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 0, 8},
+	{'D' | 'X' << 8 | 'T' << 16 | '3' << 24, "f1", 4, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 0, 16},
+	{'D' | 'X' << 8 | 'T' << 16 | '5' << 24, "f1", 4, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 0, 16},
+	{'A' | 'T' << 8 | 'I' << 16 | '1' << 24, "f1", 1, GL_COMPRESSED_RED_RGTC1, 0, 8},
+	{'B' | 'C' << 8 | '4' << 16 | 'U' << 24, "f1", 1, GL_COMPRESSED_RED_RGTC1, 0, 8},
+	{'A' | 'T' << 8 | 'I' << 16 | '2' << 24, "f1", 2, GL_COMPRESSED_RG_RGTC2, 0, 16},
+	{'B' | 'C' << 8 | '5' << 16 | 'U' << 24, "f1", 2, GL_COMPRESSED_RG_RGTC2, 0, 16},
+	{111, "f2", 1, 0, 0, 0},    // D3DFMT_R16F
+	{112, "f2", 2, 0, 0, 0},    // D3DFMT_G16R16F
+	{113, "f2", 4, 0, 0, 0},    // D3DFMT_A16B16G16R16F
+	{114, "f4", 1, 0, 0, 0},    // D3DFMT_R32F
+	{115, "f4", 2, 0, 0, 0},    // D3DFMT_G32R32F
+	{116, "f4", 4, 0, 0, 0},    // D3DFMT_A32B32G32R32F
+	{0},
+};
+
+static MGLTextureFileFormat vk_formats[] = {
+	{9, "f1", 1, 0, 0, 0},      // R8_UNORM
+	{13, "u1", 1, 0, 0, 0},     // R8_UINT
+	{16, "f1", 2, 0, 0, 0},     // R8G8_UNORM
+	{23, "f1", 3, 0, 0, 0},     // R8G8B8_UNORM
+	{29, "f1", 3, GL_SRGB8, 0, 0},
+	{37, "f1", 4, 0, 0, 0},     // R8G8B8A8_UNORM
+	{41, "u1", 4, 0, 0, 0},     // R8G8B8A8_UINT
+	{43, "f1", 4, GL_SRGB8_ALPHA8, 0, 0},
+	{44, "f1", 4, 0, GL_BGRA, 0},
+	{74, "u2", 1, 0, 0, 0},     // R16_UINT
+	{76, "f2", 1, 0, 0, 0},     // R16_SFLOAT
+	{83, "f2", 2, 0, 0, 0},     // R16G16_SFLOAT
+	{90, "f2", 3, 0, 0, 0},     // R16G16B16_SFLOAT
+	{97, "f2", 4, 0, 0, 0},     // R16G16B16A16_SFLOAT
+	{98, "u4", 1, 0, 0, 0},     // R32_UINT
+	{100, "f4", 1, 0, 0, 0},    // R32_SFLOAT
+	{103, "f4", 2, 0, 0, 0},    // R32G32_SFLOAT
+	{106, "f4", 3, 0, 0, 0},    // R32G32B32_SFLOAT
+	{109, "f4", 4, 0, 0, 0},    // R32G32B32A32_SFLOAT
+	{131, "f1", 3, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, 0, 8},
+	{132, "f1", 3, GL_COMPRESSED_SRGB_S3TC_DXT1_EXT, 0, 8},
+	{133, "f1", 4, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 0, 8},
+	{134, "f1", 4, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 0, 8},
+	{135, "f1", 4, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 0, 16},
+	{136, "f1", 4, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, 0, 16},
+	{137, "f1", 4, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 0, 16},
+	{138, "f1", 4, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 0, 16},
+	{139, "f1", 1, GL_COMPRESSED_RED_RGTC1, 0, 8},
+	{140, "f1", 1, GL_COMPRESSED_SIGNED_RED_RGTC1, 0, 8},
+	{141, "f1", 2, GL_COMPRESSED_RG_RGTC2, 0, 16},
+	{142, "f1", 2, GL_COMPRESSED_SIGNED_RG_RGTC2, 0, 16},
+	{143, "f2", 3, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, 0, 16},
+	{144, "f2", 3, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, 0, 16},
+	{145, "f1", 4, GL_COMPRESSED_RGBA_BPTC_UNORM, 0, 16},
+	{146, "f1", 4, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 0, 16},
+	{147, "f1", 3, GL_COMPRESSED_RGB8_ETC2, 0, 8},
+	{149, "f1", 4, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, 0, 8},
+	{151, "f1", 4, GL_COMPRESSED_RGBA8_ETC2_EAC, 0, 16},
+	{153, "f1", 1, GL_COMPRESSED_R11_EAC, 0, 8},
+	{155, "f1", 2, GL_COMPRESSED_RG11_EAC, 0, 16},
+	{0},
+};
+
+static MGLTextureFileFormat * find_format(MGLTextureFileFormat * formats, int container_format) {
+	for (int i = 0; formats[i].dtype; ++i) {
+		if (formats[i].container_format == container_format) {
+			return &formats[i];
+		}
+	}
+	return 0;
+}
+
+struct MGLTextureFile {
+	const unsigned char * map;
+	Py_ssize_t map_size;
+
+	MGLTextureFileFormat * format;
+	MGLDataType * data_type;
+
+	int kind;
+	int width;
+	int height;
+	int depth;      // layers, faces or slices
+	int levels;
+
+	// KTX2 stores each level at an offset from the level index, DDS stores each layer or face with all of its levels
+	bool layer_major;
+	Py_ssize_t data_offset;
+	Py_ssize_t level_offset[32];
+};
+
+// Size of one layer, face or the whole volume at the given level
+static Py_ssize_t image_size(const MGLTextureFile & file, int level) {
+	int width = max(file.width >> level, 1);
+	int height = max(file.height >> level, 1);
+	int depth = file.kind == TEXTURE_FILE_3D ? max(file.depth >> level, 1) : 1;
+
+	if (file.format->block_bytes) {
+		return (Py_ssize_t)((width + 3) / 4) * ((height + 3) / 4) * depth * file.format->block_bytes;
+	}
+
+	return (Py_ssize_t)width * height * depth * file.format->components * file.data_type->size;
+}
+
+static const unsigned char * image_data(const MGLTextureFile & file, int level, int index) {
+	if (file.layer_major) {
+		Py_ssize_t chain = 0;
+		Py_ssize_t below = 0;
+		for (int i = 0; i < file.levels; ++i) {
+			if (i < level) {
+				below += image_size(file, i);
+			}
+			chain += image_size(file, i);
+		}
+		return file.map + file.data_offset + chain * index + below;
+	}
+
+	return file.map + file.level_offset[level] + image_size(file, level) * index;
+}
+
+static int image_count(const MGLTextureFile & file) {
+	return file.kind == TEXTURE_FILE_3D ? 1 : file.depth;
+}
+
+static inline unsigned read_u32(const unsigned char * ptr) {
+	unsigned value;
+	memcpy(&value, ptr, 4);
+	return value;
+}
+
+static inline unsigned long long read_u64(const unsigned char * ptr) {
+	unsigned long long value;
+	memcpy(&value, ptr, 8);
+	return value;
+}
+
+static int mip_count(int width, int height, int depth) {
+	int size = max(width, max(height, depth));
+	int levels = 1;
+	while (size > 1) {
+		size /= 2;
+		levels += 1;
+	}
+	return levels;
+}
+
+static bool parse_dds(MGLTextureFile & file) {
+	const unsigned char * header = file.map + 4;
+
+	if (file.map_size < 128 || read_u32(header) != 124) {
+		MGLError_Set("invalid DDS header");
+		return false;
+	}
+
+	unsigned flags = read_u32(header + 4);
+	file.height = read_u32(header + 8);
+	file.width = read_u32(header + 12);
+	int depth = read_u32(header + 20);
+	file.levels = (flags & 0x20000) ? max((int)read_u32(header + 24), 1) : 1;
+
+	unsigned pf_flags = read_u32(header + 76);
+	unsigned fourcc = read_u32(header + 80);
+	unsigned bit_count = read_u32(header + 84);
+	unsigned r_mask = read_u32(header + 88);
+	unsigned a_mask = read_u32(header + 100);
+	unsigned caps2 = read_u32(header + 108);
+
+	file.kind = TEXTURE_FILE_2D;
+	file.depth = 1;
+	file.data_offset = 128;
+
+	if ((pf_flags & 0x4) && fourcc == ('D' | 'X' << 8 | '1' << 16 | '0' << 24)) {
+		if (file.map_size < 148) {
+			MGLError_Set("invalid DDS header");
+			return false;
+		}
+
+		const unsigned char * dx10 = file.map + 128;
+		int dxgi_format = read_u32(dx10);
+		int dimension = read_u32(dx10 + 4);
+		unsigned misc = read_u32(dx10 + 8);
+		int array_size = max((int)read_u32(dx10 + 12), 1);
+
+		file.format = find_format(dxgi_formats, dxgi_format);
+		file.data_offset = 148;
+
+		if (!file.format) {
+			MGLError_Set("unsupported DXGI format %d", dxgi_format);
+			return false;
+		}
+
+		if (dimension == 4) {
+			file.kind = TEXTURE_FILE_3D;
+			file.depth = max(depth, 1);
+		} else if (misc & 0x4) {
+			if (array_size != 1) {
+				MGLError_Set("cube map arrays are not supported");
+				return false;
+			}
+			file.kind = TEXTURE_FILE_CUBE;
+			file.depth = 6;
+		} else if (array_size > 1) {
+			file.kind = TEXTURE_FILE_ARRAY;
+			file.depth = array_size;
+		}
+
+	} else if (pf_flags & 0x4) {
+		file.format = find_format(fourcc_formats, fourcc);
+
+		if (!file.format) {
+			MGLError_Set("unsupported DDS FourCC 0x%x", fourcc);
+			return false;
+		}
+
+	} else if ((pf_flags & 0x40) && bit_count == 32) {
+		file.format = find_format(dxgi_formats, r_mask == 0xff ? 28 : 87);
+
+	} else if ((pf_flags & 0x20000) && bit_count == 8) {
+		file.format = find_format(dxgi_formats, 61);
+
+	} else if ((pf_flags & 0x2) && bit_count == 8 && a_mask == 0xff) {
+		file.format = find_format(dxgi_formats, 61);
+
+	} else {
+		MGLError_Set("unsupported DDS pixel format");
+		return false;
+	}
+
+	if (file.kind == TEXTURE_FILE_2D && (caps2 & 0x200)) {
+		if ((caps2 & 0xfc00) != 0xfc00) {
+			MGLError_Set("cube maps with missing faces are not supported");
+			return false;
+		}
+		file.kind = TEXTURE_FILE_CUBE;
+		file.depth = 6;
+	}
+
+	if (file.kind == TEXTURE_FILE_2D && (caps2 & 0x200000)) {
+		file.kind = TEXTURE_FILE_3D;
+		file.depth = max(depth, 1);
+	}
+
+	file.layer_major = true;
+	return true;
+}
+
+static bool parse_ktx2(MGLTextureFile & file) {
+	if (file.map_size < 80) {
+		MGLError_Set("invalid KTX2 header");
+		return false;
+	}
+
+	const unsigned char * header = file.map + 12;
+
+	int vk_format = read_u32(header);
+	file.width = read_u32(header + 8);
+	file.height = read_u32(header + 12);
+	int depth = read_u32(header + 16);
+	int layers = read_u32(header + 20);
+	int faces = read_u32(header + 24);
+	file.levels = max((int)read_u32(header + 28), 1);
+	int supercompression = read_u32(header + 32);
+
+	if (supercompression) {
+		MGLError_Set("supercompressed KTX2 files are not supported");
+		return false;
+	}
+
+	if (!vk_format) {
+		MGLError_Set("KTX2 files without a format are not supported");
+		return false;
+	}
+
+	file.format = find_format(vk_formats, vk_format);
+
+	if (!file.format) {
+		MGLError_Set("unsupported VkFormat %d", vk_format);
+		return false;
+	}
+
+	if (!file.height) {
+		MGLError_Set("1D textures are not supported");
+		return false;
+	}
+
+	if ((layers > 1 ? 1 : 0) + (faces == 6 ? 1 : 0) + (depth > 0 ? 1 : 0) > 1) {
+		MGLError_Set("cube map arrays and 3D texture arrays are not supported");
+		return false;
+	}
+
+	if (depth > 0) {
+		file.kind = TEXTURE_FILE_3D;
+		file.depth = depth;
+	} else if (faces == 6) {
+		file.kind = TEXTURE_FILE_CUBE;
+		file.depth = 6;
+	} else if (layers > 0) {
+		file.kind = TEXTURE_FILE_ARRAY;
+		file.depth = layers;
+	} else {
+		file.kind = TEXTURE_FILE_2D;
+		file.depth = 1;
+	}
+
+	if (file.levels > 32 || file.map_size < 80 + file.levels * 24) {
+		MGLError_Set("invalid KTX2 level index");
+		return false;
+	}
+
+	const unsigned char * level_index = file.map + 80;
+
+	for (int level = 0; level < file.levels; ++level) {
+		file.level_offset[level] = (Py_ssize_t)read_u64(level_index + level * 24);
+	}
+
+	file.data_offset = 80 + file.levels * 24;
+	file.layer_major = false;
+	return true;
+}
+
+static bool map_file(const char * path, MGLTextureFile & file) {
+#if defined(_WIN32) || defined(_WIN64)
+	HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if (handle == INVALID_HANDLE_VALUE) {
+		MGLError_Set("cannot open %s", path);
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	GetFileSizeEx(handle, &size);
+	HANDLE mapping = size.QuadPart ? CreateFileMappingA(handle, 0, PAGE_READONLY, 0, 0, 0) : 0;
+	CloseHandle(handle);
+
+	if (!mapping) {
+		MGLError_Set("cannot map %s", path);
+		return false;
+	}
+
+	file.map = (const unsigned char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	file.map_size = (Py_ssize_t)size.QuadPart;
+	CloseHandle(mapping);
+
+	if (!file.map) {
+		MGLError_Set("cannot map %s", path);
+		return false;
+	}
+#else
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		MGLError_Set("cannot open %s", path);
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) < 0 || !info.st_size) {
+		close(fd);
+		MGLError_Set("cannot map %s", path);
+		return false;
+	}
+
+	void * map = mmap(0, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (map == MAP_FAILED) {
+		MGLError_Set("cannot map %s", path);
+		return false;
+	}
+
+	file.map = (const unsigned char *)map;
+	file.map_size = (Py_ssize_t)info.st_size;
+#endif
+	return true;
+}
+
+static void unmap_file(MGLTextureFile & file) {
+#if defined(_WIN32) || defined(_WIN64)
+	UnmapViewOfFile((void *)file.map);
+#else
+	munmap((void *)file.map, (size_t)file.map_size);
+#endif
+}
+
+static void upload_image(const GLMethods & gl, const MGLTextureFile & file, int target, int level, int internal_format, int base_format, const unsigned char * data) {
+	int width = max(file.width >> level, 1);
+	int height = max(file.height >> level, 1);
+
+	if (file.format->block_bytes) {
+		gl.CompressedTexImage2D(target, level, internal_format, width, height, 0, (GLsizei)image_size(file, level), data);
+	} else {
+		gl.TexImage2D(target, level, internal_format, width, height, 0, base_format, file.data_type->gl_type, data);
+	}
+}
+
+static void upload_volume(const GLMethods & gl, const MGLTextureFile & file, int target, int level, int internal_format, int base_format) {
+	int width = max(file.width >> level, 1);
+	int height = max(file.height >> level, 1);
+
+	if (file.kind == TEXTURE_FILE_3D) {
+		int depth = max(file.depth >> level, 1);
+		const unsigned char * data = image_data(file, level, 0);
+		if (file.format->block_bytes) {
+			gl.CompressedTexImage3D(target, level, internal_format, width, height, depth, 0, (GLsizei)image_size(file, level), data);
+		} else {
+			gl.TexImage3D(target, level, internal_format, width, height, depth, 0, base_format, file.data_type->gl_type, data);
+		}
+		return;
+	}
+
+	Py_ssize_t layer_size = image_size(file, level);
+
+	if (file.format->block_bytes) {
+		gl.CompressedTexImage3D(target, level, internal_format, width, height, file.depth, 0, (GLsizei)(layer_size * file.depth), 0);
+	} else {
+		gl.TexImage3D(target, level, internal_format, width, height, file.depth, 0, base_format, file.data_type->gl_type, 0);
+	}
+
+	for (int layer = 0; layer < file.depth; ++layer) {
+		const unsigned char * data = image_data(file, level, layer);
+		if (file.format->block_bytes) {
+			gl.CompressedTexSubImage3D(target, level, 0, 0, layer, width, height, 1, internal_format, (GLsizei)layer_size, data);
+		} else {
+			gl.TexSubImage3D(target, level, 0, 0, layer, width, height, 1, base_format, file.data_type->gl_type, data);
+		}
+	}
+}
+
+PyObject * MGLContext_load_texture(MGLContext * self, PyObject * args) {
+	PyObject * path;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O&",
+		PyUnicode_FSConverter,
+		&path
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLTextureFile file = {};
+
+	if (!map_file(PyBytes_AS_STRING(path), file)) {
+		Py_DECREF(path);
+		return 0;
+	}
+
+	Py_DECREF(path);
+
+	static const unsigned char ktx2_identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+	bool parsed;
+
+	if (file.map_size >= 4 && !memcmp(file.map, "DDS ", 4)) {
+		parsed = parse_dds(file);
+	} else if (file.map_size >= 12 && !memcmp(file.map, ktx2_identifier, 12)) {
+		parsed = parse_ktx2(file);
+	} else {
+		MGLError_Set("the file is not a DDS or KTX2 container");
+		parsed = false;
+	}
+
+	if (!parsed) {
+		unmap_file(file);
+		return 0;
+	}
+
+	file.data_type = from_dtype(file.format->dtype);
+
+	if (file.width < 1 || file.height < 1 || file.depth < 1) {
+		MGLError_Set("invalid texture size");
+		unmap_file(file);
+		return 0;
+	}
+
+	if (file.levels > mip_count(file.width, file.height, file.kind == TEXTURE_FILE_3D ? file.depth : 1)) {
+		MGLError_Set("invalid number of levels");
+		unmap_file(file);
+		return 0;
+	}
+
+	// Every image must lie within the mapping
+	Py_ssize_t memory = 0;
+
+	for (int level = 0; level < file.levels; ++level) {
+		Py_ssize_t size = image_size(file, level);
+		Py_ssize_t offset = image_data(file, level, image_count(file) - 1) - file.map;
+		if (offset < file.data_offset || offset + size > file.map_size) {
+			MGLError_Set("the file is truncated");
+			unmap_file(file);
+			return 0;
+		}
+		memory += size * image_count(file);
+	}
+
+	int internal_format = file.format->internal_format ? file.format->internal_format : file.data_type->internal_format[file.format->components];
+	int base_format = file.format->base_format ? file.format->base_format : file.data_type->base_format[file.format->components];
+
+	static const int targets[] = {GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_3D};
+	int texture_target = targets[file.kind];
+
+	const GLMethods & gl = self->gl;
+
+	gl.GetError();
+
+	int texture_obj = 0;
+	gl.GenTextures(1, (GLuint *)&texture_obj);
+
+	if (!texture_obj) {
+		MGLError_Set("cannot create texture");
+		unmap_file(file);
+		return 0;
+	}
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
+	gl.BindTexture(texture_target, texture_obj);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	for (int level = 0; level < file.levels; ++level) {
+		if (file.kind == TEXTURE_FILE_2D) {
+			upload_image(gl, file, GL_TEXTURE_2D, level, internal_format, base_format, image_data(file, level, 0));
+		} else if (file.kind == TEXTURE_FILE_CUBE) {
+			for (int face = 0; face < 6; ++face) {
+				upload_image(gl, file, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, internal_format, base_format, image_data(file, level, face));
+			}
+		} else {
+			upload_volume(gl, file, texture_target, level, internal_format, base_format);
+		}
+	}
+
+	unmap_file(file);
+
+	if (gl.GetError() != GL_NO_ERROR) {
+		gl.DeleteTextures(1, (GLuint *)&texture_obj);
+		MGLError_Set("cannot upload the texture, the format may not be supported");
+		return 0;
+	}
+
+	MGL_STAT(self, MGL_STAT_TEXTURE_BYTES_WRITTEN, memory);
+
+	int max_level = file.levels - 1;
+	int min_filter = max_level ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+
+	gl.TexParameteri(texture_target, GL_TEXTURE_MAX_LEVEL, max_level);
+	gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, min_filter);
+	gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	self->texture_memory += memory;
+
+	PyObject * texture_object;
+	PyObject * size;
+	const char * kind;
+
+	if (file.kind == TEXTURE_FILE_2D) {
+		MGLTexture * texture = (MGLTexture *)MGLTexture_Type.tp_alloc(&MGLTexture_Type, 0);
+		MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
+		texture->texture_obj = texture_obj;
+		texture->width = file.width;
+		texture->height = file.height;
+		texture->components = file.format->components;
+		texture->samples = 0;
+		texture->data_type = file.data_type;
+		texture->internal_format = internal_format;
+		texture->compressed = file.format->block_bytes != 0;
+		texture->max_level = max_level;
+		texture->compare_func = 0;
+		texture->anisotropy = 1.0f;
+		texture->depth = false;
+		texture->min_filter = min_filter;
+		texture->mag_filter = GL_LINEAR;
+		texture->repeat_x = true;
+		texture->repeat_y = true;
+		texture->memory = memory;
+		texture->last_use = self->frame;
+		texture->backing = 0;
+		texture->framebuffers = 0;
+		texture->context = self;
+		texture_object = (PyObject *)texture;
+		size = Py_BuildValue("(ii)", file.width, file.height);
+		kind = "texture";
+
+	} else if (file.kind == TEXTURE_FILE_ARRAY) {
+		MGLTextureArray * texture = (MGLTextureArray *)MGLTextureArray_Type.tp_alloc(&MGLTextureArray_Type, 0);
+		MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
+		texture->texture_obj = texture_obj;
+		texture->width = file.width;
+		texture->height = file.height;
+		texture->layers = file.depth;
+		texture->components = file.format->components;
+		texture->data_type = file.data_type;
+		texture->max_level = max_level;
+		texture->min_filter = min_filter;
+		texture->mag_filter = GL_LINEAR;
+		texture->repeat_x = true;
+		texture->repeat_y = true;
+		texture->anisotropy = 1.0;
+		texture->memory = memory;
+		texture->context = self;
+		texture_object = (PyObject *)texture;
+		size = Py_BuildValue("(iii)", file.width, file.height, file.depth);
+		kind = "texture_array";
+
+	} else if (file.kind == TEXTURE_FILE_CUBE) {
+		MGLTextureCube * texture = (MGLTextureCube *)MGLTextureCube_Type.tp_alloc(&MGLTextureCube_Type, 0);
+		MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
+		texture->texture_obj = texture_obj;
+		texture->width = file.width;
+		texture->height = file.height;
+		texture->components = file.format->components;
+		texture->data_type = file.data_type;
+		texture->max_level = max_level;
+		texture->min_filter = min_filter;
+		texture->mag_filter = GL_LINEAR;
+		texture->anisotropy = 1.0;
+		texture->memory = memory;
+		texture->context = self;
+		texture_object = (PyObject *)texture;
+		size = Py_BuildValue("(ii)", file.width, file.height);
+		kind = "texture_cube";
+
+	} else {
+		MGLTexture3D * texture = (MGLTexture3D *)MGLTexture3D_Type.tp_alloc(&MGLTexture3D_Type, 0);
+		MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
+		texture->texture_obj = texture_obj;
+		texture->width = file.width;
+		texture->height = file.height;
+		texture->depth = file.depth;
+		texture->components = file.format->components;
+		texture->data_type = file.data_type;
+		texture->max_level = max_level;
+		texture->min_filter = min_filter;
+		texture->mag_filter = GL_LINEAR;
+		texture->repeat_x = true;
+		texture->repeat_y = true;
+		texture->repeat_z = true;
+		texture->memory = memory;
+		texture->brick_buffer_obj = 0;
+		texture->brick_buffer_size = 0;
+		texture->context = self;
+		texture_object = (PyObject *)texture;
+		size = Py_BuildValue("(iii)", file.width, file.height, file.depth);
+		kind = "texture3d";
+	}
+
+	Py_INCREF(self);
+	Py_INCREF(texture_object);
+
+	PyObject * result = PyTuple_New(7);
+	PyTuple_SET_ITEM(result, 0, PyUnicode_FromString(kind));
+	PyTuple_SET_ITEM(result, 1, texture_object);
+	PyTuple_SET_ITEM(result, 2, PyLong_FromLong(texture_obj));
+	PyTuple_SET_ITEM(result, 3, size);
+	PyTuple_SET_ITEM(result, 4, PyLong_FromLong(file.format->components));
+	PyTuple_SET_ITEM(result, 5, PyUnicode_FromString(file.format->dtype));
+	PyTuple_SET_ITEM(result, 6, PyLong_FromLong(file.levels));
+	return result;
+}
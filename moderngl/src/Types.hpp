@@ -16,6 +16,33 @@ enum MGLEnableFlag {
 	MGL_INVALID = 0x40000000,
 };
 
+// Call and traffic counters of a context. MGL_STAT compiles to nothing unless MGL_STATS is defined.
+enum MGLStatCounter {
+	MGL_STAT_DRAW_ARRAYS,
+	MGL_STAT_DRAW_ELEMENTS,
+	MGL_STAT_DRAW_INDIRECT,
+	MGL_STAT_DISPATCHES,
+	MGL_STAT_VERTICES,
+	MGL_STAT_INSTANCES,
+	MGL_STAT_PROGRAM_BINDS,
+	MGL_STAT_VERTEX_ARRAY_BINDS,
+	MGL_STAT_TEXTURE_BINDS,
+	MGL_STAT_FRAMEBUFFER_BINDS,
+	MGL_STAT_BUFFER_BYTES_WRITTEN,
+	MGL_STAT_TEXTURE_BYTES_WRITTEN,
+	MGL_STAT_CLEARS,
+	MGL_STAT_BYTES_READ,
+	MGL_STAT_OBJECTS_CREATED,
+	MGL_STAT_OBJECTS_RELEASED,
+	MGL_STAT_COUNT,
+};
+
+#ifdef MGL_STATS
+#define MGL_STAT(context, counter, value) ((context)->stats[counter] += (unsigned long long)(value))
+#else
+#define MGL_STAT(context, counter, value) ((void)0)
+#endif
+
 enum SHADER_SLOT_ENUM {
 	VERTEX_SHADER_SLOT,
 	FRAGMENT_SHADER_SLOT,
@@ -100,6 +127,11 @@ struct MGLComputeShader {
 	int shader_obj;
 };
 
+#define MGL_MAX_DRAW_BUFFERS 32
+
+// Deduplicated KHR_debug messages, allocated when the debug output is enabled
+struct MGLDebugLog;
+
 struct MGLContext {
 	PyObject_HEAD
 
@@ -134,6 +166,30 @@ struct MGLContext {
 
 	int provoking_vertex;
 
+	// Bytes allocated by the objects of this context
+	Py_ssize_t texture_memory;
+	Py_ssize_t renderbuffer_memory;
+	Py_ssize_t buffer_memory;
+
+	// Incremented by the residency manager, stamped on textures when bound
+	int frame;
+
+	// Framebuffer state last applied to GL, negative values mean unknown.
+	// MGLFramebuffer_use compares against it to issue only the changes.
+	int applied_framebuffer;
+	int applied_viewport[4];
+	int applied_scissor[4];
+	int applied_scissor_enabled;
+	int applied_depth_mask;
+	int applied_color_mask[MGL_MAX_DRAW_BUFFERS];
+
+#ifdef MGL_STATS
+	unsigned long long stats[MGL_STAT_COUNT];
+#endif
+
+	MGLDebugLog * debug_log;
+	int debug_log_limit;
+
 	GLMethods gl;
 };
 
@@ -167,6 +223,9 @@ struct MGLFramebuffer {
 	int samples;
 
 	bool depth_mask;
+
+	// The attached Texture objects, they are detached when the framebuffer is released
+	PyObject * textures;
 };
 
 struct MGLInvalidObject {
@@ -200,6 +259,21 @@ enum MGLQueryKeys {
 	ANY_SAMPLES_PASSED,
 	TIME_ELAPSED,
 	PRIMITIVES_GENERATED,
+
+	// Pipeline statistics (OpenGL 4.6 or GL_ARB_pipeline_statistics_query)
+	VERTICES_SUBMITTED,
+	PRIMITIVES_SUBMITTED,
+	VERTEX_SHADER_INVOCATIONS,
+	TESS_CONTROL_SHADER_PATCHES,
+	TESS_EVALUATION_SHADER_INVOCATIONS,
+	GEOMETRY_SHADER_INVOCATIONS,
+	GEOMETRY_SHADER_PRIMITIVES_EMITTED,
+	FRAGMENT_SHADER_INVOCATIONS,
+	COMPUTE_SHADER_INVOCATIONS,
+	CLIPPING_INPUT_PRIMITIVES,
+	CLIPPING_OUTPUT_PRIMITIVES,
+
+	MGL_QUERY_KEYS,
 };
 
 struct MGLQuery {
@@ -207,7 +281,7 @@ struct MGLQuery {
 
 	MGLContext * context;
 
-	int query_obj[4];
+	int query_obj[MGL_QUERY_KEYS];
 };
 
 struct MGLRenderbuffer {
@@ -227,6 +301,8 @@ struct MGLRenderbuffer {
 
 	int samples;
 	bool depth;
+
+	Py_ssize_t memory;
 };
 
 struct MGLScope {
@@ -239,6 +315,7 @@ struct MGLScope {
 	int * textures;
 	int * buffers;
 	PyObject * samplers;
+	PyObject * texture_objects;
 
 	int num_textures;
 	int num_buffers;
@@ -264,6 +341,10 @@ struct MGLTexture {
 
 	int samples;
 
+	// The sized format of the storage, it differs from the data type for the sRGB and compressed files
+	int internal_format;
+	bool compressed;
+
 	int min_filter;
 	int mag_filter;
 	int max_level;
@@ -275,6 +356,15 @@ struct MGLTexture {
 
 	bool repeat_x;
 	bool repeat_y;
+
+	Py_ssize_t memory;
+
+	// Residency: the frame of the last bind and the levels of an evicted texture
+	int last_use;
+	char * backing;
+
+	// The number of framebuffers rendering to the texture, it cannot be evicted while attached
+	int framebuffers;
 };
 
 struct MGLTexture3D {
@@ -298,6 +388,11 @@ struct MGLTexture3D {
 	bool repeat_x;
 	bool repeat_y;
 	bool repeat_z;
+
+	Py_ssize_t memory;
+
+	int brick_buffer_obj;
+	Py_ssize_t brick_buffer_size;
 };
 
 struct MGLTextureArray {
@@ -323,6 +418,8 @@ struct MGLTextureArray {
 	bool repeat_x;
 	bool repeat_y;
 	float anisotropy;
+
+	Py_ssize_t memory;
 };
 
 struct MGLTextureCube {
@@ -343,6 +440,8 @@ struct MGLTextureCube {
 	int mag_filter;
 	int max_level;
 	float anisotropy;
+
+	Py_ssize_t memory;
 };
 
 struct MGLUniform {
@@ -425,6 +524,7 @@ void MGLComputeShader_Invalidate(MGLComputeShader * program);
 void MGLContext_Invalidate(MGLContext * context);
 void MGLFramebuffer_Invalidate(MGLFramebuffer * framebuffer);
 void MGLProgram_Invalidate(MGLProgram * program);
+void MGLQuery_Invalidate(MGLQuery * query);
 void MGLRenderbuffer_Invalidate(MGLRenderbuffer * renderbuffer);
 void MGLTexture3D_Invalidate(MGLTexture3D * texture);
 void MGLTextureCube_Invalidate(MGLTextureCube * texture);
@@ -440,6 +540,14 @@ void MGLUniformBlock_Complete(MGLUniformBlock * uniform_block, const GLMethods &
 void MGLVertexArray_Complete(MGLVertexArray * vertex_array);
 
 void MGLContext_Initialize(MGLContext * self);
+void MGLContext_ResetFramebufferState(MGLContext * self);
+void MGLContext_ReleaseDebugLog(MGLContext * self);
+
+void MGLTexture_Restore(MGLTexture * texture);
+
+PyObject * MGL_convert_frame(PyObject * self, PyObject * args);
+
+bool MGLMipmaps_Build(MGLContext * context, int target, int texture_obj, int width, int height, int layers, int components, MGLDataType * data_type, int base, int max, const char * method, const char * filter, bool srgb, float alpha_ref);
 
 extern PyTypeObject MGLAttribute_Type;
 extern PyTypeObject MGLBuffer_Type;
@@ -126,6 +126,7 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 	const GLMethods & gl = self->gl;
 
 	MGLVertexArray * array = (MGLVertexArray *)MGLVertexArray_Type.tp_alloc(&MGLVertexArray_Type, 0);
+	MGL_STAT(self, MGL_STAT_OBJECTS_CREATED, 1);
 
 	array->num_vertices = 0;
 	array->num_instances = 1;
@@ -277,16 +278,23 @@ PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 
 	gl.UseProgram(self->program->program_obj);
 	gl.BindVertexArray(self->vertex_array_obj);
+	MGL_STAT(self->context, MGL_STAT_PROGRAM_BINDS, 1);
+	MGL_STAT(self->context, MGL_STAT_VERTEX_ARRAY_BINDS, 1);
 
 	MGLVertexArray_SET_SUBROUTINES(self, gl);
 
 	if (self->index_buffer != (MGLBuffer *)Py_None) {
 		const void * ptr = (const void *)((GLintptr)first * self->index_element_size);
 		gl.DrawElementsInstanced(mode, vertices, self->index_element_type, ptr, instances);
+		MGL_STAT(self->context, MGL_STAT_DRAW_ELEMENTS, 1);
 	} else {
 		gl.DrawArraysInstanced(mode, first, vertices, instances);
+		MGL_STAT(self->context, MGL_STAT_DRAW_ARRAYS, 1);
 	}
 
+	MGL_STAT(self->context, MGL_STAT_VERTICES, (long long)vertices * instances);
+	MGL_STAT(self->context, MGL_STAT_INSTANCES, instances);
+
 	Py_RETURN_NONE;
 }
 
@@ -318,6 +326,8 @@ PyObject * MGLVertexArray_render_indirect(MGLVertexArray * self, PyObject * args
 
 	gl.UseProgram(self->program->program_obj);
 	gl.BindVertexArray(self->vertex_array_obj);
+	MGL_STAT(self->context, MGL_STAT_PROGRAM_BINDS, 1);
+	MGL_STAT(self->context, MGL_STAT_VERTEX_ARRAY_BINDS, 1);
 	gl.BindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer->buffer_obj);
 
 	MGLVertexArray_SET_SUBROUTINES(self, gl);
@@ -330,6 +340,9 @@ PyObject * MGLVertexArray_render_indirect(MGLVertexArray * self, PyObject * args
 		gl.MultiDrawArraysIndirect(mode, ptr, count, 20);
 	}
 
+	// The vertices of indirect draws are only known to the GPU
+	MGL_STAT(self->context, MGL_STAT_DRAW_INDIRECT, count);
+
 	Py_RETURN_NONE;
 }
 
@@ -389,6 +402,8 @@ PyObject * MGLVertexArray_transform(MGLVertexArray * self, PyObject * args) {
 
 	gl.UseProgram(self->program->program_obj);
 	gl.BindVertexArray(self->vertex_array_obj);
+	MGL_STAT(self->context, MGL_STAT_PROGRAM_BINDS, 1);
+	MGL_STAT(self->context, MGL_STAT_VERTEX_ARRAY_BINDS, 1);
 
 	if (buffer_offset > 0) {
 		gl.BindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, 0, output->buffer_obj, buffer_offset, output->size - buffer_offset);
@@ -404,10 +419,15 @@ PyObject * MGLVertexArray_transform(MGLVertexArray * self, PyObject * args) {
 	if (self->index_buffer != (MGLBuffer *)Py_None) {
 		const void * ptr = (const void *)((GLintptr)first * self->index_element_size);
 		gl.DrawElementsInstanced(mode, vertices, self->index_element_type, ptr, instances);
+		MGL_STAT(self->context, MGL_STAT_DRAW_ELEMENTS, 1);
 	} else {
 		gl.DrawArraysInstanced(mode, first, vertices, instances);
+		MGL_STAT(self->context, MGL_STAT_DRAW_ARRAYS, 1);
 	}
 
+	MGL_STAT(self->context, MGL_STAT_VERTICES, (long long)vertices * instances);
+	MGL_STAT(self->context, MGL_STAT_INSTANCES, instances);
+
 	gl.EndTransformFeedback();
 	if (~self->context->enable_flags & MGL_RASTERIZER_DISCARD) {
 		gl.Disable(GL_RASTERIZER_DISCARD);
@@ -471,6 +491,7 @@ PyObject * MGLVertexArray_bind(MGLVertexArray * self, PyObject * args) {
 
 	gl.BindVertexArray(self->vertex_array_obj);
 	gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+	MGL_STAT(self->context, MGL_STAT_VERTEX_ARRAY_BINDS, 1);
 
 	switch (type[0]) {
 		case 'f':
@@ -639,6 +660,8 @@ void MGLVertexArray_Invalidate(MGLVertexArray * array) {
 		return;
 	}
 
+	MGL_STAT(array->context, MGL_STAT_OBJECTS_RELEASED, 1);
+
 	// TODO: decref
 
 	const GLMethods & gl = array->context->gl;
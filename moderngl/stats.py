@@ -0,0 +1,85 @@
+__all__ = ['ContextStats']
+
+
+class ContextStats:
+    '''
+        ContextStats counts the draw calls, state changes and bytes moved by a context.
+
+        The counters are kept by the extension and cost an addition per call.
+        Building the extension with the ``MODERNGL_STATS=0`` environment variable
+        compiles them out, then :py:attr:`enabled` is False and the snapshots are empty.
+
+        The counters are:
+
+        - ``draw_arrays``, ``draw_elements`` and ``draw_indirect``: the draw calls by type
+        - ``dispatches``: the compute shader dispatches
+        - ``vertices`` and ``instances``: submitted by the direct draw calls
+        - ``program_binds``, ``vertex_array_binds``, ``texture_binds`` and ``framebuffer_binds``
+        - ``buffer_bytes_written`` and ``texture_bytes_written``: uploaded by ``write``, ``clear``,
+          ``write_bricks``, ``load_texture``, cpu mipmaps and restoring evicted textures
+        - ``clears``: the framebuffer clears
+        - ``bytes_read``: read back into host memory
+        - ``objects_created`` and ``objects_released``
+
+        A ContextStats object cannot be instantiated directly.
+        Use :py:attr:`Context.stats` to access it.
+    '''
+
+    __slots__ = ['ctx', 'extra']
+
+    def __init__(self):
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<ContextStats: %s>' % ('enabled' if self.enabled else 'disabled')
+
+    def __getitem__(self, name):
+        return self.snapshot()[name]
+
+    @property
+    def enabled(self) -> bool:
+        '''
+            bool: False if the extension was built without the counters.
+        '''
+
+        return self.ctx.mglo.stats() is not None
+
+    def snapshot(self) -> dict:
+        '''
+            Get the current value of every counter.
+
+            Returns:
+                dict: The counters by name.
+        '''
+
+        return self.ctx.mglo.stats() or {}
+
+    def since(self, snapshot) -> dict:
+        '''
+            Get the change of every counter since an earlier snapshot,
+            for example the cost of a single frame.
+
+            Args:
+                snapshot (dict): A snapshot returned by :py:meth:`snapshot`.
+
+            Returns:
+                dict: The differences by name.
+        '''
+
+        return {name: value - snapshot.get(name, 0) for name, value in self.snapshot().items()}
+
+    def reset(self) -> None:
+        '''
+            Set every counter to zero.
+        '''
+
+        self.ctx.mglo.reset_stats()
+
+
+def _create_context_stats(ctx):
+    res = ContextStats.__new__(ContextStats)
+    res.ctx = ctx
+    res.extra = None
+    return res
@@ -14,6 +14,20 @@ LINEAR_MIPMAP_NEAREST = 0x2701
 NEAREST_MIPMAP_LINEAR = 0x2702
 LINEAR_MIPMAP_LINEAR = 0x2703
 
+# bytes per component of the dtypes
+DTYPE_SIZE = {
+    'f1': 1, 'f2': 2, 'f4': 4,
+    'u1': 1, 'u2': 2, 'u4': 4,
+    'i1': 1, 'i2': 2, 'i4': 4,
+}
+
+# memoryview formats of the dtypes, half floats are exposed as their 16 bit patterns
+ARRAY_FORMATS = {
+    'f1': 'B', 'f2': 'H', 'f4': 'f',
+    'u1': 'B', 'u2': 'H', 'u4': 'I',
+    'i1': 'b', 'i2': 'h', 'i4': 'i',
+}
+
 
 class Texture:
     '''
@@ -258,6 +272,15 @@ class Texture:
 
         return self._depth
 
+    @property
+    def resident(self) -> bool:
+        '''
+            bool: Is the texture stored on the GPU?
+            Textures evicted by a :py:class:`ResidencyManager` are restored on next use.
+        '''
+
+        return self.mglo.resident
+
     @property
     def glo(self) -> int:
         '''
@@ -318,19 +341,32 @@ class Texture:
 
         self.mglo.write(data, viewport, level, alignment)
 
-    def build_mipmaps(self, base=0, max_level=1000) -> None:
+    def build_mipmaps(self, base=0, max_level=1000, *, method='gpu', filter='box', srgb=False, alpha_coverage=None) -> None:
         '''
             Generate mipmaps.
 
             This also changes the texture filter to ``LINEAR_MIPMAP_LINEAR, LINEAR``
             (Will be removed in ``6.x``)
 
+            The ``'gpu'`` method uses ``glGenerateMipmap``.
+            The ``'cpu'`` method reads back the base level and filters the
+            whole chain on the host using multiple threads, then uploads every level.
+            It supports ``f1``, ``u1``, ``f2`` and ``f4`` textures and is often faster
+            on software rasterizers. Only the ``'cpu'`` method supports the
+            ``'kaiser'`` filter, ``srgb`` and ``alpha_coverage``.
+
             Keyword Args:
                 base (int): The base level
                 max_level (int): The maximum levels to generate
+                method (str): ``'gpu'`` or ``'cpu'``
+                filter (str): ``'box'`` or ``'kaiser'``
+                srgb (bool): Filter the color components in linear space
+                alpha_coverage (float): Scale the alpha of each level to keep the ratio
+                    of texels with alpha above this reference value
         '''
 
-        self.mglo.build_mipmaps(base, max_level)
+        alpha_ref = -1.0 if alpha_coverage is None else alpha_coverage
+        self.mglo.build_mipmaps(base, max_level, method, filter, srgb, alpha_ref)
 
     def use(self, location=0) -> None:
         '''
@@ -1,5 +1,7 @@
+from array import array
 from typing import Tuple
 
+from .bricks import BrickMap, _create_brick_map
 from .buffer import Buffer
 
 __all__ = ['Texture3D']
@@ -245,6 +247,48 @@ class Texture3D:
 
         self.mglo.write(data, viewport, alignment)
 
+    def write_bricks(self, data, origins, brick_size, *, volume=False) -> None:
+        '''
+            Update many equally sized boxes of the texture at once.
+
+            The bricks are uploaded through a single pixel buffer and
+            written with one ``glTexSubImage3D`` call each in a native loop.
+            Bricks crossing the edge of the texture are clipped.
+
+            Args:
+                data (bytes): The bricks one after the other, each tightly packed.
+                    A :py:class:`Buffer` holding the bricks can also be used.
+                origins: The ``(x, y, z)`` origin of each brick, as a sequence
+                    of tuples or a buffer of 32-bit integers.
+                brick_size (tuple): The width, height and depth of a brick.
+
+            Keyword Args:
+                volume (bool): The data is a copy of the whole texture laid out
+                    like :py:meth:`read` returns it. The bricks are read from it
+                    in place, without gathering them first.
+        '''
+
+        if type(data) is Buffer:
+            data = data.mglo
+
+        if isinstance(origins, (list, tuple)):
+            origins = array('i', [value for origin in origins for value in origin])
+
+        self.mglo.write_bricks(data, origins, tuple(brick_size), volume)
+
+    def brick_map(self, brick_size) -> BrickMap:
+        '''
+            Create a :py:class:`BrickMap` tracking the dirty bricks of this texture.
+
+            Args:
+                brick_size (tuple): The width, height and depth of a brick.
+
+            Returns:
+                :py:class:`BrickMap` object
+        '''
+
+        return _create_brick_map(self, brick_size)
+
     def build_mipmaps(self, base=0, max_level=1000) -> None:
         '''
             Generate mipmaps.
@@ -254,19 +254,32 @@ class TextureArray:
 
         self.mglo.write(data, viewport, alignment)
 
-    def build_mipmaps(self, base=0, max_level=1000) -> None:
+    def build_mipmaps(self, base=0, max_level=1000, *, method='gpu', filter='box', srgb=False, alpha_coverage=None) -> None:
         '''
             Generate mipmaps.
 
             This also changes the texture filter to ``LINEAR_MIPMAP_LINEAR, LINEAR``
             (Will be removed in ``6.x``)
 
+            The ``'gpu'`` method uses ``glGenerateMipmap``.
+            The ``'cpu'`` method reads back the base level and filters the
+            whole chain on the host using multiple threads, then uploads every level.
+            It supports ``f1``, ``u1``, ``f2`` and ``f4`` textures and is often faster
+            on software rasterizers. Only the ``'cpu'`` method supports the
+            ``'kaiser'`` filter, ``srgb`` and ``alpha_coverage``.
+
             Keyword Args:
                 base (int): The base level
                 max_level (int): The maximum levels to generate
+                method (str): ``'gpu'`` or ``'cpu'``
+                filter (str): ``'box'`` or ``'kaiser'``
+                srgb (bool): Filter the color components in linear space
+                alpha_coverage (float): Scale the alpha of each level to keep the ratio
+                    of texels with alpha above this reference value
         '''
 
-        self.mglo.build_mipmaps(base, max_level)
+        alpha_ref = -1.0 if alpha_coverage is None else alpha_coverage
+        self.mglo.build_mipmaps(base, max_level, method, filter, srgb, alpha_ref)
 
     def use(self, location=0) -> None:
         '''
@@ -0,0 +1,201 @@
+from collections import OrderedDict
+
+from .renderbuffer import Renderbuffer
+from .texture import DTYPE_SIZE, Texture
+
+__all__ = ['TexturePool']
+
+
+class TexturePool:
+    '''
+        A TexturePool recycles transient textures and renderbuffers.
+
+        Post processing passes usually need scratch render targets of the same
+        size every frame. Instead of creating and releasing them each time,
+        acquire them from the pool and hand them back with :py:meth:`release`.
+        Objects handed back are kept until the pool holds more than
+        :py:attr:`budget` bytes, then the least recently released ones are released.
+
+        Recycled objects keep the filter, repeat and swizzle settings
+        of their previous user.
+
+        A TexturePool object cannot be instantiated directly.
+        Use :py:attr:`Context.texture_pool` to access the pool of a context.
+    '''
+
+    __slots__ = ['_free', '_lru', '_bytes_held', '_budget', '_hits', '_misses', 'ctx', 'extra']
+
+    def __init__(self):
+        self._free = None
+        self._lru = None
+        self._bytes_held = None
+        self._budget = None
+        self._hits = None
+        self._misses = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<TexturePool: %d bytes held>' % self._bytes_held
+
+    @property
+    def budget(self) -> int:
+        '''
+            int: The maximum number of bytes held by the pool.
+            Lowering the budget evicts objects immediately.
+        '''
+
+        return self._budget
+
+    @budget.setter
+    def budget(self, value):
+        self._budget = int(value)
+        self._evict()
+
+    @property
+    def bytes_held(self) -> int:
+        '''
+            int: The number of bytes used by the objects waiting in the pool.
+        '''
+
+        return self._bytes_held
+
+    @property
+    def hits(self) -> int:
+        '''
+            int: The number of acquire calls served from the pool.
+        '''
+
+        return self._hits
+
+    @property
+    def misses(self) -> int:
+        '''
+            int: The number of acquire calls that had to create a new object.
+        '''
+
+        return self._misses
+
+    @property
+    def hit_rate(self) -> float:
+        '''
+            float: The ratio of acquire calls served from the pool.
+        '''
+
+        total = self._hits + self._misses
+        return self._hits / total if total else 0.0
+
+    def acquire(self, size, components=4, *, dtype='f1', samples=0, depth=False, renderbuffer=False):
+        '''
+            Get a texture or renderbuffer from the pool.
+            A new object is created when the pool has no matching one.
+
+            Args:
+                size (tuple): The width and height.
+                components (int): The number of components 1, 2, 3 or 4.
+
+            Keyword Args:
+                dtype (str): Data type.
+                samples (int): The number of samples. Value 0 means no multisample format.
+                depth (bool): Acquire a depth texture or renderbuffer, the components and dtype are ignored.
+                renderbuffer (bool): Acquire a :py:class:`Renderbuffer` instead of a :py:class:`Texture`.
+
+            Returns:
+                :py:class:`Texture` or :py:class:`Renderbuffer` object
+        '''
+
+        key = _key(Renderbuffer if renderbuffer else Texture, size, components, dtype, samples, depth)
+        entries = self._free.get(key)
+
+        if entries:
+            obj = entries.pop()
+            del self._lru[id(obj)]
+            self._bytes_held -= _nbytes(obj)
+            self._hits += 1
+            return obj
+
+        self._misses += 1
+
+        if depth and renderbuffer:
+            return self.ctx.depth_renderbuffer(size, samples=samples)
+
+        if depth:
+            return self.ctx.depth_texture(size, samples=samples)
+
+        if renderbuffer:
+            return self.ctx.renderbuffer(size, components, samples=samples, dtype=dtype)
+
+        return self.ctx.texture(size, components, samples=samples, dtype=dtype)
+
+    def release(self, obj) -> None:
+        '''
+            Give a texture or renderbuffer back to the pool.
+            The object must not be used by the caller afterwards.
+
+            Args:
+                obj: The :py:class:`Texture` or :py:class:`Renderbuffer` to recycle.
+        '''
+
+        if type(obj) not in (Texture, Renderbuffer):
+            raise TypeError('only Texture and Renderbuffer objects can be pooled')
+
+        if id(obj) in self._lru:
+            raise ValueError('the object is already in the pool')
+
+        key = _key(type(obj), obj.size, obj.components, obj.dtype, obj.samples, obj.depth)
+        self._free.setdefault(key, []).append(obj)
+        self._lru[id(obj)] = (key, obj)
+        self._bytes_held += _nbytes(obj)
+        self._evict()
+
+    def clear(self) -> None:
+        '''
+            Release every object held by the pool and reset the counters.
+        '''
+
+        for key, obj in self._lru.values():
+            obj.release()
+
+        self._free.clear()
+        self._lru.clear()
+        self._bytes_held = 0
+        self._hits = 0
+        self._misses = 0
+
+    def _evict(self):
+        while self._bytes_held > self._budget and self._lru:
+            key, obj = self._lru.popitem(last=False)[1]
+            self._free[key].remove(obj)
+            self._bytes_held -= _nbytes(obj)
+            obj.release()
+
+
+def _key(cls, size, components, dtype, samples, depth):
+    # Depth objects always have a single f4 component
+    if depth:
+        components, dtype = 1, 'f4'
+
+    return (cls, tuple(size), components, dtype, samples, depth)
+
+
+def _nbytes(obj):
+    # Textures count their mipmap levels too
+    if type(obj) is Texture:
+        return obj.mglo.memory
+
+    width, height = obj.size
+    return width * height * obj.components * DTYPE_SIZE[obj.dtype] * max(obj.samples, 1)
+
+
+def _create_texture_pool(ctx, budget):
+    res = TexturePool.__new__(TexturePool)
+    res._free = {}
+    res._lru = OrderedDict()
+    res._bytes_held = 0
+    res._budget = budget
+    res._hits = 0
+    res._misses = 0
+    res.ctx = ctx
+    res.extra = None
+    return res
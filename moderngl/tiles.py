@@ -0,0 +1,210 @@
+import mmap
+from collections import namedtuple
+
+__all__ = ['TiledRenderer']
+
+
+Tile = namedtuple('Tile', ['x', 'y', 'width', 'height', 'matrix'])
+
+
+class TiledRenderer:
+    '''
+        A TiledRenderer renders images larger than a single framebuffer can hold.
+
+        The output is split into tiles. The render callback is called once per tile
+        with the framebuffer of the tile bound and a ``Tile`` named tuple describing it.
+        The ``matrix`` of the tile is a column major 4x4 matrix that maps the
+        clip space of the whole image to the clip space of the tile,
+        multiply it in front of the projection matrix.
+
+        The pixels of a tile are read into a pixel pack buffer while the next tile
+        renders, so only two tiles of memory are used on either side.
+
+        A TiledRenderer object cannot be instantiated directly.
+        Use :py:meth:`Context.tiled_renderer` to create one.
+    '''
+
+    __slots__ = ['_size', '_tile_size', '_components', '_dtype', '_framebuffer', '_resolve', '_buffers', 'ctx', 'extra']
+
+    def __init__(self):
+        self._size = None
+        self._tile_size = None
+        self._components = None
+        self._dtype = None
+        self._framebuffer = None
+        self._resolve = None
+        self._buffers = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<TiledRenderer: %dx%d in %dx%d tiles>' % (self._size + self._tile_size)
+
+    @property
+    def size(self) -> tuple:
+        '''
+            tuple: The width and height of the output.
+        '''
+
+        return self._size
+
+    @property
+    def tile_size(self) -> tuple:
+        '''
+            tuple: The largest width and height of a tile.
+        '''
+
+        return self._tile_size
+
+    @property
+    def framebuffer(self) -> 'Framebuffer':
+        '''
+            Framebuffer: The framebuffer the tiles are rendered to.
+        '''
+
+        return self._framebuffer
+
+    @property
+    def nbytes(self) -> int:
+        '''
+            int: The size of the output in bytes.
+        '''
+
+        width, height = self._size
+        return width * height * self._components * int(self._dtype[1])
+
+    def tiles(self) -> list:
+        '''
+            Get the tiles in rendering order, bottom to top and left to right.
+
+            Returns:
+                list: ``Tile`` named tuples
+        '''
+
+        width, height = self._size
+        tile_width, tile_height = self._tile_size
+        result = []
+
+        for y in range(0, height, tile_height):
+            for x in range(0, width, tile_width):
+                w, h = min(tile_width, width - x), min(tile_height, height - y)
+                matrix = (
+                    width / w, 0.0, 0.0, 0.0,
+                    0.0, height / h, 0.0, 0.0,
+                    0.0, 0.0, 1.0, 0.0,
+                    (width - 2 * x - w) / w, (height - 2 * y - h) / h, 0.0, 1.0,
+                )
+                result.append(Tile(x, y, w, h, matrix))
+
+        return result
+
+    def render(self, callback, output) -> None:
+        '''
+            Render every tile and stream the pixels to the output.
+
+            The output is laid out like :py:meth:`Framebuffer.read` returns the pixels,
+            rows in bottom up order without padding.
+
+            Args:
+                callback (callable): Called with each ``Tile`` to render it.
+                output: A path of the file to write, a writable buffer of :py:attr:`nbytes`
+                    or a callable receiving ``(tile, data)`` for each tile.
+        '''
+
+        if isinstance(output, str):
+            with open(output, 'wb+') as f:
+                f.truncate(self.nbytes)
+                if self.nbytes:
+                    with mmap.mmap(f.fileno(), self.nbytes) as mapping:
+                        self.render(callback, mapping)
+            return
+
+        if not callable(output):
+            target = memoryview(output).cast('B')
+            if len(target) < self.nbytes:
+                raise ValueError('the output must hold %d bytes' % self.nbytes)
+
+            def output(tile, data):
+                self._copy_tile(target, tile, data)
+
+        previous = self.ctx.fbo
+        pending = None
+
+        try:
+            for index, tile in enumerate(self.tiles()):
+                fbo = self._framebuffer
+                fbo.use()
+                fbo.viewport = (0, 0, tile.width, tile.height)
+                callback(tile)
+
+                if self._resolve is not None:
+                    fbo.resolve(self._resolve, viewport=(0, 0, tile.width, tile.height))
+                    fbo = self._resolve
+
+                buffer = self._buffers[index % 2]
+                fbo.read_into(buffer, (0, 0, tile.width, tile.height), self._components, dtype=self._dtype)
+
+                # The readback of the previous tile completes while this one renders
+                if pending is not None:
+                    self._deliver(pending, output)
+                pending = (tile, buffer)
+
+            if pending is not None:
+                self._deliver(pending, output)
+
+        finally:
+            if previous is not None:
+                previous.use()
+
+    def release(self) -> None:
+        '''
+            Release the framebuffers and buffers of the renderer.
+        '''
+
+        for obj in self._buffers:
+            obj.release()
+
+        for fbo in (self._framebuffer, self._resolve):
+            if fbo is not None:
+                for attachment in fbo.color_attachments + (fbo.depth_attachment,):
+                    if attachment is not None:
+                        attachment.release()
+                fbo.release()
+
+    def _deliver(self, pending, output):
+        tile, buffer = pending
+        output(tile, buffer.read(tile.width * tile.height * self._components * int(self._dtype[1])))
+
+    def _copy_tile(self, target, tile, data):
+        pixel_size = self._components * int(self._dtype[1])
+        row_size = tile.width * pixel_size
+        stride = self._size[0] * pixel_size
+        start = (tile.y * self._size[0] + tile.x) * pixel_size
+
+        for row in range(tile.height):
+            offset = start + row * stride
+            target[offset:offset + row_size] = data[row * row_size:(row + 1) * row_size]
+
+
+def _create_tiled_renderer(ctx, size, tile_size, components, dtype, samples, depth):
+    width, height = size
+    tile_width, tile_height = min(tile_size[0], width), min(tile_size[1], height)
+    tile_bytes = tile_width * tile_height * components * int(dtype[1])
+
+    def framebuffer(samples, depth):
+        color = ctx.renderbuffer((tile_width, tile_height), components, samples=samples, dtype=dtype)
+        depth = ctx.depth_renderbuffer((tile_width, tile_height), samples=samples) if depth else None
+        return ctx.framebuffer(color, depth)
+
+    res = TiledRenderer.__new__(TiledRenderer)
+    res._size = (width, height)
+    res._tile_size = (tile_width, tile_height)
+    res._components = components
+    res._dtype = dtype
+    res._framebuffer = framebuffer(samples, depth)
+    res._resolve = framebuffer(0, False) if samples else None
+    res._buffers = (ctx.buffer(reserve=tile_bytes), ctx.buffer(reserve=tile_bytes))
+    res.ctx = ctx
+    res.extra = None
+    return res
@@ -0,0 +1,297 @@
+import collections
+import functools
+import json
+import os
+import time
+
+from .buffer import Buffer
+from .compute_shader import ComputeShader
+from .framebuffer import Framebuffer
+from .texture import Texture
+from .texture_3d import Texture3D
+from .texture_array import TextureArray
+from .texture_cube import TextureCube
+from .vertex_array import VertexArray
+
+__all__ = ['Tracer']
+
+QUERY_BATCH = 64
+
+# The traced entry points, the ones submitting GPU work are bracketed by timestamps
+TRACED = {
+    VertexArray: {'render': True, 'render_indirect': True, 'transform': True},
+    ComputeShader: {'run': True},
+    Framebuffer: {'clear': True, 'use': False, 'read': False, 'read_into': False},
+    Buffer: {'write': False, 'read': False, 'read_into': False, 'clear': False},
+    Texture: {'write': False, 'read': False, 'read_into': False, 'use': False},
+    Texture3D: {'write': False, 'read': False, 'read_into': False, 'use': False},
+    TextureArray: {'write': False, 'read': False, 'read_into': False, 'use': False},
+    TextureCube: {'write': False, 'read': False, 'read_into': False, 'use': False},
+}
+
+# The context methods creating objects
+TRACED_CONTEXT = [
+    'program', 'compute_shader', 'buffer', 'texture', 'texture3d', 'texture_array', 'texture_cube',
+    'depth_texture', 'renderbuffer', 'depth_renderbuffer', 'framebuffer', 'vertex_array',
+]
+
+
+class Tracer:
+    '''
+        A Tracer records a timeline of moderngl calls and the GPU work they submit.
+
+        While the tracer runs the main entry points of the objects of its context
+        are recorded as spans with monotonic CPU timestamps. Draw calls,
+        compute dispatches and clears are also bracketed with ``GL_TIMESTAMP``
+        queries, their results are placed on a separate GPU track
+        of the same timeline once they arrived.
+
+        The spans are kept in a ring of :py:attr:`capacity` entries, the oldest
+        ones are dropped when it is full. :py:meth:`save` writes a Chrome trace
+        JSON file that ``chrome://tracing`` and the Perfetto UI can open.
+
+        Only one tracer can run at a time, the calls of other contexts are not recorded.
+
+        A Tracer object cannot be instantiated directly.
+        Use :py:meth:`Context.tracer` to create one.
+    '''
+
+    __slots__ = ['_spans', '_gpu_spans', '_pending', '_free', '_queries', '_gpu', '_offset', '_dropped',
+                 '_originals', 'ctx', 'extra']
+
+    _active = None
+
+    def __init__(self):
+        self._spans = None
+        self._gpu_spans = None
+        self._pending = None
+        self._free = None
+        self._queries = None
+        self._gpu = None
+        self._offset = None
+        self._dropped = None
+        self._originals = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<Tracer: %d spans, %s>' % (len(self._spans), 'running' if self.running else 'stopped')
+
+    def __enter__(self):
+        self.start()
+        return self
+
+    def __exit__(self, *args):
+        self.stop()
+
+    @property
+    def running(self) -> bool:
+        '''
+            bool: True between :py:meth:`start` and :py:meth:`stop`.
+        '''
+
+        return Tracer._active is self
+
+    @property
+    def capacity(self) -> int:
+        '''
+            int: The number of spans kept per track.
+        '''
+
+        return self._spans.maxlen
+
+    @property
+    def dropped(self) -> int:
+        '''
+            int: The number of spans dropped because the ring was full.
+        '''
+
+        return self._dropped
+
+    def start(self) -> None:
+        '''
+            Start recording.
+        '''
+
+        if Tracer._active is not None:
+            raise ValueError('another tracer is running')
+
+        if self._gpu:
+            # The GPU clock is placed on the CPU timeline at start, the drift is negligible for a trace
+            self._offset = time.perf_counter_ns() - self.ctx.mglo.gpu_time()
+
+        self._originals = []
+
+        for cls, methods in TRACED.items():
+            for name, gpu in methods.items():
+                self._patch(cls, name, cls.__name__ + '.' + name, gpu and self._gpu, False)
+
+        for name in TRACED_CONTEXT:
+            self._patch(type(self.ctx), name, 'Context.' + name, False, True)
+
+        Tracer._active = self
+
+    def stop(self) -> None:
+        '''
+            Stop recording. The pending GPU spans are still collected by :py:meth:`resolve`.
+        '''
+
+        if Tracer._active is not self:
+            return
+
+        for cls, name, original in self._originals:
+            setattr(cls, name, original)
+
+        self._originals = None
+        Tracer._active = None
+
+    def resolve(self, wait=False) -> None:
+        '''
+            Collect the GPU timestamps that arrived.
+
+            Args:
+                wait (bool): Wait for every pending GPU span.
+        '''
+
+        while self._pending:
+            name, begin, end = self._pending[0]
+            values = self.ctx.mglo.timestamp_results((begin, end), wait)
+
+            if values is None:
+                break
+
+            self._pending.popleft()
+            self._free.extend((begin, end))
+            self._append(self._gpu_spans, (name, values[0] + self._offset, values[1] + self._offset))
+
+    def chrome_trace(self) -> dict:
+        '''
+            Build the Chrome trace of the recorded spans.
+            Call :py:meth:`resolve` before to include the latest GPU spans.
+
+            Returns:
+                dict: The trace in the Chrome trace event format.
+        '''
+
+        pid = os.getpid()
+        events = [
+            {'name': 'thread_name', 'ph': 'M', 'pid': pid, 'tid': 1, 'args': {'name': 'CPU'}},
+            {'name': 'thread_name', 'ph': 'M', 'pid': pid, 'tid': 2, 'args': {'name': 'GPU'}},
+        ]
+
+        for tid, spans in ((1, self._spans), (2, self._gpu_spans)):
+            for name, begin, end in spans:
+                events.append({
+                    'name': name, 'cat': 'moderngl', 'ph': 'X', 'pid': pid, 'tid': tid,
+                    'ts': begin / 1000.0, 'dur': max(end - begin, 0) / 1000.0,
+                })
+
+        return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+    def save(self, path) -> None:
+        '''
+            Resolve the arrived GPU spans and write the Chrome trace JSON file.
+
+            Args:
+                path (str): The path of the file.
+        '''
+
+        self.resolve()
+
+        with open(path, 'w') as f:
+            json.dump(self.chrome_trace(), f)
+
+    def clear(self) -> None:
+        '''
+            Drop the recorded spans.
+        '''
+
+        self._spans.clear()
+        self._gpu_spans.clear()
+        self._dropped = 0
+
+    def release(self) -> None:
+        '''
+            Stop recording and release the timestamp queries.
+        '''
+
+        self.stop()
+        self._pending.clear()
+        self._free = []
+
+        if self._queries:
+            self.ctx.mglo.release_queries(tuple(self._queries))
+            self._queries = []
+
+    def _append(self, ring, span):
+        if len(ring) == ring.maxlen:
+            self._dropped += 1
+        ring.append(span)
+
+    def _acquire(self):
+        if not self._free:
+            queries = self.ctx.mglo.timestamp_queries(QUERY_BATCH)
+            self._queries.extend(queries)
+            self._free.extend(queries)
+
+        return self._free.pop()
+
+    def _patch(self, cls, name, label, gpu, is_context):
+        original = cls.__dict__.get(name)
+
+        if original is None:
+            return
+
+        tracer = self
+
+        @functools.wraps(original)
+        def traced(obj, *args, **kwargs):
+            ctx = obj if is_context else obj.ctx
+
+            if ctx is not tracer.ctx:
+                return original(obj, *args, **kwargs)
+
+            if gpu:
+                begin_query = tracer._acquire()
+                tracer.ctx.mglo.timestamp(begin_query)
+
+            begin = time.perf_counter_ns()
+
+            try:
+                return original(obj, *args, **kwargs)
+
+            finally:
+                end = time.perf_counter_ns()
+                tracer._append(tracer._spans, (label, begin, end))
+
+                if gpu:
+                    end_query = tracer._acquire()
+                    tracer.ctx.mglo.timestamp(end_query)
+                    tracer._pending.append((label, begin_query, end_query))
+
+                    # Bound the pending queries as well, the oldest results are usually available
+                    if len(tracer._pending) > tracer._spans.maxlen:
+                        tracer.resolve(wait=True)
+
+        self._originals.append((cls, name, original))
+        setattr(cls, name, traced)
+
+
+def _create_tracer(ctx, capacity, gpu):
+    if capacity < 1:
+        raise ValueError('the capacity must be at least one span')
+
+    res = Tracer.__new__(Tracer)
+    res._spans = collections.deque(maxlen=capacity)
+    res._gpu_spans = collections.deque(maxlen=capacity)
+    res._pending = collections.deque()
+    res._free = []
+    res._queries = []
+    res._gpu = gpu
+    res._offset = 0
+    res._dropped = 0
+    res._originals = None
+    res.ctx = ctx
+    res.extra = None
+    return res
@@ -60,24 +60,27 @@ libraries = {
 
 extra_compile_args = {
     'windows': [],
-    'linux': [],
-    'cygwin': [],
+    'linux': ['-pthread'],
+    'cygwin': ['-pthread'],
     'darwin': ['-Wno-deprecated-declarations'],
     'android': [],
 }
 
 extra_linker_args = {
     'windows': [],
-    'linux': [],
-    'cygwin': [],
+    'linux': ['-pthread'],
+    'cygwin': ['-pthread'],
     'darwin': [],
     'android': [],
 }
 
+# The counters behind Context.stats, build with MODERNGL_STATS=0 to compile them out
+define_macros = [] if os.environ.get('MODERNGL_STATS') == '0' else [('MGL_STATS', None)]
+
 mgl = Extension(
     name='moderngl.mgl',
     include_dirs=['src', 'moderngl', 'moderngl/mgl'],
-    define_macros=[],
+    define_macros=define_macros,
     libraries=libraries[target],
     extra_compile_args=extra_compile_args[target],
     extra_link_args=extra_linker_args[target],
@@ -86,12 +89,15 @@ mgl = Extension(
         'moderngl/src/Attribute.cpp',
         'moderngl/src/Buffer.cpp',
         'moderngl/src/BufferFormat.cpp',
+        'moderngl/src/ColorConvert.cpp',
         'moderngl/src/ComputeShader.cpp',
         'moderngl/src/Context.cpp',
         'moderngl/src/DataType.cpp',
+        'moderngl/src/Debug.cpp',
         'moderngl/src/Error.cpp',
         'moderngl/src/Framebuffer.cpp',
         'moderngl/src/InvalidObject.cpp',
+        'moderngl/src/Mipmaps.cpp',
         'moderngl/src/ModernGL.cpp',
         'moderngl/src/Program.cpp',
         'moderngl/src/Query.cpp',
@@ -101,6 +107,7 @@ mgl = Extension(
         'moderngl/src/Texture3D.cpp',
         'moderngl/src/TextureArray.cpp',
         'moderngl/src/TextureCube.cpp',
+        'moderngl/src/TextureFile.cpp',
         'moderngl/src/Uniform.cpp',
         'moderngl/src/UniformBlock.cpp',
         'moderngl/src/UniformGetters.cpp',
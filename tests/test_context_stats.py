@@ -0,0 +1,126 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        if not cls.ctx.stats.enabled:
+            raise unittest.SkipTest('the extension was built without stats')
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                out vec4 color;
+                void main() {
+                    color = vec4(1.0);
+                }
+            ''',
+        )
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def test_draws(self):
+        vbo = self.ctx.buffer(struct.pack('6f', -1.0, -1.0, 1.0, -1.0, -1.0, 1.0))
+        ibo = self.ctx.buffer(struct.pack('3i', 0, 1, 2))
+        vao = self.ctx.simple_vertex_array(self.prog, vbo, 'in_vert')
+        indexed = self.ctx.simple_vertex_array(self.prog, vbo, 'in_vert', index_buffer=ibo)
+
+        before = self.ctx.stats.snapshot()
+        vao.render()
+        vao.render(instances=4)
+        indexed.render()
+        diff = self.ctx.stats.since(before)
+
+        self.assertEqual(diff['draw_arrays'], 2)
+        self.assertEqual(diff['draw_elements'], 1)
+        self.assertEqual(diff['vertices'], 3 + 12 + 3)
+        self.assertEqual(diff['instances'], 1 + 4 + 1)
+        self.assertEqual(diff['program_binds'], 3)
+        self.assertEqual(diff['vertex_array_binds'], 3)
+
+    def test_traffic(self):
+        buf = self.ctx.buffer(reserve=64)
+        tex = self.ctx.texture((4, 4), 4)
+
+        before = self.ctx.stats.snapshot()
+        buf.write(b'\x00' * 16)
+        buf.clear()
+        tex.write(b'\x00' * 64)
+        buf.read()
+        tex.read()
+        diff = self.ctx.stats.since(before)
+
+        self.assertEqual(diff['buffer_bytes_written'], 16 + 64)
+        self.assertEqual(diff['texture_bytes_written'], 64)
+        self.assertEqual(diff['bytes_read'], 64 + 64)
+
+    def test_texture_uploads(self):
+        volume = self.ctx.texture3d((4, 4, 4), 1)
+        tex = self.ctx.texture((4, 4), 4)
+        residency = self.ctx.residency_manager(0)
+        residency.track(tex)
+
+        before = self.ctx.stats.snapshot()
+        volume.write_bricks(bytes(16), [(0, 0, 0), (3, 3, 3)], (2, 2, 2))
+        tex.build_mipmaps(method='cpu')
+        residency.next_frame()
+        tex.use(0)
+        diff = self.ctx.stats.since(before)
+
+        # a full and a clipped brick, two mipmap levels and the three restored levels
+        self.assertEqual(diff['texture_bytes_written'], 8 + 1 + (2 * 2 + 1) * 4 + (4 * 4 + 2 * 2 + 1) * 4)
+        residency.untrack(tex)
+        volume.release()
+        tex.release()
+
+    def test_framebuffer(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        previous = self.ctx.fbo
+
+        before = self.ctx.stats.snapshot()
+        fbo.use()
+        fbo.use()
+        fbo.clear()
+        fbo.read()
+        diff = self.ctx.stats.since(before)
+        previous.use()
+
+        # The second use is a no-op thanks to the state cache
+        self.assertEqual(diff['framebuffer_binds'], 1)
+        self.assertEqual(diff['clears'], 1)
+        self.assertEqual(diff['bytes_read'], 4 * 4 * 3)
+
+    def test_objects(self):
+        before = self.ctx.stats.snapshot()
+        buf = self.ctx.buffer(reserve=4)
+        tex = self.ctx.texture((1, 1), 4)
+        buf.release()
+        tex.release()
+        diff = self.ctx.stats.since(before)
+
+        self.assertEqual(diff['objects_created'], 2)
+        self.assertEqual(diff['objects_released'], 2)
+
+    def test_reset(self):
+        self.ctx.buffer(reserve=4).release()
+        self.ctx.stats.reset()
+        self.assertEqual(set(self.ctx.stats.snapshot().values()), {0})
+        self.assertEqual(self.ctx.stats['objects_created'], 0)
+
+
+if __name__ == '__main__':
+    unittest.main()
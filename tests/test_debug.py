@@ -0,0 +1,96 @@
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = moderngl.create_standalone_context(debug=True)
+
+    def setUp(self):
+        self.ctx.__enter__()
+        self.ctx.debug_messages(clear=True)
+
+    def test_messages(self):
+        buf = self.ctx.buffer(reserve=16)
+
+        for _ in range(3):
+            buf.bind_to_uniform_block(100000)
+
+        messages = self.ctx.debug_messages(clear=True)
+        self.assertEqual(len(messages), 1)
+        self.assertEqual(messages[0]['source'], 'api')
+        self.assertEqual(messages[0]['type'], 'error')
+        self.assertEqual(messages[0]['count'], 3)
+        self.assertIsInstance(messages[0]['id'], int)
+        self.assertIsInstance(messages[0]['message'], str)
+        self.assertEqual(self.ctx.debug_messages(), [])
+        buf.release()
+
+    def test_log_limit(self):
+        self.assertEqual(self.ctx.debug_log_limit, 1024)
+        self.ctx.debug_log_limit = 2
+        buf = self.ctx.buffer(reserve=16)
+
+        try:
+            for index in (100000, 100001, 100002, 100002):
+                buf.bind_to_uniform_block(index)
+
+            # The oldest message is dropped, the repeated one is counted
+            messages = self.ctx.debug_messages()
+            self.assertEqual([msg['count'] for msg in messages], [1, 2])
+            self.assertIn('100002', messages[1]['message'])
+
+            self.ctx.debug_log_limit = 1
+            self.assertEqual(self.ctx.debug_messages(), messages[1:])
+
+            with self.assertRaises(moderngl.Error):
+                self.ctx.debug_log_limit = -1
+        finally:
+            self.ctx.debug_log_limit = 1024
+            buf.release()
+
+    def test_debug_group(self):
+        with self.ctx.debug_group('outer'):
+            with self.ctx.debug_group('inner'):
+                pass
+
+        # The push and pop notifications are not collected
+        self.assertEqual(self.ctx.debug_messages(), [])
+
+    def test_labels(self):
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                void main() {
+                    gl_Position = vec4(0.0);
+                }
+            ''',
+        )
+        buf = self.ctx.buffer(reserve=4)
+        tex = self.ctx.texture((4, 4), 4)
+        fbo = self.ctx.framebuffer(tex)
+
+        # Labeling with a wrong identifier would report an error
+        errors = [msg for msg in self.ctx.debug_messages() if msg['type'] == 'error']
+        self.assertEqual(errors, [])
+
+        fbo.release()
+        tex.release()
+        buf.release()
+        prog.release()
+
+    def test_without_debug(self):
+        ctx = get_context()
+
+        with ctx.debug_group('pass'):
+            ctx.buffer(reserve=4).release()
+
+        self.assertEqual(ctx.debug_messages(), [])
+
+
+if __name__ == '__main__':
+    unittest.main()
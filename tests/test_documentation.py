@@ -65,6 +65,18 @@ class TestCase(unittest.TestCase):
     def test_query_docs(self):
         self.validate('query.rst', 'Query', [])
 
+    def test_query_ring_docs(self):
+        self.validate('query_ring.rst', 'QueryRing', [])
+
+    def test_profiler_docs(self):
+        self.validate('profiler.rst', 'GPUProfiler', [])
+
+    def test_stats_docs(self):
+        self.validate('stats.rst', 'ContextStats', [])
+
+    def test_tracer_docs(self):
+        self.validate('tracer.rst', 'Tracer', [])
+
     def test_scope_docs(self):
         self.validate('scope.rst', 'Scope', [])
 
@@ -89,6 +101,27 @@ class TestCase(unittest.TestCase):
     def test_sampler_docs(self):
         self.validate('sampler.rst', 'Sampler', [])
 
+    def test_texture_pool_docs(self):
+        self.validate('texture_pool.rst', 'TexturePool', [])
+
+    def test_residency_docs(self):
+        self.validate('residency.rst', 'ResidencyManager', [])
+
+    def test_bricks_docs(self):
+        self.validate('bricks.rst', 'BrickMap', [])
+
+    def test_tiles_docs(self):
+        self.validate('tiles.rst', 'TiledRenderer', [])
+
+    def test_frame_ring_docs(self):
+        self.validate('frame_ring.rst', 'FrameRing', [])
+
+    def test_frame_sink_docs(self):
+        self.validate('frame_sink.rst', 'FrameSink', [])
+
+    def test_picking_docs(self):
+        self.validate('picking.rst', 'PickResult', [])
+
 
 if __name__ == '__main__':
     unittest.main()
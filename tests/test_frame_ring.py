@@ -0,0 +1,111 @@
+import os
+import subprocess
+import sys
+import tempfile
+import unittest
+import uuid
+
+import moderngl
+from common import get_context
+
+CONSUMER = '''
+import sys
+import moderngl
+
+if sys.argv[1] == 'name':
+    ring = moderngl.open_frame_ring(sys.argv[2])
+else:
+    ring = moderngl.open_frame_ring(path=sys.argv[2])
+
+sequence = 0
+while sequence < 3:
+    sequence = ring.wait(sequence, timeout=10.0)
+    if not sequence:
+        sys.exit('timeout')
+
+for sequence in (2, 3):
+    frame = ring.frame(sequence)
+    print(sequence, frame.tobytes().hex(), ring.check(sequence))
+    frame.release()
+
+print(ring.size, ring.components, ring.dtype, ring.slots)
+ring.release()
+'''
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.fbo = self.ctx.simple_framebuffer((2, 2))
+
+    def produce(self, ring):
+        for value in (0.2, 0.4, 0.6):
+            self.fbo.clear(value, value, value)
+            ring.write(self.fbo)
+
+    def consume(self, *args):
+        env = dict(os.environ, PYTHONPATH=os.pathsep.join(sys.path))
+        return subprocess.Popen([sys.executable, '-c', CONSUMER] + list(args), env=env, stdout=subprocess.PIPE)
+
+    def check_output(self, consumer):
+        output, _ = consumer.communicate(timeout=30)
+        self.assertEqual(consumer.returncode, 0)
+        lines = output.decode().splitlines()
+        self.assertEqual(lines[0], '2 %s True' % (bytes([102]) * 12).hex())
+        self.assertEqual(lines[1], '3 %s True' % (bytes([153]) * 12).hex())
+        self.assertEqual(lines[2], "(2, 2) 3 f1 3")
+
+    def test_shared_memory(self):
+        ring = self.ctx.frame_ring((2, 2), 3, name='mgl_%s' % uuid.uuid4().hex[:12])
+        consumer = self.consume('name', ring._memory.name)
+        self.produce(ring)
+        self.check_output(consumer)
+        ring.release()
+
+    def test_file(self):
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'frames.ring')
+            with self.ctx.frame_ring((2, 2), 3, path=path) as ring:
+                self.produce(ring)
+                consumer = self.consume('path', path)
+                self.check_output(consumer)
+
+    def test_slots(self):
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'frames.ring')
+            with self.ctx.frame_ring((2, 2), 3, slots=2, path=path) as ring:
+                self.assertEqual(ring.sequence, 0)
+                self.assertEqual(ring.wait(0, timeout=0.0), 0)
+                self.produce(ring)
+                self.assertEqual(ring.sequence, 3)
+
+                # The first frame was overwritten by the third one
+                self.assertFalse(ring.check(1))
+                with self.assertRaises(ValueError):
+                    ring.frame(1)
+
+                frame = ring.frame(3)
+                self.assertEqual(frame.tobytes(), bytes([153]) * 12)
+                frame.release()
+
+                with self.assertRaises(ValueError):
+                    ring.write(self.fbo, viewport=(1, 1))
+
+    def test_invalid_slots(self):
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'frames.ring')
+            for slots in (0, -1):
+                with self.assertRaises(ValueError):
+                    self.ctx.frame_ring((2, 2), 3, slots=slots, path=path)
+
+            # Nothing was created
+            self.assertFalse(os.path.exists(path))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,106 @@
+import io
+import os
+import tempfile
+import unittest
+from fractions import Fraction
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.fbo = self.ctx.simple_framebuffer((4, 2))
+
+    def render(self, value):
+        # The top row is red, the bottom row is the value
+        self.fbo.clear(value, value, value)
+        self.fbo.clear(1.0, 0.0, 0.0, viewport=(0, 1, 4, 1))
+
+    def test_y4m(self):
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'video.y4m')
+            with self.ctx.frame_sink(path, (4, 2), fps=(30000, 1001), buffers=2) as sink:
+                for value in (0.0, 1.0, 0.0, 1.0, 0.0):
+                    self.render(value)
+                    sink.write(self.fbo)
+
+            with open(path, 'rb') as f:
+                data = f.read()
+
+        header, _, frames = data.partition(b'\n')
+        self.assertEqual(header, b'YUV4MPEG2 W4 H2 F30000:1001 Ip A1:1 C420jpeg')
+        self.assertEqual(sink.frames, 5)
+
+        frame_size = 6 + 8 + 2 + 2
+        self.assertEqual(len(frames), frame_size * 5)
+
+        first = frames[:frame_size]
+        self.assertEqual(first[:6], b'FRAME\n')
+        # Red on top, black below
+        self.assertEqual(list(first[6:14]), [82] * 4 + [16] * 4)
+        self.assertEqual(list(first[14:18]), [109, 109, 184, 184])
+
+        second = frames[frame_size:frame_size * 2]
+        self.assertEqual(list(second[6:14]), [82] * 4 + [235] * 4)
+
+    def test_raw(self):
+        output = io.BytesIO()
+        sink = self.ctx.frame_sink(output, (4, 2), 'rgb', workers=3)
+        for _ in range(8):
+            self.render(0.0)
+            sink.write(self.fbo)
+        sink.flush()
+
+        self.assertEqual(output.getvalue(), (b'\xff\x00\x00' * 4 + bytes(12)) * 8)
+
+        stats = sink.stats
+        self.assertEqual(stats['frames'], 8)
+        self.assertEqual(stats['queue_depth'], 0)
+        self.assertGreaterEqual(stats['max_queue_depth'], 1)
+        for stage in ('readback', 'convert', 'write'):
+            self.assertGreaterEqual(stats[stage], 0.0)
+
+        sink.close()
+        self.assertFalse(output.closed)
+
+    def test_rgba(self):
+        output = io.BytesIO()
+        with self.ctx.frame_sink(output, (4, 2), 'rgba') as sink:
+            self.render(1.0)
+            sink.write(self.fbo)
+            sink.flush()
+        self.assertEqual(output.getvalue(), b'\xff\x00\x00\x00' * 4 + b'\xff\xff\xff\x00' * 4)
+
+    def test_fps(self):
+        for fps, expected in ((29.97, b'F2997:100'), (Fraction(24000, 1001), b'F24000:1001'), (25, b'F25:1')):
+            output = io.BytesIO()
+            self.ctx.frame_sink(output, (4, 2), fps=fps).close()
+            self.assertIn(expected, output.getvalue())
+
+        for fps in (0, -30.0, (30, 0), (29.97, 1), '30'):
+            with self.assertRaises(ValueError):
+                self.ctx.frame_sink(io.BytesIO(), (4, 2), fps=fps)
+
+    def test_invalid_format(self):
+        with self.assertRaises(ValueError):
+            self.ctx.frame_sink(io.BytesIO(), (4, 2), 'yuv444')
+
+    def test_invalid_arguments(self):
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'video.y4m')
+            for kwargs in ({'buffers': 0}, {'workers': 0}, {'max_queue': 0}, {'max_queue': -1}, {'fps': 0}):
+                with self.assertRaises(ValueError):
+                    self.ctx.frame_sink(path, (4, 2), **kwargs)
+
+            self.assertFalse(os.path.exists(path))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,99 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_texture_array_layer(self):
+        texture = self.ctx.texture_array((2, 2, 3), 1)
+        fbo = self.ctx.framebuffer((texture, 1))
+        self.assertEqual(fbo.size, (2, 2))
+
+        fbo.clear(1.0)
+        self.assertEqual(texture.read(), bytes(4) + b'\xff' * 4 + bytes(4))
+        self.assertEqual(fbo.color_attachments, ((texture, 1),))
+
+    def test_texture_cube_face(self):
+        texture = self.ctx.texture_cube((2, 2), 1)
+        depth = self.ctx.depth_renderbuffer((2, 2))
+        fbo = self.ctx.framebuffer([(texture, 3)], depth)
+
+        fbo.clear(1.0)
+        for face in range(6):
+            self.assertEqual(texture.read(face), (b'\xff' if face == 3 else b'\x00') * 4)
+
+    def test_texture_3d_slice(self):
+        texture = self.ctx.texture3d((2, 2, 2), 1, bytes(8))
+        fbo = self.ctx.framebuffer((texture, 0))
+        fbo.clear(1.0)
+        self.assertEqual(texture.read(), b'\xff' * 4 + bytes(4))
+
+    def test_layered(self):
+        texture = self.ctx.texture_array((2, 2, 3), 1)
+        fbo = self.ctx.framebuffer(texture)
+
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            geometry_shader='''
+                #version 330
+                layout (triangles) in;
+                layout (triangle_strip, max_vertices = 9) out;
+                out float v_color;
+                void main() {
+                    for (int layer = 0; layer < 3; ++layer) {
+                        for (int i = 0; i < 3; ++i) {
+                            gl_Layer = layer;
+                            v_color = float(layer + 1) / 4.0;
+                            gl_Position = gl_in[i].gl_Position;
+                            EmitVertex();
+                        }
+                        EndPrimitive();
+                    }
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                in float v_color;
+                out float f_color;
+                void main() {
+                    f_color = v_color;
+                }
+            ''',
+        )
+
+        vbo = self.ctx.buffer(struct.pack('6f', -1.0, -1.0, 3.0, -1.0, -1.0, 3.0))
+        vao = self.ctx.simple_vertex_array(prog, vbo, 'in_vert')
+
+        fbo.use()
+        fbo.clear()
+        vao.render()
+
+        data = texture.read()
+        self.assertEqual(data, b'\x40' * 4 + b'\x80' * 4 + b'\xbf' * 4)
+
+    def test_invalid_layer(self):
+        texture = self.ctx.texture((2, 2), 4)
+        array = self.ctx.texture_array((2, 2, 2), 4)
+
+        with self.assertRaisesRegex(moderngl.Error, 'not layered'):
+            self.ctx.framebuffer((texture, 0))
+
+        with self.assertRaisesRegex(moderngl.Error, 'invalid layer'):
+            self.ctx.framebuffer((array, 2))
+
+
+if __name__ == '__main__':
+    unittest.main()
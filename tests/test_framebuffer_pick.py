@@ -0,0 +1,86 @@
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.ids = self.ctx.texture((8, 8), 1, dtype='u4')
+        self.fbo = self.ctx.framebuffer([self.ctx.texture((8, 8), 4), self.ids], self.ctx.depth_renderbuffer((8, 8)))
+
+    def fill(self, value, viewport):
+        data = value.to_bytes(4, 'little') * (viewport[2] * viewport[3])
+        self.ids.write(data, viewport)
+
+    def test_pick(self):
+        self.fill(0, (0, 0, 8, 8))
+        self.fill(7, (2, 3, 2, 2))
+
+        result = self.fbo.pick(2, 3, attachment=1)
+        self.assertEqual(result.result()[0, 0, 0], 7)
+        self.assertTrue(result.ready)
+
+        result = self.fbo.pick(1, 3, 3, 2, attachment=1)
+        self.assertEqual(result.result().tolist(), [[[0], [7], [7]], [[0], [7], [7]]])
+
+    def test_deferred(self):
+        self.fill(3, (0, 0, 8, 8))
+        results = [self.fbo.pick(x, 0, attachment=1) for x in range(8)]
+
+        for result in results:
+            value = result.result(wait=False)
+            if value is None:
+                self.assertFalse(result.ready)
+                value = result.result()
+            self.assertEqual(value.tolist(), [[[3]]])
+
+        # The buffers return to the pool
+        self.assertGreaterEqual(len(self.ctx._pick_pool._free), 1)
+        count = len(self.ctx._pick_pool._free)
+        self.fbo.pick(0, 0, attachment=1).result()
+        self.assertEqual(len(self.ctx._pick_pool._free), count)
+
+    def test_colors_and_depth(self):
+        self.fbo.clear(1.0, 0.0, 0.5, 1.0, depth=0.5)
+        color = self.fbo.pick(4, 4, components=4, dtype='f1').result()
+        self.assertEqual(color.tolist(), [[[255, 0, 128, 255]]])
+
+        depth = self.fbo.pick(4, 4, attachment=-1, dtype='f4').result()
+        self.assertAlmostEqual(depth[0, 0, 0], 0.5, places=4)
+
+    def test_large_region(self):
+        self.fill(9, (0, 0, 8, 8))
+        result = self.fbo.pick(0, 0, 8, 8, attachment=1, components=1)
+        self.assertEqual(result.result().tolist(), [[[9]] * 8] * 8)
+
+    def test_release(self):
+        result = self.fbo.pick(0, 0, attachment=1)
+        result.release()
+        self.assertIsNone(result.result(wait=False))
+
+    def test_dropped(self):
+        self.fbo.pick(0, 0, attachment=1).result()
+        count = len(self.ctx._pick_pool._free)
+
+        result = self.fbo.pick(0, 0, attachment=1)
+        self.assertEqual(len(self.ctx._pick_pool._free), count - 1)
+        del result
+        self.assertEqual(len(self.ctx._pick_pool._free), count)
+
+    def test_invalid(self):
+        with self.assertRaises(moderngl.Error):
+            self.fbo.pick(0, 0, attachment=2)
+
+        with self.assertRaises(ValueError):
+            self.fbo.pick(0, 0, dtype='f8')
+
+
+if __name__ == '__main__':
+    unittest.main()
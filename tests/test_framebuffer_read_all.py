@@ -0,0 +1,67 @@
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.fbo = self.ctx.framebuffer(
+            [
+                self.ctx.texture((4, 2), 4),
+                self.ctx.texture((4, 2), 3, dtype='f2'),
+                self.ctx.renderbuffer((4, 2), 2, dtype='f4'),
+            ],
+            self.ctx.depth_texture((4, 2)),
+        )
+        self.fbo.clear(0.5, 0.25, 1.0, 1.0, depth=0.75)
+        self.fbo.clear(1.0, 0.0, 0.0, 0.0, depth=0.25, viewport=(0, 0, 2, 2))
+
+    def expected(self, viewport=None):
+        return (
+            self.fbo.read(viewport, 4, attachment=0),
+            self.fbo.read(viewport, 3, attachment=1, dtype='f2'),
+            self.fbo.read(viewport, 2, attachment=2, dtype='f4'),
+            self.fbo.read(viewport, attachment=-1, dtype='f4'),
+        )
+
+    def test_read_all(self):
+        views = self.fbo.read_all()
+        self.assertEqual(len(views), 4)
+        self.assertEqual([view.shape for view in views], [(2, 4, 4), (2, 4, 3), (2, 4, 2), (2, 4, 1)])
+        self.assertEqual(tuple(view.tobytes() for view in views), self.expected())
+
+        # The views share one arena
+        self.assertIs(views[0].obj, views[3].obj)
+
+    def test_subset(self):
+        views = self.fbo.read_all((2, 0), depth=False, viewport=(1, 0, 2, 2))
+        expected = self.expected((1, 0, 2, 2))
+        self.assertEqual(tuple(view.tobytes() for view in views), (expected[2], expected[0]))
+
+    def test_out(self):
+        arena = bytearray(4096)
+        views = self.fbo.read_all(out=arena)
+        self.assertEqual(tuple(view.tobytes() for view in views), self.expected())
+        self.assertEqual(arena[:32], bytearray(self.expected()[0]))
+
+        with self.assertRaises(moderngl.Error):
+            self.fbo.read_all(out=bytearray(64))
+
+    def test_pixel_pack_buffer(self):
+        buf = self.ctx.buffer(reserve=4096)
+        offsets = self.fbo.read_all(out=buf)
+        self.assertEqual(offsets, (0, 32, 80, 144))
+
+        for offset, expected in zip(offsets, self.expected()):
+            self.assertEqual(buf.read(len(expected), offset=offset), expected)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,102 @@
+import unittest
+
+import moderngl
+import numpy as np
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def make_framebuffer(self, dtype):
+        fbo = self.ctx.framebuffer(
+            self.ctx.texture((4, 3), 4, dtype=dtype),
+            self.ctx.depth_texture((4, 3)),
+        )
+        # Only the bottom row is white
+        fbo.clear(0.0, 0.0, 0.0, 0.0)
+        fbo.clear(1.0, 1.0, 1.0, 1.0, viewport=(0, 0, 4, 1))
+        return fbo
+
+    def test_flip(self):
+        fbo = self.make_framebuffer('f1')
+
+        array = fbo.read_array(components=4)
+        self.assertEqual(array.shape, (3, 4, 4))
+        self.assertEqual(array.format, 'B')
+        self.assertEqual(array.tobytes(), bytes(32) + b'\xff' * 16)
+
+        array = fbo.read_array(components=4, flip=False)
+        self.assertEqual(array.tobytes(), b'\xff' * 16 + bytes(32))
+
+    def test_convert(self):
+        fbo = self.make_framebuffer('f1')
+        array = np.asarray(fbo.read_array((1, 0, 2, 2), 3, out_dtype='f4'))
+        self.assertEqual(array.shape, (2, 2, 3))
+        np.testing.assert_array_equal(array[0], 0.0)
+        np.testing.assert_array_equal(array[1], 1.0)
+
+        fbo = self.make_framebuffer('f2')
+        array = np.asarray(fbo.read_array(components=1, dtype='f2', out_dtype='f4'))
+        np.testing.assert_array_equal(array[:, :, 0], [[0.0] * 4, [0.0] * 4, [1.0] * 4])
+
+        array = np.asarray(fbo.read_array(components=1, dtype='f2')).view('f2')
+        np.testing.assert_array_equal(array[2], 1.0)
+
+    def test_convert_clamps(self):
+        fbo = self.ctx.framebuffer(self.ctx.texture((2, 2), 2, dtype='f4'))
+        fbo.clear(2.0, -1.0)
+        fbo.clear(0.5, 0.25, viewport=(0, 0, 2, 1))
+
+        array = fbo.read_array(components=2, dtype='f4', out_dtype='f1')
+        self.assertEqual(array.tobytes(), b'\xff\x00' * 2 + b'\x80\x40' * 2)
+
+    def test_out(self):
+        fbo = self.make_framebuffer('f1')
+
+        out = np.zeros((3, 4, 4), 'f4')
+        self.assertIs(fbo.read_array(components=4, out_dtype='f4', out=out), out)
+        np.testing.assert_array_equal(out[2], 1.0)
+        np.testing.assert_array_equal(out[:2], 0.0)
+
+        with self.assertRaises(moderngl.Error):
+            fbo.read_array(components=4, out_dtype='f4', out=np.zeros((2, 4, 4), 'f4'))
+
+        with self.assertRaises(moderngl.Error):
+            fbo.read_array(components=4, out=bytes(48))
+
+    def test_depth(self):
+        fbo = self.make_framebuffer('f1')
+        fbo.clear(depth=0.5, viewport=(0, 2, 4, 1))
+
+        array = np.asarray(fbo.read_array(attachment=-1, dtype='f4'))
+        self.assertEqual(array.shape, (3, 4, 1))
+        np.testing.assert_allclose(array[0], 0.5, atol=1e-5)
+        np.testing.assert_allclose(array[1:], 1.0, atol=1e-5)
+
+    def test_invalid_conversion(self):
+        fbo = self.make_framebuffer('f1')
+
+        with self.assertRaises(moderngl.Error):
+            fbo.read_array(dtype='f1', out_dtype='i4')
+
+    def test_invalid_viewport(self):
+        fbo = self.make_framebuffer('f1')
+        out = np.zeros((4, 4, 3), 'f4')
+
+        for viewport in [(0, 0, -1, 4), (0, 0, 4, 0), (-1, 0, 2, 2), (3, 0, 2, 2), (0, 0, 4, 4)]:
+            with self.assertRaises(moderngl.Error):
+                fbo.read_array(viewport, dtype='f1', out_dtype='f4', out=out)
+
+        with self.assertRaises(moderngl.Error):
+            fbo.read_all(viewport=(0, 0, -1, 4))
+
+
+if __name__ == '__main__':
+    unittest.main()
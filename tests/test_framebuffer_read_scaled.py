@@ -0,0 +1,84 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def checkerboard(self, size, samples=0):
+        fbo = self.ctx.framebuffer(self.ctx.renderbuffer((size, size), 4, samples=samples, dtype='f4'))
+        fbo.clear(0.0, 0.0, 0.0, 0.0)
+        for y in range(size):
+            for x in range(y % 2, size, 2):
+                fbo.clear(1.0, 1.0, 1.0, 1.0, viewport=(x, y, 1, 1))
+        return fbo
+
+    def test_box_average(self):
+        fbo = self.checkerboard(16)
+        data = fbo.read_scaled((2, 2), 1, dtype='f4')
+        for value in struct.unpack('4f', data):
+            self.assertAlmostEqual(value, 0.5, places=2)
+
+        data = fbo.read_scaled((4, 2), 4)
+        self.assertEqual(len(data), 32)
+        for value in data:
+            self.assertIn(value, (127, 128))
+
+    def test_nearest(self):
+        fbo = self.checkerboard(8)
+        data = fbo.read_scaled((8, 8), 1, filter='nearest')
+        self.assertEqual(data, fbo.read(components=1))
+
+    def test_region(self):
+        fbo = self.ctx.simple_framebuffer((8, 8))
+        fbo.clear(0.0, 0.0, 0.0)
+        fbo.clear(1.0, 1.0, 1.0, viewport=(4, 4, 4, 4))
+        self.assertEqual(fbo.read_scaled((1, 1), viewport=(4, 4, 4, 4)), b'\xff\xff\xff')
+        self.assertEqual(fbo.read_scaled((2, 2)), bytes(9) + b'\xff\xff\xff')
+
+    def test_scissor(self):
+        fbo = self.checkerboard(8)
+        previous = self.ctx.fbo
+        fbo.use()
+        fbo.scissor = (0, 0, 1, 1)
+
+        data = fbo.read_scaled((8, 8), 1, filter='nearest')
+        self.assertEqual(data, fbo.read(components=1))
+
+        # The scissor is still applied after reading
+        fbo.clear(0.0, 0.0, 0.0, 0.0)
+        self.assertEqual(fbo.read(components=1), bytes(1) + data[1:])
+
+        fbo.scissor = None
+        previous.use()
+
+    def test_multisample(self):
+        fbo = self.checkerboard(8, samples=4)
+        data = fbo.read_scaled((1, 1), 1, dtype='f2')
+        self.assertEqual(len(data), 2)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_invalid(self):
+        fbo = self.ctx.simple_framebuffer((8, 8))
+
+        with self.assertRaises(moderngl.Error):
+            fbo.read_scaled((2, 2), dtype='u1')
+
+        with self.assertRaises(moderngl.Error):
+            fbo.read_scaled((2, 2), attachment=1)
+
+        with self.assertRaises(ValueError):
+            fbo.read_scaled((2, 2), filter='cubic')
+
+
+if __name__ == '__main__':
+    unittest.main()
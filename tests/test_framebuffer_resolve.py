@@ -0,0 +1,141 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.5, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                layout (location = 0) out vec4 color0;
+                layout (location = 1) out vec4 color1;
+                void main() {
+                    color0 = vec4(1.0);
+                    color1 = vec4(1.0);
+                }
+            ''',
+        )
+        vbo = cls.ctx.buffer(struct.pack('6f', -1.0, -1.0, 3.0, -1.0, -1.0, 3.0))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, vbo, 'in_vert')
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def tearDown(self):
+        get_context()
+
+    def test_resolve_region(self):
+        src = self.ctx.framebuffer(
+            [self.ctx.renderbuffer((4, 4), samples=4), self.ctx.renderbuffer((4, 4), samples=4)],
+        )
+        dst = self.ctx.simple_framebuffer((4, 4))
+
+        src.clear(1.0, 1.0, 1.0, 1.0)
+        src.resolve(dst, 1, (2, 2, 2, 2))
+
+        row = bytes(6) + b'\xff' * 6
+        self.assertEqual(dst.read(), bytes(24) + row * 2)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_resolve_depth(self):
+        src = self.ctx.framebuffer(
+            self.ctx.renderbuffer((4, 4), samples=4),
+            self.ctx.depth_renderbuffer((4, 4), samples=4),
+        )
+        dst = self.ctx.framebuffer(
+            self.ctx.renderbuffer((4, 4)),
+            self.ctx.depth_renderbuffer((4, 4)),
+        )
+
+        src.clear(depth=0.25)
+        src.resolve(dst, -1)
+
+        depth = struct.unpack('16f', dst.read(attachment=-1, dtype='f4'))
+        for value in depth:
+            self.assertAlmostEqual(value, 0.25, places=3)
+
+        with self.assertRaises(moderngl.Error):
+            src.resolve(dst, -1, filter='linear')
+
+    def test_draw_buffers_restored(self):
+        src = self.ctx.simple_framebuffer((4, 4), samples=4)
+        dst = self.ctx.framebuffer([self.ctx.renderbuffer((4, 4)), self.ctx.renderbuffer((4, 4))])
+
+        dst.use()
+        src.resolve(dst, dst_attachment=1)
+        self.vao.render()
+
+        self.assertEqual(dst.read(attachment=0), b'\xff' * 48)
+        self.assertEqual(dst.read(attachment=1), b'\xff' * 48)
+
+    def test_scissor(self):
+        src = self.ctx.simple_framebuffer((4, 4), samples=4)
+        dst = self.ctx.simple_framebuffer((4, 4))
+        src.clear(1.0, 1.0, 1.0)
+        dst.clear(0.0, 0.0, 0.0)
+
+        previous = self.ctx.fbo
+        src.use()
+        src.scissor = (0, 0, 1, 1)
+
+        # The scissor of the bound framebuffer does not clip the resolve
+        src.resolve(dst)
+        self.assertEqual(dst.read(), b'\xff' * 48)
+
+        # The scissor is still applied after resolving
+        src.clear(0.0, 0.0, 0.0)
+        src.resolve(dst)
+        self.assertEqual(dst.read(), bytes(3) + b'\xff' * 45)
+
+        src.scissor = None
+        previous.use()
+
+    def test_invalid_arguments(self):
+        src = self.ctx.simple_framebuffer((4, 4), samples=4)
+        dst = self.ctx.simple_framebuffer((4, 4))
+
+        with self.assertRaises(moderngl.Error):
+            src.resolve(dst, 1)
+
+        with self.assertRaises(moderngl.Error):
+            src.resolve(dst, dst_attachment=1)
+
+        with self.assertRaises(ValueError):
+            src.resolve(dst, filter='cubic')
+
+        with self.assertRaises(moderngl.Error):
+            src.invalidate((2,))
+
+    def test_invalidate(self):
+        fbo = self.ctx.framebuffer(
+            self.ctx.renderbuffer((4, 4), samples=4),
+            self.ctx.depth_renderbuffer((4, 4), samples=4),
+        )
+        fbo.use()
+        fbo.invalidate()
+        fbo.invalidate((-1,), (0, 0, 2, 2))
+        self.ctx.fbo.invalidate((-1,))
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+        # The framebuffer keeps working after invalidation
+        fbo.clear(1.0, 1.0, 1.0)
+        dst = self.ctx.simple_framebuffer((4, 4))
+        fbo.resolve(dst)
+        self.assertEqual(dst.read(), b'\xff' * 48)
+
+
+if __name__ == '__main__':
+    unittest.main()
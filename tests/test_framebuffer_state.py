@@ -0,0 +1,101 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                out vec4 f_color;
+                void main() {
+                    f_color = vec4(1.0);
+                }
+            ''',
+        )
+        vbo = cls.ctx.buffer(struct.pack('6f', -1.0, -1.0, 3.0, -1.0, -1.0, 3.0))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, vbo, 'in_vert')
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.fbo1 = self.ctx.simple_framebuffer((4, 4))
+        self.fbo2 = self.ctx.simple_framebuffer((4, 4))
+
+    def tearDown(self):
+        self.ctx.reset_state_cache()
+        get_context()
+
+    def test_switching(self):
+        self.fbo1.use()
+        self.fbo2.use()
+        self.fbo1.use()
+        self.fbo1.use()
+        self.vao.render()
+        self.assertEqual(self.fbo1.read(), b'\xff' * 48)
+        self.assertEqual(self.fbo2.read(), bytes(48))
+
+    def test_viewport_of_bound_framebuffer(self):
+        self.fbo1.use()
+        self.fbo1.viewport = (0, 0, 2, 4)
+        self.fbo2.use()
+        self.fbo1.use()
+        self.vao.render()
+        self.assertEqual(self.fbo1.read(), (b'\xff' * 6 + bytes(6)) * 4)
+
+        self.fbo1.viewport = (0, 0, 4, 4)
+        self.vao.render()
+        self.assertEqual(self.fbo1.read(), b'\xff' * 48)
+
+    def test_masks_survive_clearing_another_framebuffer(self):
+        self.fbo1.use()
+        self.fbo1.color_mask = (False, True, True, True)
+        self.fbo2.clear(1.0, 1.0, 1.0)
+        self.vao.render()
+        self.assertEqual(self.fbo1.read(), b'\x00\xff\xff' * 16)
+        self.assertEqual(self.fbo2.read(), b'\xff' * 48)
+
+    def test_scissor_survives_clearing_with_viewport(self):
+        self.fbo1.use()
+        self.fbo1.scissor = (0, 0, 1, 1)
+        self.fbo1.clear(0.0, 0.0, 0.0, viewport=(4, 4))
+        self.vao.render()
+        self.assertEqual(self.fbo1.read(), b'\xff' * 3 + bytes(45))
+
+        self.fbo1.scissor = None
+        self.vao.render()
+        self.assertEqual(self.fbo1.read(), b'\xff' * 48)
+
+    def test_scope(self):
+        self.fbo1.use()
+        with self.ctx.scope(self.fbo2):
+            self.vao.render()
+        self.assertIs(self.ctx.fbo.mglo, self.fbo1.mglo)
+        self.vao.render()
+        self.assertEqual(self.fbo1.read(), b'\xff' * 48)
+        self.assertEqual(self.fbo2.read(), b'\xff' * 48)
+
+    def test_fbo_setter(self):
+        self.fbo1.use()
+        self.ctx.fbo = self.fbo2
+        self.fbo1.read()
+        self.fbo1.use()
+        self.vao.render()
+        self.assertEqual(self.fbo1.read(), b'\xff' * 48)
+        self.assertEqual(self.fbo2.read(), bytes(48))
+
+
+if __name__ == '__main__':
+    unittest.main()
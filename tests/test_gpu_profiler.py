@@ -0,0 +1,78 @@
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.fbo = self.ctx.simple_framebuffer((64, 64))
+        self.fbo.use()
+
+    def test_sections(self):
+        profiler = self.ctx.gpu_profiler()
+
+        for _ in range(5):
+            with profiler.section('frame'):
+                with profiler.section('shadow'):
+                    self.fbo.clear(1.0, 0.0, 0.0)
+                with profiler.section('lighting'):
+                    self.fbo.clear(0.0, 1.0, 0.0)
+            profiler.resolve()
+
+        profiler.resolve(wait=True)
+        self.assertEqual(profiler.pending, 0)
+
+        results = profiler.results()
+        self.assertEqual(set(results), {'frame'})
+        self.assertEqual(set(results['frame']['children']), {'shadow', 'lighting'})
+
+        frame = results['frame']
+        shadow = frame['children']['shadow']
+        self.assertEqual(frame['count'], 5)
+        self.assertEqual(shadow['count'], 5)
+        self.assertEqual(shadow['children'], {})
+        self.assertLessEqual(shadow['min'], shadow['mean'])
+        self.assertLessEqual(shadow['mean'], shadow['p99'])
+        self.assertGreaterEqual(frame['p99'], shadow['min'])
+        profiler.release()
+
+    def test_history(self):
+        profiler = self.ctx.gpu_profiler(history=3)
+
+        for _ in range(10):
+            with profiler.section('pass'):
+                self.fbo.clear()
+
+        profiler.resolve(wait=True)
+        self.assertEqual(profiler.results()['pass']['count'], 3)
+
+        profiler.reset()
+        self.assertEqual(profiler.results(), {})
+        profiler.release()
+
+    def test_query_pool(self):
+        profiler = self.ctx.gpu_profiler()
+
+        for _ in range(100):
+            with profiler.section('pass'):
+                pass
+            profiler.resolve(wait=True)
+
+        # The queries of the collected sections are reused
+        self.assertLessEqual(len(profiler._queries), 32)
+        profiler.release()
+
+    def test_invalid_history(self):
+        with self.assertRaises(ValueError):
+            self.ctx.gpu_profiler(history=0)
+
+
+if __name__ == '__main__':
+    unittest.main()
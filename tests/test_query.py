@@ -0,0 +1,141 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                out vec4 color;
+                void main() {
+                    color = vec4(1.0);
+                }
+            ''',
+        )
+        vbo = cls.ctx.buffer(struct.pack('12f', -1.0, -1.0, 1.0, -1.0, -1.0, 1.0, 1.0, -1.0, 1.0, 1.0, -1.0, 1.0))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, vbo, 'in_vert')
+        cls.fbo = cls.ctx.simple_framebuffer((16, 16))
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.fbo.use()
+
+    def test_try_result(self):
+        query = self.ctx.query(samples=True, primitives=True)
+
+        with query:
+            self.vao.render()
+
+        self.ctx.finish()
+        self.assertTrue(query.available)
+
+        result = query.try_result()
+        self.assertEqual(set(result), {'samples', 'primitives'})
+        self.assertEqual(result['primitives'], 2)
+        self.assertEqual(result['samples'], query.samples)
+        self.assertGreater(result['samples'], 0)
+        query.release()
+
+    def test_any_samples(self):
+        query = self.ctx.query(any_samples=True)
+
+        with query:
+            self.vao.render()
+
+        self.ctx.finish()
+        self.assertEqual(query.try_result(), {'any_samples': True})
+        query.release()
+
+    def test_elapsed(self):
+        query = self.ctx.query(time=True)
+
+        with query:
+            self.vao.render()
+
+        self.assertGreaterEqual(query.elapsed, 0)
+        self.assertGreaterEqual(query.try_result()['elapsed'], 0)
+        query.release()
+
+    def test_ring(self):
+        ring = self.ctx.query_ring(3, primitives=True)
+        results = []
+
+        for frame in range(10):
+            with ring:
+                self.vao.render(vertices=3 * (frame % 2 + 1))
+            results.extend(ring.poll())
+            self.assertLessEqual(ring.pending, ring.size)
+
+        self.ctx.finish()
+        results.extend(ring.poll())
+
+        self.assertEqual(ring.pending, 0)
+        self.assertEqual([r['frame'] for r in results], list(range(10)))
+        self.assertEqual([r['primitives'] for r in results], [frame % 2 + 1 for frame in range(10)])
+        self.assertEqual(ring.latest['frame'], 9)
+        ring.release()
+
+    def test_ring_stalls(self):
+        ring = self.ctx.query_ring(1, samples=True)
+
+        for _ in range(3):
+            with ring:
+                self.vao.render()
+
+        self.ctx.finish()
+        results = ring.poll()
+        self.assertEqual([r['frame'] for r in results], [0, 1, 2])
+        self.assertLessEqual(ring.stalls, 2)
+        ring.release()
+
+    def test_statistics(self):
+        try:
+            query = self.ctx.query(statistics=True)
+        except moderngl.Error:
+            self.skipTest('pipeline statistics are not supported')
+
+        with query:
+            self.vao.render()
+
+        stats = query.statistics
+        self.assertEqual(stats['vertices_submitted'], 6)
+        self.assertEqual(stats['primitives_submitted'], 2)
+        self.assertGreaterEqual(stats['vertex_shader_invocations'], 4)
+        # Drivers may count the helper invocations along the shared edge
+        self.assertGreaterEqual(stats['fragment_shader_invocations'], 16 * 16)
+        self.assertEqual(stats['compute_shader_invocations'], 0)
+        self.assertEqual(set(query.try_result()), set(stats))
+        query.release()
+
+    def test_no_statistics(self):
+        query = self.ctx.query(time=True)
+
+        with query:
+            self.vao.render()
+
+        with self.assertRaises(ValueError):
+            query.statistics
+
+        query.release()
+
+    def test_invalid_size(self):
+        with self.assertRaises(ValueError):
+            self.ctx.query_ring(0)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,149 @@
+import struct
+import sys
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_memory_usage(self):
+        before = self.ctx.memory_usage
+
+        tex = self.ctx.texture((16, 16), 4, dtype='f2')
+        rbo = self.ctx.renderbuffer((8, 8), 2, samples=0)
+        buf = self.ctx.buffer(reserve=1024)
+
+        usage = self.ctx.memory_usage
+        self.assertEqual(usage['textures'] - before['textures'], 16 * 16 * 4 * 2)
+        self.assertEqual(usage['renderbuffers'] - before['renderbuffers'], 8 * 8 * 2)
+        self.assertEqual(usage['buffers'] - before['buffers'], 1024)
+        self.assertEqual(usage['total'], usage['textures'] + usage['renderbuffers'] + usage['buffers'])
+
+        tex.build_mipmaps()
+        mipmapped = 4 * 2 * (16 * 16 + 8 * 8 + 4 * 4 + 2 * 2 + 1)
+        self.assertEqual(self.ctx.memory_usage['textures'] - before['textures'], mipmapped)
+
+        buf.orphan(4096)
+        self.assertEqual(self.ctx.memory_usage['buffers'] - before['buffers'], 4096)
+
+        tex.release()
+        rbo.release()
+        buf.release()
+        self.assertEqual(self.ctx.memory_usage, before)
+
+    def test_evict_and_restore(self):
+        data = struct.pack('64B', *range(64))
+        tex = self.ctx.texture((4, 4), 4, data)
+        before = self.ctx.memory_usage['textures']
+
+        residency = self.ctx.residency_manager(0)
+        residency.track(tex)
+        self.assertEqual(residency.next_frame(), 1)
+        self.assertFalse(tex.resident)
+        self.assertEqual(self.ctx.memory_usage['textures'], before - 64)
+
+        tex.use(0)
+        self.assertTrue(tex.resident)
+        self.assertEqual(tex.read(), data)
+        self.assertEqual(self.ctx.memory_usage['textures'], before)
+
+        # used in the current frame
+        self.assertEqual(residency.enforce(), 0)
+        self.assertEqual(residency.evictions, 1)
+        tex.release()
+
+    def test_evict_keeps_mipmaps(self):
+        tex = self.ctx.texture((4, 4), 4, b'\x10' * 64)
+        tex.build_mipmaps()
+        tex.write(b'\xee' * 16, level=1)
+
+        residency = self.ctx.residency_manager(0)
+        residency.track(tex)
+        residency.next_frame()
+        self.assertFalse(tex.resident)
+
+        # The levels written after building the mipmaps are not generated again
+        self.assertEqual(tex.read(level=1), b'\xee' * 16)
+        self.assertEqual(tex.read(level=2), b'\x10' * 4)
+        self.assertEqual(tex.read(), b'\x10' * 64)
+        tex.release()
+
+    def test_lru_order(self):
+        textures = [self.ctx.texture((4, 4), 4) for i in range(3)]
+        residency = self.ctx.residency_manager(self.ctx.memory_usage['total'])
+
+        for tex in textures:
+            residency.track(tex)
+
+        residency.next_frame()
+        textures[0].use(0)
+        textures[2].use(0)
+        residency.next_frame()
+        textures[2].use(0)
+
+        residency.budget -= 64
+        self.assertEqual(residency.enforce(), 1)
+
+        self.assertEqual([tex.resident for tex in textures], [True, False, True])
+
+        for tex in textures:
+            tex.release()
+
+    def test_eviction_callback(self):
+        evicted = []
+        tex = self.ctx.texture((4, 4), 4)
+        residency = self.ctx.residency_manager(0, on_evict=evicted.append)
+        residency.track(tex)
+        residency.next_frame()
+        self.assertEqual(evicted, [tex])
+        self.assertTrue(tex.resident)
+        self.assertEqual(residency.resident_bytes, 0)
+        tex.release()
+
+    def test_render_targets(self):
+        tex = self.ctx.texture((4, 4), 4)
+        fbo = self.ctx.framebuffer(tex)
+        residency = self.ctx.residency_manager(0)
+
+        with self.assertRaises(ValueError):
+            residency.track(tex)
+
+        # Attached after tracking, rendering to it must keep working
+        other = self.ctx.texture((4, 4), 4)
+        residency.track(other)
+        target = self.ctx.framebuffer(other)
+        self.assertEqual(residency.next_frame(), 0)
+        self.assertTrue(other.resident)
+
+        target.clear(1.0, 1.0, 1.0, 1.0)
+        self.assertEqual(other.read(), b'\xff' * 64)
+
+        # Released framebuffers detach their textures
+        target.release()
+        self.assertEqual(residency.next_frame(), 1)
+        self.assertFalse(other.resident)
+
+        fbo.release()
+        residency.track(tex)
+        tex.release()
+        other.release()
+
+    def test_scope_releases_textures(self):
+        tex = self.ctx.texture((4, 4), 4)
+        refcount = sys.getrefcount(tex.mglo)
+
+        scope = self.ctx.scope(self.ctx.fbo, textures=[(tex, 0)])
+        self.assertGreater(sys.getrefcount(tex.mglo), refcount)
+
+        del scope
+        self.assertEqual(sys.getrefcount(tex.mglo), refcount)
+        tex.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,119 @@
+import struct
+import unittest
+from array import array
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_write_bricks(self):
+        texture = self.ctx.texture3d((4, 4, 4), 1, bytes(64))
+        bricks = bytes([1] * 8) + bytes([2] * 8)
+        texture.write_bricks(bricks, [(0, 0, 0), (2, 2, 2)], (2, 2, 2))
+
+        data = texture.read()
+        for z in range(4):
+            for y in range(4):
+                for x in range(4):
+                    expected = 1 if max(x, y, z) < 2 else (2 if min(x, y, z) >= 2 else 0)
+                    self.assertEqual(data[(z * 4 + y) * 4 + x], expected)
+
+    def test_write_bricks_clipped(self):
+        texture = self.ctx.texture3d((3, 3, 3), 1, bytes(27))
+        brick = bytes(range(8))
+        texture.write_bricks(brick, array('i', [2, 2, 2]), (2, 2, 2))
+        self.assertEqual(texture.read()[26], 0)
+
+        texture.write_bricks(brick, array('i', [1, 1, 1]), (2, 2, 2))
+        data = texture.read()
+        self.assertEqual(data[(1 * 3 + 1) * 3 + 1], 0)
+        self.assertEqual(data[(2 * 3 + 2) * 3 + 2], 7)
+
+    def test_write_bricks_buffer(self):
+        texture = self.ctx.texture3d((2, 2, 2), 4, dtype='f4')
+        data = struct.pack('32f', *range(32))
+        texture.write_bricks(self.ctx.buffer(data), [(0, 0, 0)], (2, 2, 2))
+        self.assertEqual(texture.read(), data)
+
+    def test_write_bricks_volume(self):
+        texture = self.ctx.texture3d((5, 3, 3), 2, bytes(90))
+        host = bytes(range(90))
+        texture.write_bricks(host, [(4, 2, 0), (0, 0, 2)], (2, 2, 2), volume=True)
+
+        data = texture.read()
+        for z in range(3):
+            for y in range(3):
+                for x in range(5):
+                    index = ((z * 3 + y) * 5 + x) * 2
+                    dirty = (x == 4 and y == 2 and z < 2) or (x < 2 and y < 2 and z == 2)
+                    self.assertEqual(data[index:index + 2], host[index:index + 2] if dirty else bytes(2))
+
+        texture.write_bricks(self.ctx.buffer(host[::-1]), [(2, 0, 0)], (2, 2, 2), volume=True)
+        self.assertEqual(texture.read()[4:6], host[::-1][4:6])
+
+        with self.assertRaisesRegex(moderngl.Error, 'size mismatch'):
+            texture.write_bricks(host[:-1], [(0, 0, 0)], (2, 2, 2), volume=True)
+
+    def test_write_bricks_invalid(self):
+        texture = self.ctx.texture3d((4, 4, 4), 1)
+
+        with self.assertRaisesRegex(moderngl.Error, 'outside'):
+            texture.write_bricks(bytes(8), [(4, 0, 0)], (2, 2, 2))
+
+        with self.assertRaisesRegex(moderngl.Error, 'size mismatch'):
+            texture.write_bricks(bytes(7), [(0, 0, 0)], (2, 2, 2))
+
+        with self.assertRaises(moderngl.Error):
+            texture.write_bricks(bytes(8), array('d', [0, 0, 0]), (2, 2, 2))
+
+        for size in ((0, 2, 2), (-2, 2, 2), (2, -1, 2), (2, 2, -2)):
+            with self.assertRaisesRegex(moderngl.Error, 'brick size'):
+                texture.write_bricks(bytes(8), [(0, 0, 0)], size)
+
+            with self.assertRaisesRegex(moderngl.Error, 'brick size'):
+                texture.write_bricks(bytes(64), [(0, 0, 0)], size, volume=True)
+
+    def test_brick_map(self):
+        texture = self.ctx.texture3d((8, 8, 8), 1, bytes(512))
+        bricks = texture.brick_map((4, 4, 4))
+        self.assertEqual(bricks.grid, (2, 2, 2))
+
+        bricks.mark((3, 0, 0, 2, 1, 1))
+        self.assertEqual(bricks.dirty, 2)
+        self.assertEqual(list(bricks.origins(clear=False)), [0, 0, 0, 4, 0, 0])
+
+        bricks.mark((5, 5, 5, 1, 1, 1))
+        self.assertEqual(bricks.dirty, 3)
+
+        host = bytearray(range(256)) * 2
+        self.assertEqual(bricks.flush(host), 3)
+        self.assertEqual(bricks.dirty, 0)
+        self.assertEqual(bricks.flush(host), 0)
+
+        result = texture.read()
+        for z in range(8):
+            for y in range(8):
+                for x in range(8):
+                    index = (z * 8 + y) * 8 + x
+                    dirty = (z < 4 and y < 4) or min(x, y, z) >= 4
+                    self.assertEqual(result[index], host[index] if dirty else 0)
+
+    def test_brick_map_partial_bricks(self):
+        texture = self.ctx.texture3d((5, 3, 2), 2, bytes(60))
+        bricks = texture.brick_map((4, 4, 4))
+        self.assertEqual(bricks.grid, (2, 1, 1))
+
+        bricks.mark()
+        host = bytes(range(60))
+        self.assertEqual(bricks.flush(host), 2)
+        self.assertEqual(texture.read(), host)
+
+
+if __name__ == '__main__':
+    unittest.main()
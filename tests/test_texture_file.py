@@ -0,0 +1,214 @@
+import os
+import struct
+import tempfile
+import unittest
+
+import moderngl
+from common import get_context
+
+KTX2_IDENTIFIER = b'\xabKTX 20\xbb\r\n\x1a\n'
+
+
+def dds(width, height, pixel_format, images, mipmaps=1, caps2=0, depth=0, dx10=None):
+    flags = 0x1007 | (0x20000 if mipmaps > 1 else 0) | (0x800000 if depth else 0)
+    header = struct.pack('<4s7I44x', b'DDS ', 124, flags, height, width, 0, depth, mipmaps)
+    header += pixel_format
+    header += struct.pack('<5I', 0x1000, caps2, 0, 0, 0)
+    if dx10 is not None:
+        header += struct.pack('<5I', *dx10)
+    return header + b''.join(images)
+
+
+def fourcc(code):
+    return struct.pack('<2I4s5I', 32, 0x4, code, 0, 0, 0, 0, 0)
+
+
+def rgba8():
+    return struct.pack('<8I', 32, 0x41, 0, 32, 0xff, 0xff00, 0xff0000, 0xff000000)
+
+
+def ktx2(vk_format, width, height, levels, depth=0, layers=0, faces=1):
+    header = KTX2_IDENTIFIER + struct.pack('<9I', vk_format, 1, width, height, depth, layers, faces, len(levels), 0)
+    header += struct.pack('<4I2Q', 0, 0, 0, 0, 0, 0)
+    offset = len(header) + 24 * len(levels)
+    index = b''
+    for data in levels:
+        index += struct.pack('<3Q', offset, len(data), len(data))
+        offset += len(data)
+    return header + index + b''.join(levels)
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.tmpdir = tempfile.TemporaryDirectory()
+
+    def tearDown(self):
+        self.tmpdir.cleanup()
+
+    def load(self, name, content):
+        path = os.path.join(self.tmpdir.name, name)
+        with open(path, 'wb') as f:
+            f.write(content)
+        return self.ctx.load_texture(path)
+
+    def sample(self, tex, level=0):
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                void main() {
+                    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                uniform sampler2D tex;
+                uniform int level;
+                out vec4 f_color;
+
+                void main() {
+                    f_color = texelFetch(tex, ivec2(0, 0), level);
+                }
+            ''',
+        )
+        prog['level'] = level
+        fbo = self.ctx.simple_framebuffer((1, 1))
+        vao = self.ctx.vertex_array(prog, [])
+        with self.ctx.scope(fbo):
+            tex.use(0)
+            vao.render(moderngl.POINTS, vertices=1)
+        data = fbo.read(components=4)
+        vao.release()
+        fbo.release()
+        prog.release()
+        return data
+
+    def test_dds_rgba8_mipmaps(self):
+        level0 = bytes(range(4 * 4 * 4))
+        level1 = bytes(range(100, 116))
+        level2 = bytes([1, 2, 3, 4])
+        tex = self.load('a.dds', dds(4, 4, rgba8(), [level0, level1, level2], mipmaps=3))
+
+        self.assertIsInstance(tex, moderngl.Texture)
+        self.assertEqual(tex.size, (4, 4))
+        self.assertEqual(tex.components, 4)
+        self.assertEqual(tex.dtype, 'f1')
+        self.assertEqual(tex.read(), level0)
+        self.assertEqual(tex.read(level=1), level1)
+        self.assertEqual(tex.read(level=2), level2)
+
+    def test_dds_dxt1(self):
+        # a single block with every texel set to color0, pure red in RGB565
+        block = struct.pack('<HHI', 0xf800, 0x0000, 0)
+        tex = self.load('b.dds', dds(4, 4, fourcc(b'DXT1'), [block]))
+        self.assertEqual(tex.read(), b'\xff\x00\x00\xff' * 16)
+
+    def test_dds_cube(self):
+        faces = [bytes([i * 10] * 2 * 2 * 4) for i in range(6)]
+        tex = self.load('c.dds', dds(2, 2, rgba8(), faces, caps2=0xfe00))
+        self.assertIsInstance(tex, moderngl.TextureCube)
+        for face in range(6):
+            self.assertEqual(tex.read(face), faces[face])
+
+    def test_dds_dx10_array(self):
+        layers = [struct.pack('4f', i, i, i, i) for i in range(3)]
+        tex = self.load('d.dds', dds(2, 2, fourcc(b'DX10'), layers, dx10=(41, 3, 0, 3, 0)))
+        self.assertIsInstance(tex, moderngl.TextureArray)
+        self.assertEqual(tex.size, (2, 2, 3))
+        self.assertEqual(tex.dtype, 'f4')
+        self.assertEqual(tex.read(), b''.join(layers))
+
+    def test_ktx2_2d(self):
+        level0 = bytes(range(2 * 2 * 4))
+        level1 = bytes([9, 8, 7, 6])
+        tex = self.load('e.ktx2', ktx2(37, 2, 2, [level0, level1]))
+        self.assertIsInstance(tex, moderngl.Texture)
+        self.assertEqual(tex.read(), level0)
+        self.assertEqual(tex.read(level=1), level1)
+        self.assertEqual(tex.filter, (moderngl.LINEAR_MIPMAP_LINEAR, moderngl.LINEAR))
+
+    def test_ktx2_3d(self):
+        data = bytes(range(2 * 2 * 2))
+        tex = self.load('f.ktx2', ktx2(9, 2, 2, [data], depth=2))
+        self.assertIsInstance(tex, moderngl.Texture3D)
+        self.assertEqual(tex.size, (2, 2, 2))
+        self.assertEqual(tex.read(), data)
+
+    def test_ktx2_array(self):
+        data = bytes(range(2 * 2 * 3 * 2))
+        tex = self.load('g.ktx2', ktx2(16, 2, 2, [data], layers=3))
+        self.assertIsInstance(tex, moderngl.TextureArray)
+        self.assertEqual(tex.read(), data)
+
+    def test_ktx2_srgb_evict(self):
+        tex = self.load('k.ktx2', ktx2(43, 1, 1, [b'\x80\x80\x80\xff']))
+        self.assertEqual(self.sample(tex), b'\x37\x37\x37\xff')
+
+        residency = self.ctx.residency_manager(0)
+        residency.track(tex)
+        residency.next_frame()
+        self.assertFalse(tex.resident)
+
+        # Restored as sRGB on the next use
+        self.assertEqual(self.sample(tex), b'\x37\x37\x37\xff')
+        self.assertTrue(tex.resident)
+        tex.release()
+
+    def test_compressed_evict(self):
+        block = struct.pack('<HHI', 0xf800, 0x0000, 0)
+        tex = self.load('l.dds', dds(4, 4, fourcc(b'DXT1'), [block]))
+        residency = self.ctx.residency_manager(0)
+
+        with self.assertRaises(ValueError):
+            residency.track(tex)
+
+        with self.assertRaisesRegex(moderngl.Error, 'compressed'):
+            tex.mglo.evict()
+
+    def test_ktx2_srgb_cpu_mipmaps(self):
+        tex = self.load('m.ktx2', ktx2(43, 2, 2, [b'\x80\x80\x80\xff' * 4]))
+        tex.build_mipmaps(method='cpu')
+        self.assertEqual(self.sample(tex, level=1), b'\x37\x37\x37\xff')
+        tex.release()
+
+    def test_compressed_cpu_mipmaps(self):
+        blocks = struct.pack('<HHI', 0xf800, 0x0000, 0) * 4
+        tex = self.load('n.dds', dds(8, 8, fourcc(b'DXT1'), [blocks]))
+
+        with self.assertRaisesRegex(moderngl.Error, 'compressed'):
+            tex.build_mipmaps(method='cpu')
+
+    def test_compressed_gpu_mipmaps(self):
+        blocks = struct.pack('<HHI', 0xf800, 0x0000, 0) * 4
+        before = self.ctx.memory_usage['textures']
+        tex = self.load('o.dds', dds(8, 8, fourcc(b'DXT1'), [blocks]))
+        self.assertEqual(self.ctx.memory_usage['textures'] - before, 32)
+
+        # The levels stay compressed, every level is at least one block
+        tex.build_mipmaps()
+        self.assertEqual(self.ctx.memory_usage['textures'] - before, 32 + 8 + 8 + 8)
+
+        tex.release()
+        self.assertEqual(self.ctx.memory_usage['textures'], before)
+
+    def test_invalid_files(self):
+        with self.assertRaises(moderngl.Error):
+            self.load('h.ktx2', b'not a texture')
+
+        with self.assertRaisesRegex(moderngl.Error, 'truncated'):
+            self.load('i.ktx2', ktx2(37, 4, 4, [bytes(8)]))
+
+        with self.assertRaisesRegex(moderngl.Error, 'supercompressed'):
+            content = bytearray(ktx2(37, 1, 1, [bytes(4)]))
+            content[44:48] = struct.pack('<I', 1)
+            self.load('j.ktx2', bytes(content))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,104 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+from common import get_context
+
+
+def box(array):
+    return (array[0::2, 0::2] + array[1::2, 0::2] + array[0::2, 1::2] + array[1::2, 1::2]) / 4.0
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_cpu_box_f1(self):
+        pixels = np.random.randint(0, 256, (8, 8, 4)).astype('u1')
+        texture = self.ctx.texture((8, 8), 4, pixels.tobytes())
+        texture.build_mipmaps(method='cpu')
+
+        expected = pixels.astype('f4')
+        for level in range(1, 4):
+            expected = box(expected)
+            result = np.frombuffer(texture.read(level=level), 'u1').reshape(expected.shape)
+            self.assertLessEqual(np.abs(result - expected).max(), 1.0)
+            expected = result.astype('f4')
+
+        self.assertEqual(texture.filter, (moderngl.LINEAR_MIPMAP_LINEAR, moderngl.LINEAR))
+
+    def test_cpu_box_f4_and_f2(self):
+        pixels = np.random.random_sample((16, 4, 2)).astype('f4')
+
+        texture = self.ctx.texture((4, 16), 2, pixels.tobytes(), dtype='f4')
+        texture.build_mipmaps(method='cpu')
+        result = np.frombuffer(texture.read(level=1), 'f4').reshape(8, 2, 2)
+        np.testing.assert_allclose(result, box(pixels), rtol=1e-5)
+
+        # the chain continues along the longer axis once the shorter one reaches 1
+        result = np.frombuffer(texture.read(level=4), 'f4').reshape(1, 1, 2)
+        np.testing.assert_allclose(result[0, 0], pixels.mean(axis=(0, 1)), rtol=1e-5)
+
+        texture = self.ctx.texture((4, 16), 2, pixels.astype('f2').tobytes(), dtype='f2')
+        texture.build_mipmaps(method='cpu')
+        result = np.frombuffer(texture.read(level=1), 'f2').reshape(8, 2, 2)
+        np.testing.assert_allclose(result, box(pixels.astype('f2').astype('f4')), atol=1e-3)
+
+    def test_cpu_kaiser_constant(self):
+        pixels = np.full((16, 16, 3), 100, 'u1')
+        texture = self.ctx.texture((16, 16), 3, pixels.tobytes())
+        texture.build_mipmaps(method='cpu', filter='kaiser')
+        self.assertEqual(texture.read(level=2), bytes([100]) * 4 * 4 * 3)
+
+    def test_cpu_srgb(self):
+        pixels = np.array([[0, 255], [0, 255]], 'u1')
+        texture = self.ctx.texture((2, 2), 1, pixels.tobytes())
+        texture.build_mipmaps(method='cpu', srgb=True)
+        self.assertEqual(texture.read(level=1), bytes([188]))
+
+    def test_cpu_alpha_coverage(self):
+        pixels = np.random.randint(0, 256, (64, 64, 4)).astype('u1')
+        base_coverage = (pixels[..., 3] > 204).mean()
+
+        texture = self.ctx.texture((64, 64), 4, pixels.tobytes())
+        texture.build_mipmaps(method='cpu')
+        level = np.frombuffer(texture.read(level=2), 'u1').reshape(16, 16, 4)
+        self.assertLess((level[..., 3] > 204).mean(), base_coverage / 2)
+
+        texture.build_mipmaps(method='cpu', alpha_coverage=0.8)
+        level = np.frombuffer(texture.read(level=2), 'u1').reshape(16, 16, 4)
+        self.assertAlmostEqual((level[..., 3] > 204).mean(), base_coverage, delta=0.05)
+
+    def test_cpu_array(self):
+        pixels = np.random.randint(0, 256, (3, 4, 4, 1)).astype('u1')
+        texture = self.ctx.texture_array((4, 4, 3), 1, pixels.tobytes())
+        memory = self.ctx.memory_usage['textures']
+        texture.build_mipmaps(method='cpu', filter='kaiser')
+        self.assertEqual(self.ctx.memory_usage['textures'] - memory, (4 + 1) * 3)
+        self.assertEqual(texture.filter, (moderngl.LINEAR_MIPMAP_LINEAR, moderngl.LINEAR))
+
+    def test_cpu_cube(self):
+        faces = [bytes([i * 40] * 4 * 4 * 4) for i in range(6)]
+        texture = self.ctx.texture_cube((4, 4), 4, b''.join(faces))
+        texture.build_mipmaps(method='cpu')
+        self.assertEqual(texture.filter, (moderngl.LINEAR_MIPMAP_LINEAR, moderngl.LINEAR))
+        texture.build_mipmaps()
+
+    def test_invalid(self):
+        texture = self.ctx.texture((4, 4), 4, dtype='i4')
+
+        with self.assertRaisesRegex(moderngl.Error, 'cpu method'):
+            texture.build_mipmaps(method='cpu')
+
+        with self.assertRaisesRegex(moderngl.Error, 'box filter'):
+            texture.build_mipmaps(filter='kaiser')
+
+        with self.assertRaisesRegex(moderngl.Error, 'invalid method'):
+            texture.build_mipmaps(method='shader')
+
+
+if __name__ == '__main__':
+    unittest.main()
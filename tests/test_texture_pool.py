@@ -0,0 +1,93 @@
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.pool = self.ctx.texture_pool
+        self.pool.budget = 256 * 1024 * 1024
+        self.pool.clear()
+
+    def test_recycle(self):
+        tex1 = self.pool.acquire((16, 16), 4)
+        self.assertEqual(self.pool.misses, 1)
+        self.pool.release(tex1)
+        self.assertEqual(self.pool.bytes_held, 16 * 16 * 4)
+
+        tex2 = self.pool.acquire((16, 16), 4)
+        self.assertEqual(tex1, tex2)
+        self.assertEqual(self.pool.hits, 1)
+        self.assertEqual(self.pool.bytes_held, 0)
+        self.assertAlmostEqual(self.pool.hit_rate, 0.5)
+        self.pool.release(tex2)
+
+    def test_key_mismatch(self):
+        tex1 = self.pool.acquire((16, 16), 4, dtype='f2')
+        self.pool.release(tex1)
+
+        tex2 = self.pool.acquire((16, 16), 4, dtype='f1')
+        self.assertNotEqual(tex1, tex2)
+        self.assertEqual(tex2.dtype, 'f1')
+
+        rbo = self.pool.acquire((16, 16), 4, dtype='f2', renderbuffer=True)
+        self.assertNotEqual(tex1, rbo)
+        self.assertEqual(self.pool.hits, 0)
+        self.assertEqual(self.pool.bytes_held, 16 * 16 * 4 * 2)
+
+    def test_lru_eviction(self):
+        self.pool.budget = 2 * 8 * 8 * 4
+        textures = [self.pool.acquire((8, 8), 4) for i in range(3)]
+
+        for tex in textures:
+            self.pool.release(tex)
+
+        self.assertEqual(self.pool.bytes_held, 2 * 8 * 8 * 4)
+        self.assertEqual(self.pool.acquire((8, 8), 4), textures[2])
+        self.assertEqual(self.pool.acquire((8, 8), 4), textures[1])
+        self.assertEqual(self.pool.bytes_held, 0)
+
+        self.pool.release(textures[1])
+        self.pool.budget = 0
+        self.assertEqual(self.pool.bytes_held, 0)
+
+    def test_depth(self):
+        tex1 = self.pool.acquire((16, 16), depth=True)
+        self.assertTrue(tex1.depth)
+        self.pool.release(tex1)
+        self.assertEqual(self.pool.bytes_held, 16 * 16 * 4)
+
+        self.assertEqual(self.pool.acquire((16, 16), depth=True), tex1)
+        self.assertNotEqual(self.pool.acquire((16, 16), 1, dtype='f4'), tex1)
+
+        rbo = self.pool.acquire((16, 16), depth=True, renderbuffer=True)
+        self.pool.release(rbo)
+        self.assertEqual(self.pool.acquire((16, 16), depth=True, renderbuffer=True), rbo)
+        self.assertEqual(self.pool.hits, 2)
+
+    def test_mipmaps(self):
+        tex = self.pool.acquire((4, 4), 4)
+        tex.build_mipmaps()
+        self.pool.release(tex)
+        self.assertEqual(self.pool.bytes_held, 4 * (4 * 4 + 2 * 2 + 1))
+        self.assertEqual(self.pool.acquire((4, 4), 4), tex)
+        self.assertEqual(self.pool.bytes_held, 0)
+
+    def test_double_release(self):
+        tex = self.pool.acquire((4, 4), 1)
+        self.pool.release(tex)
+
+        with self.assertRaises(ValueError):
+            self.pool.release(tex)
+
+        with self.assertRaises(TypeError):
+            self.pool.release(self.ctx.buffer(reserve=4))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,103 @@
+import os
+import struct
+import tempfile
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+                uniform mat4 tile_matrix;
+                in vec2 in_vert;
+                out vec2 v_vert;
+                void main() {
+                    v_vert = in_vert;
+                    gl_Position = tile_matrix * vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                in vec2 v_vert;
+                out vec4 f_color;
+                void main() {
+                    f_color = vec4(v_vert * 0.5 + 0.5, 1.0, 1.0);
+                }
+            ''',
+        )
+        vbo = cls.ctx.buffer(struct.pack('6f', -1.0, -1.0, 0.5, -1.0, -1.0, 0.75))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, vbo, 'in_vert')
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.ctx.error
+
+    def tearDown(self):
+        get_context()
+
+    def render(self, tile):
+        self.ctx.clear()
+        self.prog['tile_matrix'].value = tile.matrix
+        self.vao.render()
+
+    def reference(self, size):
+        identity = (1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0)
+        fbo = self.ctx.simple_framebuffer(size, 3)
+        fbo.use()
+        fbo.clear()
+        self.prog['tile_matrix'].value = identity
+        self.vao.render()
+        return fbo.read()
+
+    def assertClose(self, data, expected):
+        self.assertEqual(len(data), len(expected))
+        self.assertLessEqual(max(abs(a - b) for a, b in zip(data, expected)), 1)
+
+    def test_tiles(self):
+        tiles = self.ctx.tiled_renderer((37, 23), (16, 8), 3)
+        self.assertEqual(tiles.tile_size, (16, 8))
+        layout = [tile[:4] for tile in tiles.tiles()]
+        self.assertEqual(len(layout), 9)
+        self.assertEqual(layout[0], (0, 0, 16, 8))
+        self.assertEqual(layout[-1], (32, 16, 5, 7))
+        tiles.release()
+
+    def test_buffer_output(self):
+        tiles = self.ctx.tiled_renderer((37, 23), (16, 8), 3)
+        output = bytearray(tiles.nbytes)
+        previous = self.ctx.fbo
+        tiles.render(self.render, output)
+        self.assertIs(self.ctx.fbo, previous)
+        self.assertClose(output, self.reference((37, 23)))
+        tiles.release()
+
+    def test_file_output(self):
+        tiles = self.ctx.tiled_renderer((40, 30), (16, 16), 3, samples=4)
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'poster.raw')
+            tiles.render(self.render, path)
+            with open(path, 'rb') as f:
+                data = f.read()
+        self.assertEqual(len(data), 40 * 30 * 3)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+        tiles.release()
+
+    def test_sink(self):
+        tiles = self.ctx.tiled_renderer((20, 20), (8, 8), 4, dtype='f4')
+        received = []
+        tiles.render(self.render, lambda tile, data: received.append((tile.x, tile.y, len(data))))
+        self.assertEqual(len(received), 9)
+        self.assertEqual(received[0], (0, 0, 8 * 8 * 16))
+        self.assertEqual(received[-1], (16, 16, 4 * 4 * 16))
+        tiles.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
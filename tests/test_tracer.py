@@ -0,0 +1,114 @@
+import json
+import os
+import struct
+import tempfile
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                out vec4 color;
+                void main() {
+                    color = vec4(1.0);
+                }
+            ''',
+        )
+        cls.vbo = cls.ctx.buffer(struct.pack('6f', -1.0, -1.0, 1.0, -1.0, -1.0, 1.0))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'in_vert')
+
+    def setUp(self):
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def test_spans(self):
+        tracer = self.ctx.tracer()
+        render = moderngl.VertexArray.render
+
+        with tracer:
+            self.assertTrue(tracer.running)
+            self.assertIsNot(moderngl.VertexArray.render, render)
+            buf = self.ctx.buffer(reserve=16)
+            buf.write(b'\x00' * 16)
+            self.vao.render()
+            buf.read()
+
+        self.assertFalse(tracer.running)
+        self.assertIs(moderngl.VertexArray.render, render)
+
+        tracer.resolve(wait=True)
+        trace = tracer.chrome_trace()
+        cpu = [e['name'] for e in trace['traceEvents'] if e['ph'] == 'X' and e['tid'] == 1]
+        gpu = [e for e in trace['traceEvents'] if e['ph'] == 'X' and e['tid'] == 2]
+
+        self.assertEqual(cpu, ['Context.buffer', 'Buffer.write', 'VertexArray.render', 'Buffer.read'])
+        self.assertEqual([e['name'] for e in gpu], ['VertexArray.render'])
+        self.assertGreaterEqual(gpu[0]['dur'], 0.0)
+        tracer.release()
+
+    def test_not_running(self):
+        tracer = self.ctx.tracer(gpu=False)
+        self.vao.render()
+        self.assertEqual(tracer.chrome_trace()['traceEvents'][2:], [])
+        tracer.release()
+
+    def test_ring(self):
+        tracer = self.ctx.tracer(4, gpu=False)
+
+        with tracer:
+            for _ in range(10):
+                self.vbo.read()
+
+        events = tracer.chrome_trace()['traceEvents'][2:]
+        self.assertEqual(len(events), 4)
+        self.assertEqual(tracer.dropped, 6)
+
+        tracer.clear()
+        self.assertEqual(tracer.chrome_trace()['traceEvents'][2:], [])
+        tracer.release()
+
+    def test_save(self):
+        tracer = self.ctx.tracer()
+
+        with tracer:
+            self.vao.render()
+
+        tracer.resolve(wait=True)
+
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, 'trace.json')
+            tracer.save(path)
+            with open(path) as f:
+                trace = json.load(f)
+
+        self.assertEqual(len([e for e in trace['traceEvents'] if e['ph'] == 'X']), 2)
+        tracer.release()
+
+    def test_single_tracer(self):
+        first = self.ctx.tracer()
+        second = self.ctx.tracer()
+
+        with first:
+            with self.assertRaises(ValueError):
+                second.start()
+
+        first.release()
+        second.release()
+
+
+if __name__ == '__main__':
+    unittest.main()